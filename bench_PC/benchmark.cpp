@@ -0,0 +1,482 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <vector>
+#include <string>
+#include "FastCRC.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HAVE_RDTSC 1
+#else
+#define HAVE_RDTSC 0
+#endif
+
+// Host benchmark: all models and kernels, sizes, alignments, warm and cold caches
+// g++ -std=gnu++14 -O2 -march=native -DCRC_TUNE=1 -I../src benchmark.cpp ../src/FastCRCsw.cpp ../src/FastCRC_tune.cpp -obenchmark
+// Every kernel of every model needs CRC_TUNE 1 (crc_tune_bind()), without it only the
+// kernels of crc32 (FastCRC32::kernel()) are forced, the other models run with CRC_KERNEL_AUTO.
+//
+// ./benchmark [options]
+//   --models crc32,modbus,...   models (default: all)
+//   --min N --max N             sizes, powers of two from min to max (default 1 .. 1G)
+//   --sizes 16,1500,65536       explicit sizes instead
+//   --align 0-63                buffer offsets from a 64 byte boundary, list or range (default 0)
+//   --cache warm,cold           (default warm,cold)
+//   --time MS                   minimum measuring time per point, warm cache (default 20)
+//   --cold-reps N               calls per point, cold cache (default 16)
+//   --evict-mb N                buffer walked to evict the caches (default 64)
+//   --ref-max N                 largest size for the reference loops, period of the data (default 1M)
+//   --format text|csv|json      (default text)
+//
+// Every model is checked against a bitwise reference (FastCRC::crc_generic). The data repeats
+// every --ref-max bytes, the reference of longer buffers joins the bitwise CRC of one period
+// with crc_combine(). The models of the avr-libc functions in util/crc16.h (used by
+// examples/FastCRC_Benchmark) also run these loops.
+
+FastCRC7 CRC7;
+FastCRC8 CRC8;
+FastCRC16 CRC16;
+FastCRC32 CRC32;
+FastCRC64 CRC64;
+
+typedef uint64_t (*crc_fn)(const uint8_t *data, size_t len);
+
+typedef struct {
+  const char *name;
+  unsigned width;
+  uint64_t poly, init;
+  bool refin, refout;
+  uint64_t xorout;
+  bool bits;              // length in bits
+  crc_fn fn;
+} model_t;
+
+typedef struct {
+  const char *model;
+  const char *kernel;
+  crc_fn fn;
+  unsigned id;            // CRC_MODEL_xxx
+  uint8_t k;              // CRC_KERNEL_xxx, 0xff: not a FastCRC kernel
+} kernel_t;
+
+static const char *const kernel_names[CRC_KERNELS] = {"auto", "table", "clmul", "chorba", "byte", "pshufb"};
+
+#define M(cls, obj, name) static uint64_t f_##name(const uint8_t *d, size_t n) { return obj.name(d, n); }
+#define MB(cls, obj, name) static uint64_t f_##name(const uint8_t *d, size_t n) { return obj.name(d, n * 8); }
+M(FastCRC7, CRC7, crc7)
+M(FastCRC8, CRC8, smbus)
+M(FastCRC8, CRC8, maxim)
+M(FastCRC16, CRC16, ccitt)
+M(FastCRC16, CRC16, mcrf4xx)
+M(FastCRC16, CRC16, kermit)
+M(FastCRC16, CRC16, modbus)
+M(FastCRC16, CRC16, xmodem)
+M(FastCRC16, CRC16, x25)
+MB(FastCRC16, CRC16, can15)
+M(FastCRC32, CRC32, crc32)
+M(FastCRC32, CRC32, cksum)
+M(FastCRC32, CRC32, mpeg2)
+M(FastCRC32, CRC32, bzip2)
+MB(FastCRC32, CRC32, canfd17)
+MB(FastCRC32, CRC32, canfd21)
+M(FastCRC64, CRC64, ecma182)
+M(FastCRC64, CRC64, xz)
+M(FastCRC64, CRC64, goiso)
+M(FastCRC64, CRC64, nvme)
+#undef M
+#undef MB
+
+static const model_t models[] = {
+  {"crc7",    7,  0x09, 0x00, false, false, 0x00, false, f_crc7},
+  {"smbus",   8,  0x07, 0x00, false, false, 0x00, false, f_smbus},
+  {"maxim",   8,  0x31, 0x00, true,  true,  0x00, false, f_maxim},
+  {"ccitt",   16, 0x1021, 0xffff, false, false, 0x0000, false, f_ccitt},
+  {"mcrf4xx", 16, 0x1021, 0xffff, true,  true,  0x0000, false, f_mcrf4xx},
+  {"kermit",  16, 0x1021, 0x0000, true,  true,  0x0000, false, f_kermit},
+  {"modbus",  16, 0x8005, 0xffff, true,  true,  0x0000, false, f_modbus},
+  {"xmodem",  16, 0x1021, 0x0000, false, false, 0x0000, false, f_xmodem},
+  {"x25",     16, 0x1021, 0xffff, true,  true,  0xffff, false, f_x25},
+  {"can15",   15, 0x4599, 0x0000, false, false, 0x0000, true,  f_can15},
+  {"crc32",   32, 0x04c11db7, 0xffffffff, true,  true,  0xffffffff, false, f_crc32},
+  {"cksum",   32, 0x04c11db7, 0x00000000, false, false, 0xffffffff, false, f_cksum},
+  {"mpeg2",   32, 0x04c11db7, 0xffffffff, false, false, 0x00000000, false, f_mpeg2},
+  {"bzip2",   32, 0x04c11db7, 0xffffffff, false, false, 0xffffffff, false, f_bzip2},
+  {"canfd17", 17, 0x1685b, 0, false, false, 0, true, f_canfd17},
+  {"canfd21", 21, 0x102899, 0, false, false, 0, true, f_canfd21},
+  {"ecma182", 64, 0x42f0e1eba9ea3693, 0x0000000000000000, false, false, 0x0000000000000000, false, f_ecma182},
+  {"xz",      64, 0x42f0e1eba9ea3693, 0xffffffffffffffff, true,  true,  0xffffffffffffffff, false, f_xz},
+  {"goiso",   64, 0x000000000000001b, 0xffffffffffffffff, true,  true,  0xffffffffffffffff, false, f_goiso},
+  {"nvme",    64, 0xad93d23594c93659, 0xffffffffffffffff, true,  true,  0xffffffffffffffff, false, f_nvme},
+};
+#define NMODELS (sizeof(models) / sizeof(models[0]))
+static_assert(NMODELS == CRC_MODELS, "models[] in the order of CRC_MODEL_xxx");
+
+// ================= REFERENCES ===================
+
+static const model_t *ref_model;
+
+static uint64_t f_bitwise(const uint8_t *data, size_t len)
+{
+  const model_t *m = ref_model;
+  return FastCRC::crc_generic(m->width, m->poly, m->init, m->refin, m->refout, m->xorout, data, len * 8);
+}
+
+// Per-byte loops of avr-libc, util/crc16.h (C versions from its documentation)
+static uint64_t f_avr_crc16(const uint8_t *data, size_t len)
+{
+  uint16_t crc = 0xffff;
+  for (size_t n = 0; n < len; n++) {
+    crc ^= data[n];
+    for (int i = 0; i < 8; ++i) crc = (crc & 1) ? (crc >> 1) ^ 0xA001 : (crc >> 1);
+  }
+  return crc;
+}
+
+static uint64_t f_avr_xmodem(const uint8_t *data, size_t len)
+{
+  uint16_t crc = 0;
+  for (size_t n = 0; n < len; n++) {
+    crc = crc ^ ((uint16_t)data[n] << 8);
+    for (int i = 0; i < 8; i++) crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : (crc << 1);
+  }
+  return crc;
+}
+
+static uint64_t f_avr_ccitt(const uint8_t *data, size_t len)
+{
+  uint16_t crc = 0xffff;
+  for (size_t n = 0; n < len; n++) {
+    uint8_t d = data[n];
+    d ^= crc & 0xff;
+    d ^= d << 4;
+    crc = ((((uint16_t)d << 8) | (crc >> 8)) ^ (uint8_t)(d >> 4) ^ ((uint16_t)d << 3));
+  }
+  return crc;
+}
+
+static uint64_t f_avr_ibutton(const uint8_t *data, size_t len)
+{
+  uint8_t crc = 0;
+  for (size_t n = 0; n < len; n++) {
+    crc = crc ^ data[n];
+    for (int i = 0; i < 8; i++) crc = (crc & 0x01) ? (crc >> 1) ^ 0x8C : (crc >> 1);
+  }
+  return crc;
+}
+
+// ================= OPTIONS ===================
+
+static std::vector<std::string> opt_models;
+static std::vector<size_t> opt_sizes;
+static std::vector<unsigned> opt_align;
+static bool opt_warm = true, opt_cold = true;
+static double opt_time = 20e6;       // ns
+static unsigned opt_cold_reps = 16;
+static size_t opt_evict = 64 << 20;
+static size_t opt_ref_max = 1 << 20;
+static const char *opt_format = "text";
+
+static size_t parse_size(const char *s)
+{
+  char *end;
+  size_t v = strtoull(s, &end, 0);
+  if (*end == 'k' || *end == 'K') v <<= 10;
+  if (*end == 'm' || *end == 'M') v <<= 20;
+  if (*end == 'g' || *end == 'G') v <<= 30;
+  return v;
+}
+
+static std::vector<std::string> split(const char *s)
+{
+  std::vector<std::string> v;
+  std::string cur;
+  for (; *s; s++) {
+    if (*s == ',') { v.push_back(cur); cur.clear(); }
+    else cur += *s;
+  }
+  if (!cur.empty()) v.push_back(cur);
+  return v;
+}
+
+static void usage()
+{
+  fprintf(stderr, "usage: benchmark [--models a,b] [--min N] [--max N] [--sizes a,b] [--align 0-63]\n"
+          "                 [--cache warm,cold] [--time MS] [--cold-reps N] [--evict-mb N]\n"
+          "                 [--ref-max N] [--format text|csv|json]\n");
+  exit(1);
+}
+
+static void parse_args(int argc, char **argv)
+{
+  size_t smin = 1, smax = (size_t)1 << 30;
+
+  for (int i = 1; i < argc; i++) {
+    const char *a = argv[i];
+    const char *v = i + 1 < argc ? argv[i + 1] : NULL;
+    if (!v) usage();
+    i++;
+    if (!strcmp(a, "--models")) opt_models = split(v);
+    else if (!strcmp(a, "--min")) smin = parse_size(v);
+    else if (!strcmp(a, "--max")) smax = parse_size(v);
+    else if (!strcmp(a, "--sizes")) {
+      std::vector<std::string> l = split(v);
+      for (size_t j = 0; j < l.size(); j++) opt_sizes.push_back(parse_size(l[j].c_str()));
+    }
+    else if (!strcmp(a, "--align")) {
+      std::vector<std::string> l = split(v);
+      for (size_t j = 0; j < l.size(); j++) {
+        unsigned lo, hi;
+        if (sscanf(l[j].c_str(), "%u-%u", &lo, &hi) != 2) hi = lo = atoi(l[j].c_str());
+        for (unsigned k = lo; k <= hi && k < 64; k++) opt_align.push_back(k);
+      }
+    }
+    else if (!strcmp(a, "--cache")) {
+      opt_warm = strstr(v, "warm") != NULL;
+      opt_cold = strstr(v, "cold") != NULL;
+    }
+    else if (!strcmp(a, "--time")) opt_time = atof(v) * 1e6;
+    else if (!strcmp(a, "--cold-reps")) opt_cold_reps = atoi(v);
+    else if (!strcmp(a, "--evict-mb")) opt_evict = parse_size(v) << 20;
+    else if (!strcmp(a, "--ref-max")) opt_ref_max = parse_size(v);
+    else if (!strcmp(a, "--format")) opt_format = v;
+    else usage();
+  }
+  if (opt_sizes.empty())
+    for (size_t s = smin; s && s <= smax; s <<= 1) opt_sizes.push_back(s);
+  if (opt_align.empty()) opt_align.push_back(0);
+}
+
+// ================= MEASURING ===================
+
+static double now_ns()
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static uint64_t cycles()
+{
+#if HAVE_RDTSC
+  return __rdtsc();
+#else
+  return 0;
+#endif
+}
+
+static uint8_t *evict_buf;
+static volatile uint8_t sink;
+
+static void evict(const uint8_t *data, size_t len)
+{
+  uint8_t s = 0;
+  for (size_t i = 0; i < opt_evict; i += 64) {
+    evict_buf[i]++;
+    s += evict_buf[i];
+  }
+  sink = s;
+#if HAVE_RDTSC
+  for (size_t i = 0; i < len; i += 64) _mm_clflush(data + i);
+  if (len) _mm_clflush(data + len - 1);
+  _mm_mfence();
+#else
+  (void)data; (void)len;
+#endif
+}
+
+typedef struct {
+  const char *model, *kernel, *cache;
+  size_t size;
+  unsigned align;
+  uint64_t calls;
+  double ns, cpb;
+  bool ok;
+} result_t;
+
+static std::vector<result_t> results;
+
+// Force kernel k of a model, false if it is not compiled in
+static bool force(const unsigned id, const uint8_t k)
+{
+#if CRC_TUNE
+  if (!crc_tune_bind(id, k)) return false;
+#endif
+  if (id == CRC_MODEL_CRC32) return CRC32.kernel(k);
+  return CRC_TUNE || k == CRC_KERNEL_AUTO;
+}
+
+// @return false if the CRC is wrong
+static bool measure(const kernel_t *k, const uint8_t *data, size_t len, unsigned align, bool cold, uint64_t expect)
+{
+  result_t r;
+  double t = 0;
+  uint64_t c = 0, calls = 0, crc = 0;
+
+  if (k->k != 0xff) force(k->id, k->k);
+
+  if (cold) {
+    for (unsigned i = 0; i < opt_cold_reps; i++) {
+      evict(data, len);
+      double t0 = now_ns();
+      uint64_t c0 = cycles();
+      crc = k->fn(data, len);
+      c += cycles() - c0;
+      t += now_ns() - t0;
+      calls++;
+    }
+  } else {
+    crc = k->fn(data, len); // warm up
+    uint64_t n = 1;
+    while (t < opt_time) {
+      double t0 = now_ns();
+      uint64_t c0 = cycles();
+      for (uint64_t i = 0; i < n; i++) crc = k->fn(data, len);
+      c += cycles() - c0;
+      t += now_ns() - t0;
+      calls += n;
+      if (n < (1 << 20)) n *= 2;
+    }
+  }
+
+  r.model = k->model;
+  r.kernel = k->kernel;
+  r.cache = cold ? "cold" : "warm";
+  r.size = len;
+  r.align = align;
+  r.calls = calls;
+  r.ns = t / calls;
+  r.cpb = HAVE_RDTSC && len ? (double)c / calls / len : 0;
+  r.ok = crc == expect;
+  results.push_back(r);
+
+  if (!strcmp(opt_format, "text")) {
+    printf("%-8s %-8s %-4s %10zu %2u %12.1f %8.3f %7.3f %s\n", r.model, r.kernel, r.cache, r.size, r.align,
+      r.ns, r.ns ? r.size / r.ns : 0, r.cpb, r.ok ? "ok" : "WRONG");
+    fflush(stdout);
+  }
+  return r.ok;
+}
+
+/** Bitwise CRC of data, which repeats every period bytes
+ * @param id CRC_MODEL_xxx of m
+ * @return the expected value of m->fn(data, len)
+ */
+static uint64_t reference(const model_t *m, const unsigned id, const uint8_t *data, const size_t len, const size_t period)
+{
+  ref_model = m;
+  if (len <= period) return f_bitwise(data, len);
+
+  // q periods by doubling, then the rest (the start of a period)
+  const size_t q = len / period, r = len % period;
+  uint64_t crc = 0, part = f_bitwise(data, period);
+  size_t units = m->bits ? period * 8 : period;
+  bool empty = true;
+  for (size_t e = q; e; e >>= 1) {
+    if (e & 1) {
+      crc = empty ? part : crc_combine(id, crc, part, units);
+      empty = false;
+    }
+    if (e > 1) {
+      part = crc_combine(id, part, part, units);
+      units *= 2;
+    }
+  }
+  if (r) crc = crc_combine(id, crc, f_bitwise(data, r), m->bits ? r * 8 : r);
+  return crc;
+}
+
+static bool selected(const char *name)
+{
+  if (opt_models.empty()) return true;
+  for (size_t i = 0; i < opt_models.size(); i++) if (opt_models[i] == name) return true;
+  return false;
+}
+
+int main(int argc, char **argv)
+{
+  parse_args(argc, argv);
+
+  std::vector<kernel_t> kernels;
+  for (size_t i = 0; i < NMODELS; i++) {
+    const model_t *m = &models[i];
+    if (!selected(m->name)) continue;
+    bool forced = false;
+    for (uint8_t k = CRC_KERNEL_TABLE; k < CRC_KERNELS; k++) {
+      if (!crc_kernel_available(i, k) || !force(i, k)) continue;
+      kernel_t t = {m->name, kernel_names[k], m->fn, (unsigned)i, k};
+      kernels.push_back(t);
+      forced = true;
+    }
+    if (!forced) { kernel_t k = {m->name, "auto", m->fn, (unsigned)i, CRC_KERNEL_AUTO}; kernels.push_back(k); }
+    if (!strcmp(m->name, "modbus")) { kernel_t k = {m->name, "avr-libc", f_avr_crc16, (unsigned)i, 0xff}; kernels.push_back(k); }
+    if (!strcmp(m->name, "xmodem")) { kernel_t k = {m->name, "avr-libc", f_avr_xmodem, (unsigned)i, 0xff}; kernels.push_back(k); }
+    if (!strcmp(m->name, "mcrf4xx")) { kernel_t k = {m->name, "avr-libc", f_avr_ccitt, (unsigned)i, 0xff}; kernels.push_back(k); }
+    if (!strcmp(m->name, "maxim")) { kernel_t k = {m->name, "avr-libc", f_avr_ibutton, (unsigned)i, 0xff}; kernels.push_back(k); }
+    kernel_t b = {m->name, "bitwise", f_bitwise, (unsigned)i, 0xff};
+    kernels.push_back(b);
+  }
+
+  size_t maxsize = 0;
+  for (size_t i = 0; i < opt_sizes.size(); i++) if (opt_sizes[i] > maxsize) maxsize = opt_sizes[i];
+
+  uint8_t *buf = NULL;
+  if (posix_memalign((void **)&buf, 4096, maxsize + 128) || (opt_cold && !(evict_buf = (uint8_t *)calloc(opt_evict + 64, 1)))) {
+    fprintf(stderr, "out of memory (%zu bytes)\n", maxsize + 128 + opt_evict);
+    return 1;
+  }
+  const size_t period = opt_ref_max ? opt_ref_max : 1;
+  srand(1);
+  for (size_t i = 0; i < maxsize + 128; i++) buf[i] = i < period ? rand() : buf[i - period];
+
+  if (!strcmp(opt_format, "text")) {
+    printf("CRC_CLMUL=%d CRC_PSHUFB=%d CRC_CHORBA=%d CRC_TINY=%d CRC_BIGTABLES=%d\n",
+      CRC_CLMUL, CRC_PSHUFB, CRC_CHORBA, CRC_TINY, CRC_BIGTABLES);
+    printf("%-8s %-8s %-4s %10s %2s %12s %8s %7s\n", "model", "kernel", "cach", "size", "al", "ns/call", "GB/s", "cyc/B");
+  }
+
+  int wrong = 0;
+  for (size_t s = 0; s < opt_sizes.size(); s++) {
+    const size_t len = opt_sizes[s];
+    for (size_t a = 0; a < opt_align.size(); a++) {
+      const uint8_t *data = buf + 64 + opt_align[a];
+      for (size_t i = 0; i < NMODELS; i++) {
+        const model_t *m = &models[i];
+        if (!selected(m->name)) continue;
+        const uint64_t expect = reference(m, i, data, len, period);	// also sets ref_model for "bitwise"
+        for (size_t k = 0; k < kernels.size(); k++) {
+          if (strcmp(kernels[k].model, m->name)) continue;
+          if (len > opt_ref_max && (kernels[k].fn == f_bitwise || !strcmp(kernels[k].kernel, "avr-libc"))) continue;
+          if (opt_warm) wrong += !measure(&kernels[k], data, len, opt_align[a], false, expect);
+          if (opt_cold) wrong += !measure(&kernels[k], data, len, opt_align[a], true, expect);
+        }
+      }
+    }
+  }
+
+  if (!strcmp(opt_format, "csv")) {
+    printf("model,kernel,cache,size,align,calls,ns_per_call,gb_per_s,cycles_per_byte,ok\n");
+    for (size_t i = 0; i < results.size(); i++) {
+      const result_t *r = &results[i];
+      printf("%s,%s,%s,%zu,%u,%llu,%.3f,%.4f,%.4f,%d\n", r->model, r->kernel, r->cache, r->size, r->align,
+        (unsigned long long)r->calls, r->ns, r->ns ? r->size / r->ns : 0, r->cpb, r->ok);
+    }
+  } else if (!strcmp(opt_format, "json")) {
+    printf("{\n  \"config\": {\"CRC_CLMUL\": %d, \"CRC_PSHUFB\": %d, \"CRC_CHORBA\": %d, \"CRC_TINY\": %d, \"CRC_BIGTABLES\": %d, \"rdtsc\": %s},\n",
+      CRC_CLMUL, CRC_PSHUFB, CRC_CHORBA, CRC_TINY, CRC_BIGTABLES, HAVE_RDTSC ? "true" : "false");
+    printf("  \"results\": [\n");
+    for (size_t i = 0; i < results.size(); i++) {
+      const result_t *r = &results[i];
+      printf("    {\"model\": \"%s\", \"kernel\": \"%s\", \"cache\": \"%s\", \"size\": %zu, \"align\": %u, \"calls\": %llu, "
+        "\"ns_per_call\": %.3f, \"gb_per_s\": %.4f, \"cycles_per_byte\": %.4f, \"ok\": %s}%s\n",
+        r->model, r->kernel, r->cache, r->size, r->align, (unsigned long long)r->calls, r->ns,
+        r->ns ? r->size / r->ns : 0, r->cpb, r->ok ? "true" : "false", i + 1 < results.size() ? "," : "");
+    }
+    printf("  ]\n}\n");
+  }
+
+  free(buf);
+  free(evict_buf);
+  return wrong ? 2 : 0;
+}
@@ -0,0 +1,145 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <vector>
+#include "FastCRC_coro.h"
+
+// Latency of the other tasks of an event loop while it calculates a large CRC32
+// g++ -std=c++20 -O2 -march=native -pthread -I../src coro.cpp ../src/FastCRCsw.cpp ../src/FastCRC_exec.cpp -ocoro
+// coro [MB]
+//
+// A ticker wants to run every millisecond, its lateness is measured while the loop calculates
+// "blocking": one crc_calc() call, "sliced": crc_async(), "offload": crc_async() with an executor
+
+using namespace FastCRC;
+
+static double now()
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Single threaded loop, post() is thread-safe
+struct loop_t {
+  std::mutex m;
+  std::condition_variable cv;
+  std::deque<std::coroutine_handle<>> ready;
+  std::multimap<double, std::coroutine_handle<>> timers;
+
+  static void post(void *ctx, std::coroutine_handle<> h) {
+    loop_t *l = (loop_t *) ctx;
+    std::lock_guard<std::mutex> g(l->m);
+    l->ready.push_back(h);
+    l->cv.notify_one();
+  }
+
+  template <typename T>
+  void run(crc_task<T> &task) {
+    while (!task.done()) {
+      std::unique_lock<std::mutex> g(m);
+      while (ready.empty() && (timers.empty() || timers.begin()->first > now())) {
+        if (timers.empty()) cv.wait(g);
+        else cv.wait_for(g, std::chrono::duration<double>(timers.begin()->first - now()));
+      }
+      std::coroutine_handle<> h;
+      if (!timers.empty() && timers.begin()->first <= now()) {
+        h = timers.begin()->second;
+        timers.erase(timers.begin());
+      }
+      else {
+        h = ready.front();
+        ready.pop_front();
+      }
+      g.unlock();
+      h.resume();
+    }
+  }
+};
+
+struct sleep_t {
+  loop_t *loop;
+  double until;
+  bool await_ready() const noexcept { return false; }
+  void await_suspend(std::coroutine_handle<> h) {
+    std::lock_guard<std::mutex> g(loop->m);
+    loop->timers.emplace(until, h);
+  }
+  void await_resume() const noexcept {}
+};
+
+static crc_task<int> ticker(loop_t *loop, const bool *stop, std::vector<double> *late)
+{
+  double due = now() + 1e-3;
+  while (!*stop) {
+    co_await sleep_t{loop, due};
+    const double t = now();
+    late->push_back(t - due);
+    due = t + 1e-3;
+  }
+  co_return 0;
+}
+
+static crc_task<uint64_t> blocking(loop_t *loop, const uint8_t *data, size_t len)
+{
+  co_await sleep_t{loop, now() + 0.02};
+  co_return crc_calc(CRC_MODEL_CRC32, data, len);
+}
+
+static crc_task<uint64_t> sliced(loop_t *loop, const uint8_t *data, size_t len, crc_loop_t l)
+{
+  co_await sleep_t{loop, now() + 0.02};
+  co_return co_await crc_async(CRC_MODEL_CRC32, data, len, l);
+}
+
+static crc_task<uint64_t> all(loop_t *loop, crc_task<uint64_t> hash, bool *stop)
+{
+  const uint64_t crc = co_await hash;
+  co_await sleep_t{loop, now() + 0.02};
+  *stop = true;
+  co_return crc;
+}
+
+static void bench(const char *name, loop_t *loop, crc_task<uint64_t> hash, size_t len)
+{
+  std::vector<double> late;
+  bool stop = false;
+  crc_task<int> tick = ticker(loop, &stop, &late);
+  tick.start();
+  const double t = now();
+  crc_task<uint64_t> task = all(loop, std::move(hash), &stop);
+  task.start();
+  loop->run(task);
+  loop->run(tick);
+  const double s = now() - t - 0.04;
+
+  std::sort(late.begin(), late.end());
+  printf("%-9s %08X %7.0f MB/s  ticks %5zu  p50 %7.3f ms  p99 %7.3f ms  max %7.3f ms\n", name, (unsigned) task.get(),
+    len / s / 1e6, late.size(), late[late.size() / 2] * 1e3, late[late.size() * 99 / 100] * 1e3, late.back() * 1e3);
+}
+
+int main(int argc, char **argv)
+{
+  const size_t len = (argc > 1 ? strtoull(argv[1], NULL, 10) : 256) << 20;
+  uint8_t *data = (uint8_t *) malloc(len);
+  for (size_t i = 0; i < len; i++) data[i] = i * 7 + 1;
+
+  loop_t loop;
+  crc_exec_t *exec = crc_exec_create(0);
+  crc_loop_t l = {loop_t::post, &loop, 0, NULL, 0};
+  crc_loop_t o = {loop_t::post, &loop, 0, exec, 0};
+
+  printf("%zu MB, slice %u KB, offload %u KB\n", len >> 20, CRC_CORO_SLICE >> 10, CRC_CORO_OFFLOAD >> 10);
+  bench("blocking", &loop, blocking(&loop, data, len), len);
+  bench("sliced", &loop, sliced(&loop, data, len, l), len);
+  bench("offload", &loop, sliced(&loop, data, len, o), len);
+
+  crc_exec_destroy(exec);
+  free(data);
+  return 0;
+}
@@ -0,0 +1,100 @@
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "FastCRC.h"
+
+// Table footprint vs throughput of the table kernels, one table mode per build:
+// g++ -std=gnu++11 -O2 -DCRC_CLMUL=0 -DCRC_PSHUFB=0 -DCRC_NIBBLE=1 -I../src footprint.cpp ../src/FastCRCsw.cpp -ofootprint16
+// g++ -std=gnu++11 -O2 -DCRC_CLMUL=0 -DCRC_PSHUFB=0 -DCRC_BIGTABLES=0 -I../src footprint.cpp ../src/FastCRCsw.cpp -ofootprint256
+// g++ -std=gnu++11 -O2 -DCRC_CLMUL=0 -DCRC_PSHUFB=0 -I../src footprint.cpp ../src/FastCRCsw.cpp -ofootprint1024
+//
+// "warm": the same message again and again, the table stays in L1
+// "evict": EVICT_KB of other data is read between the messages, like a busy
+// service does; the table has to be loaded from L2/L3 again
+
+FastCRC7 CRC7;
+FastCRC8 CRC8;
+FastCRC16 CRC16;
+FastCRC32 CRC32;
+
+#define EVICT_KB 256
+#define RUNS 5
+
+static uint8_t buf[4096];
+static uint8_t evict[EVICT_KB * 1024];
+static volatile uint64_t sink;
+
+static double now()
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void evict_caches()
+{
+  uint64_t s = 0;
+  for (unsigned i = 0; i < sizeof(evict); i += 64) s += evict[i];
+  sink = s;
+}
+
+typedef uint64_t (*crc_fn)(const uint8_t *data, size_t len);
+
+#define M(obj, name) static uint64_t f_##name(const uint8_t *d, size_t n) { return obj.name(d, n); }
+M(CRC7, crc7)
+M(CRC8, smbus)
+M(CRC8, maxim)
+M(CRC16, kermit)
+M(CRC16, modbus)
+M(CRC16, xmodem)
+M(CRC32, crc32)
+M(CRC32, cksum)
+#undef M
+
+// MB/s, best of RUNS. The whole loop is timed, with flush the time of the
+// same number of evict_caches() calls alone is subtracted.
+static double bench(crc_fn fn, size_t len, unsigned loops, bool flush)
+{
+  double best = 0;
+  for (unsigned r = 0; r < RUNS; r++) {
+    double e = 0;
+    if (flush) {
+      const double t0 = now();
+      for (unsigned i = 0; i < loops; i++) evict_caches();
+      e = now() - t0;
+    }
+    const double t0 = now();
+    for (unsigned i = 0; i < loops; i++) {
+      if (flush) evict_caches();
+      sink = fn(buf, len);
+    }
+    const double t = now() - t0 - e;
+    const double mbs = t > 0 ? (double)len * loops / t * 1e3 : 0;
+    if (mbs > best) best = mbs;
+  }
+  return best;
+}
+
+static void model(const char *name, unsigned model, crc_fn fn)
+{
+  printf("%-8s %6u %9.0f %9.0f %9.0f %9.0f\n", name, (unsigned)crc_table_bytes(model),
+    bench(fn, 64, 200000, false), bench(fn, 4096, 4000, false), bench(fn, 64, 200, true), bench(fn, 4096, 200, true));
+}
+
+int main()
+{
+  for (unsigned i = 0; i < sizeof(buf); i++) buf[i] = i * 7 + 1;
+  memset(evict, 1, sizeof(evict));
+
+  printf("tables: %s\n", CRC_NIBBLE ? "16 entries (CRC_NIBBLE)" : CRC_BIGTABLES ? "1024 entries (slice-by-4)" : "256 entries (CRC_BIGTABLES 0)");
+  printf("%-8s %6s %9s %9s %9s %9s\n", "model", "bytes", "warm 64", "warm 4k", "evict 64", "evict 4k");
+  model("crc7", CRC_MODEL_CRC7, f_crc7);
+  model("smbus", CRC_MODEL_SMBUS, f_smbus);
+  model("maxim", CRC_MODEL_MAXIM, f_maxim);
+  model("kermit", CRC_MODEL_KERMIT, f_kermit);
+  model("modbus", CRC_MODEL_MODBUS, f_modbus);
+  model("xmodem", CRC_MODEL_XMODEM, f_xmodem);
+  model("crc32", CRC_MODEL_CRC32, f_crc32);
+  model("cksum", CRC_MODEL_CKSUM, f_cksum);
+  printf("(MB/s)\n");
+}
@@ -0,0 +1,76 @@
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "FastCRC.h"
+
+// Latency of short messages (4..64 bytes), ns per call
+// g++ -std=gnu++11 -O2 -I../src latency.cpp ../src/FastCRCsw.cpp -olatency
+//
+// "dep": every call depends on the result of the previous one (latency)
+// "ind": independent calls (throughput)
+
+FastCRC8 CRC8;
+FastCRC16 CRC16;
+FastCRC32 CRC32;
+FastCRC64 CRC64;
+
+#define LOOPS 1000000
+
+static uint8_t buf[64 + 8];
+static volatile uint64_t sink;
+static volatile uint64_t zero_ = 0;
+
+static double now()
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+#define RUNS 5
+
+// best of RUNS
+#define BENCH(name, call) do { \
+  double t, dep = 1e30, ind = 1e30; \
+  uint64_t crc = 0; \
+  for (unsigned r = 0; r < RUNS; r++) { \
+    t = now(); \
+    for (unsigned i = 0; i < LOOPS; i++) { \
+      p = buf + off + (crc & zero); \
+      crc = call; \
+    } \
+    t = (now() - t) / LOOPS; \
+    if (t < dep) dep = t; \
+    t = now(); \
+    p = buf + off; \
+    for (unsigned i = 0; i < LOOPS; i++) { \
+      crc += call; \
+    } \
+    t = (now() - t) / LOOPS; \
+    if (t < ind) ind = t; \
+  } \
+  sink = crc; \
+  printf("%-8s %3u %3u %7.2f %7.2f\n", name, len, off, dep, ind); \
+} while (0)
+
+int main()
+{
+  static const unsigned lens[] = {4, 7, 8, 12, 16, 20, 24, 31, 32, 48, 64};
+
+  for (unsigned i = 0; i < sizeof(buf); i++) buf[i] = i * 7 + 1;
+
+  printf("%-8s %3s %3s %7s %7s\n", "model", "len", "off", "dep ns", "ind ns");
+  for (unsigned off = 0; off < 2; off++) {
+    for (unsigned l = 0; l < sizeof(lens) / sizeof(lens[0]); l++) {
+      const unsigned len = lens[l];
+      const uint64_t zero = zero_; // dependency on the previous CRC without changing the data
+      const uint8_t *p;
+      BENCH("smbus", CRC8.smbus(p, len));
+      BENCH("modbus", CRC16.modbus(p, len));
+      BENCH("x25", CRC16.x25(p, len));
+      BENCH("crc32", CRC32.crc32(p, len));
+      BENCH("cksum", CRC32.cksum(p, len));
+      BENCH("xz", CRC64.xz(p, len));
+    }
+  }
+}
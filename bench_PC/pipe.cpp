@@ -0,0 +1,152 @@
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+#include "FastCRC_pipe.h"
+
+// Modbus RTU frame verification: one modbus() call per frame against modbus_verify(),
+// and a receive thread feeding a worker through a mutex-protected std::queue against crc_pipe_xxx
+// g++ -std=gnu++11 -O2 -march=native -pthread -I../src pipe.cpp ../src/FastCRCsw.cpp ../src/FastCRC_pipe.cpp -opipe
+// pipe [frame size]
+//
+// Frames per second and the latency from the push to the verified frame at the consumer.
+// The waiting sides yield the CPU (sched_yield), so the numbers make sense on a single core as well.
+
+#define POOL 4096		// different frames
+#define FRAMES 2000000	// per pipeline run
+#define KERNEL_LOOPS 100
+#define RUNS 5
+
+FastCRC16 CRC16;
+
+static double now()
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static uint8_t *pool[POOL];
+static size_t lens[POOL];
+static double *pushed;	// time of every push
+static std::vector<float> latency;
+static volatile size_t sink;
+
+static void report(const char *name, double t, size_t valid)
+{
+  std::sort(latency.begin(), latency.end());
+  printf("%-12s %6.2f Mframes/s  valid %zu  latency p50 %7.1f us  p99 %7.1f us\n", name, FRAMES / t / 1e6, valid,
+    latency[latency.size() / 2] * 1e6, latency[latency.size() * 99 / 100] * 1e6);
+}
+
+// one modbus() call per frame, a mutex and a condition variable
+static void bench_queue()
+{
+  std::mutex m;
+  std::condition_variable cv;
+  std::queue<size_t> q;
+  size_t valid = 0;
+  latency.clear();
+
+  const double t = now();
+  std::thread producer([&] {
+    for (size_t i = 0; i < FRAMES; i++) {
+      pushed[i] = now();
+      std::lock_guard<std::mutex> g(m);
+      q.push(i);
+      cv.notify_one();
+    }
+  });
+  for (size_t done = 0; done < FRAMES; done++) {
+    size_t i;
+    {
+      std::unique_lock<std::mutex> g(m);
+      cv.wait(g, [&] { return !q.empty(); });
+      i = q.front();
+      q.pop();
+    }
+    const uint8_t *f = pool[i % POOL];
+    const size_t len = lens[i % POOL];
+    valid += CRC16.modbus(f, len - 2) == (f[len - 2] | f[len - 1] << 8);
+    latency.push_back(now() - pushed[i]);
+  }
+  producer.join();
+  report("std::queue", now() - t, valid);
+}
+
+// the consumer thread verifies and pops
+static void bench_pipe()
+{
+  crc_pipe_t *p = crc_pipe_create(CRC_MODEL_MODBUS, 1024);
+  crc_frame_t out[CRC_PIPE_BATCH];
+  size_t valid = 0;
+  latency.clear();
+
+  const double t = now();
+  std::thread producer([&] {
+    for (size_t i = 0; i < FRAMES; i++) {
+      crc_frame_t f = {pool[i % POOL], lens[i % POOL], (void *) i, 0};
+      pushed[i] = now();
+      while (!crc_pipe_push(p, &f)) sched_yield();
+    }
+  });
+  for (size_t done = 0; done < FRAMES;) {
+    crc_pipe_verify(p);
+    const size_t n = crc_pipe_pop(p, out, CRC_PIPE_BATCH);
+    if (!n) sched_yield();
+    const double tn = now();
+    for (size_t i = 0; i < n; i++) {
+      valid += out[i].ok;
+      latency.push_back(tn - pushed[(size_t) out[i].user]);
+    }
+    done += n;
+  }
+  producer.join();
+  crc_pipe_destroy(p);
+  report("crc_pipe", now() - t, valid);
+}
+
+int main(int argc, char **argv)
+{
+  const size_t size = argc > 1 ? atoi(argv[1]) : 32;
+  if (size < 4) return 1;
+
+  srand(1);
+  for (size_t i = 0; i < POOL; i++) {
+    lens[i] = size;
+    pool[i] = (uint8_t *) malloc(size);
+    for (size_t j = 0; j < size - 2; j++) pool[i][j] = rand();
+    const uint16_t crc = CRC16.modbus(pool[i], size - 2);
+    pool[i][size - 2] = crc;
+    pool[i][size - 1] = crc >> 8;
+    if (i % 100 == 0) pool[i][0] ^= 1;	// 1% bad frames
+  }
+  pushed = new double[FRAMES];
+  latency.reserve(FRAMES);
+
+  // kernels only, best of RUNS
+  static uint8_t ok[POOL];
+  double one = 1e30, batch = 1e30, t;
+  for (unsigned r = 0; r < RUNS; r++) {
+    t = now();
+    for (unsigned l = 0; l < KERNEL_LOOPS; l++)
+      for (size_t i = 0; i < POOL; i++) sink += CRC16.modbus(pool[i], size - 2) == (pool[i][size - 2] | pool[i][size - 1] << 8);
+    one = std::min(one, now() - t);
+    t = now();
+    for (unsigned l = 0; l < KERNEL_LOOPS; l++)
+      for (size_t i = 0; i < POOL; i += CRC_PIPE_BATCH) sink += CRC16.modbus_verify(pool + i, lens + i, CRC_PIPE_BATCH, ok + i);
+    batch = std::min(batch, now() - t);
+  }
+  printf("%zu byte frames\nmodbus()        %6.2f Mframes/s\nmodbus_verify() %6.2f Mframes/s\n", size,
+    (double) KERNEL_LOOPS * POOL / one / 1e6, (double) KERNEL_LOOPS * POOL / batch / 1e6);
+
+  bench_queue();
+  bench_pipe();
+  return 0;
+}
@@ -0,0 +1,111 @@
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include "FastCRC_udp.h"
+
+// UDP datagrams with a CRC32 trailer over loopback: recv() and crc32() per datagram against crc_udp_recv()
+// g++ -std=gnu++11 -O2 -march=native -I../src udp.cpp ../src/FastCRCsw.cpp ../src/FastCRC_udp.cpp -oudp
+//
+// Every round queues ROUND datagrams in the receive buffer (sendmmsg), then only the time to receive
+// and verify them is measured, so sender and receiver do not compete for a core. 1% of the datagrams are bad.
+
+#define ROUND 1024
+#define SECONDS 0.5		// of receive time per size and method
+
+FastCRC32 CRC32;
+
+static double now()
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static uint8_t dg[ROUND][1500];
+static struct mmsghdr msgs[ROUND];
+static struct iovec iov[ROUND];
+
+static void fill(int tx)
+{
+  for (unsigned i = 0; i < ROUND; i += 64) {
+    if (sendmmsg(tx, msgs + i, 64, 0) != 64) {
+      perror("sendmmsg");
+      exit(1);
+    }
+  }
+}
+
+int main()
+{
+  static const size_t sizes[] = {64, 128, 256, 512, 1024, 1500};
+  int rx = socket(AF_INET, SOCK_DGRAM, 0), tx = socket(AF_INET, SOCK_DGRAM, 0);
+  int rcvbuf = 64 << 20;
+  struct sockaddr_in addr;
+  socklen_t addrlen = sizeof(addr);
+  memset(&addr, 0, sizeof(addr));
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  if (setsockopt(rx, SOL_SOCKET, SO_RCVBUFFORCE, &rcvbuf, sizeof(rcvbuf)))
+    setsockopt(rx, SOL_SOCKET, SO_RCVBUF, &rcvbuf, sizeof(rcvbuf));
+  if (bind(rx, (struct sockaddr *) &addr, sizeof(addr)) || getsockname(rx, (struct sockaddr *) &addr, &addrlen) ||
+      connect(tx, (struct sockaddr *) &addr, sizeof(addr))) {
+    perror("socket");
+    return 1;
+  }
+
+  crc_udp_t *u = crc_udp_create(0, 1500, 0);
+  static uint8_t buf[2048];
+  printf("size  recv()+crc32()  crc_udp_recv()  (Mpps, %u per call)\n", CRC_UDP_BATCH);
+
+  for (unsigned s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+    const size_t size = sizes[s];
+    for (unsigned i = 0; i < ROUND; i++) {
+      for (size_t j = 0; j < size - 4; j++) dg[i][j] = rand();
+      const uint32_t crc = CRC32.crc32(dg[i], size - 4);
+      for (unsigned b = 0; b < 4; b++) dg[i][size - 4 + b] = crc >> (8 * b);
+      if (i % 100 == 0) dg[i][0] ^= 1;
+      iov[i].iov_base = dg[i];
+      iov[i].iov_len = size;
+      msgs[i].msg_hdr.msg_iov = &iov[i];
+      msgs[i].msg_hdr.msg_iovlen = 1;
+    }
+
+    double one = 0, batch = 0;
+    size_t n1 = 0, n2 = 0, valid1 = 0, valid2 = 0;
+    while (one < SECONDS) {
+      fill(tx);
+      const double t = now();
+      for (unsigned i = 0; i < ROUND; i++) {
+        const ssize_t len = recv(rx, buf, sizeof(buf), 0);
+        if (len < 4) continue;
+        const uint32_t crc = buf[len - 4] | buf[len - 3] << 8 | buf[len - 2] << 16 | (uint32_t) buf[len - 1] << 24;
+        valid1 += CRC32.crc32(buf, len - 4) == crc;
+      }
+      one += now() - t;
+      n1 += ROUND;
+    }
+    while (batch < SECONDS) {
+      fill(tx);
+      const double t = now();
+      for (unsigned i = 0; i < ROUND;) {
+        crc_udp_result_t r;
+        if (crc_udp_recv(u, rx, MSG_DONTWAIT, &r)) break;
+        valid2 += r.valid;
+        i += r.received;
+      }
+      batch += now() - t;
+      n2 += ROUND;
+    }
+    printf("%4zu  %14.2f  %14.2f  valid %zu/%zu %zu/%zu\n", size, n1 / one / 1e6, n2 / batch / 1e6, valid1, n1, valid2, n2);
+  }
+
+  crc_udp_destroy(u);
+  close(rx);
+  close(tx);
+  return 0;
+}
@@ -1,11 +1,521 @@
 #include <stdio.h>
 #include "FastCRC.h"
+#include "FastCRC_coro.h"
+#include "FastCRC_udp.h"
+#include "FastCRC_exec.h"
+#include "FastCRC_pipe.h"
+#include "FastCRC_sfv.h"
+#if CRC_EXEC || CRC_PIPE
+#include <stdlib.h>
+#include <stdint.h>
+#include <atomic>
+#include <thread>
+#endif
+#if CRC_FILE
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#endif
+#if __cplusplus >= 202002L
+#include <stdlib.h>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#endif
+#if CRC_UDP
+#include <string.h>
+#include <netinet/in.h>
+#endif
 
-// g++ -std=gnu++11 test.cpp FastCRCsw.cpp -otest.exe
+// g++ -std=gnu++11 -pthread test.cpp FastCRCsw.cpp FastCRC_file.cpp FastCRC_udp.cpp FastCRC_exec.cpp FastCRC_pipe.cpp -otest.exe
+// g++ -std=c++20 -pthread test.cpp FastCRCsw.cpp FastCRC_file.cpp FastCRC_udp.cpp FastCRC_exec.cpp FastCRC_pipe.cpp -otest.exe (with the coroutines)
 
+FastCRC16 CRC16;
 FastCRC32 CRC32;
+FastCRC64 CRC64;
 uint8_t buf[9] = {'1','2','3','4','5','6','7','8','9'};
 
+// One 188 byte packet without adaptation field, the rest of the payload is stuffing
+static void ts_packet(uint8_t *pkt, unsigned pid, bool pusi, unsigned cc, const uint8_t *payload, size_t len)
+{
+  pkt[0] = 0x47;
+  pkt[1] = (pusi ? 0x40 : 0x00) | pid >> 8;
+  pkt[2] = pid & 0xff;
+  pkt[3] = 0x10 | cc;
+  for (size_t i = 0; i < 184; i++) pkt[4 + i] = i < len ? payload[i] : 0xff;
+}
+
+// A section of 403 bytes spans three packets of PID 0x100, the next section starts behind
+// pointer_field in the third one and ends in the fourth, a null packet in between is skipped
+static bool ts_test(void)
+{
+  const size_t lens[2] = {400, 200};	// section_length
+  uint8_t sec[606], pay[184], ts[5 * 188];
+  size_t sections = 0;
+  bool ok;
+
+  uint8_t *s = sec;
+  for (unsigned k = 0; k < 2; k++) {
+    s[0] = 0x02;	// table_id
+    s[1] = 0xb0 | lens[k] >> 8;	// section_syntax_indicator
+    s[2] = lens[k] & 0xff;
+    for (size_t i = 3; i < lens[k] - 1; i++) s[i] = i * 7 + k;
+    uint32_t crc = CRC32.mpeg2(s, lens[k] - 1);
+    for (unsigned i = 0; i < 4; i++) s[lens[k] - 1 + i] = crc >> (24 - 8 * i);	// CRC_32, MSB first
+    s += 3 + lens[k];
+  }
+  pay[0] = 0;	// pointer_field
+  for (size_t i = 0; i < 183; i++) pay[1 + i] = sec[i];
+  ts_packet(ts, 0x100, true, 0, pay, 184);
+  ts_packet(ts + 188, 0x1fff, false, 0, NULL, 0);
+  ts_packet(ts + 2 * 188, 0x100, false, 1, sec + 183, 184);
+  pay[0] = 36;	// the rest of the first section
+  for (size_t i = 0; i < 183; i++) pay[1 + i] = sec[367 + i];
+  ts_packet(ts + 3 * 188, 0x100, true, 2, pay, 184);
+  ts_packet(ts + 4 * 188, 0x100, false, 3, sec + 550, 56);
+
+  ok = CRC32.mpeg2_ts(ts, sizeof(ts), &sections) == 0 && sections == 2;
+  ts[4 * 188 + 14] ^= 0x01;	// in the second section
+  ok = ok && CRC32.mpeg2_ts(ts, sizeof(ts), &sections) == 1 && sections == 2;
+  ts[4 * 188 + 14] ^= 0x01;
+  ts[2 * 188 + 100] ^= 0x80;	// in the first section
+  ok = ok && CRC32.mpeg2_ts(ts, sizeof(ts), &sections) == 1 && sections == 2;
+  return ok;
+}
+
+// POSIX cksum: the CRC of the data and of its length octets, values of the cksum utility
+static bool cksum_length_test(void)
+{
+  static uint8_t data[70000];
+  FastCRC32 c;
+  bool ok;
+
+  c.cksum(NULL, 0);
+  ok = c.cksum_length(0) == 4294967295u;
+  c.cksum(buf, sizeof(buf));
+  ok = ok && c.cksum_length(sizeof(buf)) == 930766865u;
+  for (size_t i = 0; i < sizeof(data); i++) data[i] = i * 7;
+  c.cksum(data, 30000);	// in two parts, as fastcrc-cksum reads
+  c.cksum_upd(data + 30000, sizeof(data) - 30000);
+  ok = ok && c.cksum_length(sizeof(data)) == 3451499348u;
+  for (size_t i = 0; i < 256; i++) data[i] = i;
+  c.cksum(data, 256);
+  ok = ok && c.cksum_length(256) == 1313719201u;
+  return ok;
+}
+
+#if __cplusplus >= 201402L
+// Parameters of CRC_MODEL_xxx for FastCRC::crc_generic(), the CAN models count bits
+static const struct {
+  unsigned width;
+  uint64_t poly, init;
+  bool refin, refout;
+  uint64_t xorout;
+} models[CRC_MODELS] = {
+  { 7, 0x09, 0x00, false, false, 0x00},
+  { 8, 0x07, 0x00, false, false, 0x00},
+  { 8, 0x31, 0x00, true,  true,  0x00},
+  {16, 0x1021, 0xffff, false, false, 0x0000},
+  {16, 0x1021, 0xffff, true,  true,  0x0000},
+  {16, 0x1021, 0x0000, true,  true,  0x0000},
+  {16, 0x8005, 0xffff, true,  true,  0x0000},
+  {16, 0x1021, 0x0000, false, false, 0x0000},
+  {16, 0x1021, 0xffff, true,  true,  0xffff},
+  {15, 0x4599, 0x0000, false, false, 0x0000},
+  {32, 0x04c11db7, 0xffffffff, true,  true,  0xffffffff},
+  {32, 0x04c11db7, 0x00000000, false, false, 0xffffffff},
+  {32, 0x04c11db7, 0xffffffff, false, false, 0x00000000},
+  {32, 0x04c11db7, 0xffffffff, false, false, 0xffffffff},
+  {17, 0x1685b, 0x00000, false, false, 0x00000},
+  {21, 0x102899, 0x000000, false, false, 0x000000},
+  {64, 0x42f0e1eba9ea3693, 0x0000000000000000, false, false, 0x0000000000000000},
+  {64, 0x42f0e1eba9ea3693, 0xffffffffffffffff, true,  true,  0xffffffffffffffff},
+  {64, 0x000000000000001b, 0xffffffffffffffff, true,  true,  0xffffffffffffffff},
+  {64, 0xad93d23594c93659, 0xffffffffffffffff, true,  true,  0xffffffffffffffff},
+};
+
+static uint64_t generic(const unsigned model, const uint8_t *data, const size_t len)
+{
+  const bool bits = model == CRC_MODEL_CAN15 || model == CRC_MODEL_CANFD17 || model == CRC_MODEL_CANFD21;
+  return FastCRC::crc_generic(models[model].width, models[model].poly, models[model].init, models[model].refin,
+    models[model].refout, models[model].xorout, data, bits ? len : len * 8);
+}
+
+// The kernels of this build (CLMUL, PSHUFB, Chorba, tables) against the bitwise CRC: every model,
+// offsets 0..15, all lengths up to 300, around the kernel thresholds (64 .. 4096) and up to 5000 bytes
+static bool kernel_test(void)
+{
+  static uint8_t data[5016];
+  size_t lens[400], n = 0;
+  bool ok = true;
+
+  uint32_t x = 0x9e3779b9;
+  for (size_t i = 0; i < sizeof(data); i++) {
+    x ^= x << 13; x ^= x >> 17; x ^= x << 5;
+    data[i] = x;
+  }
+  for (size_t len = 0; len <= 300; len++) lens[n++] = len;
+  for (size_t t = 512; t <= 4096; t *= 2)
+    for (size_t len = t - 3; len <= t + 3; len++) lens[n++] = len;
+  for (size_t len = 301; len <= 5000; len += 97) lens[n++] = len;
+  lens[n++] = 5000;
+
+  for (unsigned model = 0; model < CRC_MODELS; model++) {
+    const bool bits = model == CRC_MODEL_CAN15 || model == CRC_MODEL_CANFD17 || model == CRC_MODEL_CANFD21;
+    for (size_t off = 0; off < 16; off++) {
+      for (size_t i = 0; i < n; i++) {
+        const size_t len = bits ? lens[i] * 8 - (lens[i] ? lens[i] % 8 : 0) : lens[i];
+        if (crc_calc(model, data + off, len) != generic(model, data + off, len)) {
+          printf("  %s, offset %u, length %u\n", crc_model_name(model), (unsigned) off, (unsigned) len);
+          ok = false;
+        }
+      }
+    }
+  }
+
+  // every CRC32 kernel of this build, forced
+  for (uint8_t k = 0; k < CRC_KERNELS; k++) {
+    FastCRC32 c;
+    if (!c.kernel(k)) continue;
+    for (size_t i = 0; i < n; i++)
+      ok = ok && c.crc32(data + 3, lens[i]) == generic(CRC_MODEL_CRC32, data + 3, lens[i]);
+  }
+  return ok;
+}
+#endif
+
+#if CRC_EXEC
+typedef struct {
+  crc_exec_job_t job;
+  uint64_t crc;
+  unsigned calls;
+} exec_test_t;
+
+static void exec_done(void *ctx, uint64_t crc)
+{
+  exec_test_t *t = (exec_test_t *) ctx;
+  t->crc = crc;
+  __atomic_add_fetch(&t->calls, 1, __ATOMIC_RELAXED);
+}
+
+// 4 threads submit jobs of all sizes to one executor: inline (<= 512 bytes), batches of small
+// jobs, jobs that are split into chunks and combined (also CAN lengths in bits, not whole bytes)
+static bool exec_test(void)
+{
+  const size_t size = 5u << 20, per = 64;
+  uint8_t *data = (uint8_t *) malloc(size);
+  exec_test_t *t = (exec_test_t *) calloc(4 * per, sizeof(exec_test_t));
+  crc_exec_t *e = crc_exec_create(3);
+  bool ok = data && t && e;
+
+  uint32_t x = 0x2545f491;
+  for (size_t i = 0; ok && i < size; i++) {
+    x ^= x << 13; x ^= x >> 17; x ^= x << 5;
+    data[i] = x;
+  }
+  for (unsigned i = 0; ok && i < 4 * per; i++) {
+    const unsigned model = (i * 7) % CRC_MODELS;
+    const bool bits = model == CRC_MODEL_CAN15 || model == CRC_MODEL_CANFD17 || model == CRC_MODEL_CANFD21;
+    const size_t off = (i * 4099) % 4096;
+    size_t len = i % 4 == 0 ? (i * 37) % 513 : i % 4 == 1 ? 1000 + i * 97 : i % 4 == 2 ? (16u << 10) + i : size - 4096 - i * 1000;
+    if (i % 16 == 3) len = (2u << 20) + i;
+    if (bits) len = len * 8 - i % 8;
+    t[i].job.model = model;
+    t[i].job.data = data + off;
+    t[i].job.len = len;
+    t[i].job.fn = exec_done;
+    t[i].job.ctx = &t[i];
+  }
+  if (ok) {
+    std::thread th[4];
+    for (unsigned n = 0; n < 4; n++) {
+      th[n] = std::thread([=] {
+        exec_test_t *mine = t + n * per;
+        crc_exec_job_t jobs[per / 2];
+        for (unsigned i = 0; i < per / 2; i++) crc_exec_submit(e, &mine[i].job);	// one by one
+        for (unsigned i = 0; i < per / 2; i++) jobs[i] = mine[per / 2 + i].job;
+        crc_exec_submit_batch(e, jobs, per / 2);	// grouped
+      });
+    }
+    for (unsigned n = 0; n < 4; n++) th[n].join();
+    crc_exec_wait(e);
+    for (unsigned i = 0; i < 4 * per; i++)
+      ok = ok && t[i].calls == 1 && t[i].crc == crc_calc(t[i].job.model, t[i].job.data, t[i].job.len);
+  }
+  crc_exec_destroy(e);
+  free(t);
+  free(data);
+  return ok;
+}
+#endif
+
+#if CRC_PIPE
+// A producer thread pushes 20000 frames through a ring of 64, every 7th one is corrupted;
+// this thread starts when the ring was full once, verifies and pops them and checks order,
+// user and ok of each
+static bool pipe_test(const unsigned model)
+{
+  const unsigned frames = 20000, pool = 500;
+  uint8_t *data = (uint8_t *) malloc(pool * 300);
+  crc_pipe_t *p = crc_pipe_create(model, 64);
+  bool ok = data && p;
+
+  uint32_t x = 0x2545f491 + model;
+  for (unsigned i = 0; ok && i < pool; i++) {
+    uint8_t *f = data + i * 300;
+    const size_t len = 4 + i % 290;
+    for (size_t j = 0; j < len - 2; j++) {
+      x ^= x << 13; x ^= x >> 17; x ^= x << 5;
+      f[j] = x;
+    }
+    const uint16_t crc = model == CRC_MODEL_MODBUS ? CRC16.modbus(f, len - 2) : CRC16.x25(f, len - 2);
+    f[len - 2] = crc & 0xff;	// low byte first
+    f[len - 1] = crc >> 8;
+    if (i % 7 == 3) f[i % (len - 2)] ^= 0x10;
+  }
+  if (ok) {
+    std::atomic<bool> full(false);
+    std::thread producer([&] {
+      for (unsigned i = 0; i < frames; i++) {
+        const crc_frame_t f = {data + (i % pool) * 300, 4 + (i % pool) % 290, (void *) (uintptr_t) (i + 1), 0};
+        while (!crc_pipe_push(p, &f)) {
+          full = true;
+          std::this_thread::yield();
+        }
+      }
+    });
+    while (!full) std::this_thread::yield();
+    crc_frame_t out[48];
+    unsigned next = 0;
+    while (next < frames) {
+      crc_pipe_verify(p);
+      const size_t n = crc_pipe_pop(p, out, 48);
+      for (size_t i = 0; i < n; i++, next++) {
+        const unsigned k = next % pool;
+        ok = ok && out[i].user == (void *) (uintptr_t) (next + 1) && out[i].data == data + k * 300 &&
+          out[i].len == 4 + k % 290 && out[i].ok == (k % 7 != 3);
+      }
+      if (!n) std::this_thread::yield();
+    }
+    producer.join();
+    ok = ok && crc_pipe_verify(p) == 0 && crc_pipe_pop(p, out, 48) == 0;
+  }
+  crc_pipe_destroy(p);
+  free(data);
+  return ok;
+}
+#endif
+
+#if __cplusplus >= 202002L
+// Single threaded loop, post() is also called by the workers of the executor
+struct coro_loop_t {
+  std::mutex m;
+  std::condition_variable cv;
+  std::deque<std::coroutine_handle<>> ready;
+  std::thread::id owner = std::this_thread::get_id();
+  unsigned posts = 0, remote = 0;
+
+  static void post(void *ctx, std::coroutine_handle<> h) {
+    coro_loop_t *l = (coro_loop_t *) ctx;
+    std::lock_guard<std::mutex> g(l->m);
+    l->ready.push_back(h);
+    l->posts++;
+    l->remote += std::this_thread::get_id() != l->owner;
+    l->cv.notify_one();
+  }
+
+  // until *pending tasks have finished
+  void run(const unsigned *pending) {
+    while (*pending) {
+      std::unique_lock<std::mutex> g(m);
+      cv.wait(g, [this] { return !ready.empty(); });
+      std::coroutine_handle<> h = ready.front();
+      ready.pop_front();
+      g.unlock();
+      h.resume();
+    }
+  }
+};
+
+// Returns the bytes in pieces of varying size, every other read completes later from the loop
+struct coro_source_t {
+  coro_loop_t *loop;
+  FastCRC::crc_bytes_t rest;
+  unsigned reads;
+
+  struct read_t {
+    coro_loop_t *loop;
+    FastCRC::crc_bytes_t bytes;
+    bool later;
+    bool await_ready() const noexcept { return !later; }
+    void await_suspend(std::coroutine_handle<> h) const { coro_loop_t::post(loop, h); }
+    FastCRC::crc_bytes_t await_resume() const noexcept { return bytes; }
+  };
+  read_t read() {
+    static const size_t sizes[] = {1, 4095, 100000, 7, 3u << 20, 65536};
+    const size_t n = sizes[reads % 6] < rest.len ? sizes[reads % 6] : rest.len;
+    read_t r = {loop, {rest.data, n}, reads % 2 == 1};
+    rest.data += n;
+    rest.len -= n;
+    reads++;
+    return r;
+  }
+};
+
+static void coro_done(void *ctx)
+{
+  (*(unsigned *) ctx)--;
+}
+
+// 12 tasks share one loop: buffers in slices and byte sources read in pieces, with and without
+// an executor for the large pieces (also a CAN model, the length is converted to bits)
+static bool coro_test(void)
+{
+  const size_t size = 6u << 20;
+  const unsigned models[3] = {CRC_MODEL_CRC32, CRC_MODEL_XZ, CRC_MODEL_CANFD21};
+  uint8_t *data = (uint8_t *) malloc(size);
+  coro_loop_t io;
+  coro_source_t src[12];
+  size_t off[12], len[12];
+  unsigned pending = 0;
+  bool ok = data;
+
+  uint32_t x = 0x6c078965;
+  for (size_t i = 0; ok && i < size; i++) {
+    x ^= x << 13; x ^= x >> 17; x ^= x << 5;
+    data[i] = x;
+  }
+  FastCRC::crc_loop_t loop = {};
+  loop.post = coro_loop_t::post;
+  loop.ctx = &io;
+  loop.slice = 10000;
+  FastCRC::crc_loop_t offload = loop;
+#if CRC_EXEC
+  crc_exec_t *e = crc_exec_create(2);
+  ok = ok && e;
+  offload.exec = e;
+  offload.offload = 50000;
+#endif
+  if (ok) {
+    std::deque<FastCRC::crc_task<uint64_t>> tasks;
+    for (unsigned i = 0; i < 12; i++) {
+      const unsigned model = models[i / 4];
+      const FastCRC::crc_loop_t &l = i % 4 < 2 ? loop : offload;
+      off[i] = i * 13;
+      len[i] = i % 2 ? size - i * 4097 : 300000 + i;
+      if (i % 4 == 0 || i % 4 == 2) {
+        tasks.push_back(FastCRC::crc_async(model, data + off[i], len[i], l));
+      }
+      else {
+        src[i] = {&io, {data + off[i], len[i]}, 0};
+        tasks.push_back(FastCRC::crc_async(model, src[i], l));
+      }
+      pending++;
+      tasks.back().start(coro_done, &pending);
+    }
+    io.run(&pending);
+    for (unsigned i = 0; i < 12; i++)
+      ok = ok && tasks[i].done() && tasks[i].get() == crc_calc(models[i / 4], data + off[i], FastCRC::crc_coro_units(models[i / 4], len[i]));
+    ok = ok && io.posts > 0;
+#if CRC_EXEC
+    ok = ok && io.remote > 0;	// the large pieces came back from the workers
+#endif
+  }
+#if CRC_EXEC
+  crc_exec_destroy(e);
+#endif
+  free(data);
+  return ok;
+}
+#endif
+
+#if CRC_FILE
+static void crc32_chunk(void *ctx, const uint8_t *data, size_t len)
+{
+  uint32_t *crc = (uint32_t *) ctx;
+  *crc = CRC32.crc32_from(*crc, data, len);
+}
+
+static bool write_file(const char *path, const uint8_t *data, size_t len)
+{
+  FILE *f = fopen(path, "wb");
+  if (!f) return false;
+  const bool ok = fwrite(data, 1, len, f) == len;
+  return fclose(f) == 0 && ok;
+}
+
+// A tree with a file of 20 parts (split 64 KB), a small, an empty and a medium file: the manifest
+// has the CRCs of crc32_file(), then one file is changed and one deleted
+static bool sfv_test(void)
+{
+  static const char *const names[4] = {"a.bin", "b.txt", "sub/c.bin", "sub/d.bin"};
+  const size_t sizes[4] = {(20u << 16) - 4321, 9, 0, 200000};
+  char dir[] = "/tmp/fastcrcsfvXXXXXX", path[64], manifest[64], json[4096];
+  uint8_t *data = (uint8_t *) malloc(sizes[0]);
+  crc_sfv_options_t opt = {3, 1u << 16, NULL, NULL};
+  crc_sfv_report_t r;
+  bool ok = data && mkdtemp(dir);
+
+  if (!ok) {
+    free(data);
+    return false;
+  }
+  for (size_t i = 0; i < sizes[0]; i++) data[i] = i * 13 + (i >> 9);
+  snprintf(path, sizeof(path), "%s/sub", dir);
+  ok = mkdir(path, 0700) == 0;
+  for (unsigned i = 0; i < 4; i++) {
+    snprintf(path, sizeof(path), "%s/%s", dir, names[i]);
+    ok = ok && write_file(path, i == 1 ? buf : data + i, sizes[i]);
+  }
+  snprintf(manifest, sizeof(manifest), "%s/files.sfv", dir);
+
+  ok = ok && crc_sfv_create(manifest, dir, &opt, &r) == 0 && r.count == 4 && r.ok == 4;
+  for (unsigned i = 0; ok && i < 4; i++) {
+    int err;
+    snprintf(path, sizeof(path), "%s/%s", dir, names[i]);
+    ok = !strcmp(r.files[i].path, names[i]) && r.files[i].size == sizes[i] &&
+      r.files[i].crc == CRC32.crc32_file(path, &err) && !err;
+  }
+  crc_sfv_free(&r);
+
+  snprintf(path, sizeof(path), "%s/b.txt", dir);
+  ok = ok && write_file(path, (const uint8_t *) "123456780", 9);
+  snprintf(path, sizeof(path), "%s/sub/d.bin", dir);
+  ok = ok && unlink(path) == 0;
+  ok = ok && crc_sfv_verify(manifest, &opt, &r) == 0 && r.count == 4 && r.ok == 2 && r.bad == 1 && r.missing == 1 &&
+    r.errors == 0 && r.files[0].status == CRC_SFV_OK && r.files[1].status == CRC_SFV_BAD &&
+    r.files[1].expected == 0xcbf43926 && r.files[2].status == CRC_SFV_OK && r.files[3].status == CRC_SFV_MISSING;
+
+  snprintf(path, sizeof(path), "%s/report.json", dir);
+  FILE *f = fopen(path, "w+");
+  size_t n = 0;
+  if (f && !crc_sfv_json(&r, fileno(f))) {
+    rewind(f);
+    n = fread(json, 1, sizeof(json) - 1, f);
+  }
+  json[n] = 0;
+  ok = ok && strstr(json, "\"files\":4,\"ok\":2,\"bad\":1,\"missing\":1,\"errors\":0,") &&
+    strstr(json, "{\"path\":\"b.txt\",\"crc\":\"") && strstr(json, "\"expected\":\"CBF43926\",\"size\":9,\"status\":\"bad\"") &&
+    strstr(json, "{\"path\":\"sub/d.bin\",") && strstr(json, "\"status\":\"missing\"");
+  if (f) fclose(f);
+  crc_sfv_free(&r);
+
+  unlink(path);
+  unlink(manifest);
+  for (unsigned i = 0; i < 3; i++) {
+    snprintf(path, sizeof(path), "%s/%s", dir, names[i]);
+    unlink(path);
+  }
+  snprintf(path, sizeof(path), "%s/sub", dir);
+  rmdir(path);
+  rmdir(dir);
+  free(data);
+  return ok;
+}
+#endif
+
 
 int main()
 {
@@ -17,5 +527,186 @@ int main()
 
   crc = CRC32.cksum(buf, sizeof(buf));
   printf("cksum %s\n", 0x765e7680 == crc ? "is OK" : "is NOT OK");
+  printf("cksum_length %s\n", cksum_length_test() ? "is OK" : "is NOT OK");
+
+  crc = CRC32.mpeg2(buf, sizeof(buf));
+  printf("mpeg2 %s\n", 0x0376e6e7 == crc ? "is OK" : "is NOT OK");
+  printf("mpeg2_ts %s\n", ts_test() ? "is OK" : "is NOT OK");
+
+  crc = CRC32.bzip2(buf, sizeof(buf));
+  printf("bzip2 %s\n", 0xfc891918 == crc ? "is OK" : "is NOT OK");
+
+  crc = CRC16.can15(buf, sizeof(buf) * 8);
+  printf("can15 %s\n", 0x059e == crc ? "is OK" : "is NOT OK");
+
+  // "123456789" + CRC low byte first, the second frame is corrupted
+  const uint8_t mb[2][11] = {{'1','2','3','4','5','6','7','8','9',0x37,0x4b}, {'1','2','3','4','5','6','7','8','8',0x37,0x4b}};
+  const uint8_t hd[11] = {'1','2','3','4','5','6','7','8','9',0x6e,0x90};
+  const uint8_t *frames[3] = {mb[0], mb[1], hd};
+  const size_t lens[3] = {11, 11, 11};
+  uint8_t ok[3];
+  printf("modbus_verify %s\n", CRC16.modbus_verify(frames, lens, 2, ok) == 1 && ok[0] && !ok[1] &&
+    CRC16.x25_verify(frames + 2, lens + 2, 1, ok + 2) == 1 && ok[2] ? "is OK" : "is NOT OK");
+
+  // DAT line n carries "123456789" rotated by n bytes and XOR-ed with n * 0x11, MSB-first
+  uint8_t lane[8][sizeof(buf)];
+  uint8_t sd[sizeof(buf) * 8] = {0};
+  uint16_t sdcrc[8];
+  bool sdok = true;
+  for (unsigned n = 0; n < 8; n++)
+    for (unsigned j = 0; j < sizeof(buf); j++) lane[n][j] = buf[(j + n) % sizeof(buf)] ^ (n * 0x11);
+  for (unsigned i = 0; i < sizeof(buf) * 8; i++) {
+    for (unsigned n = 0; n < 4; n++) {
+      uint8_t bit = (lane[n][i / 8] >> (7 - i % 8)) & 1;
+      sd[i / 2] |= bit << (n + (i & 1 ? 0 : 4));
+    }
+  }
+  CRC16.sd4bit(sd, sizeof(buf) * 4, sdcrc);
+  for (unsigned n = 0; n < 4; n++) sdok = sdok && sdcrc[n] == CRC16.xmodem(lane[n], sizeof(buf));
+  printf("sd4bit %s\n", sdok && sdcrc[0] == 0x31c3 ? "is OK" : "is NOT OK");
+
+  for (unsigned i = 0; i < sizeof(buf) * 8; i++) {
+    sd[i] = 0;
+    for (unsigned n = 0; n < 8; n++) sd[i] |= ((lane[n][i / 8] >> (7 - i % 8)) & 1) << n;
+  }
+  CRC16.sd8bit(sd, sizeof(sd), sdcrc);
+  for (unsigned n = 0; n < 8; n++) sdok = sdok && sdcrc[n] == CRC16.xmodem(lane[n], sizeof(buf));
+  printf("sd8bit %s\n", sdok && sdcrc[0] == 0x31c3 ? "is OK" : "is NOT OK");
+
+  crc = CRC32.canfd17(buf, sizeof(buf) * 8);
+  printf("canfd17 %s\n", 0x04f03 == crc ? "is OK" : "is NOT OK");
+
+  crc = CRC32.canfd21(buf, sizeof(buf) * 8);
+  printf("canfd21 %s\n", 0x0ed841 == crc ? "is OK" : "is NOT OK");
+
+  uint64_t crc64;
+
+  crc64 = CRC64.ecma182(buf, sizeof(buf));
+  printf("ecma182 %s\n", 0x6c40df5f0b497347 == crc64 ? "is OK" : "is NOT OK");
+
+  crc64 = CRC64.xz(buf, sizeof(buf));
+  printf("xz %s\n", 0x995dc9bbdf1939fa == crc64 ? "is OK" : "is NOT OK");
+
+  crc64 = CRC64.goiso(buf, sizeof(buf));
+  printf("goiso %s\n", 0xb90956c775a41001 == crc64 ? "is OK" : "is NOT OK");
+
+  crc64 = CRC64.nvme(buf, sizeof(buf));
+  printf("nvme %s\n", 0xae8b14860a799888 == crc64 ? "is OK" : "is NOT OK");
+
+#if __cplusplus >= 201402L
+  // compile-time CRCs
+  constexpr uint32_t id = FastCRC::crc32("123456789");
+  static_assert(id == 0xcbf43926, "constexpr crc32");
+  static_assert(FastCRC::ft4("123456789") == 0x0f31, "constexpr ft4");
+  printf("constexpr %s\n", FastCRC::x25("123456789") == CRC16.x25(buf, sizeof(buf)) &&
+    FastCRC::cksum(buf, sizeof(buf)) == CRC32.cksum(buf, sizeof(buf)) &&
+    FastCRC::nvme(buf, sizeof(buf)) == CRC64.nvme(buf, sizeof(buf)) ? "is OK" : "is NOT OK");
+#endif
+
+#if __cplusplus >= 201402L
+  printf("kernels %s\n", kernel_test() ? "is OK" : "is NOT OK");
+#endif
+
+  // "1234" + "56789"
+  printf("crc_combine %s\n", crc_combine(CRC_MODEL_X25, crc_calc(CRC_MODEL_X25, buf, 4), crc_calc(CRC_MODEL_X25, buf + 4, 5), 5) == 0x906e &&
+    crc_combine(CRC_MODEL_XZ, crc_calc(CRC_MODEL_XZ, buf, 4), crc_calc(CRC_MODEL_XZ, buf + 4, 5), 5) == 0x995dc9bbdf1939fa ? "is OK" : "is NOT OK");
+
+#if CRC_EXEC
+  printf("crc_exec %s\n", exec_test() ? "is OK" : "is NOT OK");
+#endif
+#if CRC_PIPE
+  printf("crc_pipe %s\n", pipe_test(CRC_MODEL_MODBUS) && pipe_test(CRC_MODEL_X25) ? "is OK" : "is NOT OK");
+#endif
+
+#if __cplusplus >= 202002L
+  // slices of 2 bytes, without a loop it never suspends
+  {
+    FastCRC::crc_loop_t loop = {};
+    loop.slice = 2;
+    FastCRC::crc_task<uint64_t> task = FastCRC::crc_async(CRC_MODEL_CRC32, buf, sizeof(buf), loop);
+    task.start();
+    printf("crc_async %s\n", task.done() && task.get() == 0xcbf43926 ? "is OK" : "is NOT OK");
+  }
+  printf("crc_async loop %s\n", coro_test() ? "is OK" : "is NOT OK");
+#endif
+
+#if CRC_FILE
+  char path[] = "/tmp/fastcrcXXXXXX";
+  int fd = mkstemp(path);
+  if (fd >= 0) {
+    int err;
+    if (write(fd, buf, sizeof(buf)) != sizeof(buf)) return 1;
+    crc = CRC32.crc32_file(path, &err);
+    crc64 = CRC64.xz_file(path, &err);
+    printf("crc32_file %s\n", 0xcbf43926 == crc && 0x995dc9bbdf1939fa == crc64 && !err ? "is OK" : "is NOT OK");
+    close(fd);
+    unlink(path);
+  }
+
+  // sparse, larger than CRC_FILE_SMALL (mapped) and across the 64 MB window of the mapping
+  const size_t big = (64u << 20) + 300000, at = (64u << 20) - 100000;
+  uint8_t *mem = (uint8_t *) calloc(big, 1);
+  char bpath[] = "/tmp/fastcrcXXXXXX";
+  fd = mem ? mkstemp(bpath) : -1;
+  if (fd >= 0) {
+    int err;
+    for (size_t i = 0; i < 200000; i++) mem[i] = mem[at + i] = i * 7 + 1;
+    for (size_t i = big - 1000; i < big; i++) mem[i] = i;
+    if (pwrite(fd, mem, 200000, 0) != 200000 || pwrite(fd, mem + at, 200000, at) != 200000 ||
+      pwrite(fd, mem + big - 1000, 1000, big - 1000) != 1000) return 1;
+    uint32_t part[2] = {0, 0};
+    lseek(fd, 1000, SEEK_SET);
+    crc = CRC32.crc32_fd(fd, &err);
+    printf("crc32_fd %s\n", crc == CRC32.crc32(mem + 1000, big - 1000) && !err && lseek(fd, 0, SEEK_CUR) == (off_t) big &&
+      !crc_file_range(fd, 12345, 150000, crc32_chunk, &part[0]) && part[0] == CRC32.crc32(mem + 12345, 150000) &&
+      !crc_file_range(fd, at, big, crc32_chunk, &part[1]) && part[1] == CRC32.crc32(mem + at, big - at) ? "is OK" : "is NOT OK");
+
+    // read ahead: io_uring (if permitted), then the pread() thread, from a non-zero offset
+    uint32_t async[2];
+    int async_err[2];
+    for (unsigned i = 0; i < 2; i++) {
+      if (i) setenv("FASTCRC_NO_URING", "1", 1);
+      lseek(fd, 4097, SEEK_SET);
+      async[i] = CRC32.crc32_async(fd, &async_err[i]);
+      async_err[i] |= lseek(fd, 0, SEEK_CUR) != (off_t) big;
+    }
+    unsetenv("FASTCRC_NO_URING");
+    crc = CRC32.crc32(mem + 4097, big - 4097);
+    printf("crc32_async %s\n", async[0] == crc && async[1] == crc && !async_err[0] && !async_err[1] ? "is OK" : "is NOT OK");
+    close(fd);
+    unlink(bpath);
+  }
+  free(mem);
+
+  printf("crc_sfv %s\n", sfv_test() ? "is OK" : "is NOT OK");
+#endif
+
+#if CRC_UDP
+  // over loopback: "123456789" + CRC32 low byte first, the second datagram is one byte short
+  int rx = socket(AF_INET, SOCK_DGRAM, 0), tx = socket(AF_INET, SOCK_DGRAM, 0);
+  struct sockaddr_in addr;
+  socklen_t addrlen = sizeof(addr);
+  memset(&addr, 0, sizeof(addr));
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  if (rx >= 0 && tx >= 0 && !bind(rx, (struct sockaddr *) &addr, sizeof(addr)) && !getsockname(rx, (struct sockaddr *) &addr, &addrlen)) {
+    uint8_t dg[3][13];
+    crc = CRC32.crc32(buf, sizeof(buf));
+    for (unsigned i = 0; i < 3; i++) {
+      memcpy(dg[i], buf, sizeof(buf));
+      for (unsigned b = 0; b < 4; b++) dg[i][9 + b] = crc >> (8 * b);
+      sendto(tx, dg[i], i == 1 ? 12 : 13, 0, (struct sockaddr *) &addr, sizeof(addr));
+    }
+    crc_udp_t *u = crc_udp_create(8, 0, 0);
+    crc_udp_result_t r;
+    size_t len;
+    const int err = u ? crc_udp_recv(u, rx, MSG_WAITFORONE, &r) : -1;
+    printf("crc_udp %s\n", !err && r.received == 3 && r.valid == 2 && r.index[0] == 0 && r.index[1] == 2 &&
+      crc_udp_data(u, 2, &len) && len == 9 ? "is OK" : "is NOT OK");
+    crc_udp_destroy(u);
+  }
+  if (rx >= 0) close(rx);
+  if (tx >= 0) close(tx);
+#endif
 
 }
\ No newline at end of file
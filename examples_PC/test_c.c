@@ -0,0 +1,45 @@
+#include <stdio.h>
+#include <stdint.h>
+#include "FastCRC_c.h"
+
+// C API of the shared library, see FastCRC_c.h
+// gcc -I../src test_c.c -L<build> -lfastcrc -otest_c.exe (or ctest)
+
+static const uint8_t buf[9] = {'1','2','3','4','5','6','7','8','9'};
+
+static int can(unsigned model)
+{
+  return model == FASTCRC_MODEL_CAN15 || model == FASTCRC_MODEL_CANFD17 || model == FASTCRC_MODEL_CANFD21;
+}
+
+int main(void)
+{
+  printf("fastcrc_crc32 %s\n", fastcrc_crc32(buf, sizeof(buf)) == 0xcbf43926 ? "is OK" : "is NOT OK");
+  printf("fastcrc_modbus %s\n", fastcrc_modbus(buf, sizeof(buf)) == 0x4b37 ? "is OK" : "is NOT OK");
+  printf("fastcrc_can15 %s\n", fastcrc_can15(buf, sizeof(buf) * 8) == 0x059e ? "is OK" : "is NOT OK");
+  printf("fastcrc_xz %s\n", fastcrc_xz(buf, sizeof(buf)) == 0x995dc9bbdf1939fa ? "is OK" : "is NOT OK");
+
+  // every model: in one piece, in two pieces, in your memory, combined
+  uint64_t mem[64];
+  int ok = fastcrc_state_size() <= sizeof(mem) && !fastcrc_new(FASTCRC_MODELS) && !fastcrc_model_name(FASTCRC_MODELS);
+  for (unsigned m = 0; m < FASTCRC_MODELS; m++) {
+    const size_t unit = can(m) ? 8 : 1;
+    const uint64_t crc = fastcrc_calc(m, buf, sizeof(buf) * unit);
+    fastcrc_state *s = fastcrc_new(m);
+    fastcrc_state *t = fastcrc_init(mem, m);
+    ok = ok && s && t && fastcrc_state_model(s) == m && fastcrc_model_name(m);
+    if (!ok) break;
+    fastcrc_update(s, buf, 4 * unit);
+    ok = ok && fastcrc_update(s, buf + 4, 5 * unit) == crc && fastcrc_value(s) == crc;
+    fastcrc_reset(s);
+    ok = ok && fastcrc_value(s) == fastcrc_calc(m, buf, 0);
+    fastcrc_update(t, buf, sizeof(buf) * unit);
+    ok = ok && fastcrc_value(t) == crc;
+    ok = ok && fastcrc_combine(m, fastcrc_calc(m, buf, 4 * unit), fastcrc_calc(m, buf + 4, 5 * unit), 5 * unit) == crc;
+    fastcrc_free(s);
+  }
+  printf("fastcrc_state %s\n", ok ? "is OK" : "is NOT OK");
+
+  printf("fastcrc_version %s\n", fastcrc_version() == FASTCRC_VERSION ? "is OK" : "is NOT OK");
+  return 0;
+}
@@ -44,6 +44,112 @@
 #define CRC_BIGTABLES 1
 #endif
 
+// Carry-less multiply folding (x86 PCLMULQDQ), set this to 0 to use the tables only.
+// 2 (GCC, Clang): compiled for PCLMULQDQ and SSSE3 without -mpclmul -mssse3, used if the CPU has them.
+#if !defined(CRC_CLMUL)
+#if defined(__PCLMUL__) && defined(__SSSE3__)
+#define CRC_CLMUL 1
+#else
+#define CRC_CLMUL 0
+#endif
+#endif
+#if CRC_CLMUL == 2 && !((defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__))
+#error "CRC_CLMUL 2 needs GCC or Clang on x86"
+#endif
+
+// Nibble-table folding for the 8-bit CRCs (x86 SSSE3 PSHUFB), set this to 0 to use the tables only:
+#if !defined(CRC_PSHUFB)
+#if defined(__SSSE3__)
+#define CRC_PSHUFB 1
+#else
+#define CRC_PSHUFB 0
+#endif
+#endif
+
+// Unrolled kernels for short buffers (up to 64 bytes), off on AVR to save flash:
+#if !defined(CRC_TINY)
+#if defined(__AVR__)
+#define CRC_TINY 0
+#else
+#define CRC_TINY 1
+#endif
+#endif
+
+// Table-free (no big tables, no CLMUL) kernel for CRC32 on large buffers, select it with FastCRC32::kernel():
+#if !defined(CRC_CHORBA)
+#define CRC_CHORBA 0
+#endif
+
+// perf_event instrumentation of all software models (Linux), see FastCRC_perf.cpp:
+#if !defined(CRC_PERF)
+#define CRC_PERF 0
+#endif
+
+// Call statistics of all software models (calls, bytes, sizes), see FastCRC_stats.cpp:
+#if !defined(CRC_STATS)
+#define CRC_STATS 0
+#endif
+
+// File checksums (<model>_file(), <model>_fd()) with mmap, POSIX hosts only, see FastCRC_file.cpp:
+#if !defined(CRC_FILE)
+#if !defined(ARDUINO) && (defined(__unix__) || defined(__APPLE__))
+#define CRC_FILE 1
+#else
+#define CRC_FILE 0
+#endif
+#endif
+
+// Work-stealing executor for CRC jobs (crc_exec_xxx), hosts with std::thread only, see FastCRC_exec.cpp:
+#if !defined(CRC_EXEC)
+#if !defined(ARDUINO)
+#define CRC_EXEC 1
+#else
+#define CRC_EXEC 0
+#endif
+#endif
+
+// Lock-free frame verification stage (crc_pipe_xxx, Modbus RTU and HDLC frames), hosts with std::atomic only, see FastCRC_pipe.cpp:
+#if !defined(CRC_PIPE)
+#if !defined(ARDUINO)
+#define CRC_PIPE 1
+#else
+#define CRC_PIPE 0
+#endif
+#endif
+
+// Batched UDP receive with CRC32 trailer verification (crc_udp_xxx, recvmmsg), Linux only, see FastCRC_udp.cpp:
+#if !defined(CRC_UDP)
+#if !defined(ARDUINO) && defined(__linux__)
+#define CRC_UDP 1
+#else
+#define CRC_UDP 0
+#endif
+#endif
+
+// Stable C API for the shared library and FFI (fastcrc_xxx, FastCRC_c.h), hosts only, see FastCRC_c.cpp:
+#if !defined(CRC_CAPI)
+#if !defined(ARDUINO)
+#define CRC_CAPI 1
+#else
+#define CRC_CAPI 0
+#endif
+#endif
+
+// 16-entry nibble tables (two per model, 32..128 bytes) for the 7, 8, 16 and 32 bit CRCs:
+#if !defined(CRC_NIBBLE)
+#define CRC_NIBBLE 0
+#endif
+
+// Tables generated in RAM on first use instead of baked into flash (not on AVR), see crc_table():
+#if !defined(CRC_TABLES_LAZY)
+#define CRC_TABLES_LAZY 0
+#endif
+
+// Run-time choice of the kernel per model (benchmarked on first use), see FastCRC_tune.cpp:
+#if !defined(CRC_TUNE)
+#define CRC_TUNE 0
+#endif
+
 #if !defined(FastCRC_h)
 #define FastCRC_h
 
@@ -52,6 +158,7 @@
 #endif
 
 #include <inttypes.h>
+#include <stddef.h>
 
 
 // ================= DEFINES ===================
@@ -66,6 +173,62 @@
 #define CRC_SW 1
 #endif
 
+// ================= MODELS ===================
+// Software models, as used by the instrumentation, the statistics and the autotuner
+
+#define CRC_MODEL_CRC7		0
+#define CRC_MODEL_SMBUS		1
+#define CRC_MODEL_MAXIM		2
+#define CRC_MODEL_CCITT		3
+#define CRC_MODEL_MCRF4XX	4
+#define CRC_MODEL_KERMIT	5
+#define CRC_MODEL_MODBUS	6
+#define CRC_MODEL_XMODEM	7
+#define CRC_MODEL_X25		8
+#define CRC_MODEL_CAN15		9
+#define CRC_MODEL_CRC32		10
+#define CRC_MODEL_CKSUM		11
+#define CRC_MODEL_MPEG2		12
+#define CRC_MODEL_BZIP2		13
+#define CRC_MODEL_CANFD17	14
+#define CRC_MODEL_CANFD21	15
+#define CRC_MODEL_ECMA182	16
+#define CRC_MODEL_XZ		17
+#define CRC_MODEL_GOISO		18
+#define CRC_MODEL_NVME		19
+#define CRC_MODELS			20
+
+const char *crc_model_name(const unsigned model);	// NULL: out of range
+
+// Kernels for large buffers, see FastCRC32::kernel() and crc_tune()
+#define CRC_KERNEL_AUTO   0	// PSHUFB, CLMUL, CHORBA or TABLE, whatever is compiled in
+#define CRC_KERNEL_TABLE  1	// slice-by-4 (slice-by-8 for 64 bit) with CRC_BIGTABLES
+#define CRC_KERNEL_CLMUL  2	// CRC_CLMUL
+#define CRC_KERNEL_CHORBA 3	// CRC_CHORBA, crc32 only
+#define CRC_KERNEL_BYTE   4	// one table lookup per byte (16 bit, 32 and 64 bit with CRC_BIGTABLES)
+#define CRC_KERNEL_PSHUFB 5	// CRC_PSHUFB, 7 and 8 bit only
+#define CRC_KERNELS       6
+
+bool crc_kernel_available(const unsigned model, const uint8_t k);	// k is compiled in for the model (and the CPU has it)
+size_t crc_table_bytes(const unsigned model);						// table memory of the model
+uint64_t crc_combine(const unsigned model, const uint64_t crc1, const uint64_t crc2, uint64_t len2);	// CRC of A + B, len2: length of B (bits for CAN)
+uint64_t crc_calc(const unsigned model, const uint8_t *data, const size_t len);	// CRC of any model (len in bits for CAN), 0: out of range
+
+#if CRC_TABLES_LAZY
+// Table registry: one table per (width, poly, reflect), 64-byte aligned, NULL: invalid or out of memory
+const void *crc_table(const uint8_t width, const uint64_t poly, const bool reflect, const uint8_t slices);
+#endif
+
+#if CRC_FILE
+// Feeds fd from its current offset to the end in chunks to fn (mmap, read() for pipes), returns 0 or errno
+typedef void (*crc_file_fn)(void *ctx, const uint8_t *data, size_t len);
+int crc_file_read(int fd, crc_file_fn fn, void *ctx);
+// len bytes from off of a regular file (less at its end), the file offset is not used
+int crc_file_range(int fd, uint64_t off, uint64_t len, crc_file_fn fn, void *ctx);
+// The same with CRC_FILE_DEPTH reads in flight (io_uring or a pread() thread), fn runs in file order
+int crc_file_async(int fd, crc_file_fn fn, void *ctx);
+#endif
+
 // ================= 7-BIT CRC ===================
 class FastCRC7
 {
@@ -73,6 +236,10 @@ public:
   FastCRC7();
   uint8_t crc7(const uint8_t *data, const size_t datalen);		// (MultiMediaCard interface)
   uint8_t crc7_upd(const uint8_t *data, const size_t datalen);	// Call for subsequent calculations with previous seed.
+#if CRC_FILE
+  uint8_t crc7_file(const char *path, int *error = NULL);	// Whole file, error: 0 or errno
+  uint8_t crc7_fd(int fd, int *error = NULL);			// From the current offset to the end of the file (or pipe)
+#endif
 #if !CRC_SW
   uint8_t generic(const uint8_t polyom, const uint8_t seed, const uint32_t flags, const uint8_t *data, const size_t datalen); //Not available in non-hw-variant (not T3.x)
 #endif
@@ -95,6 +262,16 @@ public:
 
   uint8_t smbus_upd(const uint8_t *data, size_t datalen);			// Call for subsequent calculations with previous seed.
   uint8_t maxim_upd(const uint8_t *data, size_t datalen);			// Call for subsequent calculations with previous seed.
+#if CRC_SW
+  uint8_t smbus_bits(const uint8_t *data, const size_t nbits);	// Length in bits, MSB-first
+  uint8_t maxim_bits(const uint8_t *data, const size_t nbits);	// Length in bits, LSB-first
+#endif
+#if CRC_FILE
+  uint8_t smbus_file(const char *path, int *error = NULL);	// Whole file, error: 0 or errno
+  uint8_t smbus_fd(int fd, int *error = NULL);			// From the current offset to the end of the file (or pipe)
+  uint8_t maxim_file(const char *path, int *error = NULL);
+  uint8_t maxim_fd(int fd, int *error = NULL);
+#endif
 #if !CRC_SW
   uint8_t generic(const uint8_t polyom, const uint8_t seed, const uint32_t flags, const uint8_t *data, const size_t datalen); //Not available in non-hw-variant (not T3.x)
 #endif
@@ -153,6 +330,40 @@ public:
   uint16_t modbus_upd(const uint8_t *data, size_t len);			// Call for subsequent calculations with previous seed
   uint16_t xmodem_upd(const uint8_t *data, size_t len);			// Call for subsequent calculations with previous seed
   uint16_t x25_upd(const uint8_t *data, size_t len);				// Call for subsequent calculations with previous seed
+#if CRC_SW
+  uint16_t ccitt_bits(const uint8_t *data, const size_t nbits);	// Length in bits, MSB-first
+  uint16_t mcrf4xx_bits(const uint8_t *data, const size_t nbits);	// Length in bits, LSB-first
+  uint16_t kermit_bits(const uint8_t *data, const size_t nbits);	// Length in bits, LSB-first
+  uint16_t modbus_bits(const uint8_t *data, const size_t nbits);	// Length in bits, LSB-first
+  uint16_t xmodem_bits(const uint8_t *data, const size_t nbits);	// Length in bits, MSB-first
+  uint16_t x25_bits(const uint8_t *data, const size_t nbits);		// Length in bits, LSB-first
+
+  uint16_t can15(const uint8_t *data, const size_t nbits);		// CRC-15/CAN, length in bits
+  uint16_t can15_upd(const uint8_t *data, size_t nbits);			// Call for subsequent calculations with previous seed
+
+  void sd4bit(const uint8_t *data, const size_t datalen, uint16_t *crc);	// XMODEM of each DAT line, SD 4-bit bus (crc[4])
+  void sd8bit(const uint8_t *data, const size_t datalen, uint16_t *crc);	// XMODEM of each DAT line, MMC 8-bit bus (crc[8])
+
+  // Frames that end with their CRC (low byte first), n at a time: ok[i] 1 if valid, returns the number of valid frames
+  size_t modbus_verify(const uint8_t *const *frames, const size_t *lens, const size_t n, uint8_t *ok);
+  size_t x25_verify(const uint8_t *const *frames, const size_t *lens, const size_t n, uint8_t *ok);
+#endif
+#if CRC_FILE
+  uint16_t ccitt_file(const char *path, int *error = NULL);	// Whole file, error: 0 or errno
+  uint16_t ccitt_fd(int fd, int *error = NULL);			// From the current offset to the end of the file (or pipe)
+  uint16_t mcrf4xx_file(const char *path, int *error = NULL);
+  uint16_t mcrf4xx_fd(int fd, int *error = NULL);
+  uint16_t kermit_file(const char *path, int *error = NULL);
+  uint16_t kermit_fd(int fd, int *error = NULL);
+  uint16_t modbus_file(const char *path, int *error = NULL);
+  uint16_t modbus_fd(int fd, int *error = NULL);
+  uint16_t xmodem_file(const char *path, int *error = NULL);
+  uint16_t xmodem_fd(int fd, int *error = NULL);
+  uint16_t x25_file(const char *path, int *error = NULL);
+  uint16_t x25_fd(int fd, int *error = NULL);
+  uint16_t can15_file(const char *path, int *error = NULL);
+  uint16_t can15_fd(int fd, int *error = NULL);
+#endif
 #if !CRC_SW
   uint16_t generic(const uint16_t polyom, const uint16_t seed, const uint32_t flags, const uint8_t *data, const size_t datalen); //Not available in non-hw-variant (not T3.x)
 #endif
@@ -172,18 +383,244 @@ public:
   FastCRC32();
   uint32_t crc32(const uint8_t *data, const size_t datalen);		// Alias CRC-32/ADCCP, PKZIP, Ethernet, 802.3
   uint32_t cksum(const uint8_t *data, const size_t datalen);		// Alias CRC-32/POSIX
+  uint32_t mpeg2(const uint8_t *data, const size_t datalen);		// MPEG-2 transport stream sections (PSI/SI)
+  uint32_t bzip2(const uint8_t *data, const size_t datalen);		// Alias CRC-32/AAL5, CRC-32/DECT-B
 
   uint32_t crc32_upd(const uint8_t *data, size_t len);			// Call for subsequent calculations with previous seed
   uint32_t cksum_upd(const uint8_t *data, size_t len);			// Call for subsequent calculations with previous seed
+  uint32_t cksum_length(uint64_t length);						// POSIX cksum: appends the length octets to the CRC of cksum()
+  uint32_t mpeg2_upd(const uint8_t *data, size_t len);			// Call for subsequent calculations with previous seed
+  uint32_t bzip2_upd(const uint8_t *data, size_t len);			// Call for subsequent calculations with previous seed
+#if CRC_SW
+  uint32_t crc32_bits(const uint8_t *data, const size_t nbits);	// Length in bits, LSB-first
+  uint32_t cksum_bits(const uint8_t *data, const size_t nbits);	// Length in bits, MSB-first
+  uint32_t mpeg2_bits(const uint8_t *data, const size_t nbits);	// Length in bits, MSB-first
+  uint32_t bzip2_bits(const uint8_t *data, const size_t nbits);	// Length in bits, MSB-first
+
+  uint32_t canfd17(const uint8_t *data, const size_t nbits);		// CRC-17/CAN-FD, length in bits
+  uint32_t canfd21(const uint8_t *data, const size_t nbits);		// CRC-21/CAN-FD, length in bits
+  uint32_t canfd17_upd(const uint8_t *data, size_t nbits);		// Call for subsequent calculations with previous seed
+  uint32_t canfd21_upd(const uint8_t *data, size_t nbits);		// Call for subsequent calculations with previous seed
+
+  size_t mpeg2_ts(const uint8_t *data, const size_t datalen, size_t *sections = NULL); // Validate all PSI/SI sections in a transport stream, returns number of bad CRCs
+
+  bool kernel(const uint8_t k);									// Select the CRC32 kernel (CRC_KERNEL_xxx), false if not compiled in
+  uint32_t crc32_from(const uint32_t crc, const uint8_t *data, const size_t datalen);	// Continues a CRC32 value (zlib's crc32(crc, data, len))
+  uint32_t crc32_combine(const uint32_t crc1, const uint32_t crc2, uint64_t len2);	// CRC32 of A + B from crc32(A), crc32(B) and the length of B
+  size_t crc32_verify(const uint8_t *const *frames, const size_t *lens, const size_t n, uint8_t *ok);	// Frames that end with their CRC32 (low byte first): ok[i] 1 if valid, returns the number of valid frames
+#endif
+#if CRC_FILE
+  uint32_t crc32_file(const char *path, int *error = NULL);	// Whole file, error: 0 or errno
+  uint32_t crc32_fd(int fd, int *error = NULL);			// From the current offset to the end of the file (or pipe)
+  uint32_t cksum_file(const char *path, int *error = NULL);
+  uint32_t cksum_fd(int fd, int *error = NULL);
+  uint32_t mpeg2_file(const char *path, int *error = NULL);
+  uint32_t mpeg2_fd(int fd, int *error = NULL);
+  uint32_t bzip2_file(const char *path, int *error = NULL);
+  uint32_t bzip2_fd(int fd, int *error = NULL);
+  uint32_t canfd17_file(const char *path, int *error = NULL);
+  uint32_t canfd17_fd(int fd, int *error = NULL);
+  uint32_t canfd21_file(const char *path, int *error = NULL);
+  uint32_t canfd21_fd(int fd, int *error = NULL);
+  uint32_t crc32_async(int fd, int *error = NULL);		// Reads ahead while calculating, see crc_file_async()
+  uint32_t cksum_async(int fd, int *error = NULL);
+#endif
 #if !CRC_SW
   uint32_t generic(const uint32_t polyom, const uint32_t seed, const uint32_t flags, const uint8_t *data, const size_t datalen); //Not available in non-hw-variant (not T3.x)
 #endif
 private:
 #if CRC_SW
   uint32_t seed;
+  uint8_t crc32_kernel;
 #else
   uint32_t update(const uint8_t *data, const size_t datalen);
 #endif
 };
 
+// ================= 64-BIT CRC ===================
+
+class FastCRC64
+{
+public:
+#if CRC_SW //NO Hardware-implementation
+  FastCRC64();
+  uint64_t ecma182(const uint8_t *data, const size_t datalen);	// Alias CRC-64
+  uint64_t xz(const uint8_t *data, const size_t datalen);		// Alias CRC-64/GO-ECMA
+  uint64_t goiso(const uint8_t *data, const size_t datalen);		// hash/crc64 ISO table of golang
+  uint64_t nvme(const uint8_t *data, const size_t datalen);		// NVM Express end-to-end data protection
+
+  uint64_t ecma182_upd(const uint8_t *data, size_t len);			// Call for subsequent calculations with previous seed
+  uint64_t xz_upd(const uint8_t *data, size_t len);				// Call for subsequent calculations with previous seed
+  uint64_t goiso_upd(const uint8_t *data, size_t len);			// Call for subsequent calculations with previous seed
+  uint64_t nvme_upd(const uint8_t *data, size_t len);			// Call for subsequent calculations with previous seed
+#if CRC_FILE
+  uint64_t ecma182_file(const char *path, int *error = NULL);	// Whole file, error: 0 or errno
+  uint64_t ecma182_fd(int fd, int *error = NULL);			// From the current offset to the end of the file (or pipe)
+  uint64_t xz_file(const char *path, int *error = NULL);
+  uint64_t xz_fd(int fd, int *error = NULL);
+  uint64_t goiso_file(const char *path, int *error = NULL);
+  uint64_t goiso_fd(int fd, int *error = NULL);
+  uint64_t nvme_file(const char *path, int *error = NULL);
+  uint64_t nvme_fd(int fd, int *error = NULL);
+#endif
+#endif
+private:
+#if CRC_SW
+  uint64_t seed;
+#endif
+};
+
+// ================= INSTRUMENTATION ===================
+// CRC_PERF 1: every _upd() call is counted with perf_event counters, per model and
+// per size bucket (bucket n: 2^(n-1) <= length < 2^n, bucket 0: length 0).
+// The report is printed to stderr at exit (or to the file in $FASTCRC_PERF_DUMP).
+
+#if CRC_PERF
+#define CRC_PERF_BUCKETS 33	// the last bucket takes all larger calls
+
+typedef struct {
+  uint64_t calls;
+  uint64_t bytes;
+  uint64_t pmu_calls;		// calls counted by the PMU
+  uint64_t pmu_bytes;
+  uint64_t cycles;			// CPU cycles of the pmu_calls
+  uint64_t instructions;
+  uint64_t l1d_misses;		// L1D read misses
+  uint64_t tick_calls;		// calls timed without PMU
+  uint64_t tick_bytes;
+  uint64_t ticks;			// rdtsc ticks (x86) or ns of the tick_calls
+} crc_perf_counter_t;
+
+typedef struct {
+  crc_perf_counter_t total;
+  crc_perf_counter_t bucket[CRC_PERF_BUCKETS];
+  bool pmu;					// all threads got the PMU counters
+} crc_perf_t;
+
+bool crc_perf_snapshot(const unsigned model, crc_perf_t *perf);	// false: model out of range
+void crc_perf_reset(void);
+void crc_perf_dump(int fd);
+#endif
+
+// CRC_STATS 1: calls, bytes and a log2 histogram of the lengths per model, counted
+// per thread without atomics and summed up by crc_stats_get() (threads that have
+// exited included). Buckets as above. No permissions needed.
+
+#if CRC_STATS
+#define CRC_STATS_BUCKETS 33	// the last bucket takes all larger calls
+
+typedef struct {
+  uint64_t calls;
+  uint64_t bytes;
+  uint64_t histogram[CRC_STATS_BUCKETS];
+} crc_stats_t;
+
+bool crc_stats_get(const unsigned model, crc_stats_t *stats);	// false: model out of range
+void crc_stats_reset(void);
+void crc_stats_dump(int fd);
+#endif
+
+// ================= AUTOTUNING ===================
+// CRC_TUNE 1: on the first call of a model its kernels (CRC_KERNEL_xxx) are timed
+// with CRC_TUNE_HINT bytes and the fastest one is used from then on. If $FASTCRC_TUNE
+// names a file, the kernels are read from it and the results are written to it.
+// FastCRC32::kernel() overrides the tuned kernel of an instance.
+
+#if CRC_TUNE
+#if !defined(CRC_TUNE_HINT)
+#define CRC_TUNE_HINT 4096		// expected message size
+#endif
+
+void crc_tune(const size_t hint);								// tune all models again, hint 0: CRC_TUNE_HINT (or the mean size with CRC_STATS)
+bool crc_tune_model(const unsigned model, const size_t hint);	// tune one model again, false: model out of range
+uint8_t crc_tune_kernel(const unsigned model);				// kernel in use, tunes the model if not yet done
+bool crc_tune_bind(const unsigned model, const uint8_t k);		// use kernel k (AUTO: tune again), false: out of range or not compiled in
+bool crc_tune_load(const char *path);							// false: not readable
+bool crc_tune_save(const char *path);							// false: not writeable
+#endif
+
+// ================= COMPILE-TIME CRC ===================
+// constexpr versions of all models (C++14), same values as the methods above:
+//   constexpr uint32_t id = FastCRC::crc32("HEARTBEAT");
+// String literals are taken without the terminating zero, uint8_t arrays as a whole.
+// This is a bitwise implementation, use the classes at run time.
+
+#if defined(__cplusplus) && (__cplusplus >= 201402L)
+
+namespace FastCRC {
+
+template <typename C>
+constexpr uint64_t crc_generic(const unsigned width, const uint64_t poly, const uint64_t init, const bool refin, const bool refout,
+	const uint64_t xorout, const C *data, const size_t nbits)
+{
+	const uint64_t top = (uint64_t)1 << (width - 1);
+	const uint64_t mask = (top << 1) - 1;
+	uint64_t crc = init;
+	for (size_t i = 0; i < nbits; i++) {
+		const uint8_t b = (uint8_t)data[i >> 3];
+		const uint64_t bit = refin ? (b >> (i & 7)) & 1 : (b >> (7 - (i & 7))) & 1;
+		const bool fb = ((crc & top) != 0) != (bit != 0);
+		crc = (crc << 1) & mask;
+		if (fb) crc ^= poly & mask;
+	}
+	if (refout) {
+		uint64_t r = 0;
+		for (unsigned i = 0; i < width; i++) r |= ((crc >> i) & 1) << (width - 1 - i);
+		crc = r;
+	}
+	return crc ^ xorout;
+}
+
+#define FASTCRC_CONSTEXPR(name, type, width, poly, init, refin, refout, xorout) \
+	constexpr type name(const uint8_t *data, const size_t datalen) { return (type)crc_generic(width, poly, init, refin, refout, xorout, data, datalen * 8); } \
+	constexpr type name(const char *data, const size_t datalen) { return (type)crc_generic(width, poly, init, refin, refout, xorout, data, datalen * 8); } \
+	template <size_t N> constexpr type name(const uint8_t (&data)[N]) { return name(data, N); } \
+	template <size_t N> constexpr type name(const char (&str)[N]) { return name(str, N - 1); }
+
+#define FASTCRC_CONSTEXPR_BITS(name, type, width, poly) \
+	constexpr type name(const uint8_t *data, const size_t nbits) { return (type)crc_generic(width, poly, 0, false, false, 0, data, nbits); }
+
+// ================= 7-BIT CRC ===================
+FASTCRC_CONSTEXPR(crc7,    uint8_t,   7, 0x09, 0x00, false, false, 0x00)
+
+// ================= 8-BIT CRC ===================
+FASTCRC_CONSTEXPR(smbus,   uint8_t,   8, 0x07, 0x00, false, false, 0x00)
+FASTCRC_CONSTEXPR(maxim,   uint8_t,   8, 0x31, 0x00, true,  true,  0x00)
+
+// ================= 14-BIT CRC ===================
+FASTCRC_CONSTEXPR(darc,    uint16_t, 14, 0x0805, 0x0000, true,  true,  0x0000)
+FASTCRC_CONSTEXPR(gsm,     uint16_t, 14, 0x202d, 0x0000, false, false, 0x3fff)
+FASTCRC_CONSTEXPR(eloran,  uint16_t, 14, 0x60b1, 0x0000, false, false, 0x0000)
+FASTCRC_CONSTEXPR(ft4,     uint16_t, 14, 0x2757, 0x0000, false, false, 0x0000)	// FT4/FT8 (WSJT-X), check 0x0f31
+
+// ================= 16-BIT CRC ===================
+FASTCRC_CONSTEXPR(ccitt,   uint16_t, 16, 0x1021, 0xffff, false, false, 0x0000)
+FASTCRC_CONSTEXPR(mcrf4xx, uint16_t, 16, 0x1021, 0xffff, true,  true,  0x0000)
+FASTCRC_CONSTEXPR(kermit,  uint16_t, 16, 0x1021, 0x0000, true,  true,  0x0000)
+FASTCRC_CONSTEXPR(modbus,  uint16_t, 16, 0x8005, 0xffff, true,  true,  0x0000)
+FASTCRC_CONSTEXPR(xmodem,  uint16_t, 16, 0x1021, 0x0000, false, false, 0x0000)
+FASTCRC_CONSTEXPR(x25,     uint16_t, 16, 0x1021, 0xffff, true,  true,  0xffff)
+FASTCRC_CONSTEXPR_BITS(can15, uint16_t, 15, 0x4599)
+
+// ================= 32-BIT CRC ===================
+FASTCRC_CONSTEXPR(crc32,   uint32_t, 32, 0x04c11db7, 0xffffffff, true,  true,  0xffffffff)
+FASTCRC_CONSTEXPR(cksum,   uint32_t, 32, 0x04c11db7, 0x00000000, false, false, 0xffffffff)
+FASTCRC_CONSTEXPR(mpeg2,   uint32_t, 32, 0x04c11db7, 0xffffffff, false, false, 0x00000000)
+FASTCRC_CONSTEXPR(bzip2,   uint32_t, 32, 0x04c11db7, 0xffffffff, false, false, 0xffffffff)
+FASTCRC_CONSTEXPR_BITS(canfd17, uint32_t, 17, 0x1685b)
+FASTCRC_CONSTEXPR_BITS(canfd21, uint32_t, 21, 0x102899)
+
+// ================= 64-BIT CRC ===================
+FASTCRC_CONSTEXPR(ecma182, uint64_t, 64, 0x42f0e1eba9ea3693, 0x0000000000000000, false, false, 0x0000000000000000)
+FASTCRC_CONSTEXPR(xz,      uint64_t, 64, 0x42f0e1eba9ea3693, 0xffffffffffffffff, true,  true,  0xffffffffffffffff)
+FASTCRC_CONSTEXPR(goiso,   uint64_t, 64, 0x000000000000001b, 0xffffffffffffffff, true,  true,  0xffffffffffffffff)
+FASTCRC_CONSTEXPR(nvme,    uint64_t, 64, 0xad93d23594c93659, 0xffffffffffffffff, true,  true,  0xffffffffffffffff)
+
+#undef FASTCRC_CONSTEXPR
+#undef FASTCRC_CONSTEXPR_BITS
+
+} // namespace FastCRC
+
+#endif // C++14
+
 #endif
@@ -0,0 +1,183 @@
+/* FastCRC library code is placed under the MIT license
+ * Copyright (c) 2014 - 2021 Frank Bösing
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+//
+// C API (FastCRC_c.h)
+//
+// The stateless functions construct the object of their class on the stack
+// (no allocation, the constructors only set the kernel selection) and call
+// the method of the model. A state holds one object of each class: the first
+// update of a message calls the method, all further ones the _upd() method,
+// which continues from the seed of the object. fastcrc_value() of a message
+// without data is the CRC of the empty message.
+//
+// Build the shared library with -fvisibility=hidden, so that only the
+// functions of FastCRC_c.h are exported; the C++ classes are not part of its ABI.
+//
+
+#if defined(ARDUINO)
+#include <Arduino.h>
+#endif
+
+#include "FastCRC.h"
+
+#if CRC_CAPI
+
+#if !CRC_SW
+#error "the C API needs the software CRCs (CRC_SW)"
+#endif
+
+#include <stdlib.h>
+#include <new>
+#include "FastCRC_c.h"
+
+static_assert(FASTCRC_MODELS == CRC_MODELS && FASTCRC_MODEL_CAN15 == CRC_MODEL_CAN15 &&
+	FASTCRC_MODEL_CRC32 == CRC_MODEL_CRC32 && FASTCRC_MODEL_NVME == CRC_MODEL_NVME, "model numbers of FastCRC_c.h");
+
+struct fastcrc_state {
+	unsigned model;
+	bool started;
+	uint64_t value;
+	FastCRC7 c7;
+	FastCRC8 c8;
+	FastCRC16 c16;
+	FastCRC32 c32;
+	FastCRC64 c64;
+};
+
+typedef uint64_t (*fastcrc_fn)(fastcrc_state *s, const uint8_t *data, size_t len);
+
+// fastcrc_<name>() and the first and the next piece of a state
+#define FASTCRC_C_MODEL(C, obj, T, name) \
+	FASTCRC_API T fastcrc_##name(const uint8_t *data, size_t len) { C c; return c.name(data, len); } \
+	static uint64_t fastcrc_first_##name(fastcrc_state *s, const uint8_t *data, size_t len) { return s->obj.name(data, len); } \
+	static uint64_t fastcrc_next_##name(fastcrc_state *s, const uint8_t *data, size_t len) { return s->obj.name##_upd(data, len); }
+
+extern "C" {
+
+FASTCRC_C_MODEL(FastCRC7, c7, uint8_t, crc7)
+FASTCRC_C_MODEL(FastCRC8, c8, uint8_t, smbus)
+FASTCRC_C_MODEL(FastCRC8, c8, uint8_t, maxim)
+FASTCRC_C_MODEL(FastCRC16, c16, uint16_t, ccitt)
+FASTCRC_C_MODEL(FastCRC16, c16, uint16_t, mcrf4xx)
+FASTCRC_C_MODEL(FastCRC16, c16, uint16_t, kermit)
+FASTCRC_C_MODEL(FastCRC16, c16, uint16_t, modbus)
+FASTCRC_C_MODEL(FastCRC16, c16, uint16_t, xmodem)
+FASTCRC_C_MODEL(FastCRC16, c16, uint16_t, x25)
+FASTCRC_C_MODEL(FastCRC16, c16, uint16_t, can15)
+FASTCRC_C_MODEL(FastCRC32, c32, uint32_t, crc32)
+FASTCRC_C_MODEL(FastCRC32, c32, uint32_t, cksum)
+FASTCRC_C_MODEL(FastCRC32, c32, uint32_t, mpeg2)
+FASTCRC_C_MODEL(FastCRC32, c32, uint32_t, bzip2)
+FASTCRC_C_MODEL(FastCRC32, c32, uint32_t, canfd17)
+FASTCRC_C_MODEL(FastCRC32, c32, uint32_t, canfd21)
+FASTCRC_C_MODEL(FastCRC64, c64, uint64_t, ecma182)
+FASTCRC_C_MODEL(FastCRC64, c64, uint64_t, xz)
+FASTCRC_C_MODEL(FastCRC64, c64, uint64_t, goiso)
+FASTCRC_C_MODEL(FastCRC64, c64, uint64_t, nvme)
+
+#define FASTCRC_C_FNS(name) {fastcrc_first_##name, fastcrc_next_##name}
+
+// In the order of CRC_MODEL_xxx
+static const fastcrc_fn fastcrc_fns[CRC_MODELS][2] = {
+	FASTCRC_C_FNS(crc7), FASTCRC_C_FNS(smbus), FASTCRC_C_FNS(maxim),
+	FASTCRC_C_FNS(ccitt), FASTCRC_C_FNS(mcrf4xx), FASTCRC_C_FNS(kermit), FASTCRC_C_FNS(modbus),
+	FASTCRC_C_FNS(xmodem), FASTCRC_C_FNS(x25), FASTCRC_C_FNS(can15),
+	FASTCRC_C_FNS(crc32), FASTCRC_C_FNS(cksum), FASTCRC_C_FNS(mpeg2), FASTCRC_C_FNS(bzip2),
+	FASTCRC_C_FNS(canfd17), FASTCRC_C_FNS(canfd21),
+	FASTCRC_C_FNS(ecma182), FASTCRC_C_FNS(xz), FASTCRC_C_FNS(goiso), FASTCRC_C_FNS(nvme),
+};
+
+FASTCRC_API unsigned fastcrc_version(void)
+{
+	return FASTCRC_VERSION;
+}
+
+FASTCRC_API const char *fastcrc_model_name(unsigned model)
+{
+	return crc_model_name(model);
+}
+
+FASTCRC_API uint64_t fastcrc_calc(unsigned model, const uint8_t *data, size_t len)
+{
+	return crc_calc(model, data, len);
+}
+
+FASTCRC_API uint64_t fastcrc_combine(unsigned model, uint64_t crc1, uint64_t crc2, uint64_t len2)
+{
+	return crc_combine(model, crc1, crc2, len2);
+}
+
+FASTCRC_API size_t fastcrc_state_size(void)
+{
+	return sizeof(fastcrc_state);
+}
+
+FASTCRC_API fastcrc_state *fastcrc_init(void *mem, unsigned model)
+{
+	if (!mem || model >= CRC_MODELS) return NULL;
+	fastcrc_state *s = new (mem) fastcrc_state;
+	s->model = model;
+	fastcrc_reset(s);
+	return s;
+}
+
+FASTCRC_API fastcrc_state *fastcrc_new(unsigned model)
+{
+	if (model >= CRC_MODELS) return NULL;
+	void *mem = malloc(sizeof(fastcrc_state));
+	if (!mem) return NULL;
+	return fastcrc_init(mem, model);
+}
+
+FASTCRC_API void fastcrc_free(fastcrc_state *s)
+{
+	free(s);
+}
+
+FASTCRC_API void fastcrc_reset(fastcrc_state *s)
+{
+	s->started = false;
+	s->value = crc_calc(s->model, NULL, 0);
+}
+
+FASTCRC_API uint64_t fastcrc_update(fastcrc_state *s, const uint8_t *data, size_t len)
+{
+	s->value = fastcrc_fns[s->model][s->started](s, data, len);
+	s->started = true;
+	return s->value;
+}
+
+FASTCRC_API uint64_t fastcrc_value(const fastcrc_state *s)
+{
+	return s->value;
+}
+
+FASTCRC_API unsigned fastcrc_state_model(const fastcrc_state *s)
+{
+	return s->model;
+}
+
+} // extern "C"
+
+#endif // CRC_CAPI
@@ -0,0 +1,128 @@
+/* FastCRC library code is placed under the MIT license
+ * Copyright (c) 2014 - 2021 Frank Bösing
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+// Stable C API of the shared library (libfastcrc), for C and FFI (Go, Rust, Java, ...), see FastCRC_c.cpp
+//
+// Stateless functions per model, and state handles for data that arrives in pieces:
+//   uint32_t crc = fastcrc_crc32(data, len);
+//   fastcrc_state *s = fastcrc_new(FASTCRC_MODEL_CRC32);
+//   fastcrc_update(s, a, alen); fastcrc_update(s, b, blen); crc = fastcrc_value(s);
+// None of them allocates, except fastcrc_new(). The values are the ones of the C++ classes of FastCRC.h.
+
+#if !defined(FastCRC_c_h)
+#define FastCRC_c_h
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define FASTCRC_VERSION_MAJOR 1
+#define FASTCRC_VERSION_MINOR 44
+#define FASTCRC_VERSION (FASTCRC_VERSION_MAJOR * 100 + FASTCRC_VERSION_MINOR)
+#define FASTCRC_ABI 1		// soname libfastcrc.so.1, changes only with incompatible changes of this file
+
+#if defined(_WIN32)
+#if defined(FASTCRC_BUILD)
+#define FASTCRC_API __declspec(dllexport)
+#else
+#define FASTCRC_API __declspec(dllimport)
+#endif
+#else
+#define FASTCRC_API __attribute__((visibility("default")))
+#endif
+
+// The same numbers as CRC_MODEL_xxx of FastCRC.h
+#define FASTCRC_MODEL_CRC7		0
+#define FASTCRC_MODEL_SMBUS		1
+#define FASTCRC_MODEL_MAXIM		2
+#define FASTCRC_MODEL_CCITT		3
+#define FASTCRC_MODEL_MCRF4XX	4
+#define FASTCRC_MODEL_KERMIT	5
+#define FASTCRC_MODEL_MODBUS	6
+#define FASTCRC_MODEL_XMODEM	7
+#define FASTCRC_MODEL_X25		8
+#define FASTCRC_MODEL_CAN15		9	// length in bits
+#define FASTCRC_MODEL_CRC32		10
+#define FASTCRC_MODEL_CKSUM		11
+#define FASTCRC_MODEL_MPEG2		12
+#define FASTCRC_MODEL_BZIP2		13
+#define FASTCRC_MODEL_CANFD17	14	// length in bits
+#define FASTCRC_MODEL_CANFD21	15	// length in bits
+#define FASTCRC_MODEL_ECMA182	16
+#define FASTCRC_MODEL_XZ		17
+#define FASTCRC_MODEL_GOISO		18
+#define FASTCRC_MODEL_NVME		19
+#define FASTCRC_MODELS			20
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+FASTCRC_API unsigned fastcrc_version(void);						// FASTCRC_VERSION of the library
+FASTCRC_API const char *fastcrc_model_name(unsigned model);		// "crc32", NULL: no such model
+
+// Stateless, one call per message
+FASTCRC_API uint8_t fastcrc_crc7(const uint8_t *data, size_t len);
+FASTCRC_API uint8_t fastcrc_smbus(const uint8_t *data, size_t len);
+FASTCRC_API uint8_t fastcrc_maxim(const uint8_t *data, size_t len);
+FASTCRC_API uint16_t fastcrc_ccitt(const uint8_t *data, size_t len);
+FASTCRC_API uint16_t fastcrc_mcrf4xx(const uint8_t *data, size_t len);
+FASTCRC_API uint16_t fastcrc_kermit(const uint8_t *data, size_t len);
+FASTCRC_API uint16_t fastcrc_modbus(const uint8_t *data, size_t len);
+FASTCRC_API uint16_t fastcrc_xmodem(const uint8_t *data, size_t len);
+FASTCRC_API uint16_t fastcrc_x25(const uint8_t *data, size_t len);
+FASTCRC_API uint16_t fastcrc_can15(const uint8_t *data, size_t nbits);
+FASTCRC_API uint32_t fastcrc_crc32(const uint8_t *data, size_t len);
+FASTCRC_API uint32_t fastcrc_cksum(const uint8_t *data, size_t len);
+FASTCRC_API uint32_t fastcrc_mpeg2(const uint8_t *data, size_t len);
+FASTCRC_API uint32_t fastcrc_bzip2(const uint8_t *data, size_t len);
+FASTCRC_API uint32_t fastcrc_canfd17(const uint8_t *data, size_t nbits);
+FASTCRC_API uint32_t fastcrc_canfd21(const uint8_t *data, size_t nbits);
+FASTCRC_API uint64_t fastcrc_ecma182(const uint8_t *data, size_t len);
+FASTCRC_API uint64_t fastcrc_xz(const uint8_t *data, size_t len);
+FASTCRC_API uint64_t fastcrc_goiso(const uint8_t *data, size_t len);
+FASTCRC_API uint64_t fastcrc_nvme(const uint8_t *data, size_t len);
+
+// Any model by its number, 0 for an unknown model. len and len2 are in bits for the CAN models
+// (FASTCRC_MODEL_CAN15, _CANFD17, _CANFD21), in bytes for all others.
+FASTCRC_API uint64_t fastcrc_calc(unsigned model, const uint8_t *data, size_t len);
+FASTCRC_API uint64_t fastcrc_combine(unsigned model, uint64_t crc1, uint64_t crc2, uint64_t len2);	// CRC of A + B, len2: length of B
+
+// State handles, one per message in flight, not shared between threads
+typedef struct fastcrc_state fastcrc_state;
+
+FASTCRC_API size_t fastcrc_state_size(void);						// bytes for fastcrc_init()
+FASTCRC_API fastcrc_state *fastcrc_init(void *mem, unsigned model);	// in your memory (8-byte aligned), NULL: unknown model
+FASTCRC_API fastcrc_state *fastcrc_new(unsigned model);				// allocated, NULL: unknown model or out of memory
+FASTCRC_API void fastcrc_free(fastcrc_state *s);					// of fastcrc_new(), NULL is ignored
+FASTCRC_API void fastcrc_reset(fastcrc_state *s);					// starts a new message
+FASTCRC_API uint64_t fastcrc_update(fastcrc_state *s, const uint8_t *data, size_t len);	// returns the CRC so far (CAN: bits, only the last piece may end within a byte)
+FASTCRC_API uint64_t fastcrc_value(const fastcrc_state *s);		// CRC of all pieces since the start
+FASTCRC_API unsigned fastcrc_state_model(const fastcrc_state *s);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif // FastCRC_c_h
@@ -0,0 +1,163 @@
+/* FastCRC library code is placed under the MIT license
+ * Copyright (c) 2014 - 2021 Frank Bösing
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+//
+// Carry-less multiply (PCLMULQDQ) folding for x86.
+//
+// The data is folded in 128 bit lanes until 16 bytes are left. These 16 bytes
+// are congruent to the whole message modulo the polynom, so the CRC of the
+// message is the table-CRC (seed 0) of the residue. This works for any width
+// up to 64 bit, reflected or not. The seed is xored into the first bytes of
+// the message - the same for the reflected and for the byteswapped
+// non-reflected tables.
+//
+// Fold constants (n = 512 for four lanes, n = 128 for one lane):
+//  reflected:     rev64(x^(n+63) mod P), rev64(x^(n-1) mod P)
+//  non-reflected: x^n mod P, x^(n+64) mod P
+//
+
+#if !defined(FastCRC_clmul)
+#define FastCRC_clmul
+
+#if CRC_CLMUL
+
+#include <wmmintrin.h>
+#include <tmmintrin.h>
+
+#if !defined(CRC_CLMUL_MIN)
+#define CRC_CLMUL_MIN 64
+#endif
+
+// CRC_CLMUL 2: the folding is compiled for these instructions only, crc_clmul_cpu() tells if they can run
+#if CRC_CLMUL == 2
+#define CRC_CLMUL_TARGET __attribute__((target("pclmul,ssse3")))
+#else
+#define CRC_CLMUL_TARGET
+#endif
+
+typedef struct {
+	uint64_t k512[2];
+	uint64_t k128[2];
+	int msb; // non-reflected
+} crc_clmul_t;
+
+// ================= 7-BIT CRC ===================
+static const crc_clmul_t crc_clmul_crc7 = {{0x0000000000000010, 0x0000000000000052}, {0x0000000000000002, 0x0000000000000028}, 1}; // x * P(x)
+
+// ================= 8-BIT CRC ===================
+static const crc_clmul_t crc_clmul_smbus = {{0x0000000000000010, 0x0000000000000037}, {0x0000000000000002, 0x0000000000000026}, 1};
+static const crc_clmul_t crc_clmul_maxim = {{0x5400000000000000, 0x1000000000000000}, {0x9200000000000000, 0x8000000000000000}, 0};
+
+// ================= 16-BIT CRC ===================
+static const crc_clmul_t crc_clmul_ccitt = {{0x00000000000013fc, 0x0000000000008832}, {0x000000000000aefc, 0x000000000000650b}, 1}; // ccitt, xmodem
+static const crc_clmul_t crc_clmul_kermit = {{0x9822000000000000, 0x7f90000000000000}, {0xa95d000000000000, 0x7eea000000000000}, 0}; // kermit, mcrf4xx, x25
+static const crc_clmul_t crc_clmul_modbus = {{0xc450000000000000, 0x8101000000000000}, {0xccd0000000000000, 0xc100000000000000}, 0};
+
+// ================= 32-BIT CRC ===================
+static const crc_clmul_t crc_clmul_crc32 = {{0x653d982200000000, 0xcad38e8f00000000}, {0x65673b4600000000, 0x9ba54c6f00000000}, 0};
+static const crc_clmul_t crc_clmul_cksum = {{0x00000000e6228b11, 0x000000008833794c}, {0x00000000e8a45605, 0x00000000c5b9cd4c}, 1}; // cksum, mpeg2, bzip2
+
+// ================= 64-BIT CRC ===================
+static const crc_clmul_t crc_clmul_ecma182 = {{0x5f6843ca540df020, 0xddf4b6981205b83f}, {0x05f5c3c7eb52fab6, 0x4eb938a7d257740e}, 1};
+static const crc_clmul_t crc_clmul_xz = {{0x6ae3efbb9dd441f3, 0x081f6054a7842df4}, {0xe05dd497ca393ae4, 0xdabe95afc7875f40}, 0};
+static const crc_clmul_t crc_clmul_goiso = {{0x01b001b1b0000001, 0xb100010100000001}, {0x6b70000000000001, 0xf500000000000001}, 0};
+static const crc_clmul_t crc_clmul_nvme = {{0x0c32cdb31e18a84a, 0x62242240ace5045a}, {0xeadc41fd2ba3d420, 0x21e9761e252621ac}, 0};
+
+
+/** The CPU has PCLMULQDQ and SSSE3 (always true unless CRC_CLMUL is 2) */
+static inline bool crc_clmul_cpu(void)
+{
+#if CRC_CLMUL == 2
+	static const bool has = (__builtin_cpu_init(), __builtin_cpu_supports("pclmul") && __builtin_cpu_supports("ssse3"));
+	return has;
+#else
+	return true;
+#endif
+}
+
+static inline CRC_CLMUL_TARGET __m128i crc_clmul_fold(__m128i a, __m128i k, __m128i b)
+{
+	return _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(a, k, 0x00), _mm_clmulepi64_si128(a, k, 0x11)), b);
+}
+
+static inline __attribute__((always_inline)) CRC_CLMUL_TARGET
+size_t crc_clmul_body(uint64_t seed, const uint8_t *data, size_t len, const crc_clmul_t *k, uint8_t *res, const int msb)
+{
+	const __m128i bswap = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+	const __m128i k512 = _mm_loadu_si128((const __m128i *)k->k512);
+	const __m128i k128 = _mm_loadu_si128((const __m128i *)k->k128);
+	const uint8_t *p = data;
+	const uint8_t *end = data + (len & ~(size_t)15);
+	__m128i x0, x1, x2, x3;
+
+#define CRC_CLMUL_LOAD(ptr) (msb ? _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(ptr)), bswap) : _mm_loadu_si128((const __m128i *)(ptr)))
+
+	x0 = _mm_xor_si128(_mm_loadu_si128((const __m128i *)p), _mm_set_epi64x(0, (long long)seed));
+	if (msb) x0 = _mm_shuffle_epi8(x0, bswap);
+	x1 = CRC_CLMUL_LOAD(p + 16);
+	x2 = CRC_CLMUL_LOAD(p + 32);
+	x3 = CRC_CLMUL_LOAD(p + 48);
+	p += 64;
+
+	while (end - p >= 64) {
+		x0 = crc_clmul_fold(x0, k512, CRC_CLMUL_LOAD(p));
+		x1 = crc_clmul_fold(x1, k512, CRC_CLMUL_LOAD(p + 16));
+		x2 = crc_clmul_fold(x2, k512, CRC_CLMUL_LOAD(p + 32));
+		x3 = crc_clmul_fold(x3, k512, CRC_CLMUL_LOAD(p + 48));
+		p += 64;
+	}
+
+	x0 = crc_clmul_fold(x0, k128, x1);
+	x0 = crc_clmul_fold(x0, k128, x2);
+	x0 = crc_clmul_fold(x0, k128, x3);
+
+	while (p < end) {
+		x0 = crc_clmul_fold(x0, k128, CRC_CLMUL_LOAD(p));
+		p += 16;
+	}
+#undef CRC_CLMUL_LOAD
+
+	if (msb) x0 = _mm_shuffle_epi8(x0, bswap);
+	_mm_storeu_si128((__m128i *)res, x0);
+	return p - data;
+}
+
+/** Fold the data down to 16 bytes
+ * @param seed CRC register (as used with the tables)
+ * @param data Pointer to Data
+ * @param len Length of Data, at least 64
+ * @param k Fold constants of the model
+ * @param res 16 bytes residue, to be processed with the table and seed 0
+ * @return Number of bytes consumed
+ */
+static CRC_CLMUL_TARGET size_t crc_clmul(uint64_t seed, const uint8_t *data, size_t len, const crc_clmul_t *k, uint8_t *res)
+{
+	if (k->msb)
+		return crc_clmul_body(seed, data, len, k, res, 1);
+	else
+		return crc_clmul_body(seed, data, len, k, res, 0);
+}
+
+#endif // #if CRC_CLMUL
+#endif
@@ -0,0 +1,266 @@
+/* FastCRC library code is placed under the MIT license
+ * Copyright (c) 2014 - 2021 Frank Bösing
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+// Awaitable CRCs for event loops (C++20 coroutines), header only.
+//
+// A large buffer or an async byte source is calculated in slices of at most CRC_CORO_SLICE bytes,
+// between two slices the coroutine is posted back to the loop, so the other tasks of the loop
+// wait for one slice at most. With an executor (FastCRC_exec.h) pieces of CRC_CORO_OFFLOAD bytes
+// or more are calculated by its workers while the loop goes on. The pieces are joined with crc_combine().
+//
+//   static void post(void *io, std::coroutine_handle<> h) { asio::post(*(asio::io_context *) io, h); }
+//   FastCRC::crc_loop_t loop = {post, &io};
+//   uint32_t crc = co_await FastCRC::crc_async(CRC_MODEL_CRC32, data, len, loop);
+
+#if !defined(FastCRC_coro_h)
+#define FastCRC_coro_h
+
+#include "FastCRC.h"
+
+#if defined(__cplusplus) && (__cplusplus >= 202002L) && __has_include(<coroutine>)
+
+#include <coroutine>
+#include <exception>
+#include <utility>
+#if CRC_EXEC
+#include "FastCRC_exec.h"
+#endif
+
+#if !defined(CRC_CORO_SLICE)
+#define CRC_CORO_SLICE   (64u << 10)	// bytes calculated on the loop between two suspensions
+#endif
+#if !defined(CRC_CORO_OFFLOAD)
+#define CRC_CORO_OFFLOAD (1u << 20)		// pieces of this size or larger go to crc_loop_t.exec
+#endif
+
+namespace FastCRC {
+
+// How the coroutines give the loop back: post(ctx, h) resumes h later from the loop (never inside post).
+// With an executor post is called from its workers as well, so it must be thread-safe then.
+struct crc_loop_t {
+	void (*post)(void *ctx, std::coroutine_handle<> h);	// NULL: never suspend (no loop)
+	void *ctx;
+	size_t slice;		// 0: CRC_CORO_SLICE
+#if CRC_EXEC
+	crc_exec_t *exec;	// NULL: every slice is calculated on the loop
+	size_t offload;		// 0: CRC_CORO_OFFLOAD
+#endif
+};
+
+// What a byte source returns, valid until its next read()
+struct crc_bytes_t {
+	const uint8_t *data;
+	size_t len;			// 0: end of the source
+};
+
+// Lazy coroutine task, started by co_await or start()
+template <typename T>
+class crc_task {
+public:
+	struct promise_type {
+		T value{};
+		std::exception_ptr error;
+		std::coroutine_handle<> next;		// the awaiting coroutine
+		void (*done)(void *ctx) = nullptr;	// start()
+		void *ctx = nullptr;
+
+		crc_task get_return_object() { return crc_task(std::coroutine_handle<promise_type>::from_promise(*this)); }
+		std::suspend_always initial_suspend() noexcept { return {}; }
+		struct final_awaiter {
+			bool await_ready() const noexcept { return false; }
+			std::coroutine_handle<> await_suspend(std::coroutine_handle<promise_type> h) const noexcept {
+				promise_type &p = h.promise();
+				if (p.done) p.done(p.ctx);
+				return p.next ? p.next : std::noop_coroutine();
+			}
+			void await_resume() const noexcept {}
+		};
+		final_awaiter final_suspend() noexcept { return {}; }
+		void return_value(T v) { value = v; }
+		void unhandled_exception() { error = std::current_exception(); }
+	};
+
+	crc_task(crc_task &&t) noexcept : h(std::exchange(t.h, {})) {}
+	crc_task &operator=(crc_task &&t) noexcept {
+		if (this != &t) {
+			if (h) h.destroy();
+			h = std::exchange(t.h, {});
+		}
+		return *this;
+	}
+	~crc_task() { if (h) h.destroy(); }
+
+	bool await_ready() const noexcept { return h.done(); }
+	std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept {
+		h.promise().next = awaiting;
+		return h;
+	}
+	T await_resume() { return get(); }
+
+	/**
+	 * Runs the task without an awaiting coroutine, up to its first suspension
+	 * @param done called when the task has finished (from the loop), get() is valid then
+	 * @param ctx passed to done
+	 */
+	void start(void (*done)(void *ctx) = nullptr, void *ctx = nullptr) {
+		h.promise().done = done;
+		h.promise().ctx = ctx;
+		h.resume();
+	}
+	bool done() const noexcept { return h.done(); }
+	T get() {
+		if (h.promise().error) std::rethrow_exception(h.promise().error);
+		return h.promise().value;
+	}
+
+private:
+	explicit crc_task(std::coroutine_handle<promise_type> h) : h(h) {}
+	std::coroutine_handle<promise_type> h;
+};
+
+// A byte source that is already in memory
+struct crc_buffer_t {
+	crc_bytes_t bytes;
+
+	struct read_t {
+		crc_bytes_t bytes;
+		bool await_ready() const noexcept { return true; }
+		void await_suspend(std::coroutine_handle<>) const noexcept {}
+		crc_bytes_t await_resume() const noexcept { return bytes; }
+	};
+	read_t read() noexcept {
+		read_t r = {bytes};
+		bytes.len = 0;
+		return r;
+	}
+};
+
+// The CAN models count bits
+static inline size_t crc_coro_units(const unsigned model, const size_t len)
+{
+	return model == CRC_MODEL_CAN15 || model == CRC_MODEL_CANFD17 || model == CRC_MODEL_CANFD21 ? len * 8 : len;
+}
+
+// Lets the other tasks of the loop run
+struct crc_yield_t {
+	const crc_loop_t *loop;
+	bool await_ready() const noexcept { return !loop->post; }
+	void await_suspend(std::coroutine_handle<> h) const { loop->post(loop->ctx, h); }
+	void await_resume() const noexcept {}
+};
+
+#if CRC_EXEC
+// Calculates a piece on the executor, the coroutine is posted back to the loop when it is done
+struct crc_offload_t {
+	const crc_loop_t *loop;
+	crc_exec_job_t job;
+	std::coroutine_handle<> h;
+	uint64_t crc;
+	bool queued;
+
+	static void done(void *ctx, uint64_t crc) {
+		crc_offload_t *o = (crc_offload_t *) ctx;
+		o->crc = crc;
+		o->loop->post(o->loop->ctx, o->h);
+	}
+	bool await_ready() const noexcept { return false; }
+	bool await_suspend(std::coroutine_handle<> awaiting) {
+		h = awaiting;
+		job.fn = done;
+		job.ctx = this;
+		queued = true;	// done() may resume the coroutine before crc_exec_submit() returns
+		if (crc_exec_submit(loop->exec, &job) == 0) return true;
+		queued = false;
+		return false;
+	}
+	uint64_t await_resume() const { return queued ? crc : crc_calc(job.model, job.data, job.len); }
+};
+#endif
+
+/**
+ * CRC of an async byte source
+ * @param model CRC_MODEL_xxx
+ * @param src co_await src.read() returns the next crc_bytes_t, len 0 at the end
+ * @param loop how to suspend (copied)
+ * @return task of the CRC, the same value as crc_calc() of all bytes
+ */
+template <typename Source>
+crc_task<uint64_t> crc_async(const unsigned model, Source &src, const crc_loop_t loop)
+{
+	const size_t slice = loop.slice ? loop.slice : CRC_CORO_SLICE;
+	uint64_t crc = crc_calc(model, NULL, 0);
+	bool empty = true;
+	size_t since = 0;	// bytes since the last suspension
+
+	for (;;) {
+		crc_bytes_t b = co_await src.read();
+		if (!b.len) break;
+		while (b.len) {
+			size_t n;
+			uint64_t part;
+#if CRC_EXEC
+			if (loop.exec && loop.post && b.len >= (loop.offload ? loop.offload : CRC_CORO_OFFLOAD)) {
+				n = b.len;
+				part = co_await crc_offload_t{&loop, {model, b.data, crc_coro_units(model, n), NULL, NULL}, {}, 0, false};
+				since = 0;
+			}
+			else
+#endif
+			{
+				n = b.len < slice - since ? b.len : slice - since;
+				part = crc_calc(model, b.data, crc_coro_units(model, n));
+				since += n;
+				if (since == slice) {
+					since = 0;
+					co_await crc_yield_t{&loop};
+				}
+			}
+			crc = empty ? part : crc_combine(model, crc, part, crc_coro_units(model, n));
+			empty = false;
+			b.data += n;
+			b.len -= n;
+		}
+	}
+	co_return crc;
+}
+
+/**
+ * CRC of a buffer, in slices
+ * @param model CRC_MODEL_xxx
+ * @param data valid until the task has finished
+ * @param len in bytes
+ * @param loop how to suspend (copied)
+ * @return task of the CRC
+ */
+inline crc_task<uint64_t> crc_async(const unsigned model, const uint8_t *data, const size_t len, const crc_loop_t loop)
+{
+	crc_buffer_t src = {{data, len}};
+	co_return co_await crc_async(model, src, loop);
+}
+
+} // namespace FastCRC
+
+#endif // C++20
+#endif // FastCRC_coro_h
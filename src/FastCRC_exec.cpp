@@ -0,0 +1,448 @@
+/* FastCRC library code is placed under the MIT license
+ * Copyright (c) 2014 - 2021 Frank Bösing
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+//
+// Work-stealing executor (CRC_EXEC)
+//
+// Jobs up to CRC_EXEC_INLINE bytes are calculated by the caller, a queue costs
+// more. crc_exec_submit_batch() groups small jobs into tasks of up to
+// CRC_EXEC_BATCH bytes. All other tasks go into a shared queue, or into the
+// deque of the worker if a worker submits (from a callback).
+//
+// Every worker has a Chase-Lev deque: the owner pushes and pops at the
+// bottom without locks, the other workers steal at the top with one CAS.
+// A worker that takes a job of more than two chunks splits it into parts of
+// CRC_EXEC_CHUNK bytes, pushes all but the first part into its deque (the
+// shared queue when it is full) and calculates the first one; idle workers
+// steal the others. The worker that
+// finishes the last part combines the CRCs with crc_combine() and calls fn.
+//
+// Idle workers sleep on a condition variable. They announce it in sleepers
+// before the last look into the deques, a worker that pushes parts checks
+// sleepers after the push, so one of both sees the other.
+//
+
+#include "FastCRC_exec.h"
+
+#if CRC_EXEC
+
+#include <errno.h>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <new>
+#include <thread>
+
+#define CRC_EXEC_DEQUE 1024		// parts per worker deque, a power of 2
+
+typedef struct crc_exec_split crc_exec_split_t;
+
+typedef struct {
+	crc_exec_job_t *jobs;		// count whole jobs (owned), or the job of split
+	unsigned count;
+	unsigned part;
+	crc_exec_split_t *split;	// NULL: whole jobs
+} crc_exec_task_t;
+
+struct crc_exec_split {
+	crc_exec_job_t job;
+	unsigned parts;
+	std::atomic<unsigned> left;
+	uint64_t *crc;				// of each part
+	size_t *len;				// of each part, in the unit of job.len
+	crc_exec_task_t *tasks;
+};
+
+typedef struct {
+	alignas(64) std::atomic<int64_t> top;
+	alignas(64) std::atomic<int64_t> bottom;
+	std::atomic<crc_exec_task_t *> buf[CRC_EXEC_DEQUE];
+} crc_exec_deque_t;
+
+typedef struct {
+	crc_exec_t *exec;
+	unsigned index;
+	crc_exec_deque_t deque;
+	std::thread thread;
+} crc_exec_worker_t;
+
+struct crc_exec {
+	crc_exec_worker_t *workers;
+	unsigned threads;
+
+	std::mutex mutex;					// queue, generation, stop
+	std::condition_variable cond;
+	std::deque<crc_exec_task_t *> queue;
+	unsigned generation;				// wakes the sleepers
+	bool stop;
+	std::atomic<unsigned> sleepers;
+
+	std::atomic<size_t> pending;		// jobs submitted, fn not called yet
+	std::mutex done_mutex;
+	std::condition_variable done_cond;
+};
+
+static thread_local crc_exec_worker_t *crc_exec_self;
+
+// ================= DEQUE ===================
+
+static bool crc_exec_push(crc_exec_deque_t *d, crc_exec_task_t *task)
+{
+	const int64_t b = d->bottom.load(std::memory_order_relaxed);
+	const int64_t t = d->top.load(std::memory_order_acquire);
+	if (b - t >= CRC_EXEC_DEQUE) return false;
+	d->buf[b & (CRC_EXEC_DEQUE - 1)].store(task, std::memory_order_relaxed);
+	d->bottom.store(b + 1, std::memory_order_release);	// the task is visible to the thieves
+	return true;
+}
+
+static crc_exec_task_t *crc_exec_pop(crc_exec_deque_t *d)
+{
+	const int64_t b = d->bottom.load(std::memory_order_relaxed) - 1;
+	d->bottom.store(b, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	int64_t t = d->top.load(std::memory_order_relaxed);
+	if (t > b) {
+		d->bottom.store(b + 1, std::memory_order_relaxed);
+		return NULL;
+	}
+	crc_exec_task_t *task = d->buf[b & (CRC_EXEC_DEQUE - 1)].load(std::memory_order_relaxed);
+	if (t == b) {
+		// the last one: race with the thieves
+		if (!d->top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) task = NULL;
+		d->bottom.store(b + 1, std::memory_order_relaxed);
+	}
+	return task;
+}
+
+static crc_exec_task_t *crc_exec_steal(crc_exec_deque_t *d)
+{
+	int64_t t = d->top.load(std::memory_order_acquire);
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	const int64_t b = d->bottom.load(std::memory_order_acquire);
+	if (t >= b) return NULL;
+	crc_exec_task_t *task = d->buf[t & (CRC_EXEC_DEQUE - 1)].load(std::memory_order_relaxed);
+	if (!d->top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) return NULL;
+	return task;
+}
+
+static bool crc_exec_empty(crc_exec_deque_t *d)
+{
+	return d->top.load(std::memory_order_seq_cst) >= d->bottom.load(std::memory_order_seq_cst);
+}
+
+// ================= JOBS ===================
+
+static bool crc_exec_bits(const unsigned model)
+{
+	return model == CRC_MODEL_CAN15 || model == CRC_MODEL_CANFD17 || model == CRC_MODEL_CANFD21;
+}
+
+static size_t crc_exec_bytes(const crc_exec_job_t *job)
+{
+	return crc_exec_bits(job->model) ? (job->len + 7) >> 3 : job->len;
+}
+
+static void crc_exec_done(crc_exec_t *e, size_t jobs)
+{
+	if (e->pending.fetch_sub(jobs) == jobs) {
+		std::lock_guard<std::mutex> lock(e->done_mutex);
+		e->done_cond.notify_all();
+	}
+}
+
+/** After parts were pushed: wake the sleepers to steal them */
+static void crc_exec_wake(crc_exec_t *e)
+{
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	if (!e->sleepers.load()) return;
+	{
+		std::lock_guard<std::mutex> lock(e->mutex);
+		e->generation++;
+	}
+	e->cond.notify_all();
+}
+
+static void crc_exec_part(crc_exec_t *e, crc_exec_task_t *task)
+{
+	crc_exec_split_t *s = task->split;
+	const size_t off = (size_t) task->part * CRC_EXEC_CHUNK;
+	const bool bits = crc_exec_bits(s->job.model);
+	size_t len = task->part == s->parts - 1 ? s->job.len - (bits ? off * 8 : off) : bits ? CRC_EXEC_CHUNK * 8 : CRC_EXEC_CHUNK;
+
+	s->crc[task->part] = crc_calc(s->job.model, s->job.data + off, len);
+	s->len[task->part] = len;
+	if (--s->left) return;
+
+	// the last part: combine in order
+	uint64_t crc = s->crc[0];
+	for (unsigned p = 1; p < s->parts; p++) crc = crc_combine(s->job.model, crc, s->crc[p], s->len[p]);
+	s->job.fn(s->job.ctx, crc);
+
+	delete[] s->crc;
+	delete[] s->len;
+	delete[] s->tasks;
+	delete s;
+	crc_exec_done(e, 1);
+}
+
+/** Splits the job of a task into parts, returns the first one (NULL: out of memory, run it whole) */
+static crc_exec_task_t *crc_exec_split(crc_exec_worker_t *w, crc_exec_task_t *task)
+{
+	const size_t bytes = crc_exec_bytes(&task->jobs[0]);
+	const unsigned parts = (bytes + CRC_EXEC_CHUNK - 1) / CRC_EXEC_CHUNK;
+
+	crc_exec_split_t *s = new (std::nothrow) crc_exec_split_t;
+	if (!s) return NULL;
+	s->crc = new (std::nothrow) uint64_t[parts];
+	s->len = new (std::nothrow) size_t[parts];
+	s->tasks = new (std::nothrow) crc_exec_task_t[parts];
+	if (!s->crc || !s->len || !s->tasks) {
+		delete[] s->crc;
+		delete[] s->len;
+		delete[] s->tasks;
+		delete s;
+		return NULL;
+	}
+	s->job = task->jobs[0];
+	s->parts = parts;
+	s->left = parts;
+	for (unsigned p = 0; p < parts; p++) s->tasks[p] = { NULL, 1, p, s };
+
+	delete[] task->jobs;
+	delete task;
+
+	// the last parts first: the owner pops them from the bottom, thieves take the first ones.
+	// The parts that do not fit into the deque go to the shared queue.
+	unsigned p = parts - 1;
+	while (p > 0 && crc_exec_push(&w->deque, &s->tasks[p])) p--;
+	if (p > 0) {
+		std::lock_guard<std::mutex> lock(w->exec->mutex);
+		for (unsigned q = 1; q <= p; q++) w->exec->queue.push_back(&s->tasks[q]);
+	}
+	crc_exec_wake(w->exec);
+	return &s->tasks[0];
+}
+
+static void crc_exec_run(crc_exec_worker_t *w, crc_exec_task_t *task)
+{
+	crc_exec_t *e = w->exec;
+
+	if (task->split) {
+		crc_exec_part(e, task);
+		return;
+	}
+	if (task->count == 1 && crc_exec_bytes(&task->jobs[0]) > 2 * CRC_EXEC_CHUNK) {
+		crc_exec_task_t *first = crc_exec_split(w, task);
+		if (first) {
+			crc_exec_part(e, first);
+			return;
+		}
+	}
+
+	for (unsigned i = 0; i < task->count; i++) {
+		const crc_exec_job_t *job = &task->jobs[i];
+		job->fn(job->ctx, crc_calc(job->model, job->data, job->len));
+	}
+	const unsigned count = task->count;
+	delete[] task->jobs;
+	delete task;
+	crc_exec_done(e, count);
+}
+
+// ================= WORKERS ===================
+
+/** Own deque, the shared queue, then the deques of the others */
+static crc_exec_task_t *crc_exec_take(crc_exec_worker_t *w)
+{
+	crc_exec_t *e = w->exec;
+	crc_exec_task_t *task = crc_exec_pop(&w->deque);
+	if (task) return task;
+
+	{
+		std::lock_guard<std::mutex> lock(e->mutex);
+		if (!e->queue.empty()) {
+			task = e->queue.front();
+			e->queue.pop_front();
+			return task;
+		}
+	}
+
+	for (unsigned i = 1; i < e->threads; i++) {
+		task = crc_exec_steal(&e->workers[(w->index + i) % e->threads].deque);
+		if (task) return task;
+	}
+	return NULL;
+}
+
+static void crc_exec_worker(crc_exec_worker_t *w)
+{
+	crc_exec_t *e = w->exec;
+	crc_exec_self = w;
+
+	for (;;) {
+		crc_exec_task_t *task = crc_exec_take(w);
+		if (task) {
+			crc_exec_run(w, task);
+			continue;
+		}
+
+		std::unique_lock<std::mutex> lock(e->mutex);
+		if (e->stop) break;
+		if (!e->queue.empty()) continue;
+
+		e->sleepers++;
+		bool empty = true;
+		for (unsigned i = 0; i < e->threads && empty; i++) empty = crc_exec_empty(&e->workers[i].deque);
+		if (empty) {
+			const unsigned gen = e->generation;
+			e->cond.wait(lock, [&] { return e->generation != gen || !e->queue.empty() || e->stop; });
+		}
+		e->sleepers--;
+	}
+	crc_exec_self = NULL;
+}
+
+/** A new task: into the deque of the worker that submits it, else into the shared queue */
+static void crc_exec_queue(crc_exec_t *e, crc_exec_task_t *task)
+{
+	crc_exec_worker_t *w = crc_exec_self;
+	if (w && w->exec == e && crc_exec_push(&w->deque, task)) {
+		crc_exec_wake(e);
+		return;
+	}
+	{
+		std::lock_guard<std::mutex> lock(e->mutex);
+		e->queue.push_back(task);
+	}
+	e->cond.notify_one();
+}
+
+/** A task of count jobs, copied */
+static int crc_exec_task(crc_exec_t *e, const crc_exec_job_t *jobs, unsigned count)
+{
+	crc_exec_task_t *task = new (std::nothrow) crc_exec_task_t;
+	crc_exec_job_t *copy = new (std::nothrow) crc_exec_job_t[count];
+	if (!task || !copy) {
+		delete task;
+		delete[] copy;
+		return ENOMEM;
+	}
+	for (unsigned i = 0; i < count; i++) copy[i] = jobs[i];
+	*task = { copy, count, 0, NULL };
+
+	e->pending += count;
+	crc_exec_queue(e, task);
+	return 0;
+}
+
+crc_exec_t *crc_exec_create(unsigned threads)
+{
+	if (!threads) threads = std::thread::hardware_concurrency();
+	if (!threads) threads = 1;
+
+	crc_exec_t *e = new (std::nothrow) crc_exec_t;
+	if (!e) return NULL;
+	e->workers = new (std::nothrow) crc_exec_worker_t[threads];
+	if (!e->workers) {
+		delete e;
+		return NULL;
+	}
+	e->threads = threads;
+	e->generation = 0;
+	e->stop = false;
+	e->sleepers = 0;
+	e->pending = 0;
+
+	for (unsigned i = 0; i < threads; i++) {
+		crc_exec_worker_t *w = &e->workers[i];
+		w->exec = e;
+		w->index = i;
+		w->deque.top = 0;
+		w->deque.bottom = 0;
+	}
+	for (unsigned i = 0; i < threads; i++) e->workers[i].thread = std::thread(crc_exec_worker, &e->workers[i]);
+	return e;
+}
+
+int crc_exec_submit(crc_exec_t *e, const crc_exec_job_t *job)
+{
+	if (job->model >= CRC_MODELS) return EINVAL;
+	if (crc_exec_bytes(job) <= CRC_EXEC_INLINE) {
+		job->fn(job->ctx, crc_calc(job->model, job->data, job->len));
+		return 0;
+	}
+	return crc_exec_task(e, job, 1);
+}
+
+int crc_exec_submit_batch(crc_exec_t *e, const crc_exec_job_t *jobs, size_t n)
+{
+	for (size_t i = 0; i < n; i++)
+		if (jobs[i].model >= CRC_MODELS) return EINVAL;
+
+	// runs of small jobs up to CRC_EXEC_BATCH bytes, large jobs alone
+	size_t first = 0, bytes = 0;
+	int err = 0;
+	for (size_t i = 0; i < n && !err; i++) {
+		const size_t b = crc_exec_bytes(&jobs[i]);
+		if (b > CRC_EXEC_BATCH / 2 || bytes + b > CRC_EXEC_BATCH) {
+			if (i > first) err = crc_exec_task(e, jobs + first, i - first);
+			first = i;
+			bytes = 0;
+		}
+		if (b > CRC_EXEC_BATCH / 2) {
+			if (!err) err = crc_exec_task(e, jobs + i, 1);
+			first = i + 1;
+			continue;
+		}
+		bytes += b;
+	}
+	if (!err && n > first) err = crc_exec_task(e, jobs + first, n - first);
+	return err;
+}
+
+void crc_exec_wait(crc_exec_t *e)
+{
+	std::unique_lock<std::mutex> lock(e->done_mutex);
+	e->done_cond.wait(lock, [&] { return e->pending.load() == 0; });
+}
+
+void crc_exec_destroy(crc_exec_t *e)
+{
+	if (!e) return;
+	crc_exec_wait(e);
+	{
+		std::lock_guard<std::mutex> lock(e->mutex);
+		e->stop = true;
+	}
+	e->cond.notify_all();
+	for (unsigned i = 0; i < e->threads; i++) e->workers[i].thread.join();
+	delete[] e->workers;
+	delete e;
+}
+
+#endif // CRC_EXEC
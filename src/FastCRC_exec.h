@@ -0,0 +1,63 @@
+/* FastCRC library code is placed under the MIT license
+ * Copyright (c) 2014 - 2021 Frank Bösing
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// Work-stealing executor for CRC jobs, see FastCRC_exec.cpp
+
+#if !defined(FastCRC_exec_h)
+#define FastCRC_exec_h
+
+#include "FastCRC.h"
+
+#if CRC_EXEC
+
+#if !defined(CRC_EXEC_INLINE)
+#define CRC_EXEC_INLINE 512			// smaller jobs run in crc_exec_submit()
+#endif
+#if !defined(CRC_EXEC_BATCH)
+#define CRC_EXEC_BATCH  (64u << 10)	// crc_exec_submit_batch(): small jobs are grouped up to this size
+#endif
+#if !defined(CRC_EXEC_CHUNK)
+#define CRC_EXEC_CHUNK  (256u << 10)	// larger jobs are split into chunks of this size
+#endif
+
+typedef void (*crc_exec_fn)(void *ctx, uint64_t crc);
+
+typedef struct {
+	unsigned model;			// CRC_MODEL_xxx
+	const uint8_t *data;	// valid until fn is called
+	size_t len;				// in bits for the CAN models
+	crc_exec_fn fn;			// called once with the CRC, by a worker or in crc_exec_submit()
+	void *ctx;				// passed to fn
+} crc_exec_job_t;
+
+typedef struct crc_exec crc_exec_t;
+
+crc_exec_t *crc_exec_create(unsigned threads);	// 0: one per CPU, NULL: out of memory
+int crc_exec_submit(crc_exec_t *e, const crc_exec_job_t *job);	// 0 or EINVAL (model), ENOMEM
+int crc_exec_submit_batch(crc_exec_t *e, const crc_exec_job_t *jobs, size_t n);	// the same for n jobs
+void crc_exec_wait(crc_exec_t *e);			// until all jobs submitted so far are done
+void crc_exec_destroy(crc_exec_t *e);		// waits for all jobs
+
+#endif // CRC_EXEC
+#endif // FastCRC_exec_h
@@ -0,0 +1,638 @@
+/* FastCRC library code is placed under the MIT license
+ * Copyright (c) 2014 - 2021 Frank Bösing
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+//
+// File checksums (CRC_FILE)
+//
+// Regular files are mapped in windows of CRC_FILE_WINDOW bytes, so the data
+// is read by the page cache directly into the CRC kernels, without a copy.
+// Files up to CRC_FILE_SMALL bytes are read with pread(), that is cheaper.
+// The window is marked MADV_SEQUENTIAL (early readahead, pages are dropped
+// behind), the next chunk is requested with MADV_WILLNEED while the current
+// one is calculated and the next window with POSIX_FADV_WILLNEED.
+// Pipes, sockets and ttys cannot be mapped (and pread() fails with ESPIPE
+// on them), they are read() into a buffer; so are regular files if mmap()
+// fails, with pread().
+// A file that is truncated by another process while it is mapped raises
+// SIGBUS, like with every mmap reader.
+//
+
+#if defined(ARDUINO)
+#include <Arduino.h>
+#endif
+
+#include "FastCRC.h"
+
+#if CRC_FILE
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#if !defined(O_CLOEXEC)
+#define O_CLOEXEC 0
+#endif
+
+#define CRC_FILE_WINDOW (64u << 20)	// mapped at once
+#define CRC_FILE_CHUNK  (2u << 20)	// calculated at once, the next one is prefetched
+#define CRC_FILE_BUFFER (256u << 10)	// read() buffer
+#define CRC_FILE_SMALL  (64u << 10)		// files up to this size are read, not mapped
+
+/** read() loop, for everything that is not a regular file
+ * @param fd File descriptor
+ * @param fn Called for every chunk
+ * @param ctx Passed to fn
+ * @return 0 or errno
+ */
+static int crc_file_stream(int fd, crc_file_fn fn, void *ctx)
+{
+	uint8_t *buf = (uint8_t *) malloc(CRC_FILE_BUFFER);
+	if (!buf) return ENOMEM;
+
+	int err = 0;
+	for (;;) {
+		ssize_t n = read(fd, buf, CRC_FILE_BUFFER);
+		if (n > 0) fn(ctx, buf, n);
+		else if (n == 0) break;
+		else if (errno != EINTR) {
+			err = errno;
+			break;
+		}
+	}
+	free(buf);
+	return err;
+}
+
+/** pread() loop from off to end, if the file cannot be mapped or is small
+ * @param pos Offset behind the last byte read
+ * @param buf NULL: allocates CRC_FILE_BUFFER bytes
+ * @return 0 or errno
+ */
+static int crc_file_pread(int fd, off_t off, off_t end, crc_file_fn fn, void *ctx, off_t *pos, uint8_t *buf = NULL, size_t size = CRC_FILE_BUFFER)
+{
+	uint8_t *mem = NULL;
+	if (!buf) {
+		buf = mem = (uint8_t *) malloc(size);
+		if (!buf) return ENOMEM;
+	}
+
+	int err = 0;
+	while (off < end) {
+		size_t len = end - off < (off_t) size ? end - off : size;
+		ssize_t n = pread(fd, buf, len, off);
+		if (n > 0) {
+			fn(ctx, buf, n);
+			off += n;
+		}
+		else if (n == 0) break;		// truncated meanwhile
+		else if (errno != EINTR) {
+			err = errno;
+			break;
+		}
+	}
+	free(mem);
+	*pos = off;
+	return err;
+}
+
+/** off to end of a regular file, mapped or read, the file offset is not used
+ * @param pos Offset behind the last byte passed to fn
+ * @return 0 or errno
+ */
+static int crc_file_map(int fd, off_t off, off_t end, crc_file_fn fn, void *ctx, off_t *pos)
+{
+	// mmap() and munmap() cost more than the copy (many small files), the buffer is
+	// not on the stack: the pools of sfv and exec and coroutines have small stacks
+	if (end - off <= (off_t) CRC_FILE_SMALL) return crc_file_pread(fd, off, end, fn, ctx, pos, NULL, end - off);
+
+	const uintptr_t page = sysconf(_SC_PAGESIZE);
+
+	while (off < end) {
+		const off_t base = off & ~(off_t)(page - 1);
+		const size_t len = end - base < (off_t) CRC_FILE_WINDOW ? end - base : CRC_FILE_WINDOW;
+
+		uint8_t *map = (uint8_t *) mmap(NULL, len, PROT_READ, MAP_PRIVATE, fd, base);
+		if (map == MAP_FAILED) return crc_file_pread(fd, off, end, fn, ctx, pos);
+
+		madvise(map, len, MADV_SEQUENTIAL);
+#if defined(POSIX_FADV_WILLNEED)
+		if (base + (off_t) len < end) posix_fadvise(fd, base + len, end - base - len < (off_t) CRC_FILE_WINDOW ? end - base - len : CRC_FILE_WINDOW, POSIX_FADV_WILLNEED);
+#endif
+
+		const uint8_t *p = map + (off - base);
+		const uint8_t *e = map + len;
+		while (p < e) {
+			size_t n = (size_t)(e - p) < CRC_FILE_CHUNK ? e - p : CRC_FILE_CHUNK;
+			if (p + n < e) {
+				uint8_t *next = (uint8_t *)((uintptr_t)(p + n) & ~(page - 1));
+				madvise(next, e - next < (ptrdiff_t) CRC_FILE_CHUNK ? e - next : CRC_FILE_CHUNK, MADV_WILLNEED);
+			}
+			fn(ctx, p, n);
+			p += n;
+		}
+
+		munmap(map, len);
+		off = base + len;
+	}
+
+	*pos = off;
+	return 0;
+}
+
+int crc_file_read(int fd, crc_file_fn fn, void *ctx)
+{
+	struct stat st;
+	if (fstat(fd, &st) < 0) return errno;
+
+	// st_size is 0 for the files in /proc and /sys, they have to be read
+	if (!S_ISREG(st.st_mode) || st.st_size == 0) return crc_file_stream(fd, fn, ctx);
+
+	off_t off = lseek(fd, 0, SEEK_CUR);
+	if (off < 0) return crc_file_stream(fd, fn, ctx);
+	if (off >= st.st_size) return 0;
+
+	int err = crc_file_map(fd, off, st.st_size, fn, ctx, &off);
+	if (lseek(fd, off, SEEK_SET) < 0 && !err) err = errno;
+	return err;
+}
+
+int crc_file_range(int fd, uint64_t off, uint64_t len, crc_file_fn fn, void *ctx)
+{
+	struct stat st;
+	if (fstat(fd, &st) < 0) return errno;
+	if (!S_ISREG(st.st_mode)) return ESPIPE;
+
+	// beyond the end of the file the mapping would raise SIGBUS
+	if (off >= (uint64_t) st.st_size) return 0;
+	if (len > st.st_size - off) len = st.st_size - off;
+
+	off_t pos;
+	return crc_file_map(fd, off, off + len, fn, ctx, &pos);
+}
+
+
+// ================= ASYNC ===================
+//
+// crc_file_async(): CRC_FILE_DEPTH reads of CRC_FILE_BLOCK bytes are in flight,
+// the blocks are passed to fn in file order as soon as they are complete and
+// are submitted again for the next offset right after. So the device reads
+// while the CPU calculates. Linux: io_uring (raw syscalls, no liburing),
+// elsewhere, if io_uring is not permitted or if $FASTCRC_NO_URING is set:
+// a reader thread with pread().
+//
+
+#if !defined(CRC_FILE_DEPTH)
+#define CRC_FILE_DEPTH 4				// blocks in flight
+#endif
+#define CRC_FILE_BLOCK  (1u << 20)		// bytes per read
+
+typedef struct {
+	uint8_t *buf;
+	off_t off;		// file offset of buf[0]
+	size_t len;		// requested
+	size_t got;		// read so far
+	int state;		// CRC_FILE_FREE, _BUSY, _DONE
+	int err;
+} crc_file_block_t;
+
+#define CRC_FILE_FREE 0
+#define CRC_FILE_BUSY 1
+#define CRC_FILE_DONE 2
+
+/** Page aligned buffers of CRC_FILE_BLOCK bytes
+ * @return false: out of memory
+ */
+static bool crc_file_blocks(crc_file_block_t *b, unsigned n)
+{
+	memset(b, 0, n * sizeof(*b));
+	for (unsigned i = 0; i < n; i++) {
+		void *p;
+		if (posix_memalign(&p, 4096, CRC_FILE_BLOCK)) {
+			while (i) free(b[--i].buf);
+			return false;
+		}
+		b[i].buf = (uint8_t *) p;
+	}
+	return true;
+}
+
+static void crc_file_blocks_free(crc_file_block_t *b, unsigned n)
+{
+	for (unsigned i = 0; i < n; i++) free(b[i].buf);
+}
+
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#include <sys/syscall.h>
+#if defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter)
+#define CRC_FILE_URING 1
+#endif
+#endif
+#endif
+
+#if defined(CRC_FILE_URING)
+
+typedef struct {
+	int fd;
+	void *sq_map, *cq_map;
+	size_t sq_size, cq_size;
+	struct io_uring_sqe *sqes;
+	size_t sqes_size;
+	unsigned *sq_tail, *sq_mask, *sq_array;
+	unsigned *cq_head, *cq_tail, *cq_mask;
+	struct io_uring_cqe *cqes;
+	unsigned pending;		// prepared, not yet submitted
+	struct iovec iov[CRC_FILE_DEPTH];
+} crc_uring_t;
+
+static void crc_uring_exit(crc_uring_t *r)
+{
+	if (r->sqes) munmap(r->sqes, r->sqes_size);
+	if (r->cq_map && r->cq_map != r->sq_map) munmap(r->cq_map, r->cq_size);
+	if (r->sq_map) munmap(r->sq_map, r->sq_size);
+	close(r->fd);
+}
+
+/** io_uring with CRC_FILE_DEPTH entries
+ * @return false: not available (old kernel, seccomp, RLIMIT_MEMLOCK), use the thread
+ */
+static bool crc_uring_init(crc_uring_t *r)
+{
+	struct io_uring_params p;
+	memset(r, 0, sizeof(*r));
+	memset(&p, 0, sizeof(p));
+	r->fd = syscall(__NR_io_uring_setup, CRC_FILE_DEPTH, &p);
+	if (r->fd < 0) return false;
+
+	r->sq_size = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+	r->cq_size = p.cq_off.cqes + p.cq_entries * sizeof(struct io_uring_cqe);
+	if (p.features & IORING_FEAT_SINGLE_MMAP) {
+		if (r->cq_size > r->sq_size) r->sq_size = r->cq_size;
+		r->cq_size = r->sq_size;
+	}
+	r->sq_map = mmap(NULL, r->sq_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, r->fd, IORING_OFF_SQ_RING);
+	if (r->sq_map == MAP_FAILED) {
+		r->sq_map = NULL;
+		crc_uring_exit(r);
+		return false;
+	}
+	if (p.features & IORING_FEAT_SINGLE_MMAP) r->cq_map = r->sq_map;
+	else {
+		r->cq_map = mmap(NULL, r->cq_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, r->fd, IORING_OFF_CQ_RING);
+		if (r->cq_map == MAP_FAILED) {
+			r->cq_map = NULL;
+			crc_uring_exit(r);
+			return false;
+		}
+	}
+	r->sqes_size = p.sq_entries * sizeof(struct io_uring_sqe);
+	r->sqes = (struct io_uring_sqe *) mmap(NULL, r->sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, r->fd, IORING_OFF_SQES);
+	if (r->sqes == MAP_FAILED) {
+		r->sqes = NULL;
+		crc_uring_exit(r);
+		return false;
+	}
+
+	uint8_t *sq = (uint8_t *) r->sq_map, *cq = (uint8_t *) r->cq_map;
+	r->sq_tail = (unsigned *)(sq + p.sq_off.tail);
+	r->sq_mask = (unsigned *)(sq + p.sq_off.ring_mask);
+	r->sq_array = (unsigned *)(sq + p.sq_off.array);
+	r->cq_head = (unsigned *)(cq + p.cq_off.head);
+	r->cq_tail = (unsigned *)(cq + p.cq_off.tail);
+	r->cq_mask = (unsigned *)(cq + p.cq_off.ring_mask);
+	r->cqes = (struct io_uring_cqe *)(cq + p.cq_off.cqes);
+	return true;
+}
+
+/** Queue a read of the rest of block i (submitted with the next crc_uring_enter()) */
+static void crc_uring_read(crc_uring_t *r, int fd, crc_file_block_t *b, unsigned i)
+{
+	// single producer: only the kernel reads the tail
+	const unsigned tail = *r->sq_tail;
+	const unsigned idx = tail & *r->sq_mask;
+	struct io_uring_sqe *sqe = &r->sqes[idx];
+
+	r->iov[i].iov_base = b[i].buf + b[i].got;
+	r->iov[i].iov_len = b[i].len - b[i].got;
+	memset(sqe, 0, sizeof(*sqe));
+	sqe->opcode = IORING_OP_READV;		// 5.1, IORING_OP_READ needs 5.6
+	sqe->fd = fd;
+	sqe->off = b[i].off + b[i].got;
+	sqe->addr = (uintptr_t) &r->iov[i];
+	sqe->len = 1;
+	sqe->user_data = i;
+	r->sq_array[idx] = idx;
+	__atomic_store_n(r->sq_tail, tail + 1, __ATOMIC_RELEASE);
+	r->pending++;
+	b[i].state = CRC_FILE_BUSY;
+}
+
+/** Submit the queued reads and wait for at least one completion
+ * @return 0 or errno
+ */
+static int crc_uring_enter(crc_uring_t *r)
+{
+	for (;;) {
+		int n = syscall(__NR_io_uring_enter, r->fd, r->pending, 1, IORING_ENTER_GETEVENTS, NULL, 0);
+		if (n >= 0) {
+			r->pending -= n;
+			return 0;
+		}
+		if (errno != EINTR && errno != EAGAIN && errno != EBUSY) return errno;
+	}
+}
+
+/** Collect the completions, short reads are continued
+ * @param drain Only wait for the reads in flight, submit nothing new
+ */
+static void crc_uring_reap(crc_uring_t *r, int fd, crc_file_block_t *b, bool drain)
+{
+	unsigned h = *r->cq_head;
+	const unsigned t = __atomic_load_n(r->cq_tail, __ATOMIC_ACQUIRE);
+	for (; h != t; h++) {
+		const struct io_uring_cqe *cqe = &r->cqes[h & *r->cq_mask];
+		const unsigned i = cqe->user_data;
+		crc_file_block_t *c = &b[i];
+		if (cqe->res > 0) {
+			c->got += cqe->res;
+			if (c->got < c->len && !drain) crc_uring_read(r, fd, b, i);	// short read
+			else c->state = CRC_FILE_DONE;
+		}
+		else if (cqe->res == 0) c->state = CRC_FILE_DONE;	// truncated meanwhile
+		else if ((cqe->res == -EINTR || cqe->res == -EAGAIN) && !drain) crc_uring_read(r, fd, b, i);
+		else {
+			c->err = -cqe->res;
+			c->state = CRC_FILE_DONE;
+		}
+	}
+	__atomic_store_n(r->cq_head, h, __ATOMIC_RELEASE);
+}
+
+static int crc_file_uring(crc_uring_t *r, int fd, off_t off, off_t end, crc_file_fn fn, void *ctx)
+{
+	crc_file_block_t b[CRC_FILE_DEPTH];
+	if (!crc_file_blocks(b, CRC_FILE_DEPTH)) {
+		crc_uring_exit(r);
+		return ENOMEM;
+	}
+
+	off_t next = off;	// offset of the next block to submit
+	unsigned head = 0;	// the block to pass to fn next
+	int err = 0;
+
+	for (unsigned i = 0; i < CRC_FILE_DEPTH && next < end; i++) {
+		b[i].off = next;
+		b[i].len = end - next < (off_t) CRC_FILE_BLOCK ? end - next : CRC_FILE_BLOCK;
+		next += b[i].len;
+		crc_uring_read(r, fd, b, i);
+	}
+
+	while (b[head].state != CRC_FILE_FREE) {
+		if (b[head].state == CRC_FILE_BUSY) {
+			if ((err = crc_uring_enter(r))) break;
+			crc_uring_reap(r, fd, b, false);
+			continue;
+		}
+
+		// in order: head is complete
+		crc_file_block_t *c = &b[head];
+		if (c->err) {
+			err = c->err;
+			break;
+		}
+		if (c->got) fn(ctx, c->buf, c->got);
+		off = c->off + c->got;
+		if (c->got < c->len) break;			// end of a truncated file
+
+		c->state = CRC_FILE_FREE;
+		if (next < end) {
+			c->off = next;
+			c->len = end - next < (off_t) CRC_FILE_BLOCK ? end - next : CRC_FILE_BLOCK;
+			c->got = 0;
+			next += c->len;
+			crc_uring_read(r, fd, b, head);
+		}
+		head = (head + 1) % CRC_FILE_DEPTH;
+	}
+
+	// after an error the kernel may still write into b[]
+	bool busy = true;
+	while (busy) {
+		busy = false;
+		for (unsigned i = 0; i < CRC_FILE_DEPTH; i++) busy |= b[i].state == CRC_FILE_BUSY;
+		if (busy && crc_uring_enter(r)) break;
+		crc_uring_reap(r, fd, b, true);
+	}
+
+	crc_uring_exit(r);
+	if (!busy) crc_file_blocks_free(b, CRC_FILE_DEPTH);	// else leaked, rather than freed under a read
+	if (lseek(fd, off, SEEK_SET) < 0 && !err) err = errno;
+	return err;
+}
+
+#endif // CRC_FILE_URING
+
+/** A thread reads the blocks with pread(), the caller calculates them */
+static int crc_file_thread(int fd, off_t off, off_t end, crc_file_fn fn, void *ctx)
+{
+	crc_file_block_t b[CRC_FILE_DEPTH];
+	if (!crc_file_blocks(b, CRC_FILE_DEPTH)) return ENOMEM;
+
+	std::mutex mutex;
+	std::condition_variable cond;
+	bool stop = false;
+
+	std::thread reader([&] {
+		off_t next = off;
+		for (unsigned i = 0; next < end; i = (i + 1) % CRC_FILE_DEPTH) {
+			crc_file_block_t *c = &b[i];
+			{
+				std::unique_lock<std::mutex> lock(mutex);
+				cond.wait(lock, [&] { return c->state == CRC_FILE_FREE || stop; });
+				if (stop) return;
+				c->state = CRC_FILE_BUSY;
+			}
+			c->off = next;
+			c->len = end - next < (off_t) CRC_FILE_BLOCK ? end - next : CRC_FILE_BLOCK;
+			c->got = 0;
+			c->err = 0;
+			while (c->got < c->len) {
+				ssize_t n = pread(fd, c->buf + c->got, c->len - c->got, c->off + c->got);
+				if (n > 0) c->got += n;
+				else if (n == 0) break;
+				else if (errno != EINTR) {
+					c->err = errno;
+					break;
+				}
+			}
+			next += c->len;
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+				c->state = CRC_FILE_DONE;
+			}
+			cond.notify_all();
+			if (c->err || c->got < c->len) return;
+		}
+	});
+
+	int err = 0;
+	for (unsigned head = 0; off < end; head = (head + 1) % CRC_FILE_DEPTH) {
+		crc_file_block_t *c = &b[head];
+		{
+			std::unique_lock<std::mutex> lock(mutex);
+			cond.wait(lock, [&] { return c->state == CRC_FILE_DONE; });
+		}
+		if (c->err) {
+			err = c->err;
+			break;
+		}
+		if (c->got) fn(ctx, c->buf, c->got);
+		off = c->off + c->got;
+		if (c->got < c->len) break;
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			c->state = CRC_FILE_FREE;
+		}
+		cond.notify_all();
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		stop = true;
+	}
+	cond.notify_all();
+	reader.join();
+	crc_file_blocks_free(b, CRC_FILE_DEPTH);
+	if (lseek(fd, off, SEEK_SET) < 0 && !err) err = errno;
+	return err;
+}
+
+int crc_file_async(int fd, crc_file_fn fn, void *ctx)
+{
+	struct stat st;
+	if (fstat(fd, &st) < 0) return errno;
+	if (!S_ISREG(st.st_mode) || st.st_size == 0) return crc_file_stream(fd, fn, ctx);
+
+	const off_t off = lseek(fd, 0, SEEK_CUR);
+	if (off < 0) return crc_file_stream(fd, fn, ctx);
+	if (off >= st.st_size) return 0;
+
+#if defined(CRC_FILE_URING)
+	const char *no_uring = getenv("FASTCRC_NO_URING");
+	crc_uring_t r;
+	if ((!no_uring || !*no_uring) && crc_uring_init(&r)) return crc_file_uring(&r, fd, off, st.st_size, fn, ctx);
+#endif
+	return crc_file_thread(fd, off, st.st_size, fn, ctx);
+}
+
+
+// ================= MODELS ===================
+
+template <class C, typename T> struct crc_file_ctx {
+	C *crc;
+	T value;
+};
+
+/** <name>_fd() and <name>_file() of a model
+ * bits: 8 for the models with the length in bits (can15, canfd17, canfd21)
+ */
+#define CRC_FILE_MODEL(C, T, name, bits) \
+static void name##_chunk(void *ctx, const uint8_t *data, size_t len) \
+{ \
+	crc_file_ctx<C, T> *c = (crc_file_ctx<C, T> *) ctx; \
+	c->value = c->crc->name##_upd(data, len * bits); \
+} \
+\
+T C::name##_fd(int fd, int *error) \
+{ \
+	crc_file_ctx<C, T> c = { this, name(NULL, 0) }; \
+	int err = crc_file_read(fd, name##_chunk, &c); \
+	if (error) *error = err; \
+	return c.value; \
+} \
+\
+T C::name##_file(const char *path, int *error) \
+{ \
+	int fd; \
+	do fd = open(path, O_RDONLY | O_CLOEXEC); while (fd < 0 && errno == EINTR); \
+	if (fd < 0) { \
+		if (error) *error = errno; \
+		return 0; \
+	} \
+	T crc = name##_fd(fd, error); \
+	close(fd); \
+	return crc; \
+}
+
+CRC_FILE_MODEL(FastCRC7, uint8_t, crc7, 1)
+
+CRC_FILE_MODEL(FastCRC8, uint8_t, smbus, 1)
+CRC_FILE_MODEL(FastCRC8, uint8_t, maxim, 1)
+
+CRC_FILE_MODEL(FastCRC16, uint16_t, ccitt, 1)
+CRC_FILE_MODEL(FastCRC16, uint16_t, mcrf4xx, 1)
+CRC_FILE_MODEL(FastCRC16, uint16_t, kermit, 1)
+CRC_FILE_MODEL(FastCRC16, uint16_t, modbus, 1)
+CRC_FILE_MODEL(FastCRC16, uint16_t, xmodem, 1)
+CRC_FILE_MODEL(FastCRC16, uint16_t, x25, 1)
+CRC_FILE_MODEL(FastCRC16, uint16_t, can15, 8)
+
+CRC_FILE_MODEL(FastCRC32, uint32_t, crc32, 1)
+CRC_FILE_MODEL(FastCRC32, uint32_t, cksum, 1)
+CRC_FILE_MODEL(FastCRC32, uint32_t, mpeg2, 1)
+CRC_FILE_MODEL(FastCRC32, uint32_t, bzip2, 1)
+CRC_FILE_MODEL(FastCRC32, uint32_t, canfd17, 8)
+CRC_FILE_MODEL(FastCRC32, uint32_t, canfd21, 8)
+
+#define CRC_FILE_ASYNC(C, T, name) \
+T C::name##_async(int fd, int *error) \
+{ \
+	crc_file_ctx<C, T> c = { this, name(NULL, 0) }; \
+	int err = crc_file_async(fd, name##_chunk, &c); \
+	if (error) *error = err; \
+	return c.value; \
+}
+
+CRC_FILE_ASYNC(FastCRC32, uint32_t, crc32)
+CRC_FILE_ASYNC(FastCRC32, uint32_t, cksum)
+
+#if CRC_SW
+CRC_FILE_MODEL(FastCRC64, uint64_t, ecma182, 1)
+CRC_FILE_MODEL(FastCRC64, uint64_t, xz, 1)
+CRC_FILE_MODEL(FastCRC64, uint64_t, goiso, 1)
+CRC_FILE_MODEL(FastCRC64, uint64_t, nvme, 1)
+#endif
+
+#endif // CRC_FILE
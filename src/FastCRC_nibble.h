@@ -0,0 +1,110 @@
+/* FastCRC library code is placed under the MIT license
+ * Copyright (c) 2014 - 2021 Frank Bösing
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+//
+// Nibble tables (CRC_NIBBLE): the byte table T of a model is linear, so
+// T[x] = T[x & 0x0f] ^ T[x & 0xf0]. Two 16-entry tables per model replace the
+// 256 (1024) entries: lo[i] = T[i], hi[i] = T[i << 4], stored as lo, then hi.
+// Non-reflected models keep the byteswapped entries of FastCRC_tables.h.
+//
+
+#if !defined(FastCRC_nibble)
+#define FastCRC_nibble
+#include <inttypes.h>
+
+// ================= 7-BIT CRC ===================
+const uint8_t crc_nibble_crc7[32] PROGMEM = {
+	0x00, 0x12, 0x24, 0x36, 0x48, 0x5a, 0x6c, 0x7e,
+	0x90, 0x82, 0xb4, 0xa6, 0xd8, 0xca, 0xfc, 0xee,
+	0x00, 0x32, 0x64, 0x56, 0xc8, 0xfa, 0xac, 0x9e,
+	0x82, 0xb0, 0xe6, 0xd4, 0x4a, 0x78, 0x2e, 0x1c
+};
+
+// ================= 8-BIT CRC ===================
+const uint8_t crc_nibble_smbus[32] PROGMEM = {
+	0x00, 0x07, 0x0e, 0x09, 0x1c, 0x1b, 0x12, 0x15,
+	0x38, 0x3f, 0x36, 0x31, 0x24, 0x23, 0x2a, 0x2d,
+	0x00, 0x70, 0xe0, 0x90, 0xc7, 0xb7, 0x27, 0x57,
+	0x89, 0xf9, 0x69, 0x19, 0x4e, 0x3e, 0xae, 0xde
+};
+const uint8_t crc_nibble_maxim[32] PROGMEM = {
+	0x00, 0x5e, 0xbc, 0xe2, 0x61, 0x3f, 0xdd, 0x83,
+	0xc2, 0x9c, 0x7e, 0x20, 0xa3, 0xfd, 0x1f, 0x41,
+	0x00, 0x9d, 0x23, 0xbe, 0x46, 0xdb, 0x65, 0xf8,
+	0x8c, 0x11, 0xaf, 0x32, 0xca, 0x57, 0xe9, 0x74
+};
+
+// ================= 16-BIT CRC ===================
+const uint16_t crc_nibble_ccitt[32] PROGMEM = { // ccitt, xmodem
+	0x0000, 0x2110, 0x4220, 0x6330, 0x8440, 0xa550, 0xc660, 0xe770,
+	0x0881, 0x2991, 0x4aa1, 0x6bb1, 0x8cc1, 0xadd1, 0xcee1, 0xeff1,
+	0x0000, 0x3112, 0x6224, 0x5336, 0xc448, 0xf55a, 0xa66c, 0x977e,
+	0x8891, 0xb983, 0xeab5, 0xdba7, 0x4cd9, 0x7dcb, 0x2efd, 0x1fef
+};
+const uint16_t crc_nibble_kermit[32] PROGMEM = { // kermit, mcrf4xx, x25
+	0x0000, 0x1189, 0x2312, 0x329b, 0x4624, 0x57ad, 0x6536, 0x74bf,
+	0x8c48, 0x9dc1, 0xaf5a, 0xbed3, 0xca6c, 0xdbe5, 0xe97e, 0xf8f7,
+	0x0000, 0x1081, 0x2102, 0x3183, 0x4204, 0x5285, 0x6306, 0x7387,
+	0x8408, 0x9489, 0xa50a, 0xb58b, 0xc60c, 0xd68d, 0xe70e, 0xf78f
+};
+const uint16_t crc_nibble_modbus[32] PROGMEM = {
+	0x0000, 0xc0c1, 0xc181, 0x0140, 0xc301, 0x03c0, 0x0280, 0xc241,
+	0xc601, 0x06c0, 0x0780, 0xc741, 0x0500, 0xc5c1, 0xc481, 0x0440,
+	0x0000, 0xcc01, 0xd801, 0x1400, 0xf001, 0x3c00, 0x2800, 0xe401,
+	0xa001, 0x6c00, 0x7800, 0xb401, 0x5000, 0x9c01, 0x8801, 0x4400
+};
+const uint16_t crc_nibble_can15[32] PROGMEM = {
+	0x0000, 0x328b, 0x569d, 0x6416, 0x9eb1, 0xac3a, 0xc82c, 0xfaa7,
+	0x0ee8, 0x3c63, 0x5875, 0x6afe, 0x9059, 0xa2d2, 0xc6c4, 0xf44f,
+	0x0000, 0x2e5b, 0x5cb6, 0x72ed, 0x8ae7, 0xa4bc, 0xd651, 0xf80a,
+	0x2644, 0x081f, 0x7af2, 0x54a9, 0xaca3, 0x82f8, 0xf015, 0xde4e
+};
+
+// ================= 32-BIT CRC ===================
+const uint32_t crc_nibble_crc32[32] PROGMEM = {
+	0x00000000, 0x77073096, 0xee0e612c, 0x990951ba, 0x076dc419, 0x706af48f, 0xe963a535, 0x9e6495a3,
+	0x0edb8832, 0x79dcb8a4, 0xe0d5e91e, 0x97d2d988, 0x09b64c2b, 0x7eb17cbd, 0xe7b82d07, 0x90bf1d91,
+	0x00000000, 0x1db71064, 0x3b6e20c8, 0x26d930ac, 0x76dc4190, 0x6b6b51f4, 0x4db26158, 0x5005713c,
+	0xedb88320, 0xf00f9344, 0xd6d6a3e8, 0xcb61b38c, 0x9b64c2b0, 0x86d3d2d4, 0xa00ae278, 0xbdbdf21c
+};
+const uint32_t crc_nibble_cksum[32] PROGMEM = { // cksum, mpeg2, bzip2
+	0x00000000, 0xb71dc104, 0x6e3b8209, 0xd926430d, 0xdc760413, 0x6b6bc517, 0xb24d861a, 0x0550471e,
+	0xb8ed0826, 0x0ff0c922, 0xd6d68a2f, 0x61cb4b2b, 0x649b0c35, 0xd386cd31, 0x0aa08e3c, 0xbdbd4f38,
+	0x00000000, 0x70db114c, 0xe0b62398, 0x906d32d4, 0x77708634, 0x07ab9778, 0x97c6a5ac, 0xe71db4e0,
+	0xeee00c69, 0x9e3b1d25, 0x0e562ff1, 0x7e8d3ebd, 0x99908a5d, 0xe94b9b11, 0x7926a9c5, 0x09fdb889
+};
+const uint32_t crc_nibble_canfd17[32] PROGMEM = {
+	0x00000000, 0x00802db4, 0x008076dc, 0x00005b68, 0x0080c00c, 0x0000edb8, 0x0000b6d0, 0x00809b64,
+	0x00008119, 0x0080acad, 0x0080f7c5, 0x0000da71, 0x00804115, 0x00006ca1, 0x000037c9, 0x00801a7d,
+	0x00000000, 0x00000233, 0x00000466, 0x00000655, 0x000008cc, 0x00000aff, 0x00000caa, 0x00000e99,
+	0x00803d2c, 0x00803f1f, 0x0080394a, 0x00803b79, 0x008035e0, 0x008037d3, 0x00803186, 0x008033b5
+};
+const uint32_t crc_nibble_canfd21[32] PROGMEM = {
+	0x00000000, 0x00c84481, 0x0058cd83, 0x00908902, 0x0078de86, 0x00b09a07, 0x00201305, 0x00e85784,
+	0x0038f88c, 0x00f0bc0d, 0x0060350f, 0x00a8718e, 0x0040260a, 0x0088628b, 0x0018eb89, 0x00d0af08,
+	0x00000000, 0x00b8b498, 0x00b82db0, 0x00009928, 0x00b81fe1, 0x0000ab79, 0x00003251, 0x00b886c9,
+	0x00b87b43, 0x0000cfdb, 0x000056f3, 0x00b8e26b, 0x000064a2, 0x00b8d03a, 0x00b84912, 0x0000fd8a
+};
+
+#endif
@@ -0,0 +1,349 @@
+/* FastCRC library code is placed under the MIT license
+ * Copyright (c) 2014 - 2021 Frank Bösing
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+//
+// perf_event instrumentation (CRC_PERF, Linux)
+//
+// Every thread opens a counter group (cycles, instructions, L1D read misses,
+// user space only) on its first CRC. The counters are read with rdpmc if the
+// kernel allows it, else with one read() of the group. Without a PMU (VMs,
+// perf_event_paranoid) the calls are timed in rdtsc ticks (x86) or nanoseconds,
+// these are added to separate counters, never to the cycles.
+// The results are added per model and per size bucket, the report is
+// written at exit.
+//
+
+#if defined(ARDUINO)
+#include <Arduino.h>
+#endif
+
+#include "FastCRC.h"
+#include "FastCRC_perf.h"
+
+#if CRC_PERF
+
+#if !defined(__linux__)
+#error "CRC_PERF needs Linux (perf_event_open)"
+#endif
+
+#include <linux/perf_event.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define CRC_PERF_RDTSC 1
+#else
+#define CRC_PERF_RDTSC 0
+#endif
+
+#define CRC_PERF_COUNTERS 3
+
+static crc_perf_counter_t crc_perf[CRC_MODELS][CRC_PERF_BUCKETS];
+static bool crc_perf_pmu = true;	// all threads got the PMU counters (__atomic)
+
+typedef struct crc_perf_thread {
+	int fd[CRC_PERF_COUNTERS];
+	struct perf_event_mmap_page *pc[CRC_PERF_COUNTERS];
+	int state;						// 0: not opened, 1: PMU, 2: no PMU
+
+	crc_perf_thread() : state(0) {}
+	~crc_perf_thread()
+	{
+		if (state != 1) return;
+		for (int i = 0; i < CRC_PERF_COUNTERS; i++) {
+			if (pc[i]) munmap(pc[i], sysconf(_SC_PAGESIZE));
+			close(fd[i]);
+		}
+	}
+} crc_perf_thread_t;
+
+static thread_local crc_perf_thread_t crc_perf_thread;
+
+static void crc_perf_atexit(void)
+{
+	const char *path = getenv("FASTCRC_PERF_DUMP");
+	int fd = 2;
+	if (path && *path) fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	if (fd < 0) return;
+	crc_perf_dump(fd);
+	if (fd != 2) close(fd);
+}
+
+static int crc_perf_open(uint32_t type, uint64_t config, int group)
+{
+	struct perf_event_attr attr;
+	memset(&attr, 0, sizeof(attr));
+	attr.size = sizeof(attr);
+	attr.type = type;
+	attr.config = config;
+	attr.exclude_kernel = 1;
+	attr.exclude_hv = 1;
+	attr.read_format = PERF_FORMAT_GROUP;
+	return syscall(SYS_perf_event_open, &attr, 0, -1, group, PERF_FLAG_FD_CLOEXEC);
+}
+
+static void crc_perf_init(crc_perf_thread_t *t)
+{
+	static const uint64_t config[CRC_PERF_COUNTERS] = {
+		PERF_COUNT_HW_CPU_CYCLES,
+		PERF_COUNT_HW_INSTRUCTIONS,
+		PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)
+	};
+	static bool registered = false;
+	int i;
+
+	if (!__atomic_exchange_n(&registered, true, __ATOMIC_ACQ_REL)) atexit(crc_perf_atexit);
+
+	t->state = 2;
+	for (i = 0; i < CRC_PERF_COUNTERS; i++) {
+		t->fd[i] = crc_perf_open(i == 2 ? PERF_TYPE_HW_CACHE : PERF_TYPE_HARDWARE, config[i], i ? t->fd[0] : -1);
+		if (t->fd[i] < 0) break;
+		t->pc[i] = (struct perf_event_mmap_page *)mmap(NULL, sysconf(_SC_PAGESIZE), PROT_READ, MAP_SHARED, t->fd[i], 0);
+		if (t->pc[i] == MAP_FAILED) t->pc[i] = NULL;
+	}
+	if (i < CRC_PERF_COUNTERS) {
+		while (i--) {
+			if (t->pc[i]) munmap(t->pc[i], sysconf(_SC_PAGESIZE));
+			close(t->fd[i]);
+		}
+		__atomic_store_n(&crc_perf_pmu, false, __ATOMIC_RELAXED);
+		return;
+	}
+	t->state = 1;
+}
+
+#if CRC_PERF_RDTSC
+/** Read a counter in user space (rdpmc), see perf_event_open(2)
+ * @return false if rdpmc is not allowed
+ */
+static bool crc_perf_rdpmc(struct perf_event_mmap_page *pc, uint64_t *value)
+{
+	uint32_t seq, idx;
+	uint64_t count;
+
+	if (!pc) return false;
+	do {
+		seq = pc->lock;
+		__atomic_signal_fence(__ATOMIC_SEQ_CST);
+		idx = pc->index;
+		count = pc->offset;
+		if (!pc->cap_user_rdpmc || !idx) return false;
+		const unsigned width = pc->pmc_width;
+		int64_t pmc = __rdpmc(idx - 1);
+		pmc <<= 64 - width;
+		pmc >>= 64 - width;
+		count += pmc;
+		__atomic_signal_fence(__ATOMIC_SEQ_CST);
+	} while (pc->lock != seq);
+	*value = count;
+	return true;
+}
+#endif
+
+/** Read the PMU counters of the thread
+ * @param v cycles, instructions, L1D misses
+ * @return false if they cannot be read
+ */
+static bool crc_perf_read(crc_perf_thread_t *t, uint64_t *v)
+{
+	if (t->state != 1) return false;
+#if CRC_PERF_RDTSC
+	if (crc_perf_rdpmc(t->pc[0], &v[0]) && crc_perf_rdpmc(t->pc[1], &v[1]) && crc_perf_rdpmc(t->pc[2], &v[2]))
+		return true;
+#endif
+	uint64_t g[1 + CRC_PERF_COUNTERS];
+	if (read(t->fd[0], g, sizeof(g)) != (ssize_t)sizeof(g)) return false;
+	memcpy(v, &g[1], CRC_PERF_COUNTERS * sizeof(uint64_t));
+	return true;
+}
+
+static uint64_t crc_perf_ticks(void)
+{
+#if CRC_PERF_RDTSC
+	return __rdtsc();
+#else
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+#endif
+}
+
+/** Counters at the begin of a call
+ * @param start cycles, instructions, L1D misses, or ticks in start[0]
+ * @return true if start is from the PMU
+ */
+bool crc_perf_begin(uint64_t *start)
+{
+	crc_perf_thread_t *t = &crc_perf_thread;
+
+	if (!t->state) crc_perf_init(t);
+	if (crc_perf_read(t, start)) return true;
+	start[0] = crc_perf_ticks();
+	return false;
+}
+
+static unsigned crc_perf_bucket(size_t len)
+{
+	unsigned b = 0;
+	while (len && b < CRC_PERF_BUCKETS - 1) {
+		len >>= 1;
+		b++;
+	}
+	return b;
+}
+
+/** Add a call
+ * @param model CRC_MODEL_xxx
+ * @param len Length of Data
+ * @param start Counters from crc_perf_begin()
+ * @param pmu Return value of crc_perf_begin()
+ */
+void crc_perf_end(const unsigned model, const size_t len, const uint64_t *start, const bool pmu)
+{
+	uint64_t end[CRC_PERF_COUNTERS];
+	crc_perf_counter_t *c = &crc_perf[model][crc_perf_bucket(len)];
+
+	__atomic_fetch_add(&c->calls, 1, __ATOMIC_RELAXED);
+	__atomic_fetch_add(&c->bytes, len, __ATOMIC_RELAXED);
+	if (pmu) {
+		if (!crc_perf_read(&crc_perf_thread, end)) return;	// not timed
+		__atomic_fetch_add(&c->pmu_calls, 1, __ATOMIC_RELAXED);
+		__atomic_fetch_add(&c->pmu_bytes, len, __ATOMIC_RELAXED);
+		__atomic_fetch_add(&c->cycles, end[0] - start[0], __ATOMIC_RELAXED);
+		__atomic_fetch_add(&c->instructions, end[1] - start[1], __ATOMIC_RELAXED);
+		__atomic_fetch_add(&c->l1d_misses, end[2] - start[2], __ATOMIC_RELAXED);
+	}
+	else {
+		__atomic_fetch_add(&c->tick_calls, 1, __ATOMIC_RELAXED);
+		__atomic_fetch_add(&c->tick_bytes, len, __ATOMIC_RELAXED);
+		__atomic_fetch_add(&c->ticks, crc_perf_ticks() - start[0], __ATOMIC_RELAXED);
+	}
+}
+
+/** Counters of a model since start or the last crc_perf_reset()
+ * @param model CRC_MODEL_xxx
+ * @param perf Totals and size buckets
+ * @return false if model is out of range
+ */
+bool crc_perf_snapshot(const unsigned model, crc_perf_t *perf)
+{
+	if (model >= CRC_MODELS) return false;
+	memset(perf, 0, sizeof(*perf));
+	for (unsigned b = 0; b < CRC_PERF_BUCKETS; b++) {
+		crc_perf_counter_t *c = &crc_perf[model][b];
+		crc_perf_counter_t *d = &perf->bucket[b];
+		d->calls = __atomic_load_n(&c->calls, __ATOMIC_RELAXED);
+		d->bytes = __atomic_load_n(&c->bytes, __ATOMIC_RELAXED);
+		d->pmu_calls = __atomic_load_n(&c->pmu_calls, __ATOMIC_RELAXED);
+		d->pmu_bytes = __atomic_load_n(&c->pmu_bytes, __ATOMIC_RELAXED);
+		d->cycles = __atomic_load_n(&c->cycles, __ATOMIC_RELAXED);
+		d->instructions = __atomic_load_n(&c->instructions, __ATOMIC_RELAXED);
+		d->l1d_misses = __atomic_load_n(&c->l1d_misses, __ATOMIC_RELAXED);
+		d->tick_calls = __atomic_load_n(&c->tick_calls, __ATOMIC_RELAXED);
+		d->tick_bytes = __atomic_load_n(&c->tick_bytes, __ATOMIC_RELAXED);
+		d->ticks = __atomic_load_n(&c->ticks, __ATOMIC_RELAXED);
+		perf->total.calls += d->calls;
+		perf->total.bytes += d->bytes;
+		perf->total.pmu_calls += d->pmu_calls;
+		perf->total.pmu_bytes += d->pmu_bytes;
+		perf->total.cycles += d->cycles;
+		perf->total.instructions += d->instructions;
+		perf->total.l1d_misses += d->l1d_misses;
+		perf->total.tick_calls += d->tick_calls;
+		perf->total.tick_bytes += d->tick_bytes;
+		perf->total.ticks += d->ticks;
+	}
+	perf->pmu = __atomic_load_n(&crc_perf_pmu, __ATOMIC_RELAXED);
+	return true;
+}
+
+/** Clear all counters
+ */
+void crc_perf_reset(void)
+{
+	for (unsigned m = 0; m < CRC_MODELS; m++) {
+		for (unsigned b = 0; b < CRC_PERF_BUCKETS; b++) {
+			crc_perf_counter_t *c = &crc_perf[m][b];
+			__atomic_store_n(&c->calls, 0, __ATOMIC_RELAXED);
+			__atomic_store_n(&c->bytes, 0, __ATOMIC_RELAXED);
+			__atomic_store_n(&c->pmu_calls, 0, __ATOMIC_RELAXED);
+			__atomic_store_n(&c->pmu_bytes, 0, __ATOMIC_RELAXED);
+			__atomic_store_n(&c->cycles, 0, __ATOMIC_RELAXED);
+			__atomic_store_n(&c->instructions, 0, __ATOMIC_RELAXED);
+			__atomic_store_n(&c->l1d_misses, 0, __ATOMIC_RELAXED);
+			__atomic_store_n(&c->tick_calls, 0, __ATOMIC_RELAXED);
+			__atomic_store_n(&c->tick_bytes, 0, __ATOMIC_RELAXED);
+			__atomic_store_n(&c->ticks, 0, __ATOMIC_RELAXED);
+		}
+	}
+}
+
+static void crc_perf_line(int fd, const char *name, const char *bucket, const crc_perf_counter_t *c)
+{
+	char pmu[96] = "        -         -           -         -", tick[32] = "        -";
+	if (c->pmu_calls)
+		snprintf(pmu, sizeof(pmu), "%9.3f %9.3f %11.3f %9.1f", (double)c->cycles / (c->pmu_bytes ? c->pmu_bytes : 1),
+			(double)c->instructions / (c->pmu_bytes ? c->pmu_bytes : 1), (double)c->l1d_misses / c->pmu_calls,
+			(double)c->cycles / c->pmu_calls);
+	if (c->tick_calls)
+		snprintf(tick, sizeof(tick), "%9.3f", (double)c->ticks / (c->tick_bytes ? c->tick_bytes : 1));
+	dprintf(fd, "%-8s %-10s %12llu %14llu %s %s\n", name, bucket,
+		(unsigned long long)c->calls, (unsigned long long)c->bytes, pmu, tick);
+}
+
+/** Write the report, models with calls only
+ * cyc/B .. cyc/call: calls counted by the PMU, tick/B: calls timed without it
+ * @param fd File descriptor
+ */
+void crc_perf_dump(int fd)
+{
+	const bool pmu = __atomic_load_n(&crc_perf_pmu, __ATOMIC_RELAXED);
+	crc_perf_t p;
+
+	dprintf(fd, "FastCRC perf (%s, tick/B without PMU in %s)\n", pmu ? "PMU cycles" : "PMU cycles where available",
+		CRC_PERF_RDTSC ? "rdtsc ticks" : "ns");
+	dprintf(fd, "%-8s %-10s %12s %14s %9s %9s %11s %9s %9s\n", "model", "length", "calls", "bytes", "cyc/B", "ins/B", "L1Dmiss/call", "cyc/call", "tick/B");
+	for (unsigned m = 0; m < CRC_MODELS; m++) {
+		crc_perf_snapshot(m, &p);
+		if (!p.total.calls) continue;
+		crc_perf_line(fd, crc_model_name(m), "total", &p.total);
+		for (unsigned b = 0; b < CRC_PERF_BUCKETS; b++) {
+			char range[16];
+			if (!p.bucket[b].calls) continue;
+			if (b == 0) snprintf(range, sizeof(range), "0");
+			else if (b == CRC_PERF_BUCKETS - 1) snprintf(range, sizeof(range), ">=2^%u", b - 1);
+			else snprintf(range, sizeof(range), "<2^%u", b);
+			crc_perf_line(fd, "", range, &p.bucket[b]);
+		}
+	}
+}
+
+#endif // #if CRC_PERF
@@ -0,0 +1,59 @@
+/* FastCRC library code is placed under the MIT license
+ * Copyright (c) 2014 - 2021 Frank Bösing
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+//
+// Hook for the perf_event instrumentation (CRC_PERF), one per _upd() method:
+// the counters are read when the scope is entered and when it is left.
+//
+
+#if !defined(FastCRC_perf)
+#define FastCRC_perf
+
+#include "FastCRC_tune.h"
+
+#if CRC_PERF
+
+bool crc_perf_begin(uint64_t *start);
+void crc_perf_end(const unsigned model, const size_t len, const uint64_t *start, const bool pmu);
+
+class crc_perf_scope
+{
+public:
+  crc_perf_scope(const unsigned model, const size_t len) : model(model), len(len), on(!CRC_TUNE_TIMING()) { if (on) pmu = crc_perf_begin(start); }
+  ~crc_perf_scope() { if (on) crc_perf_end(model, len, start, pmu); }
+private:
+  const unsigned model;
+  const size_t len;
+  const bool on;		// false: a call of the tuner
+  bool pmu;				// start is from the PMU, else ticks
+  uint64_t start[3];
+};
+
+#define CRC_PERF_SCOPE(model, len) crc_perf_scope crc_perf_scope_(model, len)
+
+#else
+#define CRC_PERF_SCOPE(model, len)
+#endif
+
+#endif
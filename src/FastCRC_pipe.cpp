@@ -0,0 +1,164 @@
+/* FastCRC library code is placed under the MIT license
+ * Copyright (c) 2014 - 2021 Frank Bösing
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+//
+// Frame verification stage (CRC_PIPE)
+//
+// A ring of frame descriptors with three indexes, each written by one thread only:
+// the producer advances head, the verifier advances verified, the consumer advances
+// tail. The verifier and the consumer may be the same thread. Each index is stored
+// with release after the slots are written and loaded with acquire by the next
+// stage, no locks, no read-modify-write. Every stage keeps a copy of the index it
+// waits for and loads the shared one only when the copy says empty or full.
+//
+// The verifier takes up to CRC_PIPE_BATCH frames at a time into the batched
+// kernels (FastCRC16::modbus_verify(), x25_verify(): residue check, one kernel choice per batch)
+// and publishes each batch at once.
+//
+
+#include "FastCRC_pipe.h"
+
+#if CRC_PIPE
+
+#include <atomic>
+#include <new>
+
+struct crc_pipe {
+	crc_frame_t *ring;
+	size_t mask;
+	unsigned model;
+	FastCRC16 crc;
+
+	alignas(64) std::atomic<size_t> head;	// producer
+	size_t tail_cache;
+
+	alignas(64) std::atomic<size_t> verified;	// verifier
+	size_t head_cache;
+
+	alignas(64) std::atomic<size_t> tail;	// consumer
+	size_t verified_cache;
+};
+
+/** Creates a verification stage
+ * @param model CRC_MODEL_MODBUS or CRC_MODEL_X25
+ * @param capacity Frames in flight, rounded up to a power of 2
+ * @return Stage, NULL: invalid model or out of memory
+ */
+crc_pipe_t *crc_pipe_create(unsigned model, size_t capacity)
+{
+	if (model != CRC_MODEL_MODBUS && model != CRC_MODEL_X25) return NULL;
+	size_t n = 2;
+	while (n < capacity) n <<= 1;
+
+	crc_pipe_t *p = new (std::nothrow) crc_pipe_t;
+	if (!p) return NULL;
+	p->ring = new (std::nothrow) crc_frame_t[n];
+	if (!p->ring) {
+		delete p;
+		return NULL;
+	}
+	p->mask = n - 1;
+	p->model = model;
+	p->head.store(0, std::memory_order_relaxed);
+	p->verified.store(0, std::memory_order_relaxed);
+	p->tail.store(0, std::memory_order_relaxed);
+	p->tail_cache = p->head_cache = p->verified_cache = 0;
+	return p;
+}
+
+/** Queues a frame (producer thread)
+ * @param p Stage
+ * @param frame Copied into the ring
+ * @return false: the ring is full
+ */
+bool crc_pipe_push(crc_pipe_t *p, const crc_frame_t *frame)
+{
+	const size_t h = p->head.load(std::memory_order_relaxed);
+	if (h - p->tail_cache > p->mask) {
+		p->tail_cache = p->tail.load(std::memory_order_acquire);
+		if (h - p->tail_cache > p->mask) return false;
+	}
+	p->ring[h & p->mask] = *frame;
+	p->head.store(h + 1, std::memory_order_release);
+	return true;
+}
+
+/** Verifies the queued frames (verifier thread)
+ * @param p Stage
+ * @return Number of frames verified, 0: none queued
+ */
+size_t crc_pipe_verify(crc_pipe_t *p)
+{
+	const uint8_t *frames[CRC_PIPE_BATCH];
+	size_t lens[CRC_PIPE_BATCH];
+	uint8_t ok[CRC_PIPE_BATCH];
+	size_t v = p->verified.load(std::memory_order_relaxed);
+	const size_t start = v;
+
+	p->head_cache = p->head.load(std::memory_order_acquire);
+	while (v != p->head_cache) {
+		size_t n = p->head_cache - v;
+		if (n > CRC_PIPE_BATCH) n = CRC_PIPE_BATCH;
+		for (size_t i = 0; i < n; i++) {
+			const crc_frame_t *f = &p->ring[(v + i) & p->mask];
+			frames[i] = f->data;
+			lens[i] = f->len;
+		}
+		if (p->model == CRC_MODEL_MODBUS) p->crc.modbus_verify(frames, lens, n, ok);
+		else p->crc.x25_verify(frames, lens, n, ok);
+		for (size_t i = 0; i < n; i++) p->ring[(v + i) & p->mask].ok = ok[i];
+		v += n;
+		p->verified.store(v, std::memory_order_release);
+	}
+	return v - start;
+}
+
+/** Takes verified frames (consumer thread)
+ * @param p Stage
+ * @param frames Copies of the frames, with ok set
+ * @param max Size of frames
+ * @return Number of frames, 0: none verified
+ */
+size_t crc_pipe_pop(crc_pipe_t *p, crc_frame_t *frames, size_t max)
+{
+	const size_t t = p->tail.load(std::memory_order_relaxed);
+	if (p->verified_cache == t) p->verified_cache = p->verified.load(std::memory_order_acquire);
+	size_t n = p->verified_cache - t;
+	if (n > max) n = max;
+	if (!n) return 0;
+	for (size_t i = 0; i < n; i++) frames[i] = p->ring[(t + i) & p->mask];
+	p->tail.store(t + n, std::memory_order_release);
+	return n;
+}
+
+/** Frees a stage, no other thread may use it any more
+ * @param p Stage, may be NULL
+ */
+void crc_pipe_destroy(crc_pipe_t *p)
+{
+	if (!p) return;
+	delete[] p->ring;
+	delete p;
+}
+
+#endif // CRC_PIPE
@@ -0,0 +1,55 @@
+/* FastCRC library code is placed under the MIT license
+ * Copyright (c) 2014 - 2021 Frank Bösing
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+// Frame verification stage (lock-free single producer, single consumer), see FastCRC_pipe.cpp
+
+#if !defined(FastCRC_pipe_h)
+#define FastCRC_pipe_h
+
+#include "FastCRC.h"
+
+#if CRC_PIPE
+
+#if !defined(CRC_PIPE_BATCH)
+#define CRC_PIPE_BATCH 32		// frames per call of the verify kernel, results are published per batch
+#endif
+
+typedef struct {
+	const uint8_t *data;	// the frame including its CRC (low byte first), valid until popped
+	size_t len;
+	void *user;				// passed through
+	uint8_t ok;				// set by crc_pipe_verify(): 1 valid, 0 not
+} crc_frame_t;
+
+typedef struct crc_pipe crc_pipe_t;
+
+crc_pipe_t *crc_pipe_create(unsigned model, size_t capacity);	// CRC_MODEL_MODBUS or CRC_MODEL_X25, capacity is rounded up to a power of 2, NULL: invalid or out of memory
+bool crc_pipe_push(crc_pipe_t *p, const crc_frame_t *frame);		// producer, false: full
+size_t crc_pipe_verify(crc_pipe_t *p);								// verifier: all frames pushed so far, returns their number
+size_t crc_pipe_pop(crc_pipe_t *p, crc_frame_t *frames, size_t max);	// consumer: verified frames in the order of push
+void crc_pipe_destroy(crc_pipe_t *p);
+
+#endif // CRC_PIPE
+#endif // FastCRC_pipe_h
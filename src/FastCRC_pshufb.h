@@ -0,0 +1,135 @@
+/* FastCRC library code is placed under the MIT license
+ * Copyright (c) 2014 - 2021 Frank Bösing
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+//
+// Nibble-table (PSHUFB) folding of the 8-bit CRCs for x86.
+//
+// With a table driven 8-bit CRC, k zero bytes map the register through a
+// linear function L_k(crc). A 16 byte block can therefore be folded into the
+// next one byte by byte: B' = L_16(A) ^ B. L_k is split into two 16-entry
+// tables for the low and the high nibble, which is one PSHUFB each. Four
+// blocks are folded independently with L_64, then combined with L_16.
+// The 16 bytes left are congruent to the message, the CRC is the table-CRC
+// (seed 0) of this residue. The seed is xored into the first byte.
+//
+// Tables (n = 64 for four lanes, n = 16 for one lane):
+//  Ln_lo[i] = L_n(i), Ln_hi[i] = L_n(i << 4)
+//
+
+#if !defined(FastCRC_pshufb)
+#define FastCRC_pshufb
+
+#if CRC_PSHUFB
+
+#include <tmmintrin.h>
+
+#if !defined(CRC_PSHUFB_MIN)
+#define CRC_PSHUFB_MIN 64
+#endif
+
+typedef struct {
+	uint8_t l64_lo[16];
+	uint8_t l64_hi[16];
+	uint8_t l16_lo[16];
+	uint8_t l16_hi[16];
+} crc_pshufb_t;
+
+// ================= 7-BIT CRC ===================
+static const crc_pshufb_t crc_pshufb_crc7 = {
+	{0x00, 0x10, 0x20, 0x30, 0x40, 0x50, 0x60, 0x70, 0x80, 0x90, 0xa0, 0xb0, 0xc0, 0xd0, 0xe0, 0xf0},
+	{0x00, 0x12, 0x24, 0x36, 0x48, 0x5a, 0x6c, 0x7e, 0x90, 0x82, 0xb4, 0xa6, 0xd8, 0xca, 0xfc, 0xee},
+	{0x00, 0x02, 0x04, 0x06, 0x08, 0x0a, 0x0c, 0x0e, 0x10, 0x12, 0x14, 0x16, 0x18, 0x1a, 0x1c, 0x1e},
+	{0x00, 0x20, 0x40, 0x60, 0x80, 0xa0, 0xc0, 0xe0, 0x12, 0x32, 0x52, 0x72, 0x92, 0xb2, 0xd2, 0xf2}
+};
+
+// ================= 8-BIT CRC ===================
+static const crc_pshufb_t crc_pshufb_smbus = {
+	{0x00, 0x10, 0x20, 0x30, 0x40, 0x50, 0x60, 0x70, 0x80, 0x90, 0xa0, 0xb0, 0xc0, 0xd0, 0xe0, 0xf0},
+	{0x00, 0x07, 0x0e, 0x09, 0x1c, 0x1b, 0x12, 0x15, 0x38, 0x3f, 0x36, 0x31, 0x24, 0x23, 0x2a, 0x2d},
+	{0x00, 0x02, 0x04, 0x06, 0x08, 0x0a, 0x0c, 0x0e, 0x10, 0x12, 0x14, 0x16, 0x18, 0x1a, 0x1c, 0x1e},
+	{0x00, 0x20, 0x40, 0x60, 0x80, 0xa0, 0xc0, 0xe0, 0x07, 0x27, 0x47, 0x67, 0x87, 0xa7, 0xc7, 0xe7}
+};
+static const crc_pshufb_t crc_pshufb_maxim = {
+	{0x00, 0x9d, 0x23, 0xbe, 0x46, 0xdb, 0x65, 0xf8, 0x8c, 0x11, 0xaf, 0x32, 0xca, 0x57, 0xe9, 0x74},
+	{0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f},
+	{0x00, 0x8c, 0x01, 0x8d, 0x02, 0x8e, 0x03, 0x8f, 0x04, 0x88, 0x05, 0x89, 0x06, 0x8a, 0x07, 0x8b},
+	{0x00, 0x08, 0x10, 0x18, 0x20, 0x28, 0x30, 0x38, 0x40, 0x48, 0x50, 0x58, 0x60, 0x68, 0x70, 0x78}
+};
+
+
+static inline __m128i crc_pshufb_fold(__m128i a, __m128i lo, __m128i hi, __m128i b)
+{
+	const __m128i mask = _mm_set1_epi8(0x0f);
+	__m128i l = _mm_shuffle_epi8(lo, _mm_and_si128(a, mask));
+	__m128i h = _mm_shuffle_epi8(hi, _mm_and_si128(_mm_srli_epi16(a, 4), mask));
+	return _mm_xor_si128(_mm_xor_si128(l, h), b);
+}
+
+/** Fold the data down to 16 bytes
+ * @param seed CRC register (as used with the table)
+ * @param data Pointer to Data
+ * @param len Length of Data, at least 64
+ * @param k Nibble tables of the model
+ * @param res 16 bytes residue, to be processed with the table and seed 0
+ * @return Number of bytes consumed
+ */
+static size_t crc_pshufb(uint8_t seed, const uint8_t *data, size_t len, const crc_pshufb_t *k, uint8_t *res)
+{
+	const __m128i l64_lo = _mm_loadu_si128((const __m128i *)k->l64_lo);
+	const __m128i l64_hi = _mm_loadu_si128((const __m128i *)k->l64_hi);
+	const __m128i l16_lo = _mm_loadu_si128((const __m128i *)k->l16_lo);
+	const __m128i l16_hi = _mm_loadu_si128((const __m128i *)k->l16_hi);
+	const uint8_t *p = data;
+	const uint8_t *end = data + (len & ~(size_t)15);
+	__m128i x0, x1, x2, x3;
+
+	x0 = _mm_xor_si128(_mm_loadu_si128((const __m128i *)p), _mm_cvtsi32_si128(seed));
+	x1 = _mm_loadu_si128((const __m128i *)(p + 16));
+	x2 = _mm_loadu_si128((const __m128i *)(p + 32));
+	x3 = _mm_loadu_si128((const __m128i *)(p + 48));
+	p += 64;
+
+	while (end - p >= 64) {
+		x0 = crc_pshufb_fold(x0, l64_lo, l64_hi, _mm_loadu_si128((const __m128i *)p));
+		x1 = crc_pshufb_fold(x1, l64_lo, l64_hi, _mm_loadu_si128((const __m128i *)(p + 16)));
+		x2 = crc_pshufb_fold(x2, l64_lo, l64_hi, _mm_loadu_si128((const __m128i *)(p + 32)));
+		x3 = crc_pshufb_fold(x3, l64_lo, l64_hi, _mm_loadu_si128((const __m128i *)(p + 48)));
+		p += 64;
+	}
+
+	x0 = crc_pshufb_fold(x0, l16_lo, l16_hi, x1);
+	x0 = crc_pshufb_fold(x0, l16_lo, l16_hi, x2);
+	x0 = crc_pshufb_fold(x0, l16_lo, l16_hi, x3);
+
+	while (p < end) {
+		x0 = crc_pshufb_fold(x0, l16_lo, l16_hi, _mm_loadu_si128((const __m128i *)p));
+		p += 16;
+	}
+
+	_mm_storeu_si128((__m128i *)res, x0);
+	return p - data;
+}
+
+#endif // #if CRC_PSHUFB
+#endif
@@ -0,0 +1,457 @@
+/* FastCRC library code is placed under the MIT license
+ * Copyright (c) 2014 - 2021 Frank Bösing
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+//
+// SFV manifests
+//
+// One line per file: "path CRC", the CRC32 (FastCRC32::crc32) in 8 hex
+// digits, the path relative to the directory of the manifest. Lines that
+// start with ';' are comments.
+//
+// Files larger than the split size are cut into parts. All parts are dealt
+// out to the deques of the workers, one after the other, so the parts of a
+// large file are read at the same time. A worker takes the parts of its own
+// deque from the front and steals from the back of the others when its
+// own is empty. The worker that finishes the last part of a file combines
+// the CRCs of all parts with crc32_combine().
+//
+
+#include "FastCRC_sfv.h"
+
+#if CRC_FILE
+
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if !defined(O_CLOEXEC)
+#define O_CLOEXEC 0
+#endif
+
+typedef struct {
+	size_t file;
+	unsigned part;
+	uint64_t off, len;
+} crc_sfv_part_t;
+
+typedef struct {
+	std::string path;				// to open()
+	std::vector<uint32_t> crc;		// of each part
+	std::vector<uint64_t> len;		// read of each part
+	std::atomic<unsigned> left;		// parts to do
+	std::atomic<int> err;
+} crc_sfv_job_t;
+
+typedef struct {
+	std::deque<crc_sfv_part_t> parts;
+	std::mutex mutex;
+} crc_sfv_worker_t;
+
+typedef struct {
+	crc_sfv_report_t *report;
+	crc_sfv_job_t *jobs;
+	crc_sfv_worker_t *workers;
+	unsigned threads;
+	const crc_sfv_options_t *opt;
+	bool verify;					// else the CRCs are the reference
+	std::mutex progress_mutex;
+	crc_sfv_progress_t progress;
+} crc_sfv_run_t;
+
+typedef struct {
+	FastCRC32 crc;
+	uint32_t value;
+	uint64_t len;
+} crc_sfv_sum_t;
+
+static double crc_sfv_now()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void crc_sfv_chunk(void *ctx, const uint8_t *data, size_t len)
+{
+	crc_sfv_sum_t *s = (crc_sfv_sum_t *) ctx;
+	s->value = s->crc.crc32_upd(data, len);
+	s->len += len;
+}
+
+/** Own deque first (front), then steal (back)
+ * @return false: no work left
+ */
+static bool crc_sfv_take(crc_sfv_run_t *run, unsigned w, crc_sfv_part_t *part)
+{
+	for (unsigned i = 0; i < run->threads; i++) {
+		crc_sfv_worker_t *v = &run->workers[(w + i) % run->threads];
+		std::lock_guard<std::mutex> lock(v->mutex);
+		if (v->parts.empty()) continue;
+		if (i == 0) {
+			*part = v->parts.front();
+			v->parts.pop_front();
+		}
+		else {
+			*part = v->parts.back();
+			v->parts.pop_back();
+		}
+		return true;
+	}
+	return false;	// parts are never added while the workers run
+}
+
+static void crc_sfv_finish(crc_sfv_run_t *run, size_t i)
+{
+	crc_sfv_job_t *job = &run->jobs[i];
+	crc_sfv_file_t *f = &run->report->files[i];
+	FastCRC32 c;
+
+	f->err = job->err;
+	if (f->err) {
+		f->status = f->err == ENOENT ? CRC_SFV_MISSING : CRC_SFV_ERROR;
+		return;
+	}
+
+	uint32_t crc = job->crc[0];
+	uint64_t size = job->len[0];
+	for (size_t p = 1; p < job->crc.size(); p++) {
+		crc = c.crc32_combine(crc, job->crc[p], job->len[p]);
+		size += job->len[p];
+	}
+	f->crc = crc;
+	f->size = size;
+	if (!run->verify) f->expected = crc;
+	f->status = crc == f->expected ? CRC_SFV_OK : CRC_SFV_BAD;
+}
+
+static void crc_sfv_worker(crc_sfv_run_t *run, unsigned w)
+{
+	crc_sfv_part_t part;
+	crc_sfv_sum_t sum;
+
+	while (crc_sfv_take(run, w, &part)) {
+		crc_sfv_job_t *job = &run->jobs[part.file];
+		sum.value = sum.crc.crc32(NULL, 0);
+		sum.len = 0;
+
+		if (!job->err) {
+			int fd, err = 0;
+			do fd = open(job->path.c_str(), O_RDONLY | O_CLOEXEC); while (fd < 0 && errno == EINTR);
+			if (fd < 0) err = errno;
+			else {
+				err = crc_file_range(fd, part.off, part.len, crc_sfv_chunk, &sum);
+				close(fd);
+			}
+			if (err) {
+				int none = 0;
+				job->err.compare_exchange_strong(none, err);
+			}
+		}
+		job->crc[part.part] = sum.value;
+		job->len[part.part] = sum.len;
+
+		const bool last = --job->left == 0;
+		if (last) crc_sfv_finish(run, part.file);
+
+		std::lock_guard<std::mutex> lock(run->progress_mutex);
+		run->progress.bytes_done += sum.len;
+		if (last) run->progress.files_done++;
+		if (run->opt && run->opt->progress) {
+			run->progress.file = last ? &run->report->files[part.file] : NULL;
+			run->opt->progress(run->opt->ctx, &run->progress);
+		}
+	}
+}
+
+/** Calculates all files of the report (path, size and expected are set) */
+static void crc_sfv_run(const std::string &dir, const crc_sfv_options_t *opt, crc_sfv_report_t *report, bool verify)
+{
+	const double t0 = crc_sfv_now();
+	const uint64_t split = opt && opt->split ? opt->split : CRC_SFV_SPLIT;
+	unsigned threads = opt && opt->threads ? opt->threads : std::thread::hardware_concurrency();
+	if (threads < 1) threads = 1;
+
+	crc_sfv_run_t run;
+	run.report = report;
+	run.jobs = new crc_sfv_job_t[report->count];
+	run.workers = new crc_sfv_worker_t[threads];
+	run.threads = threads;
+	run.opt = opt;
+	run.verify = verify;
+	memset(&run.progress, 0, sizeof(run.progress));
+	run.progress.files = report->count;
+
+	unsigned w = 0;
+	for (size_t i = 0; i < report->count; i++) {
+		crc_sfv_job_t *job = &run.jobs[i];
+		const uint64_t size = report->files[i].size;
+		const unsigned parts = size > split ? (size + split - 1) / split : 1;
+
+		job->path = dir + report->files[i].path;
+		job->crc.resize(parts);
+		job->len.resize(parts);
+		job->left = parts;
+		job->err = 0;
+		run.progress.bytes += size;
+
+		for (unsigned p = 0; p < parts; p++) {
+			const uint64_t off = (uint64_t) p * split;
+			// the last part reads to the end, the file may have grown
+			crc_sfv_part_t part = { i, p, off, p == parts - 1 ? UINT64_MAX : split };
+			run.workers[w].parts.push_back(part);
+			w = (w + 1) % threads;
+		}
+	}
+
+	std::vector<std::thread> pool;
+	for (unsigned t = 1; t < threads; t++) pool.emplace_back(crc_sfv_worker, &run, t);
+	crc_sfv_worker(&run, 0);
+	for (auto &t : pool) t.join();
+
+	report->ok = report->bad = report->missing = report->errors = 0;
+	report->bytes = 0;
+	for (size_t i = 0; i < report->count; i++) {
+		const crc_sfv_file_t *f = &report->files[i];
+		report->bytes += f->size;
+		if (f->status == CRC_SFV_OK) report->ok++;
+		else if (f->status == CRC_SFV_BAD) report->bad++;
+		else if (f->status == CRC_SFV_MISSING) report->missing++;
+		else report->errors++;
+	}
+
+	delete[] run.jobs;
+	delete[] run.workers;
+	report->seconds = crc_sfv_now() - t0;
+}
+
+/** Directory of the manifest, with '/' at the end ("" for the current directory) */
+static std::string crc_sfv_dir(const char *manifest)
+{
+	const char *slash = strrchr(manifest, '/');
+	return slash ? std::string(manifest, slash + 1 - manifest) : std::string();
+}
+
+static int crc_sfv_report_alloc(crc_sfv_report_t *report, const std::vector<std::pair<std::string, uint64_t> > &files)
+{
+	memset(report, 0, sizeof(*report));
+	report->files = (crc_sfv_file_t *) calloc(files.size() ? files.size() : 1, sizeof(crc_sfv_file_t));
+	if (!report->files) return ENOMEM;
+	report->count = files.size();
+	for (size_t i = 0; i < files.size(); i++) {
+		report->files[i].path = strdup(files[i].first.c_str());
+		if (!report->files[i].path) {
+			crc_sfv_free(report);
+			return ENOMEM;
+		}
+		report->files[i].size = files[i].second;
+	}
+	return 0;
+}
+
+/** Regular files below dir, symbolic links are not followed
+ * @param rel Path relative to the manifest
+ * @param skip Device and inode of the manifest
+ */
+static int crc_sfv_walk(const std::string &dir, const std::string &rel, const struct stat *skip, std::vector<std::pair<std::string, uint64_t> > &files)
+{
+	DIR *d = opendir(dir.empty() ? "." : dir.c_str());
+	if (!d) return errno;
+
+	int err = 0;
+	struct dirent *e;
+	while ((e = readdir(d))) {
+		if (!strcmp(e->d_name, ".") || !strcmp(e->d_name, "..")) continue;
+		const std::string path = dir + e->d_name;
+		struct stat st;
+		if (lstat(path.c_str(), &st) < 0) continue;	// removed meanwhile
+		if (S_ISDIR(st.st_mode)) {
+			if ((err = crc_sfv_walk(path + "/", rel + e->d_name + "/", skip, files))) break;
+		}
+		else if (S_ISREG(st.st_mode) && !(st.st_dev == skip->st_dev && st.st_ino == skip->st_ino))
+			files.push_back(std::make_pair(rel + e->d_name, (uint64_t) st.st_size));
+	}
+	closedir(d);
+	return err;
+}
+
+int crc_sfv_create(const char *manifest, const char *root, const crc_sfv_options_t *opt, crc_sfv_report_t *report)
+{
+	memset(report, 0, sizeof(*report));
+
+	// root has to be the directory of the manifest or below it
+	const std::string dir = crc_sfv_dir(manifest);
+	char real_dir[PATH_MAX], real_root[PATH_MAX];
+	if (!realpath(dir.empty() ? "." : dir.c_str(), real_dir) || !realpath(root, real_root)) return errno;
+	const size_t n = strlen(real_dir);
+	std::string rel;
+	if (strcmp(real_dir, real_root)) {
+		if (strncmp(real_dir, real_root, n) || (real_root[n] != '/' && strcmp(real_dir, "/"))) return EXDEV;
+		rel = std::string(real_root + n + (real_root[n] == '/')) + "/";
+	}
+
+	struct stat skip;
+	if (stat(manifest, &skip) < 0) memset(&skip, 0xff, sizeof(skip));	// not there yet
+
+	std::vector<std::pair<std::string, uint64_t> > files;
+	int err = crc_sfv_walk(dir + rel, rel, &skip, files);
+	if (err) return err;
+	std::sort(files.begin(), files.end());
+
+	if ((err = crc_sfv_report_alloc(report, files))) return err;
+	crc_sfv_run(dir, opt, report, false);
+
+	// files that cannot be read are left out
+	FILE *f = fopen(manifest, "w");
+	if (!f) return errno;
+	fprintf(f, "; Generated by FastCRC\n");
+	for (size_t i = 0; i < report->count; i++) {
+		const crc_sfv_file_t *e = &report->files[i];
+		if (e->status == CRC_SFV_OK) fprintf(f, "%s %08X\n", e->path, (unsigned) e->crc);
+	}
+	if (fclose(f) == EOF) return errno;
+	return 0;
+}
+
+int crc_sfv_verify(const char *manifest, const crc_sfv_options_t *opt, crc_sfv_report_t *report)
+{
+	memset(report, 0, sizeof(*report));
+
+	FILE *f = fopen(manifest, "r");
+	if (!f) return errno;
+
+	const std::string dir = crc_sfv_dir(manifest);
+	std::vector<std::pair<std::string, uint64_t> > files;
+	std::vector<uint32_t> expected;
+	char *line = NULL;
+	size_t cap = 0;
+	ssize_t len;
+	while ((len = getline(&line, &cap, f)) >= 0) {
+		while (len && (line[len - 1] == '\n' || line[len - 1] == '\r' || line[len - 1] == ' ')) line[--len] = 0;
+		if (!len || line[0] == ';') continue;
+
+		char *sp = strrchr(line, ' ');
+		char *end;
+		if (!sp || strlen(sp + 1) != 8) continue;	// not an SFV line
+		const unsigned long crc = strtoul(sp + 1, &end, 16);
+		if (*end) continue;
+		while (sp > line && sp[-1] == ' ') sp--;
+		*sp = 0;
+		for (char *c = line; *c; c++) if (*c == '\\') *c = '/';	// written on Windows
+
+		struct stat st;
+		uint64_t size = stat((dir + line).c_str(), &st) == 0 ? st.st_size : 0;
+		files.push_back(std::make_pair(std::string(line), size));
+		expected.push_back(crc);
+	}
+	free(line);
+	const int err = ferror(f) ? EIO : 0;
+	fclose(f);
+	if (err) return err;
+
+	int e = crc_sfv_report_alloc(report, files);
+	if (e) return e;
+	for (size_t i = 0; i < report->count; i++) report->files[i].expected = expected[i];
+	crc_sfv_run(dir, opt, report, true);
+	return 0;
+}
+
+static void crc_sfv_json_string(std::string &out, const char *s)
+{
+	out += '"';
+	for (; *s; s++) {
+		const unsigned char c = *s;
+		if (c == '"' || c == '\\') {
+			out += '\\';
+			out += c;
+		}
+		else if (c < 0x20) {
+			char hex[8];
+			snprintf(hex, sizeof(hex), "\\u%04x", c);
+			out += hex;
+		}
+		else out += c;
+	}
+	out += '"';
+}
+
+int crc_sfv_json(const crc_sfv_report_t *report, int fd)
+{
+	static const char *const status[] = { "ok", "bad", "missing", "error" };
+	std::string out;
+	char buf[256];
+
+	snprintf(buf, sizeof(buf), "{\"files\":%zu,\"ok\":%zu,\"bad\":%zu,\"missing\":%zu,\"errors\":%zu,"
+		"\"bytes\":%llu,\"seconds\":%.3f,\"mb_per_s\":%.1f,\"results\":[",
+		report->count, report->ok, report->bad, report->missing, report->errors,
+		(unsigned long long) report->bytes, report->seconds,
+		report->seconds > 0 ? report->bytes / report->seconds / 1e6 : 0.0);
+	out += buf;
+
+	for (size_t i = 0; i < report->count; i++) {
+		const crc_sfv_file_t *f = &report->files[i];
+		out += i ? ",\n{\"path\":" : "\n{\"path\":";
+		crc_sfv_json_string(out, f->path);
+		snprintf(buf, sizeof(buf), ",\"crc\":\"%08X\",\"expected\":\"%08X\",\"size\":%llu,\"status\":\"%s\"",
+			(unsigned) f->crc, (unsigned) f->expected, (unsigned long long) f->size, status[f->status]);
+		out += buf;
+		if (f->err) {
+			out += ",\"error\":";
+			crc_sfv_json_string(out, strerror(f->err));
+		}
+		out += '}';
+	}
+	out += "]}\n";
+
+	for (size_t done = 0; done < out.size(); ) {
+		ssize_t n = write(fd, out.data() + done, out.size() - done);
+		if (n > 0) done += n;
+		else if (n < 0 && errno != EINTR) return errno;
+	}
+	return 0;
+}
+
+void crc_sfv_free(crc_sfv_report_t *report)
+{
+	for (size_t i = 0; i < report->count; i++) free(report->files[i].path);
+	free(report->files);
+	memset(report, 0, sizeof(*report));
+}
+
+#endif // CRC_FILE
@@ -0,0 +1,82 @@
+/* FastCRC library code is placed under the MIT license
+ * Copyright (c) 2014 - 2021 Frank Bösing
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// SFV manifests (CRC32 of files), see FastCRC_sfv.cpp
+
+#if !defined(FastCRC_sfv_h)
+#define FastCRC_sfv_h
+
+#include "FastCRC.h"
+
+#if CRC_FILE
+
+#define CRC_SFV_SPLIT (64u << 20)	// default part size of large files
+
+// crc_sfv_file_t.status
+#define CRC_SFV_OK      0
+#define CRC_SFV_BAD     1	// CRC differs from the manifest
+#define CRC_SFV_MISSING 2	// in the manifest, but not found
+#define CRC_SFV_ERROR   3	// cannot be read, see err
+
+typedef struct {
+	char *path;			// relative to the directory of the manifest
+	uint32_t crc;		// calculated
+	uint32_t expected;	// from the manifest (verify)
+	uint64_t size;
+	int status;			// CRC_SFV_xxx
+	int err;			// errno
+} crc_sfv_file_t;
+
+typedef struct {
+	crc_sfv_file_t *files;	// in the order of the manifest (sorted by path when created)
+	size_t count;
+	size_t ok, bad, missing, errors;
+	uint64_t bytes;
+	double seconds;
+} crc_sfv_report_t;
+
+typedef struct {
+	size_t files_done, files;
+	uint64_t bytes_done, bytes;
+	const crc_sfv_file_t *file;	// the file that was just finished, NULL: only a part of it
+} crc_sfv_progress_t;
+
+typedef void (*crc_sfv_progress_fn)(void *ctx, const crc_sfv_progress_t *progress);
+
+typedef struct {
+	unsigned threads;				// 0: one per CPU
+	uint64_t split;					// larger files are calculated in parts of this size, 0: CRC_SFV_SPLIT
+	crc_sfv_progress_fn progress;	// called by one thread at a time, NULL: none
+	void *ctx;						// passed to progress
+} crc_sfv_options_t;
+
+// All functions return 0 or errno (of the manifest or the directory), the results per file are in the report.
+// Free the report with crc_sfv_free(), opt may be NULL.
+int crc_sfv_create(const char *manifest, const char *root, const crc_sfv_options_t *opt, crc_sfv_report_t *report);
+int crc_sfv_verify(const char *manifest, const crc_sfv_options_t *opt, crc_sfv_report_t *report);
+int crc_sfv_json(const crc_sfv_report_t *report, int fd);
+void crc_sfv_free(crc_sfv_report_t *report);
+
+#endif // CRC_FILE
+#endif // FastCRC_sfv_h
@@ -0,0 +1,163 @@
+/* FastCRC library code is placed under the MIT license
+ * Copyright (c) 2014 - 2021 Frank Bösing
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+//
+// Call statistics (CRC_STATS)
+//
+// Every thread counts into its own thread_local block. On the first call the
+// block is linked into a list, crc_stats_get() sums up the list. When a thread
+// exits, its counters are added to crc_stats_exited and the block is unlinked.
+// crc_stats_reset() only takes a new baseline: the threads are never written
+// by others.
+//
+
+#if defined(ARDUINO)
+#include <Arduino.h>
+#endif
+
+#include "FastCRC.h"
+#include "FastCRC_stats.h"
+
+#if CRC_STATS
+
+#include <mutex>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+thread_local crc_stats_local_t crc_stats_local;
+
+typedef struct crc_stats_thread {
+	crc_stats_local_t *local;
+	struct crc_stats_thread *next;
+
+	crc_stats_thread();
+	~crc_stats_thread();
+} crc_stats_thread_t;
+
+static std::mutex crc_stats_mutex;
+static crc_stats_thread_t *crc_stats_threads;
+static crc_stats_t crc_stats_exited[CRC_MODELS];	// threads that have exited
+static crc_stats_t crc_stats_base[CRC_MODELS];		// at the last crc_stats_reset()
+
+static void crc_stats_sum(crc_stats_t *sum, const crc_stats_t *s)
+{
+	sum->calls += __atomic_load_n(&s->calls, __ATOMIC_RELAXED);
+	sum->bytes += __atomic_load_n(&s->bytes, __ATOMIC_RELAXED);
+	for (unsigned b = 0; b < CRC_STATS_BUCKETS; b++)
+		sum->histogram[b] += __atomic_load_n(&s->histogram[b], __ATOMIC_RELAXED);
+}
+
+crc_stats_thread::crc_stats_thread() : local(&crc_stats_local)
+{
+	std::lock_guard<std::mutex> lock(crc_stats_mutex);
+	next = crc_stats_threads;
+	crc_stats_threads = this;
+}
+
+crc_stats_thread::~crc_stats_thread()
+{
+	std::lock_guard<std::mutex> lock(crc_stats_mutex);
+	for (unsigned m = 0; m < CRC_MODELS; m++)
+		crc_stats_sum(&crc_stats_exited[m], &local->model[m]);
+	for (crc_stats_thread_t **t = &crc_stats_threads; *t; t = &(*t)->next) {
+		if (*t == this) {
+			*t = next;
+			break;
+		}
+	}
+	// later calls of this thread (other destructors) are not counted
+}
+
+static thread_local crc_stats_thread_t crc_stats_thread;
+
+/** Register the counters of this thread, called on its first CRC
+ */
+void crc_stats_link(void)
+{
+	crc_stats_local.linked = true;
+	(void)crc_stats_thread.local;	// constructs (links) it
+}
+
+static void crc_stats_total(const unsigned model, crc_stats_t *sum)
+{
+	memset(sum, 0, sizeof(*sum));
+	crc_stats_sum(sum, &crc_stats_exited[model]);
+	for (crc_stats_thread_t *t = crc_stats_threads; t; t = t->next)
+		crc_stats_sum(sum, &t->local->model[model]);
+}
+
+/** Statistics of a model since start or the last crc_stats_reset(), all threads
+ * @param model CRC_MODEL_xxx
+ * @param stats Calls, bytes and histogram of the lengths
+ * @return false if model is out of range
+ */
+bool crc_stats_get(const unsigned model, crc_stats_t *stats)
+{
+	if (model >= CRC_MODELS) return false;
+	std::lock_guard<std::mutex> lock(crc_stats_mutex);
+	const crc_stats_t *base = &crc_stats_base[model];
+	crc_stats_total(model, stats);
+	stats->calls -= base->calls;
+	stats->bytes -= base->bytes;
+	for (unsigned b = 0; b < CRC_STATS_BUCKETS; b++)
+		stats->histogram[b] -= base->histogram[b];
+	return true;
+}
+
+/** Start counting from zero
+ */
+void crc_stats_reset(void)
+{
+	std::lock_guard<std::mutex> lock(crc_stats_mutex);
+	for (unsigned m = 0; m < CRC_MODELS; m++)
+		crc_stats_total(m, &crc_stats_base[m]);
+}
+
+/** Write the statistics, models with calls only
+ * @param fd File descriptor
+ */
+void crc_stats_dump(int fd)
+{
+	crc_stats_t s;
+
+	dprintf(fd, "%-8s %12s %14s %10s  %s\n", "model", "calls", "bytes", "bytes/call", "calls per length");
+	for (unsigned m = 0; m < CRC_MODELS; m++) {
+		crc_stats_get(m, &s);
+		if (!s.calls) continue;
+		dprintf(fd, "%-8s %12llu %14llu %10.1f ", crc_model_name(m), (unsigned long long)s.calls,
+			(unsigned long long)s.bytes, (double)s.bytes / s.calls);
+		for (unsigned b = 0; b < CRC_STATS_BUCKETS; b++) {
+			if (!s.histogram[b]) continue;
+			if (b == 0) dprintf(fd, " 0:%llu", (unsigned long long)s.histogram[b]);
+			else if (b == CRC_STATS_BUCKETS - 1) dprintf(fd, " >=2^%u:%llu", b - 1, (unsigned long long)s.histogram[b]);
+			else dprintf(fd, " <2^%u:%llu", b, (unsigned long long)s.histogram[b]);
+		}
+		dprintf(fd, "\n");
+	}
+}
+
+#endif // #if CRC_STATS
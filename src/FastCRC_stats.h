@@ -0,0 +1,68 @@
+/* FastCRC library code is placed under the MIT license
+ * Copyright (c) 2014 - 2021 Frank Bösing
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+//
+// Hook for the call statistics (CRC_STATS), one per _upd() method.
+// The counters of a thread are written by this thread only: no atomic
+// read-modify-write, just relaxed stores so that crc_stats_get() can read them.
+//
+
+#if !defined(FastCRC_stats)
+#define FastCRC_stats
+
+#include "FastCRC_tune.h"
+
+#if CRC_STATS
+
+typedef struct {
+  crc_stats_t model[CRC_MODELS];
+  bool linked;						// registered for crc_stats_get()
+} crc_stats_local_t;
+
+extern thread_local crc_stats_local_t crc_stats_local;
+void crc_stats_link(void);
+
+static inline void crc_stats_add(const unsigned model, const size_t len)
+{
+	if (CRC_TUNE_TIMING()) return;
+
+	crc_stats_local_t *l = &crc_stats_local;
+	if (!l->linked) crc_stats_link();
+
+	crc_stats_t *s = &l->model[model];
+	unsigned b = len ? 64 - __builtin_clzll((unsigned long long)len) : 0;
+	if (b > CRC_STATS_BUCKETS - 1) b = CRC_STATS_BUCKETS - 1;
+	__atomic_store_n(&s->calls, s->calls + 1, __ATOMIC_RELAXED);
+	__atomic_store_n(&s->bytes, s->bytes + len, __ATOMIC_RELAXED);
+	__atomic_store_n(&s->histogram[b], s->histogram[b] + 1, __ATOMIC_RELAXED);
+}
+
+#define CRC_STATS_ADD(model, len) crc_stats_add(model, len)
+
+#else
+#define CRC_STATS_ADD(model, len)
+#endif
+
+#endif
@@ -40,12 +40,19 @@
 #endif
 #endif
 #endif
+// Every table starts on its own cache line (not on AVR, to save flash):
+#if defined(__AVR__)
+#define CRC_TABLE_ALIGN
+#else
+#define CRC_TABLE_ALIGN __attribute__((aligned(64)))
+#endif
+
 #ifndef PROGMEM
 // usefull if you're trying to test the lib in a non arduino env (in cppyy on x64 for exemple)
 #define PROGMEM
 #define PROGMEM_MOCK_ACTIVE
 #endif
-const uint8_t crc_table_crc7[256] PROGMEM = {
+const uint8_t crc_table_crc7[256] CRC_TABLE_ALIGN PROGMEM = {
 	0x00, 0x12, 0x24, 0x36, 0x48, 0x5a, 0x6c, 0x7e,
 	0x90, 0x82, 0xb4, 0xa6, 0xd8, 0xca, 0xfc, 0xee,
 	0x32, 0x20, 0x16, 0x04, 0x7a, 0x68, 0x5e, 0x4c,
@@ -80,7 +87,7 @@ const uint8_t crc_table_crc7[256] PROGMEM = {
 	0x8c, 0x9e, 0xa8, 0xba, 0xc4, 0xd6, 0xe0, 0xf2
 };
 
-const uint8_t crc_table_smbus[256] PROGMEM = {
+const uint8_t crc_table_smbus[256] CRC_TABLE_ALIGN PROGMEM = {
 	0x00, 0x07, 0x0e, 0x09, 0x1c, 0x1b, 0x12, 0x15,
 	0x38, 0x3f, 0x36, 0x31, 0x24, 0x23, 0x2a, 0x2d,
 	0x70, 0x77, 0x7e, 0x79, 0x6c, 0x6b, 0x62, 0x65,
@@ -115,7 +122,7 @@ const uint8_t crc_table_smbus[256] PROGMEM = {
 	0xe6, 0xe1, 0xe8, 0xef, 0xfa, 0xfd, 0xf4, 0xf3
 };
 
-const uint8_t crc_table_maxim[256] PROGMEM = {
+const uint8_t crc_table_maxim[256] CRC_TABLE_ALIGN PROGMEM = {
 	0x00, 0x5e, 0xbc, 0xe2, 0x61, 0x3f, 0xdd, 0x83,
 	0xc2, 0x9c, 0x7e, 0x20, 0xa3, 0xfd, 0x1f, 0x41,
 	0x9d, 0xc3, 0x21, 0x7f, 0xfc, 0xa2, 0x40, 0x1e,
@@ -150,7 +157,8 @@ const uint8_t crc_table_maxim[256] PROGMEM = {
 	0xb6, 0xe8, 0x0a, 0x54, 0xd7, 0x89, 0x6b, 0x35
 };
 
-const unsigned short crc_table_ccitt[1024] PROGMEM = {
+// ccitt, xmodem
+const uint16_t crc_table_ccitt[1024] CRC_TABLE_ALIGN PROGMEM = {
 	0x0000, 0x2110, 0x4220, 0x6330, 0x8440, 0xa550, 0xc660, 0xe770,
 	0x0881, 0x2991, 0x4aa1, 0x6bb1, 0x8cc1, 0xadd1, 0xcee1, 0xeff1,
 	0x3112, 0x1002, 0x7332, 0x5222, 0xb552, 0x9442, 0xf772, 0xd662,
@@ -281,138 +289,7 @@ const unsigned short crc_table_ccitt[1024] PROGMEM = {
 	0x8e1a, 0x3a6c, 0xe6f7, 0x5281, 0x7fd0, 0xcba6, 0x173d, 0xa34b
 };
 
-const uint16_t crc_table_mcrf4xx[1024] PROGMEM = {
-	0x0000, 0x1189, 0x2312, 0x329b, 0x4624, 0x57ad, 0x6536, 0x74bf,
-	0x8c48, 0x9dc1, 0xaf5a, 0xbed3, 0xca6c, 0xdbe5, 0xe97e, 0xf8f7,
-	0x1081, 0x0108, 0x3393, 0x221a, 0x56a5, 0x472c, 0x75b7, 0x643e,
-	0x9cc9, 0x8d40, 0xbfdb, 0xae52, 0xdaed, 0xcb64, 0xf9ff, 0xe876,
-	0x2102, 0x308b, 0x0210, 0x1399, 0x6726, 0x76af, 0x4434, 0x55bd,
-	0xad4a, 0xbcc3, 0x8e58, 0x9fd1, 0xeb6e, 0xfae7, 0xc87c, 0xd9f5,
-	0x3183, 0x200a, 0x1291, 0x0318, 0x77a7, 0x662e, 0x54b5, 0x453c,
-	0xbdcb, 0xac42, 0x9ed9, 0x8f50, 0xfbef, 0xea66, 0xd8fd, 0xc974,
-	0x4204, 0x538d, 0x6116, 0x709f, 0x0420, 0x15a9, 0x2732, 0x36bb,
-	0xce4c, 0xdfc5, 0xed5e, 0xfcd7, 0x8868, 0x99e1, 0xab7a, 0xbaf3,
-	0x5285, 0x430c, 0x7197, 0x601e, 0x14a1, 0x0528, 0x37b3, 0x263a,
-	0xdecd, 0xcf44, 0xfddf, 0xec56, 0x98e9, 0x8960, 0xbbfb, 0xaa72,
-	0x6306, 0x728f, 0x4014, 0x519d, 0x2522, 0x34ab, 0x0630, 0x17b9,
-	0xef4e, 0xfec7, 0xcc5c, 0xddd5, 0xa96a, 0xb8e3, 0x8a78, 0x9bf1,
-	0x7387, 0x620e, 0x5095, 0x411c, 0x35a3, 0x242a, 0x16b1, 0x0738,
-	0xffcf, 0xee46, 0xdcdd, 0xcd54, 0xb9eb, 0xa862, 0x9af9, 0x8b70,
-	0x8408, 0x9581, 0xa71a, 0xb693, 0xc22c, 0xd3a5, 0xe13e, 0xf0b7,
-	0x0840, 0x19c9, 0x2b52, 0x3adb, 0x4e64, 0x5fed, 0x6d76, 0x7cff,
-	0x9489, 0x8500, 0xb79b, 0xa612, 0xd2ad, 0xc324, 0xf1bf, 0xe036,
-	0x18c1, 0x0948, 0x3bd3, 0x2a5a, 0x5ee5, 0x4f6c, 0x7df7, 0x6c7e,
-	0xa50a, 0xb483, 0x8618, 0x9791, 0xe32e, 0xf2a7, 0xc03c, 0xd1b5,
-	0x2942, 0x38cb, 0x0a50, 0x1bd9, 0x6f66, 0x7eef, 0x4c74, 0x5dfd,
-	0xb58b, 0xa402, 0x9699, 0x8710, 0xf3af, 0xe226, 0xd0bd, 0xc134,
-	0x39c3, 0x284a, 0x1ad1, 0x0b58, 0x7fe7, 0x6e6e, 0x5cf5, 0x4d7c,
-	0xc60c, 0xd785, 0xe51e, 0xf497, 0x8028, 0x91a1, 0xa33a, 0xb2b3,
-	0x4a44, 0x5bcd, 0x6956, 0x78df, 0x0c60, 0x1de9, 0x2f72, 0x3efb,
-	0xd68d, 0xc704, 0xf59f, 0xe416, 0x90a9, 0x8120, 0xb3bb, 0xa232,
-	0x5ac5, 0x4b4c, 0x79d7, 0x685e, 0x1ce1, 0x0d68, 0x3ff3, 0x2e7a,
-	0xe70e, 0xf687, 0xc41c, 0xd595, 0xa12a, 0xb0a3, 0x8238, 0x93b1,
-	0x6b46, 0x7acf, 0x4854, 0x59dd, 0x2d62, 0x3ceb, 0x0e70, 0x1ff9,
-	0xf78f, 0xe606, 0xd49d, 0xc514, 0xb1ab, 0xa022, 0x92b9, 0x8330,
-	0x7bc7, 0x6a4e, 0x58d5, 0x495c, 0x3de3, 0x2c6a, 0x1ef1, 0x0f78,
-	0x0000, 0x19d8, 0x33b0, 0x2a68, 0x6760, 0x7eb8, 0x54d0, 0x4d08,
-	0xcec0, 0xd718, 0xfd70, 0xe4a8, 0xa9a0, 0xb078, 0x9a10, 0x83c8,
-	0x9591, 0x8c49, 0xa621, 0xbff9, 0xf2f1, 0xeb29, 0xc141, 0xd899,
-	0x5b51, 0x4289, 0x68e1, 0x7139, 0x3c31, 0x25e9, 0x0f81, 0x1659,
-	0x2333, 0x3aeb, 0x1083, 0x095b, 0x4453, 0x5d8b, 0x77e3, 0x6e3b,
-	0xedf3, 0xf42b, 0xde43, 0xc79b, 0x8a93, 0x934b, 0xb923, 0xa0fb,
-	0xb6a2, 0xaf7a, 0x8512, 0x9cca, 0xd1c2, 0xc81a, 0xe272, 0xfbaa,
-	0x7862, 0x61ba, 0x4bd2, 0x520a, 0x1f02, 0x06da, 0x2cb2, 0x356a,
-	0x4666, 0x5fbe, 0x75d6, 0x6c0e, 0x2106, 0x38de, 0x12b6, 0x0b6e,
-	0x88a6, 0x917e, 0xbb16, 0xa2ce, 0xefc6, 0xf61e, 0xdc76, 0xc5ae,
-	0xd3f7, 0xca2f, 0xe047, 0xf99f, 0xb497, 0xad4f, 0x8727, 0x9eff,
-	0x1d37, 0x04ef, 0x2e87, 0x375f, 0x7a57, 0x638f, 0x49e7, 0x503f,
-	0x6555, 0x7c8d, 0x56e5, 0x4f3d, 0x0235, 0x1bed, 0x3185, 0x285d,
-	0xab95, 0xb24d, 0x9825, 0x81fd, 0xccf5, 0xd52d, 0xff45, 0xe69d,
-	0xf0c4, 0xe91c, 0xc374, 0xdaac, 0x97a4, 0x8e7c, 0xa414, 0xbdcc,
-	0x3e04, 0x27dc, 0x0db4, 0x146c, 0x5964, 0x40bc, 0x6ad4, 0x730c,
-	0x8ccc, 0x9514, 0xbf7c, 0xa6a4, 0xebac, 0xf274, 0xd81c, 0xc1c4,
-	0x420c, 0x5bd4, 0x71bc, 0x6864, 0x256c, 0x3cb4, 0x16dc, 0x0f04,
-	0x195d, 0x0085, 0x2aed, 0x3335, 0x7e3d, 0x67e5, 0x4d8d, 0x5455,
-	0xd79d, 0xce45, 0xe42d, 0xfdf5, 0xb0fd, 0xa925, 0x834d, 0x9a95,
-	0xafff, 0xb627, 0x9c4f, 0x8597, 0xc89f, 0xd147, 0xfb2f, 0xe2f7,
-	0x613f, 0x78e7, 0x528f, 0x4b57, 0x065f, 0x1f87, 0x35ef, 0x2c37,
-	0x3a6e, 0x23b6, 0x09de, 0x1006, 0x5d0e, 0x44d6, 0x6ebe, 0x7766,
-	0xf4ae, 0xed76, 0xc71e, 0xdec6, 0x93ce, 0x8a16, 0xa07e, 0xb9a6,
-	0xcaaa, 0xd372, 0xf91a, 0xe0c2, 0xadca, 0xb412, 0x9e7a, 0x87a2,
-	0x046a, 0x1db2, 0x37da, 0x2e02, 0x630a, 0x7ad2, 0x50ba, 0x4962,
-	0x5f3b, 0x46e3, 0x6c8b, 0x7553, 0x385b, 0x2183, 0x0beb, 0x1233,
-	0x91fb, 0x8823, 0xa24b, 0xbb93, 0xf69b, 0xef43, 0xc52b, 0xdcf3,
-	0xe999, 0xf041, 0xda29, 0xc3f1, 0x8ef9, 0x9721, 0xbd49, 0xa491,
-	0x2759, 0x3e81, 0x14e9, 0x0d31, 0x4039, 0x59e1, 0x7389, 0x6a51,
-	0x7c08, 0x65d0, 0x4fb8, 0x5660, 0x1b68, 0x02b0, 0x28d8, 0x3100,
-	0xb2c8, 0xab10, 0x8178, 0x98a0, 0xd5a8, 0xcc70, 0xe618, 0xffc0,
-	0x0000, 0x5adc, 0xb5b8, 0xef64, 0x6361, 0x39bd, 0xd6d9, 0x8c05,
-	0xc6c2, 0x9c1e, 0x737a, 0x29a6, 0xa5a3, 0xff7f, 0x101b, 0x4ac7,
-	0x8595, 0xdf49, 0x302d, 0x6af1, 0xe6f4, 0xbc28, 0x534c, 0x0990,
-	0x4357, 0x198b, 0xf6ef, 0xac33, 0x2036, 0x7aea, 0x958e, 0xcf52,
-	0x033b, 0x59e7, 0xb683, 0xec5f, 0x605a, 0x3a86, 0xd5e2, 0x8f3e,
-	0xc5f9, 0x9f25, 0x7041, 0x2a9d, 0xa698, 0xfc44, 0x1320, 0x49fc,
-	0x86ae, 0xdc72, 0x3316, 0x69ca, 0xe5cf, 0xbf13, 0x5077, 0x0aab,
-	0x406c, 0x1ab0, 0xf5d4, 0xaf08, 0x230d, 0x79d1, 0x96b5, 0xcc69,
-	0x0676, 0x5caa, 0xb3ce, 0xe912, 0x6517, 0x3fcb, 0xd0af, 0x8a73,
-	0xc0b4, 0x9a68, 0x750c, 0x2fd0, 0xa3d5, 0xf909, 0x166d, 0x4cb1,
-	0x83e3, 0xd93f, 0x365b, 0x6c87, 0xe082, 0xba5e, 0x553a, 0x0fe6,
-	0x4521, 0x1ffd, 0xf099, 0xaa45, 0x2640, 0x7c9c, 0x93f8, 0xc924,
-	0x054d, 0x5f91, 0xb0f5, 0xea29, 0x662c, 0x3cf0, 0xd394, 0x8948,
-	0xc38f, 0x9953, 0x7637, 0x2ceb, 0xa0ee, 0xfa32, 0x1556, 0x4f8a,
-	0x80d8, 0xda04, 0x3560, 0x6fbc, 0xe3b9, 0xb965, 0x5601, 0x0cdd,
-	0x461a, 0x1cc6, 0xf3a2, 0xa97e, 0x257b, 0x7fa7, 0x90c3, 0xca1f,
-	0x0cec, 0x5630, 0xb954, 0xe388, 0x6f8d, 0x3551, 0xda35, 0x80e9,
-	0xca2e, 0x90f2, 0x7f96, 0x254a, 0xa94f, 0xf393, 0x1cf7, 0x462b,
-	0x8979, 0xd3a5, 0x3cc1, 0x661d, 0xea18, 0xb0c4, 0x5fa0, 0x057c,
-	0x4fbb, 0x1567, 0xfa03, 0xa0df, 0x2cda, 0x7606, 0x9962, 0xc3be,
-	0x0fd7, 0x550b, 0xba6f, 0xe0b3, 0x6cb6, 0x366a, 0xd90e, 0x83d2,
-	0xc915, 0x93c9, 0x7cad, 0x2671, 0xaa74, 0xf0a8, 0x1fcc, 0x4510,
-	0x8a42, 0xd09e, 0x3ffa, 0x6526, 0xe923, 0xb3ff, 0x5c9b, 0x0647,
-	0x4c80, 0x165c, 0xf938, 0xa3e4, 0x2fe1, 0x753d, 0x9a59, 0xc085,
-	0x0a9a, 0x5046, 0xbf22, 0xe5fe, 0x69fb, 0x3327, 0xdc43, 0x869f,
-	0xcc58, 0x9684, 0x79e0, 0x233c, 0xaf39, 0xf5e5, 0x1a81, 0x405d,
-	0x8f0f, 0xd5d3, 0x3ab7, 0x606b, 0xec6e, 0xb6b2, 0x59d6, 0x030a,
-	0x49cd, 0x1311, 0xfc75, 0xa6a9, 0x2aac, 0x7070, 0x9f14, 0xc5c8,
-	0x09a1, 0x537d, 0xbc19, 0xe6c5, 0x6ac0, 0x301c, 0xdf78, 0x85a4,
-	0xcf63, 0x95bf, 0x7adb, 0x2007, 0xac02, 0xf6de, 0x19ba, 0x4366,
-	0x8c34, 0xd6e8, 0x398c, 0x6350, 0xef55, 0xb589, 0x5aed, 0x0031,
-	0x4af6, 0x102a, 0xff4e, 0xa592, 0x2997, 0x734b, 0x9c2f, 0xc6f3,
-	0x0000, 0x1cbb, 0x3976, 0x25cd, 0x72ec, 0x6e57, 0x4b9a, 0x5721,
-	0xe5d8, 0xf963, 0xdcae, 0xc015, 0x9734, 0x8b8f, 0xae42, 0xb2f9,
-	0xc3a1, 0xdf1a, 0xfad7, 0xe66c, 0xb14d, 0xadf6, 0x883b, 0x9480,
-	0x2679, 0x3ac2, 0x1f0f, 0x03b4, 0x5495, 0x482e, 0x6de3, 0x7158,
-	0x8f53, 0x93e8, 0xb625, 0xaa9e, 0xfdbf, 0xe104, 0xc4c9, 0xd872,
-	0x6a8b, 0x7630, 0x53fd, 0x4f46, 0x1867, 0x04dc, 0x2111, 0x3daa,
-	0x4cf2, 0x5049, 0x7584, 0x693f, 0x3e1e, 0x22a5, 0x0768, 0x1bd3,
-	0xa92a, 0xb591, 0x905c, 0x8ce7, 0xdbc6, 0xc77d, 0xe2b0, 0xfe0b,
-	0x16b7, 0x0a0c, 0x2fc1, 0x337a, 0x645b, 0x78e0, 0x5d2d, 0x4196,
-	0xf36f, 0xefd4, 0xca19, 0xd6a2, 0x8183, 0x9d38, 0xb8f5, 0xa44e,
-	0xd516, 0xc9ad, 0xec60, 0xf0db, 0xa7fa, 0xbb41, 0x9e8c, 0x8237,
-	0x30ce, 0x2c75, 0x09b8, 0x1503, 0x4222, 0x5e99, 0x7b54, 0x67ef,
-	0x99e4, 0x855f, 0xa092, 0xbc29, 0xeb08, 0xf7b3, 0xd27e, 0xcec5,
-	0x7c3c, 0x6087, 0x454a, 0x59f1, 0x0ed0, 0x126b, 0x37a6, 0x2b1d,
-	0x5a45, 0x46fe, 0x6333, 0x7f88, 0x28a9, 0x3412, 0x11df, 0x0d64,
-	0xbf9d, 0xa326, 0x86eb, 0x9a50, 0xcd71, 0xd1ca, 0xf407, 0xe8bc,
-	0x2d6e, 0x31d5, 0x1418, 0x08a3, 0x5f82, 0x4339, 0x66f4, 0x7a4f,
-	0xc8b6, 0xd40d, 0xf1c0, 0xed7b, 0xba5a, 0xa6e1, 0x832c, 0x9f97,
-	0xeecf, 0xf274, 0xd7b9, 0xcb02, 0x9c23, 0x8098, 0xa555, 0xb9ee,
-	0x0b17, 0x17ac, 0x3261, 0x2eda, 0x79fb, 0x6540, 0x408d, 0x5c36,
-	0xa23d, 0xbe86, 0x9b4b, 0x87f0, 0xd0d1, 0xcc6a, 0xe9a7, 0xf51c,
-	0x47e5, 0x5b5e, 0x7e93, 0x6228, 0x3509, 0x29b2, 0x0c7f, 0x10c4,
-	0x619c, 0x7d27, 0x58ea, 0x4451, 0x1370, 0x0fcb, 0x2a06, 0x36bd,
-	0x8444, 0x98ff, 0xbd32, 0xa189, 0xf6a8, 0xea13, 0xcfde, 0xd365,
-	0x3bd9, 0x2762, 0x02af, 0x1e14, 0x4935, 0x558e, 0x7043, 0x6cf8,
-	0xde01, 0xc2ba, 0xe777, 0xfbcc, 0xaced, 0xb056, 0x959b, 0x8920,
-	0xf878, 0xe4c3, 0xc10e, 0xddb5, 0x8a94, 0x962f, 0xb3e2, 0xaf59,
-	0x1da0, 0x011b, 0x24d6, 0x386d, 0x6f4c, 0x73f7, 0x563a, 0x4a81,
-	0xb48a, 0xa831, 0x8dfc, 0x9147, 0xc666, 0xdadd, 0xff10, 0xe3ab,
-	0x5152, 0x4de9, 0x6824, 0x749f, 0x23be, 0x3f05, 0x1ac8, 0x0673,
-	0x772b, 0x6b90, 0x4e5d, 0x52e6, 0x05c7, 0x197c, 0x3cb1, 0x200a,
-	0x92f3, 0x8e48, 0xab85, 0xb73e, 0xe01f, 0xfca4, 0xd969, 0xc5d2
-};
-
-const uint16_t crc_table_modbus[1024] PROGMEM = {
+const uint16_t crc_table_modbus[1024] CRC_TABLE_ALIGN PROGMEM = {
 	0x0000, 0xc0c1, 0xc181, 0x0140, 0xc301, 0x03c0, 0x0280, 0xc241,
 	0xc601, 0x06c0, 0x0780, 0xc741, 0x0500, 0xc5c1, 0xc481, 0x0440,
 	0xcc01, 0x0cc0, 0x0d80, 0xcd41, 0x0f00, 0xcfc1, 0xce81, 0x0e40,
@@ -543,7 +420,8 @@ const uint16_t crc_table_modbus[1024] PROGMEM = {
 	0x6031, 0x9c30, 0xd830, 0x2431, 0x5030, 0xac31, 0xe831, 0x1430
 };
 
-const uint16_t crc_table_kermit[1024] PROGMEM = {
+// kermit, mcrf4xx, x25
+const uint16_t crc_table_kermit[1024] CRC_TABLE_ALIGN PROGMEM = {
 	0x0000, 0x1189, 0x2312, 0x329b, 0x4624, 0x57ad, 0x6536, 0x74bf,
 	0x8c48, 0x9dc1, 0xaf5a, 0xbed3, 0xca6c, 0xdbe5, 0xe97e, 0xf8f7,
 	0x1081, 0x0108, 0x3393, 0x221a, 0x56a5, 0x472c, 0x75b7, 0x643e,
@@ -674,269 +552,42 @@ const uint16_t crc_table_kermit[1024] PROGMEM = {
 	0x92f3, 0x8e48, 0xab85, 0xb73e, 0xe01f, 0xfca4, 0xd969, 0xc5d2
 };
 
-const uint16_t crc_table_xmodem[1024] PROGMEM = {
-	0x0000, 0x2110, 0x4220, 0x6330, 0x8440, 0xa550, 0xc660, 0xe770,
-	0x0881, 0x2991, 0x4aa1, 0x6bb1, 0x8cc1, 0xadd1, 0xcee1, 0xeff1,
-	0x3112, 0x1002, 0x7332, 0x5222, 0xb552, 0x9442, 0xf772, 0xd662,
-	0x3993, 0x1883, 0x7bb3, 0x5aa3, 0xbdd3, 0x9cc3, 0xfff3, 0xdee3,
-	0x6224, 0x4334, 0x2004, 0x0114, 0xe664, 0xc774, 0xa444, 0x8554,
-	0x6aa5, 0x4bb5, 0x2885, 0x0995, 0xeee5, 0xcff5, 0xacc5, 0x8dd5,
-	0x5336, 0x7226, 0x1116, 0x3006, 0xd776, 0xf666, 0x9556, 0xb446,
-	0x5bb7, 0x7aa7, 0x1997, 0x3887, 0xdff7, 0xfee7, 0x9dd7, 0xbcc7,
-	0xc448, 0xe558, 0x8668, 0xa778, 0x4008, 0x6118, 0x0228, 0x2338,
-	0xccc9, 0xedd9, 0x8ee9, 0xaff9, 0x4889, 0x6999, 0x0aa9, 0x2bb9,
-	0xf55a, 0xd44a, 0xb77a, 0x966a, 0x711a, 0x500a, 0x333a, 0x122a,
-	0xfddb, 0xdccb, 0xbffb, 0x9eeb, 0x799b, 0x588b, 0x3bbb, 0x1aab,
-	0xa66c, 0x877c, 0xe44c, 0xc55c, 0x222c, 0x033c, 0x600c, 0x411c,
-	0xaeed, 0x8ffd, 0xeccd, 0xcddd, 0x2aad, 0x0bbd, 0x688d, 0x499d,
-	0x977e, 0xb66e, 0xd55e, 0xf44e, 0x133e, 0x322e, 0x511e, 0x700e,
-	0x9fff, 0xbeef, 0xdddf, 0xfccf, 0x1bbf, 0x3aaf, 0x599f, 0x788f,
-	0x8891, 0xa981, 0xcab1, 0xeba1, 0x0cd1, 0x2dc1, 0x4ef1, 0x6fe1,
-	0x8010, 0xa100, 0xc230, 0xe320, 0x0450, 0x2540, 0x4670, 0x6760,
-	0xb983, 0x9893, 0xfba3, 0xdab3, 0x3dc3, 0x1cd3, 0x7fe3, 0x5ef3,
-	0xb102, 0x9012, 0xf322, 0xd232, 0x3542, 0x1452, 0x7762, 0x5672,
-	0xeab5, 0xcba5, 0xa895, 0x8985, 0x6ef5, 0x4fe5, 0x2cd5, 0x0dc5,
-	0xe234, 0xc324, 0xa014, 0x8104, 0x6674, 0x4764, 0x2454, 0x0544,
-	0xdba7, 0xfab7, 0x9987, 0xb897, 0x5fe7, 0x7ef7, 0x1dc7, 0x3cd7,
-	0xd326, 0xf236, 0x9106, 0xb016, 0x5766, 0x7676, 0x1546, 0x3456,
-	0x4cd9, 0x6dc9, 0x0ef9, 0x2fe9, 0xc899, 0xe989, 0x8ab9, 0xaba9,
-	0x4458, 0x6548, 0x0678, 0x2768, 0xc018, 0xe108, 0x8238, 0xa328,
-	0x7dcb, 0x5cdb, 0x3feb, 0x1efb, 0xf98b, 0xd89b, 0xbbab, 0x9abb,
-	0x754a, 0x545a, 0x376a, 0x167a, 0xf10a, 0xd01a, 0xb32a, 0x923a,
-	0x2efd, 0x0fed, 0x6cdd, 0x4dcd, 0xaabd, 0x8bad, 0xe89d, 0xc98d,
-	0x267c, 0x076c, 0x645c, 0x454c, 0xa23c, 0x832c, 0xe01c, 0xc10c,
-	0x1fef, 0x3eff, 0x5dcf, 0x7cdf, 0x9baf, 0xbabf, 0xd98f, 0xf89f,
-	0x176e, 0x367e, 0x554e, 0x745e, 0x932e, 0xb23e, 0xd10e, 0xf01e,
-	0x0000, 0x3133, 0x6266, 0x5355, 0xc4cc, 0xf5ff, 0xa6aa, 0x9799,
-	0xa989, 0x98ba, 0xcbef, 0xfadc, 0x6d45, 0x5c76, 0x0f23, 0x3e10,
-	0x7303, 0x4230, 0x1165, 0x2056, 0xb7cf, 0x86fc, 0xd5a9, 0xe49a,
-	0xda8a, 0xebb9, 0xb8ec, 0x89df, 0x1e46, 0x2f75, 0x7c20, 0x4d13,
-	0xe606, 0xd735, 0x8460, 0xb553, 0x22ca, 0x13f9, 0x40ac, 0x719f,
-	0x4f8f, 0x7ebc, 0x2de9, 0x1cda, 0x8b43, 0xba70, 0xe925, 0xd816,
-	0x9505, 0xa436, 0xf763, 0xc650, 0x51c9, 0x60fa, 0x33af, 0x029c,
-	0x3c8c, 0x0dbf, 0x5eea, 0x6fd9, 0xf840, 0xc973, 0x9a26, 0xab15,
-	0xcc0d, 0xfd3e, 0xae6b, 0x9f58, 0x08c1, 0x39f2, 0x6aa7, 0x5b94,
-	0x6584, 0x54b7, 0x07e2, 0x36d1, 0xa148, 0x907b, 0xc32e, 0xf21d,
-	0xbf0e, 0x8e3d, 0xdd68, 0xec5b, 0x7bc2, 0x4af1, 0x19a4, 0x2897,
-	0x1687, 0x27b4, 0x74e1, 0x45d2, 0xd24b, 0xe378, 0xb02d, 0x811e,
-	0x2a0b, 0x1b38, 0x486d, 0x795e, 0xeec7, 0xdff4, 0x8ca1, 0xbd92,
-	0x8382, 0xb2b1, 0xe1e4, 0xd0d7, 0x474e, 0x767d, 0x2528, 0x141b,
-	0x5908, 0x683b, 0x3b6e, 0x0a5d, 0x9dc4, 0xacf7, 0xffa2, 0xce91,
-	0xf081, 0xc1b2, 0x92e7, 0xa3d4, 0x344d, 0x057e, 0x562b, 0x6718,
-	0x981b, 0xa928, 0xfa7d, 0xcb4e, 0x5cd7, 0x6de4, 0x3eb1, 0x0f82,
-	0x3192, 0x00a1, 0x53f4, 0x62c7, 0xf55e, 0xc46d, 0x9738, 0xa60b,
-	0xeb18, 0xda2b, 0x897e, 0xb84d, 0x2fd4, 0x1ee7, 0x4db2, 0x7c81,
-	0x4291, 0x73a2, 0x20f7, 0x11c4, 0x865d, 0xb76e, 0xe43b, 0xd508,
-	0x7e1d, 0x4f2e, 0x1c7b, 0x2d48, 0xbad1, 0x8be2, 0xd8b7, 0xe984,
-	0xd794, 0xe6a7, 0xb5f2, 0x84c1, 0x1358, 0x226b, 0x713e, 0x400d,
-	0x0d1e, 0x3c2d, 0x6f78, 0x5e4b, 0xc9d2, 0xf8e1, 0xabb4, 0x9a87,
-	0xa497, 0x95a4, 0xc6f1, 0xf7c2, 0x605b, 0x5168, 0x023d, 0x330e,
-	0x5416, 0x6525, 0x3670, 0x0743, 0x90da, 0xa1e9, 0xf2bc, 0xc38f,
-	0xfd9f, 0xccac, 0x9ff9, 0xaeca, 0x3953, 0x0860, 0x5b35, 0x6a06,
-	0x2715, 0x1626, 0x4573, 0x7440, 0xe3d9, 0xd2ea, 0x81bf, 0xb08c,
-	0x8e9c, 0xbfaf, 0xecfa, 0xddc9, 0x4a50, 0x7b63, 0x2836, 0x1905,
-	0xb210, 0x8323, 0xd076, 0xe145, 0x76dc, 0x47ef, 0x14ba, 0x2589,
-	0x1b99, 0x2aaa, 0x79ff, 0x48cc, 0xdf55, 0xee66, 0xbd33, 0x8c00,
-	0xc113, 0xf020, 0xa375, 0x9246, 0x05df, 0x34ec, 0x67b9, 0x568a,
-	0x689a, 0x59a9, 0x0afc, 0x3bcf, 0xac56, 0x9d65, 0xce30, 0xff03,
-	0x0000, 0x3037, 0x606e, 0x5059, 0xc0dc, 0xf0eb, 0xa0b2, 0x9085,
-	0xa1a9, 0x919e, 0xc1c7, 0xf1f0, 0x6175, 0x5142, 0x011b, 0x312c,
-	0x6343, 0x5374, 0x032d, 0x331a, 0xa39f, 0x93a8, 0xc3f1, 0xf3c6,
-	0xc2ea, 0xf2dd, 0xa284, 0x92b3, 0x0236, 0x3201, 0x6258, 0x526f,
-	0xc686, 0xf6b1, 0xa6e8, 0x96df, 0x065a, 0x366d, 0x6634, 0x5603,
-	0x672f, 0x5718, 0x0741, 0x3776, 0xa7f3, 0x97c4, 0xc79d, 0xf7aa,
-	0xa5c5, 0x95f2, 0xc5ab, 0xf59c, 0x6519, 0x552e, 0x0577, 0x3540,
-	0x046c, 0x345b, 0x6402, 0x5435, 0xc4b0, 0xf487, 0xa4de, 0x94e9,
-	0xad1d, 0x9d2a, 0xcd73, 0xfd44, 0x6dc1, 0x5df6, 0x0daf, 0x3d98,
-	0x0cb4, 0x3c83, 0x6cda, 0x5ced, 0xcc68, 0xfc5f, 0xac06, 0x9c31,
-	0xce5e, 0xfe69, 0xae30, 0x9e07, 0x0e82, 0x3eb5, 0x6eec, 0x5edb,
-	0x6ff7, 0x5fc0, 0x0f99, 0x3fae, 0xaf2b, 0x9f1c, 0xcf45, 0xff72,
-	0x6b9b, 0x5bac, 0x0bf5, 0x3bc2, 0xab47, 0x9b70, 0xcb29, 0xfb1e,
-	0xca32, 0xfa05, 0xaa5c, 0x9a6b, 0x0aee, 0x3ad9, 0x6a80, 0x5ab7,
-	0x08d8, 0x38ef, 0x68b6, 0x5881, 0xc804, 0xf833, 0xa86a, 0x985d,
-	0xa971, 0x9946, 0xc91f, 0xf928, 0x69ad, 0x599a, 0x09c3, 0x39f4,
-	0x5a3b, 0x6a0c, 0x3a55, 0x0a62, 0x9ae7, 0xaad0, 0xfa89, 0xcabe,
-	0xfb92, 0xcba5, 0x9bfc, 0xabcb, 0x3b4e, 0x0b79, 0x5b20, 0x6b17,
-	0x3978, 0x094f, 0x5916, 0x6921, 0xf9a4, 0xc993, 0x99ca, 0xa9fd,
-	0x98d1, 0xa8e6, 0xf8bf, 0xc888, 0x580d, 0x683a, 0x3863, 0x0854,
-	0x9cbd, 0xac8a, 0xfcd3, 0xcce4, 0x5c61, 0x6c56, 0x3c0f, 0x0c38,
-	0x3d14, 0x0d23, 0x5d7a, 0x6d4d, 0xfdc8, 0xcdff, 0x9da6, 0xad91,
-	0xfffe, 0xcfc9, 0x9f90, 0xafa7, 0x3f22, 0x0f15, 0x5f4c, 0x6f7b,
-	0x5e57, 0x6e60, 0x3e39, 0x0e0e, 0x9e8b, 0xaebc, 0xfee5, 0xced2,
-	0xf726, 0xc711, 0x9748, 0xa77f, 0x37fa, 0x07cd, 0x5794, 0x67a3,
-	0x568f, 0x66b8, 0x36e1, 0x06d6, 0x9653, 0xa664, 0xf63d, 0xc60a,
-	0x9465, 0xa452, 0xf40b, 0xc43c, 0x54b9, 0x648e, 0x34d7, 0x04e0,
-	0x35cc, 0x05fb, 0x55a2, 0x6595, 0xf510, 0xc527, 0x957e, 0xa549,
-	0x31a0, 0x0197, 0x51ce, 0x61f9, 0xf17c, 0xc14b, 0x9112, 0xa125,
-	0x9009, 0xa03e, 0xf067, 0xc050, 0x50d5, 0x60e2, 0x30bb, 0x008c,
-	0x52e3, 0x62d4, 0x328d, 0x02ba, 0x923f, 0xa208, 0xf251, 0xc266,
-	0xf34a, 0xc37d, 0x9324, 0xa313, 0x3396, 0x03a1, 0x53f8, 0x63cf,
-	0x0000, 0xb476, 0x68ed, 0xdc9b, 0xf1ca, 0x45bc, 0x9927, 0x2d51,
-	0xc385, 0x77f3, 0xab68, 0x1f1e, 0x324f, 0x8639, 0x5aa2, 0xeed4,
-	0xa71b, 0x136d, 0xcff6, 0x7b80, 0x56d1, 0xe2a7, 0x3e3c, 0x8a4a,
-	0x649e, 0xd0e8, 0x0c73, 0xb805, 0x9554, 0x2122, 0xfdb9, 0x49cf,
-	0x4e37, 0xfa41, 0x26da, 0x92ac, 0xbffd, 0x0b8b, 0xd710, 0x6366,
-	0x8db2, 0x39c4, 0xe55f, 0x5129, 0x7c78, 0xc80e, 0x1495, 0xa0e3,
-	0xe92c, 0x5d5a, 0x81c1, 0x35b7, 0x18e6, 0xac90, 0x700b, 0xc47d,
-	0x2aa9, 0x9edf, 0x4244, 0xf632, 0xdb63, 0x6f15, 0xb38e, 0x07f8,
-	0x9c6e, 0x2818, 0xf483, 0x40f5, 0x6da4, 0xd9d2, 0x0549, 0xb13f,
-	0x5feb, 0xeb9d, 0x3706, 0x8370, 0xae21, 0x1a57, 0xc6cc, 0x72ba,
-	0x3b75, 0x8f03, 0x5398, 0xe7ee, 0xcabf, 0x7ec9, 0xa252, 0x1624,
-	0xf8f0, 0x4c86, 0x901d, 0x246b, 0x093a, 0xbd4c, 0x61d7, 0xd5a1,
-	0xd259, 0x662f, 0xbab4, 0x0ec2, 0x2393, 0x97e5, 0x4b7e, 0xff08,
-	0x11dc, 0xa5aa, 0x7931, 0xcd47, 0xe016, 0x5460, 0x88fb, 0x3c8d,
-	0x7542, 0xc134, 0x1daf, 0xa9d9, 0x8488, 0x30fe, 0xec65, 0x5813,
-	0xb6c7, 0x02b1, 0xde2a, 0x6a5c, 0x470d, 0xf37b, 0x2fe0, 0x9b96,
-	0x38dd, 0x8cab, 0x5030, 0xe446, 0xc917, 0x7d61, 0xa1fa, 0x158c,
-	0xfb58, 0x4f2e, 0x93b5, 0x27c3, 0x0a92, 0xbee4, 0x627f, 0xd609,
-	0x9fc6, 0x2bb0, 0xf72b, 0x435d, 0x6e0c, 0xda7a, 0x06e1, 0xb297,
-	0x5c43, 0xe835, 0x34ae, 0x80d8, 0xad89, 0x19ff, 0xc564, 0x7112,
-	0x76ea, 0xc29c, 0x1e07, 0xaa71, 0x8720, 0x3356, 0xefcd, 0x5bbb,
-	0xb56f, 0x0119, 0xdd82, 0x69f4, 0x44a5, 0xf0d3, 0x2c48, 0x983e,
-	0xd1f1, 0x6587, 0xb91c, 0x0d6a, 0x203b, 0x944d, 0x48d6, 0xfca0,
-	0x1274, 0xa602, 0x7a99, 0xceef, 0xe3be, 0x57c8, 0x8b53, 0x3f25,
-	0xa4b3, 0x10c5, 0xcc5e, 0x7828, 0x5579, 0xe10f, 0x3d94, 0x89e2,
-	0x6736, 0xd340, 0x0fdb, 0xbbad, 0x96fc, 0x228a, 0xfe11, 0x4a67,
-	0x03a8, 0xb7de, 0x6b45, 0xdf33, 0xf262, 0x4614, 0x9a8f, 0x2ef9,
-	0xc02d, 0x745b, 0xa8c0, 0x1cb6, 0x31e7, 0x8591, 0x590a, 0xed7c,
-	0xea84, 0x5ef2, 0x8269, 0x361f, 0x1b4e, 0xaf38, 0x73a3, 0xc7d5,
-	0x2901, 0x9d77, 0x41ec, 0xf59a, 0xd8cb, 0x6cbd, 0xb026, 0x0450,
-	0x4d9f, 0xf9e9, 0x2572, 0x9104, 0xbc55, 0x0823, 0xd4b8, 0x60ce,
-	0x8e1a, 0x3a6c, 0xe6f7, 0x5281, 0x7fd0, 0xcba6, 0x173d, 0xa34b
+const uint16_t crc_table_can15[256] CRC_TABLE_ALIGN PROGMEM = {
+	0x0000, 0x328b, 0x569d, 0x6416, 0x9eb1, 0xac3a, 0xc82c, 0xfaa7,
+	0x0ee8, 0x3c63, 0x5875, 0x6afe, 0x9059, 0xa2d2, 0xc6c4, 0xf44f,
+	0x2e5b, 0x1cd0, 0x78c6, 0x4a4d, 0xb0ea, 0x8261, 0xe677, 0xd4fc,
+	0x20b3, 0x1238, 0x762e, 0x44a5, 0xbe02, 0x8c89, 0xe89f, 0xda14,
+	0x5cb6, 0x6e3d, 0x0a2b, 0x38a0, 0xc207, 0xf08c, 0x949a, 0xa611,
+	0x525e, 0x60d5, 0x04c3, 0x3648, 0xccef, 0xfe64, 0x9a72, 0xa8f9,
+	0x72ed, 0x4066, 0x2470, 0x16fb, 0xec5c, 0xded7, 0xbac1, 0x884a,
+	0x7c05, 0x4e8e, 0x2a98, 0x1813, 0xe2b4, 0xd03f, 0xb429, 0x86a2,
+	0x8ae7, 0xb86c, 0xdc7a, 0xeef1, 0x1456, 0x26dd, 0x42cb, 0x7040,
+	0x840f, 0xb684, 0xd292, 0xe019, 0x1abe, 0x2835, 0x4c23, 0x7ea8,
+	0xa4bc, 0x9637, 0xf221, 0xc0aa, 0x3a0d, 0x0886, 0x6c90, 0x5e1b,
+	0xaa54, 0x98df, 0xfcc9, 0xce42, 0x34e5, 0x066e, 0x6278, 0x50f3,
+	0xd651, 0xe4da, 0x80cc, 0xb247, 0x48e0, 0x7a6b, 0x1e7d, 0x2cf6,
+	0xd8b9, 0xea32, 0x8e24, 0xbcaf, 0x4608, 0x7483, 0x1095, 0x221e,
+	0xf80a, 0xca81, 0xae97, 0x9c1c, 0x66bb, 0x5430, 0x3026, 0x02ad,
+	0xf6e2, 0xc469, 0xa07f, 0x92f4, 0x6853, 0x5ad8, 0x3ece, 0x0c45,
+	0x2644, 0x14cf, 0x70d9, 0x4252, 0xb8f5, 0x8a7e, 0xee68, 0xdce3,
+	0x28ac, 0x1a27, 0x7e31, 0x4cba, 0xb61d, 0x8496, 0xe080, 0xd20b,
+	0x081f, 0x3a94, 0x5e82, 0x6c09, 0x96ae, 0xa425, 0xc033, 0xf2b8,
+	0x06f7, 0x347c, 0x506a, 0x62e1, 0x9846, 0xaacd, 0xcedb, 0xfc50,
+	0x7af2, 0x4879, 0x2c6f, 0x1ee4, 0xe443, 0xd6c8, 0xb2de, 0x8055,
+	0x741a, 0x4691, 0x2287, 0x100c, 0xeaab, 0xd820, 0xbc36, 0x8ebd,
+	0x54a9, 0x6622, 0x0234, 0x30bf, 0xca18, 0xf893, 0x9c85, 0xae0e,
+	0x5a41, 0x68ca, 0x0cdc, 0x3e57, 0xc4f0, 0xf67b, 0x926d, 0xa0e6,
+	0xaca3, 0x9e28, 0xfa3e, 0xc8b5, 0x3212, 0x0099, 0x648f, 0x5604,
+	0xa24b, 0x90c0, 0xf4d6, 0xc65d, 0x3cfa, 0x0e71, 0x6a67, 0x58ec,
+	0x82f8, 0xb073, 0xd465, 0xe6ee, 0x1c49, 0x2ec2, 0x4ad4, 0x785f,
+	0x8c10, 0xbe9b, 0xda8d, 0xe806, 0x12a1, 0x202a, 0x443c, 0x76b7,
+	0xf015, 0xc29e, 0xa688, 0x9403, 0x6ea4, 0x5c2f, 0x3839, 0x0ab2,
+	0xfefd, 0xcc76, 0xa860, 0x9aeb, 0x604c, 0x52c7, 0x36d1, 0x045a,
+	0xde4e, 0xecc5, 0x88d3, 0xba58, 0x40ff, 0x7274, 0x1662, 0x24e9,
+	0xd0a6, 0xe22d, 0x863b, 0xb4b0, 0x4e17, 0x7c9c, 0x188a, 0x2a01
 };
 
-const uint16_t crc_table_x25[1024] PROGMEM = {
-	0x0000, 0x1189, 0x2312, 0x329b, 0x4624, 0x57ad, 0x6536, 0x74bf,
-	0x8c48, 0x9dc1, 0xaf5a, 0xbed3, 0xca6c, 0xdbe5, 0xe97e, 0xf8f7,
-	0x1081, 0x0108, 0x3393, 0x221a, 0x56a5, 0x472c, 0x75b7, 0x643e,
-	0x9cc9, 0x8d40, 0xbfdb, 0xae52, 0xdaed, 0xcb64, 0xf9ff, 0xe876,
-	0x2102, 0x308b, 0x0210, 0x1399, 0x6726, 0x76af, 0x4434, 0x55bd,
-	0xad4a, 0xbcc3, 0x8e58, 0x9fd1, 0xeb6e, 0xfae7, 0xc87c, 0xd9f5,
-	0x3183, 0x200a, 0x1291, 0x0318, 0x77a7, 0x662e, 0x54b5, 0x453c,
-	0xbdcb, 0xac42, 0x9ed9, 0x8f50, 0xfbef, 0xea66, 0xd8fd, 0xc974,
-	0x4204, 0x538d, 0x6116, 0x709f, 0x0420, 0x15a9, 0x2732, 0x36bb,
-	0xce4c, 0xdfc5, 0xed5e, 0xfcd7, 0x8868, 0x99e1, 0xab7a, 0xbaf3,
-	0x5285, 0x430c, 0x7197, 0x601e, 0x14a1, 0x0528, 0x37b3, 0x263a,
-	0xdecd, 0xcf44, 0xfddf, 0xec56, 0x98e9, 0x8960, 0xbbfb, 0xaa72,
-	0x6306, 0x728f, 0x4014, 0x519d, 0x2522, 0x34ab, 0x0630, 0x17b9,
-	0xef4e, 0xfec7, 0xcc5c, 0xddd5, 0xa96a, 0xb8e3, 0x8a78, 0x9bf1,
-	0x7387, 0x620e, 0x5095, 0x411c, 0x35a3, 0x242a, 0x16b1, 0x0738,
-	0xffcf, 0xee46, 0xdcdd, 0xcd54, 0xb9eb, 0xa862, 0x9af9, 0x8b70,
-	0x8408, 0x9581, 0xa71a, 0xb693, 0xc22c, 0xd3a5, 0xe13e, 0xf0b7,
-	0x0840, 0x19c9, 0x2b52, 0x3adb, 0x4e64, 0x5fed, 0x6d76, 0x7cff,
-	0x9489, 0x8500, 0xb79b, 0xa612, 0xd2ad, 0xc324, 0xf1bf, 0xe036,
-	0x18c1, 0x0948, 0x3bd3, 0x2a5a, 0x5ee5, 0x4f6c, 0x7df7, 0x6c7e,
-	0xa50a, 0xb483, 0x8618, 0x9791, 0xe32e, 0xf2a7, 0xc03c, 0xd1b5,
-	0x2942, 0x38cb, 0x0a50, 0x1bd9, 0x6f66, 0x7eef, 0x4c74, 0x5dfd,
-	0xb58b, 0xa402, 0x9699, 0x8710, 0xf3af, 0xe226, 0xd0bd, 0xc134,
-	0x39c3, 0x284a, 0x1ad1, 0x0b58, 0x7fe7, 0x6e6e, 0x5cf5, 0x4d7c,
-	0xc60c, 0xd785, 0xe51e, 0xf497, 0x8028, 0x91a1, 0xa33a, 0xb2b3,
-	0x4a44, 0x5bcd, 0x6956, 0x78df, 0x0c60, 0x1de9, 0x2f72, 0x3efb,
-	0xd68d, 0xc704, 0xf59f, 0xe416, 0x90a9, 0x8120, 0xb3bb, 0xa232,
-	0x5ac5, 0x4b4c, 0x79d7, 0x685e, 0x1ce1, 0x0d68, 0x3ff3, 0x2e7a,
-	0xe70e, 0xf687, 0xc41c, 0xd595, 0xa12a, 0xb0a3, 0x8238, 0x93b1,
-	0x6b46, 0x7acf, 0x4854, 0x59dd, 0x2d62, 0x3ceb, 0x0e70, 0x1ff9,
-	0xf78f, 0xe606, 0xd49d, 0xc514, 0xb1ab, 0xa022, 0x92b9, 0x8330,
-	0x7bc7, 0x6a4e, 0x58d5, 0x495c, 0x3de3, 0x2c6a, 0x1ef1, 0x0f78,
-	0x0000, 0x19d8, 0x33b0, 0x2a68, 0x6760, 0x7eb8, 0x54d0, 0x4d08,
-	0xcec0, 0xd718, 0xfd70, 0xe4a8, 0xa9a0, 0xb078, 0x9a10, 0x83c8,
-	0x9591, 0x8c49, 0xa621, 0xbff9, 0xf2f1, 0xeb29, 0xc141, 0xd899,
-	0x5b51, 0x4289, 0x68e1, 0x7139, 0x3c31, 0x25e9, 0x0f81, 0x1659,
-	0x2333, 0x3aeb, 0x1083, 0x095b, 0x4453, 0x5d8b, 0x77e3, 0x6e3b,
-	0xedf3, 0xf42b, 0xde43, 0xc79b, 0x8a93, 0x934b, 0xb923, 0xa0fb,
-	0xb6a2, 0xaf7a, 0x8512, 0x9cca, 0xd1c2, 0xc81a, 0xe272, 0xfbaa,
-	0x7862, 0x61ba, 0x4bd2, 0x520a, 0x1f02, 0x06da, 0x2cb2, 0x356a,
-	0x4666, 0x5fbe, 0x75d6, 0x6c0e, 0x2106, 0x38de, 0x12b6, 0x0b6e,
-	0x88a6, 0x917e, 0xbb16, 0xa2ce, 0xefc6, 0xf61e, 0xdc76, 0xc5ae,
-	0xd3f7, 0xca2f, 0xe047, 0xf99f, 0xb497, 0xad4f, 0x8727, 0x9eff,
-	0x1d37, 0x04ef, 0x2e87, 0x375f, 0x7a57, 0x638f, 0x49e7, 0x503f,
-	0x6555, 0x7c8d, 0x56e5, 0x4f3d, 0x0235, 0x1bed, 0x3185, 0x285d,
-	0xab95, 0xb24d, 0x9825, 0x81fd, 0xccf5, 0xd52d, 0xff45, 0xe69d,
-	0xf0c4, 0xe91c, 0xc374, 0xdaac, 0x97a4, 0x8e7c, 0xa414, 0xbdcc,
-	0x3e04, 0x27dc, 0x0db4, 0x146c, 0x5964, 0x40bc, 0x6ad4, 0x730c,
-	0x8ccc, 0x9514, 0xbf7c, 0xa6a4, 0xebac, 0xf274, 0xd81c, 0xc1c4,
-	0x420c, 0x5bd4, 0x71bc, 0x6864, 0x256c, 0x3cb4, 0x16dc, 0x0f04,
-	0x195d, 0x0085, 0x2aed, 0x3335, 0x7e3d, 0x67e5, 0x4d8d, 0x5455,
-	0xd79d, 0xce45, 0xe42d, 0xfdf5, 0xb0fd, 0xa925, 0x834d, 0x9a95,
-	0xafff, 0xb627, 0x9c4f, 0x8597, 0xc89f, 0xd147, 0xfb2f, 0xe2f7,
-	0x613f, 0x78e7, 0x528f, 0x4b57, 0x065f, 0x1f87, 0x35ef, 0x2c37,
-	0x3a6e, 0x23b6, 0x09de, 0x1006, 0x5d0e, 0x44d6, 0x6ebe, 0x7766,
-	0xf4ae, 0xed76, 0xc71e, 0xdec6, 0x93ce, 0x8a16, 0xa07e, 0xb9a6,
-	0xcaaa, 0xd372, 0xf91a, 0xe0c2, 0xadca, 0xb412, 0x9e7a, 0x87a2,
-	0x046a, 0x1db2, 0x37da, 0x2e02, 0x630a, 0x7ad2, 0x50ba, 0x4962,
-	0x5f3b, 0x46e3, 0x6c8b, 0x7553, 0x385b, 0x2183, 0x0beb, 0x1233,
-	0x91fb, 0x8823, 0xa24b, 0xbb93, 0xf69b, 0xef43, 0xc52b, 0xdcf3,
-	0xe999, 0xf041, 0xda29, 0xc3f1, 0x8ef9, 0x9721, 0xbd49, 0xa491,
-	0x2759, 0x3e81, 0x14e9, 0x0d31, 0x4039, 0x59e1, 0x7389, 0x6a51,
-	0x7c08, 0x65d0, 0x4fb8, 0x5660, 0x1b68, 0x02b0, 0x28d8, 0x3100,
-	0xb2c8, 0xab10, 0x8178, 0x98a0, 0xd5a8, 0xcc70, 0xe618, 0xffc0,
-	0x0000, 0x5adc, 0xb5b8, 0xef64, 0x6361, 0x39bd, 0xd6d9, 0x8c05,
-	0xc6c2, 0x9c1e, 0x737a, 0x29a6, 0xa5a3, 0xff7f, 0x101b, 0x4ac7,
-	0x8595, 0xdf49, 0x302d, 0x6af1, 0xe6f4, 0xbc28, 0x534c, 0x0990,
-	0x4357, 0x198b, 0xf6ef, 0xac33, 0x2036, 0x7aea, 0x958e, 0xcf52,
-	0x033b, 0x59e7, 0xb683, 0xec5f, 0x605a, 0x3a86, 0xd5e2, 0x8f3e,
-	0xc5f9, 0x9f25, 0x7041, 0x2a9d, 0xa698, 0xfc44, 0x1320, 0x49fc,
-	0x86ae, 0xdc72, 0x3316, 0x69ca, 0xe5cf, 0xbf13, 0x5077, 0x0aab,
-	0x406c, 0x1ab0, 0xf5d4, 0xaf08, 0x230d, 0x79d1, 0x96b5, 0xcc69,
-	0x0676, 0x5caa, 0xb3ce, 0xe912, 0x6517, 0x3fcb, 0xd0af, 0x8a73,
-	0xc0b4, 0x9a68, 0x750c, 0x2fd0, 0xa3d5, 0xf909, 0x166d, 0x4cb1,
-	0x83e3, 0xd93f, 0x365b, 0x6c87, 0xe082, 0xba5e, 0x553a, 0x0fe6,
-	0x4521, 0x1ffd, 0xf099, 0xaa45, 0x2640, 0x7c9c, 0x93f8, 0xc924,
-	0x054d, 0x5f91, 0xb0f5, 0xea29, 0x662c, 0x3cf0, 0xd394, 0x8948,
-	0xc38f, 0x9953, 0x7637, 0x2ceb, 0xa0ee, 0xfa32, 0x1556, 0x4f8a,
-	0x80d8, 0xda04, 0x3560, 0x6fbc, 0xe3b9, 0xb965, 0x5601, 0x0cdd,
-	0x461a, 0x1cc6, 0xf3a2, 0xa97e, 0x257b, 0x7fa7, 0x90c3, 0xca1f,
-	0x0cec, 0x5630, 0xb954, 0xe388, 0x6f8d, 0x3551, 0xda35, 0x80e9,
-	0xca2e, 0x90f2, 0x7f96, 0x254a, 0xa94f, 0xf393, 0x1cf7, 0x462b,
-	0x8979, 0xd3a5, 0x3cc1, 0x661d, 0xea18, 0xb0c4, 0x5fa0, 0x057c,
-	0x4fbb, 0x1567, 0xfa03, 0xa0df, 0x2cda, 0x7606, 0x9962, 0xc3be,
-	0x0fd7, 0x550b, 0xba6f, 0xe0b3, 0x6cb6, 0x366a, 0xd90e, 0x83d2,
-	0xc915, 0x93c9, 0x7cad, 0x2671, 0xaa74, 0xf0a8, 0x1fcc, 0x4510,
-	0x8a42, 0xd09e, 0x3ffa, 0x6526, 0xe923, 0xb3ff, 0x5c9b, 0x0647,
-	0x4c80, 0x165c, 0xf938, 0xa3e4, 0x2fe1, 0x753d, 0x9a59, 0xc085,
-	0x0a9a, 0x5046, 0xbf22, 0xe5fe, 0x69fb, 0x3327, 0xdc43, 0x869f,
-	0xcc58, 0x9684, 0x79e0, 0x233c, 0xaf39, 0xf5e5, 0x1a81, 0x405d,
-	0x8f0f, 0xd5d3, 0x3ab7, 0x606b, 0xec6e, 0xb6b2, 0x59d6, 0x030a,
-	0x49cd, 0x1311, 0xfc75, 0xa6a9, 0x2aac, 0x7070, 0x9f14, 0xc5c8,
-	0x09a1, 0x537d, 0xbc19, 0xe6c5, 0x6ac0, 0x301c, 0xdf78, 0x85a4,
-	0xcf63, 0x95bf, 0x7adb, 0x2007, 0xac02, 0xf6de, 0x19ba, 0x4366,
-	0x8c34, 0xd6e8, 0x398c, 0x6350, 0xef55, 0xb589, 0x5aed, 0x0031,
-	0x4af6, 0x102a, 0xff4e, 0xa592, 0x2997, 0x734b, 0x9c2f, 0xc6f3,
-	0x0000, 0x1cbb, 0x3976, 0x25cd, 0x72ec, 0x6e57, 0x4b9a, 0x5721,
-	0xe5d8, 0xf963, 0xdcae, 0xc015, 0x9734, 0x8b8f, 0xae42, 0xb2f9,
-	0xc3a1, 0xdf1a, 0xfad7, 0xe66c, 0xb14d, 0xadf6, 0x883b, 0x9480,
-	0x2679, 0x3ac2, 0x1f0f, 0x03b4, 0x5495, 0x482e, 0x6de3, 0x7158,
-	0x8f53, 0x93e8, 0xb625, 0xaa9e, 0xfdbf, 0xe104, 0xc4c9, 0xd872,
-	0x6a8b, 0x7630, 0x53fd, 0x4f46, 0x1867, 0x04dc, 0x2111, 0x3daa,
-	0x4cf2, 0x5049, 0x7584, 0x693f, 0x3e1e, 0x22a5, 0x0768, 0x1bd3,
-	0xa92a, 0xb591, 0x905c, 0x8ce7, 0xdbc6, 0xc77d, 0xe2b0, 0xfe0b,
-	0x16b7, 0x0a0c, 0x2fc1, 0x337a, 0x645b, 0x78e0, 0x5d2d, 0x4196,
-	0xf36f, 0xefd4, 0xca19, 0xd6a2, 0x8183, 0x9d38, 0xb8f5, 0xa44e,
-	0xd516, 0xc9ad, 0xec60, 0xf0db, 0xa7fa, 0xbb41, 0x9e8c, 0x8237,
-	0x30ce, 0x2c75, 0x09b8, 0x1503, 0x4222, 0x5e99, 0x7b54, 0x67ef,
-	0x99e4, 0x855f, 0xa092, 0xbc29, 0xeb08, 0xf7b3, 0xd27e, 0xcec5,
-	0x7c3c, 0x6087, 0x454a, 0x59f1, 0x0ed0, 0x126b, 0x37a6, 0x2b1d,
-	0x5a45, 0x46fe, 0x6333, 0x7f88, 0x28a9, 0x3412, 0x11df, 0x0d64,
-	0xbf9d, 0xa326, 0x86eb, 0x9a50, 0xcd71, 0xd1ca, 0xf407, 0xe8bc,
-	0x2d6e, 0x31d5, 0x1418, 0x08a3, 0x5f82, 0x4339, 0x66f4, 0x7a4f,
-	0xc8b6, 0xd40d, 0xf1c0, 0xed7b, 0xba5a, 0xa6e1, 0x832c, 0x9f97,
-	0xeecf, 0xf274, 0xd7b9, 0xcb02, 0x9c23, 0x8098, 0xa555, 0xb9ee,
-	0x0b17, 0x17ac, 0x3261, 0x2eda, 0x79fb, 0x6540, 0x408d, 0x5c36,
-	0xa23d, 0xbe86, 0x9b4b, 0x87f0, 0xd0d1, 0xcc6a, 0xe9a7, 0xf51c,
-	0x47e5, 0x5b5e, 0x7e93, 0x6228, 0x3509, 0x29b2, 0x0c7f, 0x10c4,
-	0x619c, 0x7d27, 0x58ea, 0x4451, 0x1370, 0x0fcb, 0x2a06, 0x36bd,
-	0x8444, 0x98ff, 0xbd32, 0xa189, 0xf6a8, 0xea13, 0xcfde, 0xd365,
-	0x3bd9, 0x2762, 0x02af, 0x1e14, 0x4935, 0x558e, 0x7043, 0x6cf8,
-	0xde01, 0xc2ba, 0xe777, 0xfbcc, 0xaced, 0xb056, 0x959b, 0x8920,
-	0xf878, 0xe4c3, 0xc10e, 0xddb5, 0x8a94, 0x962f, 0xb3e2, 0xaf59,
-	0x1da0, 0x011b, 0x24d6, 0x386d, 0x6f4c, 0x73f7, 0x563a, 0x4a81,
-	0xb48a, 0xa831, 0x8dfc, 0x9147, 0xc666, 0xdadd, 0xff10, 0xe3ab,
-	0x5152, 0x4de9, 0x6824, 0x749f, 0x23be, 0x3f05, 0x1ac8, 0x0673,
-	0x772b, 0x6b90, 0x4e5d, 0x52e6, 0x05c7, 0x197c, 0x3cb1, 0x200a,
-	0x92f3, 0x8e48, 0xab85, 0xb73e, 0xe01f, 0xfca4, 0xd969, 0xc5d2
-};
-
-const uint32_t crc_table_crc32[256] PROGMEM = {
+const uint32_t crc_table_crc32[256] CRC_TABLE_ALIGN PROGMEM = {
 	0x00000000, 0x77073096, 0xee0e612c, 0x990951ba,
 	0x076dc419, 0x706af48f, 0xe963a535, 0x9e6495a3,
 	0x0edb8832, 0x79dcb8a4, 0xe0d5e91e, 0x97d2d988,
@@ -1003,7 +654,7 @@ const uint32_t crc_table_crc32[256] PROGMEM = {
 	0xb40bbe37, 0xc30c8ea1, 0x5a05df1b, 0x2d02ef8d
 };
 
-const uint32_t crc_table_crc32_big[1024] PROGMEM = {
+const uint32_t crc_table_crc32_big[1024] CRC_TABLE_ALIGN PROGMEM = {
 	0x00000000, 0x77073096, 0xee0e612c, 0x990951ba,
 	0x076dc419, 0x706af48f, 0xe963a535, 0x9e6495a3,
 	0x0edb8832, 0x79dcb8a4, 0xe0d5e91e, 0x97d2d988,
@@ -1262,7 +913,8 @@ const uint32_t crc_table_crc32_big[1024] PROGMEM = {
 	0xccb0a91f, 0x740cce7a, 0x66b96194, 0xde0506f1
 };
 
-const uint32_t crc_table_cksum[256] PROGMEM = {
+// cksum, mpeg2, bzip2
+const uint32_t crc_table_cksum[256] CRC_TABLE_ALIGN PROGMEM = {
 	0x00000000, 0xb71dc104, 0x6e3b8209, 0xd926430d,
 	0xdc760413, 0x6b6bc517, 0xb24d861a, 0x0550471e,
 	0xb8ed0826, 0x0ff0c922, 0xd6d68a2f, 0x61cb4b2b,
@@ -1329,7 +981,8 @@ const uint32_t crc_table_cksum[256] PROGMEM = {
 	0x6d66b4bc, 0xda7b75b8, 0x035d36b5, 0xb440f7b1
 };
 
-const uint32_t crc_table_cksum_big[1024] PROGMEM = {
+// cksum, mpeg2, bzip2
+const uint32_t crc_table_cksum_big[1024] CRC_TABLE_ALIGN PROGMEM = {
 	0x00000000, 0xb71dc104, 0x6e3b8209, 0xd926430d,
 	0xdc760413, 0x6b6bc517, 0xb24d861a, 0x0550471e,
 	0xb8ed0826, 0x0ff0c922, 0xd6d68a2f, 0x61cb4b2b,
@@ -1588,6 +1241,2468 @@ const uint32_t crc_table_cksum_big[1024] PROGMEM = {
 	0x151217ef, 0xa2887a33, 0xcc3a0d53, 0x7ba0608f
 };
 
+const uint32_t crc_table_canfd17[256] CRC_TABLE_ALIGN PROGMEM = {
+	0x00000000, 0x00802db4, 0x008076dc, 0x00005b68,
+	0x0080c00c, 0x0000edb8, 0x0000b6d0, 0x00809b64,
+	0x00008119, 0x0080acad, 0x0080f7c5, 0x0000da71,
+	0x00804115, 0x00006ca1, 0x000037c9, 0x00801a7d,
+	0x00000233, 0x00802f87, 0x008074ef, 0x0000595b,
+	0x0080c23f, 0x0000ef8b, 0x0000b4e3, 0x00809957,
+	0x0000832a, 0x0080ae9e, 0x0080f5f6, 0x0000d842,
+	0x00804326, 0x00006e92, 0x000035fa, 0x0080184e,
+	0x00000466, 0x008029d2, 0x008072ba, 0x00005f0e,
+	0x0080c46a, 0x0000e9de, 0x0000b2b6, 0x00809f02,
+	0x0000857f, 0x0080a8cb, 0x0080f3a3, 0x0000de17,
+	0x00804573, 0x000068c7, 0x000033af, 0x00801e1b,
+	0x00000655, 0x00802be1, 0x00807089, 0x00005d3d,
+	0x0080c659, 0x0000ebed, 0x0000b085, 0x00809d31,
+	0x0000874c, 0x0080aaf8, 0x0080f190, 0x0000dc24,
+	0x00804740, 0x00006af4, 0x0000319c, 0x00801c28,
+	0x000008cc, 0x00802578, 0x00807e10, 0x000053a4,
+	0x0080c8c0, 0x0000e574, 0x0000be1c, 0x008093a8,
+	0x000089d5, 0x0080a461, 0x0080ff09, 0x0000d2bd,
+	0x008049d9, 0x0000646d, 0x00003f05, 0x008012b1,
+	0x00000aff, 0x0080274b, 0x00807c23, 0x00005197,
+	0x0080caf3, 0x0000e747, 0x0000bc2f, 0x0080919b,
+	0x00008be6, 0x0080a652, 0x0080fd3a, 0x0000d08e,
+	0x00804bea, 0x0000665e, 0x00003d36, 0x00801082,
+	0x00000caa, 0x0080211e, 0x00807a76, 0x000057c2,
+	0x0080cca6, 0x0000e112, 0x0000ba7a, 0x008097ce,
+	0x00008db3, 0x0080a007, 0x0080fb6f, 0x0000d6db,
+	0x00804dbf, 0x0000600b, 0x00003b63, 0x008016d7,
+	0x00000e99, 0x0080232d, 0x00807845, 0x000055f1,
+	0x0080ce95, 0x0000e321, 0x0000b849, 0x008095fd,
+	0x00008f80, 0x0080a234, 0x0080f95c, 0x0000d4e8,
+	0x00804f8c, 0x00006238, 0x00003950, 0x008014e4,
+	0x00803d2c, 0x00001098, 0x00004bf0, 0x00806644,
+	0x0000fd20, 0x0080d094, 0x00808bfc, 0x0000a648,
+	0x0080bc35, 0x00009181, 0x0000cae9, 0x0080e75d,
+	0x00007c39, 0x0080518d, 0x00800ae5, 0x00002751,
+	0x00803f1f, 0x000012ab, 0x000049c3, 0x00806477,
+	0x0000ff13, 0x0080d2a7, 0x008089cf, 0x0000a47b,
+	0x0080be06, 0x000093b2, 0x0000c8da, 0x0080e56e,
+	0x00007e0a, 0x008053be, 0x008008d6, 0x00002562,
+	0x0080394a, 0x000014fe, 0x00004f96, 0x00806222,
+	0x0000f946, 0x0080d4f2, 0x00808f9a, 0x0000a22e,
+	0x0080b853, 0x000095e7, 0x0000ce8f, 0x0080e33b,
+	0x0000785f, 0x008055eb, 0x00800e83, 0x00002337,
+	0x00803b79, 0x000016cd, 0x00004da5, 0x00806011,
+	0x0000fb75, 0x0080d6c1, 0x00808da9, 0x0000a01d,
+	0x0080ba60, 0x000097d4, 0x0000ccbc, 0x0080e108,
+	0x00007a6c, 0x008057d8, 0x00800cb0, 0x00002104,
+	0x008035e0, 0x00001854, 0x0000433c, 0x00806e88,
+	0x0000f5ec, 0x0080d858, 0x00808330, 0x0000ae84,
+	0x0080b4f9, 0x0000994d, 0x0000c225, 0x0080ef91,
+	0x000074f5, 0x00805941, 0x00800229, 0x00002f9d,
+	0x008037d3, 0x00001a67, 0x0000410f, 0x00806cbb,
+	0x0000f7df, 0x0080da6b, 0x00808103, 0x0000acb7,
+	0x0080b6ca, 0x00009b7e, 0x0000c016, 0x0080eda2,
+	0x000076c6, 0x00805b72, 0x0080001a, 0x00002dae,
+	0x00803186, 0x00001c32, 0x0000475a, 0x00806aee,
+	0x0000f18a, 0x0080dc3e, 0x00808756, 0x0000aae2,
+	0x0080b09f, 0x00009d2b, 0x0000c643, 0x0080ebf7,
+	0x00007093, 0x00805d27, 0x0080064f, 0x00002bfb,
+	0x008033b5, 0x00001e01, 0x00004569, 0x008068dd,
+	0x0000f3b9, 0x0080de0d, 0x00808565, 0x0000a8d1,
+	0x0080b2ac, 0x00009f18, 0x0000c470, 0x0080e9c4,
+	0x000072a0, 0x00805f14, 0x0080047c, 0x000029c8
+};
+
+const uint32_t crc_table_canfd21[256] CRC_TABLE_ALIGN PROGMEM = {
+	0x00000000, 0x00c84481, 0x0058cd83, 0x00908902,
+	0x0078de86, 0x00b09a07, 0x00201305, 0x00e85784,
+	0x0038f88c, 0x00f0bc0d, 0x0060350f, 0x00a8718e,
+	0x0040260a, 0x0088628b, 0x0018eb89, 0x00d0af08,
+	0x00b8b498, 0x0070f019, 0x00e0791b, 0x00283d9a,
+	0x00c06a1e, 0x00082e9f, 0x0098a79d, 0x0050e31c,
+	0x00804c14, 0x00480895, 0x00d88197, 0x0010c516,
+	0x00f89292, 0x0030d613, 0x00a05f11, 0x00681b90,
+	0x00b82db0, 0x00706931, 0x00e0e033, 0x0028a4b2,
+	0x00c0f336, 0x0008b7b7, 0x00983eb5, 0x00507a34,
+	0x0080d53c, 0x004891bd, 0x00d818bf, 0x00105c3e,
+	0x00f80bba, 0x00304f3b, 0x00a0c639, 0x006882b8,
+	0x00009928, 0x00c8dda9, 0x005854ab, 0x0090102a,
+	0x007847ae, 0x00b0032f, 0x00208a2d, 0x00e8ceac,
+	0x003861a4, 0x00f02525, 0x0060ac27, 0x00a8e8a6,
+	0x0040bf22, 0x0088fba3, 0x001872a1, 0x00d03620,
+	0x00b81fe1, 0x00705b60, 0x00e0d262, 0x002896e3,
+	0x00c0c167, 0x000885e6, 0x00980ce4, 0x00504865,
+	0x0080e76d, 0x0048a3ec, 0x00d82aee, 0x00106e6f,
+	0x00f839eb, 0x00307d6a, 0x00a0f468, 0x0068b0e9,
+	0x0000ab79, 0x00c8eff8, 0x005866fa, 0x0090227b,
+	0x007875ff, 0x00b0317e, 0x0020b87c, 0x00e8fcfd,
+	0x003853f5, 0x00f01774, 0x00609e76, 0x00a8daf7,
+	0x00408d73, 0x0088c9f2, 0x001840f0, 0x00d00471,
+	0x00003251, 0x00c876d0, 0x0058ffd2, 0x0090bb53,
+	0x0078ecd7, 0x00b0a856, 0x00202154, 0x00e865d5,
+	0x0038cadd, 0x00f08e5c, 0x0060075e, 0x00a843df,
+	0x0040145b, 0x008850da, 0x0018d9d8, 0x00d09d59,
+	0x00b886c9, 0x0070c248, 0x00e04b4a, 0x00280fcb,
+	0x00c0584f, 0x00081cce, 0x009895cc, 0x0050d14d,
+	0x00807e45, 0x00483ac4, 0x00d8b3c6, 0x0010f747,
+	0x00f8a0c3, 0x0030e442, 0x00a06d40, 0x006829c1,
+	0x00b87b43, 0x00703fc2, 0x00e0b6c0, 0x0028f241,
+	0x00c0a5c5, 0x0008e144, 0x00986846, 0x00502cc7,
+	0x008083cf, 0x0048c74e, 0x00d84e4c, 0x00100acd,
+	0x00f85d49, 0x003019c8, 0x00a090ca, 0x0068d44b,
+	0x0000cfdb, 0x00c88b5a, 0x00580258, 0x009046d9,
+	0x0078115d, 0x00b055dc, 0x0020dcde, 0x00e8985f,
+	0x00383757, 0x00f073d6, 0x0060fad4, 0x00a8be55,
+	0x0040e9d1, 0x0088ad50, 0x00182452, 0x00d060d3,
+	0x000056f3, 0x00c81272, 0x00589b70, 0x0090dff1,
+	0x00788875, 0x00b0ccf4, 0x002045f6, 0x00e80177,
+	0x0038ae7f, 0x00f0eafe, 0x006063fc, 0x00a8277d,
+	0x004070f9, 0x00883478, 0x0018bd7a, 0x00d0f9fb,
+	0x00b8e26b, 0x0070a6ea, 0x00e02fe8, 0x00286b69,
+	0x00c03ced, 0x0008786c, 0x0098f16e, 0x0050b5ef,
+	0x00801ae7, 0x00485e66, 0x00d8d764, 0x001093e5,
+	0x00f8c461, 0x003080e0, 0x00a009e2, 0x00684d63,
+	0x000064a2, 0x00c82023, 0x0058a921, 0x0090eda0,
+	0x0078ba24, 0x00b0fea5, 0x002077a7, 0x00e83326,
+	0x00389c2e, 0x00f0d8af, 0x006051ad, 0x00a8152c,
+	0x004042a8, 0x00880629, 0x00188f2b, 0x00d0cbaa,
+	0x00b8d03a, 0x007094bb, 0x00e01db9, 0x00285938,
+	0x00c00ebc, 0x00084a3d, 0x0098c33f, 0x005087be,
+	0x008028b6, 0x00486c37, 0x00d8e535, 0x0010a1b4,
+	0x00f8f630, 0x0030b2b1, 0x00a03bb3, 0x00687f32,
+	0x00b84912, 0x00700d93, 0x00e08491, 0x0028c010,
+	0x00c09794, 0x0008d315, 0x00985a17, 0x00501e96,
+	0x0080b19e, 0x0048f51f, 0x00d87c1d, 0x0010389c,
+	0x00f86f18, 0x00302b99, 0x00a0a29b, 0x0068e61a,
+	0x0000fd8a, 0x00c8b90b, 0x00583009, 0x00907488,
+	0x0078230c, 0x00b0678d, 0x0020ee8f, 0x00e8aa0e,
+	0x00380506, 0x00f04187, 0x0060c885, 0x00a88c04,
+	0x0040db80, 0x00889f01, 0x00181603, 0x00d05282
+};
+
+const uint64_t crc_table_ecma182[256] CRC_TABLE_ALIGN PROGMEM = {
+	0x0000000000000000, 0x9336eaa9ebe1f042, 0x266dd453d7c3e185, 0xb55b3efa3c2211c7,
+	0xdfec420e45663349, 0x4cdaa8a7ae87c30b, 0xf981965d92a5d2cc, 0x6ab77cf47944228e,
+	0xbed9851c8acc6692, 0x2def6fb5612d96d0, 0x98b4514f5d0f8717, 0x0b82bbe6b6ee7755,
+	0x6135c712cfaa55db, 0xf2032dbb244ba599, 0x475813411869b45e, 0xd46ef9e8f388441c,
+	0xef85e190ff783d66, 0x7cb30b391499cd24, 0xc9e835c328bbdce3, 0x5adedf6ac35a2ca1,
+	0x3069a39eba1e0e2f, 0xa35f493751fffe6d, 0x160477cd6dddefaa, 0x85329d64863c1fe8,
+	0x515c648c75b45bf4, 0xc26a8e259e55abb6, 0x7731b0dfa277ba71, 0xe4075a7649964a33,
+	0x8eb0268230d268bd, 0x1d86cc2bdb3398ff, 0xa8ddf2d1e7118938, 0x3beb18780cf0797a,
+	0xde0bc321fff17acc, 0x4d3d298814108a8e, 0xf866177228329b49, 0x6b50fddbc3d36b0b,
+	0x01e7812fba974985, 0x92d16b865176b9c7, 0x278a557c6d54a800, 0xb4bcbfd586b55842,
+	0x60d2463d753d1c5e, 0xf3e4ac949edcec1c, 0x46bf926ea2fefddb, 0xd58978c7491f0d99,
+	0xbf3e0433305b2f17, 0x2c08ee9adbbadf55, 0x9953d060e798ce92, 0x0a653ac90c793ed0,
+	0x318e22b1008947aa, 0xa2b8c818eb68b7e8, 0x17e3f6e2d74aa62f, 0x84d51c4b3cab566d,
+	0xee6260bf45ef74e3, 0x7d548a16ae0e84a1, 0xc80fb4ec922c9566, 0x5b395e4579cd6524,
+	0x8f57a7ad8a452138, 0x1c614d0461a4d17a, 0xa93a73fe5d86c0bd, 0x3a0c9957b66730ff,
+	0x50bbe5a3cf231271, 0xc38d0f0a24c2e233, 0x76d631f018e0f3f4, 0xe5e0db59f30103b6,
+	0x2f216cea150205da, 0xbc178643fee3f598, 0x094cb8b9c2c1e45f, 0x9a7a52102920141d,
+	0xf0cd2ee450643693, 0x63fbc44dbb85c6d1, 0xd6a0fab787a7d716, 0x4596101e6c462754,
+	0x91f8e9f69fce6348, 0x02ce035f742f930a, 0xb7953da5480d82cd, 0x24a3d70ca3ec728f,
+	0x4e14abf8daa85001, 0xdd2241513149a043, 0x68797fab0d6bb184, 0xfb4f9502e68a41c6,
+	0xc0a48d7aea7a38bc, 0x539267d3019bc8fe, 0xe6c959293db9d939, 0x75ffb380d658297b,
+	0x1f48cf74af1c0bf5, 0x8c7e25dd44fdfbb7, 0x39251b2778dfea70, 0xaa13f18e933e1a32,
+	0x7e7d086660b65e2e, 0xed4be2cf8b57ae6c, 0x5810dc35b775bfab, 0xcb26369c5c944fe9,
+	0xa1914a6825d06d67, 0x32a7a0c1ce319d25, 0x87fc9e3bf2138ce2, 0x14ca749219f27ca0,
+	0xf12aafcbeaf37f16, 0x621c456201128f54, 0xd7477b983d309e93, 0x44719131d6d16ed1,
+	0x2ec6edc5af954c5f, 0xbdf0076c4474bc1d, 0x08ab39967856adda, 0x9b9dd33f93b75d98,
+	0x4ff32ad7603f1984, 0xdcc5c07e8bdee9c6, 0x699efe84b7fcf801, 0xfaa8142d5c1d0843,
+	0x901f68d925592acd, 0x03298270ceb8da8f, 0xb672bc8af29acb48, 0x25445623197b3b0a,
+	0x1eaf4e5b158b4270, 0x8d99a4f2fe6ab232, 0x38c29a08c248a3f5, 0xabf470a129a953b7,
+	0xc1430c5550ed7139, 0x5275e6fcbb0c817b, 0xe72ed806872e90bc, 0x741832af6ccf60fe,
+	0xa076cb479f4724e2, 0x334021ee74a6d4a0, 0x861b1f144884c567, 0x152df5bda3653525,
+	0x7f9a8949da2117ab, 0xecac63e031c0e7e9, 0x59f75d1a0de2f62e, 0xcac1b7b3e603066c,
+	0xcd74327dc0e5faf6, 0x5e42d8d42b040ab4, 0xeb19e62e17261b73, 0x782f0c87fcc7eb31,
+	0x129870738583c9bf, 0x81ae9ada6e6239fd, 0x34f5a4205240283a, 0xa7c34e89b9a1d878,
+	0x73adb7614a299c64, 0xe09b5dc8a1c86c26, 0x55c063329dea7de1, 0xc6f6899b760b8da3,
+	0xac41f56f0f4faf2d, 0x3f771fc6e4ae5f6f, 0x8a2c213cd88c4ea8, 0x191acb95336dbeea,
+	0x22f1d3ed3f9dc790, 0xb1c73944d47c37d2, 0x049c07bee85e2615, 0x97aaed1703bfd657,
+	0xfd1d91e37afbf4d9, 0x6e2b7b4a911a049b, 0xdb7045b0ad38155c, 0x4846af1946d9e51e,
+	0x9c2856f1b551a102, 0x0f1ebc585eb05140, 0xba4582a262924087, 0x2973680b8973b0c5,
+	0x43c414fff037924b, 0xd0f2fe561bd66209, 0x65a9c0ac27f473ce, 0xf69f2a05cc15838c,
+	0x137ff15c3f14803a, 0x80491bf5d4f57078, 0x3512250fe8d761bf, 0xa624cfa6033691fd,
+	0xcc93b3527a72b373, 0x5fa559fb91934331, 0xeafe6701adb152f6, 0x79c88da84650a2b4,
+	0xada67440b5d8e6a8, 0x3e909ee95e3916ea, 0x8bcba013621b072d, 0x18fd4aba89faf76f,
+	0x724a364ef0bed5e1, 0xe17cdce71b5f25a3, 0x5427e21d277d3464, 0xc71108b4cc9cc426,
+	0xfcfa10ccc06cbd5c, 0x6fccfa652b8d4d1e, 0xda97c49f17af5cd9, 0x49a12e36fc4eac9b,
+	0x231652c2850a8e15, 0xb020b86b6eeb7e57, 0x057b869152c96f90, 0x964d6c38b9289fd2,
+	0x422395d04aa0dbce, 0xd1157f79a1412b8c, 0x644e41839d633a4b, 0xf778ab2a7682ca09,
+	0x9dcfd7de0fc6e887, 0x0ef93d77e42718c5, 0xbba2038dd8050902, 0x2894e92433e4f940,
+	0xe2555e97d5e7ff2c, 0x7163b43e3e060f6e, 0xc4388ac402241ea9, 0x570e606de9c5eeeb,
+	0x3db91c999081cc65, 0xae8ff6307b603c27, 0x1bd4c8ca47422de0, 0x88e22263aca3dda2,
+	0x5c8cdb8b5f2b99be, 0xcfba3122b4ca69fc, 0x7ae10fd888e8783b, 0xe9d7e57163098879,
+	0x836099851a4daaf7, 0x1056732cf1ac5ab5, 0xa50d4dd6cd8e4b72, 0x363ba77f266fbb30,
+	0x0dd0bf072a9fc24a, 0x9ee655aec17e3208, 0x2bbd6b54fd5c23cf, 0xb88b81fd16bdd38d,
+	0xd23cfd096ff9f103, 0x410a17a084180141, 0xf451295ab83a1086, 0x6767c3f353dbe0c4,
+	0xb3093a1ba053a4d8, 0x203fd0b24bb2549a, 0x9564ee487790455d, 0x065204e19c71b51f,
+	0x6ce57815e5359791, 0xffd392bc0ed467d3, 0x4a88ac4632f67614, 0xd9be46efd9178656,
+	0x3c5e9db62a1685e0, 0xaf68771fc1f775a2, 0x1a3349e5fdd56465, 0x8905a34c16349427,
+	0xe3b2dfb86f70b6a9, 0x70843511849146eb, 0xc5df0bebb8b3572c, 0x56e9e1425352a76e,
+	0x828718aaa0dae372, 0x11b1f2034b3b1330, 0xa4eaccf9771902f7, 0x37dc26509cf8f2b5,
+	0x5d6b5aa4e5bcd03b, 0xce5db00d0e5d2079, 0x7b068ef7327f31be, 0xe830645ed99ec1fc,
+	0xd3db7c26d56eb886, 0x40ed968f3e8f48c4, 0xf5b6a87502ad5903, 0x668042dce94ca941,
+	0x0c373e2890088bcf, 0x9f01d4817be97b8d, 0x2a5aea7b47cb6a4a, 0xb96c00d2ac2a9a08,
+	0x6d02f93a5fa2de14, 0xfe341393b4432e56, 0x4b6f2d6988613f91, 0xd859c7c06380cfd3,
+	0xb2eebb341ac4ed5d, 0x21d8519df1251d1f, 0x94836f67cd070cd8, 0x07b585ce26e6fc9a
+};
+
+const uint64_t crc_table_ecma182_big[2048] CRC_TABLE_ALIGN PROGMEM = {
+	0x0000000000000000, 0x9336eaa9ebe1f042, 0x266dd453d7c3e185, 0xb55b3efa3c2211c7,
+	0xdfec420e45663349, 0x4cdaa8a7ae87c30b, 0xf981965d92a5d2cc, 0x6ab77cf47944228e,
+	0xbed9851c8acc6692, 0x2def6fb5612d96d0, 0x98b4514f5d0f8717, 0x0b82bbe6b6ee7755,
+	0x6135c712cfaa55db, 0xf2032dbb244ba599, 0x475813411869b45e, 0xd46ef9e8f388441c,
+	0xef85e190ff783d66, 0x7cb30b391499cd24, 0xc9e835c328bbdce3, 0x5adedf6ac35a2ca1,
+	0x3069a39eba1e0e2f, 0xa35f493751fffe6d, 0x160477cd6dddefaa, 0x85329d64863c1fe8,
+	0x515c648c75b45bf4, 0xc26a8e259e55abb6, 0x7731b0dfa277ba71, 0xe4075a7649964a33,
+	0x8eb0268230d268bd, 0x1d86cc2bdb3398ff, 0xa8ddf2d1e7118938, 0x3beb18780cf0797a,
+	0xde0bc321fff17acc, 0x4d3d298814108a8e, 0xf866177228329b49, 0x6b50fddbc3d36b0b,
+	0x01e7812fba974985, 0x92d16b865176b9c7, 0x278a557c6d54a800, 0xb4bcbfd586b55842,
+	0x60d2463d753d1c5e, 0xf3e4ac949edcec1c, 0x46bf926ea2fefddb, 0xd58978c7491f0d99,
+	0xbf3e0433305b2f17, 0x2c08ee9adbbadf55, 0x9953d060e798ce92, 0x0a653ac90c793ed0,
+	0x318e22b1008947aa, 0xa2b8c818eb68b7e8, 0x17e3f6e2d74aa62f, 0x84d51c4b3cab566d,
+	0xee6260bf45ef74e3, 0x7d548a16ae0e84a1, 0xc80fb4ec922c9566, 0x5b395e4579cd6524,
+	0x8f57a7ad8a452138, 0x1c614d0461a4d17a, 0xa93a73fe5d86c0bd, 0x3a0c9957b66730ff,
+	0x50bbe5a3cf231271, 0xc38d0f0a24c2e233, 0x76d631f018e0f3f4, 0xe5e0db59f30103b6,
+	0x2f216cea150205da, 0xbc178643fee3f598, 0x094cb8b9c2c1e45f, 0x9a7a52102920141d,
+	0xf0cd2ee450643693, 0x63fbc44dbb85c6d1, 0xd6a0fab787a7d716, 0x4596101e6c462754,
+	0x91f8e9f69fce6348, 0x02ce035f742f930a, 0xb7953da5480d82cd, 0x24a3d70ca3ec728f,
+	0x4e14abf8daa85001, 0xdd2241513149a043, 0x68797fab0d6bb184, 0xfb4f9502e68a41c6,
+	0xc0a48d7aea7a38bc, 0x539267d3019bc8fe, 0xe6c959293db9d939, 0x75ffb380d658297b,
+	0x1f48cf74af1c0bf5, 0x8c7e25dd44fdfbb7, 0x39251b2778dfea70, 0xaa13f18e933e1a32,
+	0x7e7d086660b65e2e, 0xed4be2cf8b57ae6c, 0x5810dc35b775bfab, 0xcb26369c5c944fe9,
+	0xa1914a6825d06d67, 0x32a7a0c1ce319d25, 0x87fc9e3bf2138ce2, 0x14ca749219f27ca0,
+	0xf12aafcbeaf37f16, 0x621c456201128f54, 0xd7477b983d309e93, 0x44719131d6d16ed1,
+	0x2ec6edc5af954c5f, 0xbdf0076c4474bc1d, 0x08ab39967856adda, 0x9b9dd33f93b75d98,
+	0x4ff32ad7603f1984, 0xdcc5c07e8bdee9c6, 0x699efe84b7fcf801, 0xfaa8142d5c1d0843,
+	0x901f68d925592acd, 0x03298270ceb8da8f, 0xb672bc8af29acb48, 0x25445623197b3b0a,
+	0x1eaf4e5b158b4270, 0x8d99a4f2fe6ab232, 0x38c29a08c248a3f5, 0xabf470a129a953b7,
+	0xc1430c5550ed7139, 0x5275e6fcbb0c817b, 0xe72ed806872e90bc, 0x741832af6ccf60fe,
+	0xa076cb479f4724e2, 0x334021ee74a6d4a0, 0x861b1f144884c567, 0x152df5bda3653525,
+	0x7f9a8949da2117ab, 0xecac63e031c0e7e9, 0x59f75d1a0de2f62e, 0xcac1b7b3e603066c,
+	0xcd74327dc0e5faf6, 0x5e42d8d42b040ab4, 0xeb19e62e17261b73, 0x782f0c87fcc7eb31,
+	0x129870738583c9bf, 0x81ae9ada6e6239fd, 0x34f5a4205240283a, 0xa7c34e89b9a1d878,
+	0x73adb7614a299c64, 0xe09b5dc8a1c86c26, 0x55c063329dea7de1, 0xc6f6899b760b8da3,
+	0xac41f56f0f4faf2d, 0x3f771fc6e4ae5f6f, 0x8a2c213cd88c4ea8, 0x191acb95336dbeea,
+	0x22f1d3ed3f9dc790, 0xb1c73944d47c37d2, 0x049c07bee85e2615, 0x97aaed1703bfd657,
+	0xfd1d91e37afbf4d9, 0x6e2b7b4a911a049b, 0xdb7045b0ad38155c, 0x4846af1946d9e51e,
+	0x9c2856f1b551a102, 0x0f1ebc585eb05140, 0xba4582a262924087, 0x2973680b8973b0c5,
+	0x43c414fff037924b, 0xd0f2fe561bd66209, 0x65a9c0ac27f473ce, 0xf69f2a05cc15838c,
+	0x137ff15c3f14803a, 0x80491bf5d4f57078, 0x3512250fe8d761bf, 0xa624cfa6033691fd,
+	0xcc93b3527a72b373, 0x5fa559fb91934331, 0xeafe6701adb152f6, 0x79c88da84650a2b4,
+	0xada67440b5d8e6a8, 0x3e909ee95e3916ea, 0x8bcba013621b072d, 0x18fd4aba89faf76f,
+	0x724a364ef0bed5e1, 0xe17cdce71b5f25a3, 0x5427e21d277d3464, 0xc71108b4cc9cc426,
+	0xfcfa10ccc06cbd5c, 0x6fccfa652b8d4d1e, 0xda97c49f17af5cd9, 0x49a12e36fc4eac9b,
+	0x231652c2850a8e15, 0xb020b86b6eeb7e57, 0x057b869152c96f90, 0x964d6c38b9289fd2,
+	0x422395d04aa0dbce, 0xd1157f79a1412b8c, 0x644e41839d633a4b, 0xf778ab2a7682ca09,
+	0x9dcfd7de0fc6e887, 0x0ef93d77e42718c5, 0xbba2038dd8050902, 0x2894e92433e4f940,
+	0xe2555e97d5e7ff2c, 0x7163b43e3e060f6e, 0xc4388ac402241ea9, 0x570e606de9c5eeeb,
+	0x3db91c999081cc65, 0xae8ff6307b603c27, 0x1bd4c8ca47422de0, 0x88e22263aca3dda2,
+	0x5c8cdb8b5f2b99be, 0xcfba3122b4ca69fc, 0x7ae10fd888e8783b, 0xe9d7e57163098879,
+	0x836099851a4daaf7, 0x1056732cf1ac5ab5, 0xa50d4dd6cd8e4b72, 0x363ba77f266fbb30,
+	0x0dd0bf072a9fc24a, 0x9ee655aec17e3208, 0x2bbd6b54fd5c23cf, 0xb88b81fd16bdd38d,
+	0xd23cfd096ff9f103, 0x410a17a084180141, 0xf451295ab83a1086, 0x6767c3f353dbe0c4,
+	0xb3093a1ba053a4d8, 0x203fd0b24bb2549a, 0x9564ee487790455d, 0x065204e19c71b51f,
+	0x6ce57815e5359791, 0xffd392bc0ed467d3, 0x4a88ac4632f67614, 0xd9be46efd9178656,
+	0x3c5e9db62a1685e0, 0xaf68771fc1f775a2, 0x1a3349e5fdd56465, 0x8905a34c16349427,
+	0xe3b2dfb86f70b6a9, 0x70843511849146eb, 0xc5df0bebb8b3572c, 0x56e9e1425352a76e,
+	0x828718aaa0dae372, 0x11b1f2034b3b1330, 0xa4eaccf9771902f7, 0x37dc26509cf8f2b5,
+	0x5d6b5aa4e5bcd03b, 0xce5db00d0e5d2079, 0x7b068ef7327f31be, 0xe830645ed99ec1fc,
+	0xd3db7c26d56eb886, 0x40ed968f3e8f48c4, 0xf5b6a87502ad5903, 0x668042dce94ca941,
+	0x0c373e2890088bcf, 0x9f01d4817be97b8d, 0x2a5aea7b47cb6a4a, 0xb96c00d2ac2a9a08,
+	0x6d02f93a5fa2de14, 0xfe341393b4432e56, 0x4b6f2d6988613f91, 0xd859c7c06380cfd3,
+	0xb2eebb341ac4ed5d, 0x21d8519df1251d1f, 0x94836f67cd070cd8, 0x07b585ce26e6fc9a,
+	0x0000000000000000, 0x09df8e536b2a05af, 0x8188f70e3db5fa1c, 0x8857795d569fffb3,
+	0x0211ef1d7a6af539, 0x0bce614e1140f096, 0x8399181347df0f25, 0x8a4696402cf50a8a,
+	0x0422de3bf4d4ea73, 0x0dfd50689ffeefdc, 0x85aa2935c961106f, 0x8c75a766a24b15c0,
+	0x063331268ebe1f4a, 0x0fecbf75e5941ae5, 0x87bbc628b30be556, 0x8e64487bd821e0f9,
+	0x0844bc77e8a9d5e7, 0x019b32248383d048, 0x89cc4b79d51c2ffb, 0x8013c52abe362a54,
+	0x0a55536a92c320de, 0x038add39f9e92571, 0x8bdda464af76dac2, 0x82022a37c45cdf6d,
+	0x0c66624c1c7d3f94, 0x05b9ec1f77573a3b, 0x8dee954221c8c588, 0x84311b114ae2c027,
+	0x0e778d516617caad, 0x07a803020d3dcf02, 0x8fff7a5f5ba230b1, 0x8620f40c3088351e,
+	0x83be92463bb25b8d, 0x8a611c1550985e22, 0x023665480607a191, 0x0be9eb1b6d2da43e,
+	0x81af7d5b41d8aeb4, 0x8870f3082af2ab1b, 0x00278a557c6d54a8, 0x09f8040617475107,
+	0x879c4c7dcf66b1fe, 0x8e43c22ea44cb451, 0x0614bb73f2d34be2, 0x0fcb352099f94e4d,
+	0x858da360b50c44c7, 0x8c522d33de264168, 0x0405546e88b9bedb, 0x0ddada3de393bb74,
+	0x8bfa2e31d31b8e6a, 0x8225a062b8318bc5, 0x0a72d93feeae7476, 0x03ad576c858471d9,
+	0x89ebc12ca9717b53, 0x80344f7fc25b7efc, 0x0863362294c4814f, 0x01bcb871ffee84e0,
+	0x8fd8f00a27cf6419, 0x86077e594ce561b6, 0x0e5007041a7a9e05, 0x078f895771509baa,
+	0x8dc91f175da59120, 0x84169144368f948f, 0x0c41e81960106b3c, 0x059e664a0b3a6e93,
+	0x954bcf249d854758, 0x9c944177f6af42f7, 0x14c3382aa030bd44, 0x1d1cb679cb1ab8eb,
+	0x975a2039e7efb261, 0x9e85ae6a8cc5b7ce, 0x16d2d737da5a487d, 0x1f0d5964b1704dd2,
+	0x9169111f6951ad2b, 0x98b69f4c027ba884, 0x10e1e61154e45737, 0x193e68423fce5298,
+	0x9378fe02133b5812, 0x9aa7705178115dbd, 0x12f0090c2e8ea20e, 0x1b2f875f45a4a7a1,
+	0x9d0f7353752c92bf, 0x94d0fd001e069710, 0x1c87845d489968a3, 0x15580a0e23b36d0c,
+	0x9f1e9c4e0f466786, 0x96c1121d646c6229, 0x1e966b4032f39d9a, 0x1749e51359d99835,
+	0x992dad6881f878cc, 0x90f2233bead27d63, 0x18a55a66bc4d82d0, 0x117ad435d767877f,
+	0x9b3c4275fb928df5, 0x92e3cc2690b8885a, 0x1ab4b57bc62777e9, 0x136b3b28ad0d7246,
+	0x16f55d62a6371cd5, 0x1f2ad331cd1d197a, 0x977daa6c9b82e6c9, 0x9ea2243ff0a8e366,
+	0x14e4b27fdc5de9ec, 0x1d3b3c2cb777ec43, 0x956c4571e1e813f0, 0x9cb3cb228ac2165f,
+	0x12d7835952e3f6a6, 0x1b080d0a39c9f309, 0x935f74576f560cba, 0x9a80fa04047c0915,
+	0x10c66c442889039f, 0x1919e21743a30630, 0x914e9b4a153cf983, 0x989115197e16fc2c,
+	0x1eb1e1154e9ec932, 0x176e6f4625b4cc9d, 0x9f39161b732b332e, 0x96e6984818013681,
+	0x1ca00e0834f43c0b, 0x157f805b5fde39a4, 0x9d28f9060941c617, 0x94f77755626bc3b8,
+	0x1a933f2eba4a2341, 0x134cb17dd16026ee, 0x9b1bc82087ffd95d, 0x92c44673ecd5dcf2,
+	0x1882d033c020d678, 0x115d5e60ab0ad3d7, 0x990a273dfd952c64, 0x90d5a96e96bf29cb,
+	0x2a979e493a0b8fb0, 0x2348101a51218a1f, 0xab1f694707be75ac, 0xa2c0e7146c947003,
+	0x2886715440617a89, 0x2159ff072b4b7f26, 0xa90e865a7dd48095, 0xa0d1080916fe853a,
+	0x2eb54072cedf65c3, 0x276ace21a5f5606c, 0xaf3db77cf36a9fdf, 0xa6e2392f98409a70,
+	0x2ca4af6fb4b590fa, 0x257b213cdf9f9555, 0xad2c586189006ae6, 0xa4f3d632e22a6f49,
+	0x22d3223ed2a25a57, 0x2b0cac6db9885ff8, 0xa35bd530ef17a04b, 0xaa845b63843da5e4,
+	0x20c2cd23a8c8af6e, 0x291d4370c3e2aac1, 0xa14a3a2d957d5572, 0xa895b47efe5750dd,
+	0x26f1fc052676b024, 0x2f2e72564d5cb58b, 0xa7790b0b1bc34a38, 0xaea6855870e94f97,
+	0x24e013185c1c451d, 0x2d3f9d4b373640b2, 0xa568e41661a9bf01, 0xacb76a450a83baae,
+	0xa9290c0f01b9d43d, 0xa0f6825c6a93d192, 0x28a1fb013c0c2e21, 0x217e755257262b8e,
+	0xab38e3127bd32104, 0xa2e76d4110f924ab, 0x2ab0141c4666db18, 0x236f9a4f2d4cdeb7,
+	0xad0bd234f56d3e4e, 0xa4d45c679e473be1, 0x2c83253ac8d8c452, 0x255cab69a3f2c1fd,
+	0xaf1a3d298f07cb77, 0xa6c5b37ae42dced8, 0x2e92ca27b2b2316b, 0x274d4474d99834c4,
+	0xa16db078e91001da, 0xa8b23e2b823a0475, 0x20e54776d4a5fbc6, 0x293ac925bf8ffe69,
+	0xa37c5f65937af4e3, 0xaaa3d136f850f14c, 0x22f4a86baecf0eff, 0x2b2b2638c5e50b50,
+	0xa54f6e431dc4eba9, 0xac90e01076eeee06, 0x24c7994d207111b5, 0x2d18171e4b5b141a,
+	0xa75e815e67ae1e90, 0xae810f0d0c841b3f, 0x26d676505a1be48c, 0x2f09f8033131e123,
+	0xbfdc516da78ec8e8, 0xb603df3ecca4cd47, 0x3e54a6639a3b32f4, 0x378b2830f111375b,
+	0xbdcdbe70dde43dd1, 0xb4123023b6ce387e, 0x3c45497ee051c7cd, 0x359ac72d8b7bc262,
+	0xbbfe8f56535a229b, 0xb221010538702734, 0x3a7678586eefd887, 0x33a9f60b05c5dd28,
+	0xb9ef604b2930d7a2, 0xb030ee18421ad20d, 0x3867974514852dbe, 0x31b819167faf2811,
+	0xb798ed1a4f271d0f, 0xbe476349240d18a0, 0x36101a147292e713, 0x3fcf944719b8e2bc,
+	0xb5890207354de836, 0xbc568c545e67ed99, 0x3401f50908f8122a, 0x3dde7b5a63d21785,
+	0xb3ba3321bbf3f77c, 0xba65bd72d0d9f2d3, 0x3232c42f86460d60, 0x3bed4a7ced6c08cf,
+	0xb1abdc3cc1990245, 0xb874526faab307ea, 0x30232b32fc2cf859, 0x39fca5619706fdf6,
+	0x3c62c32b9c3c9365, 0x35bd4d78f71696ca, 0xbdea3425a1896979, 0xb435ba76caa36cd6,
+	0x3e732c36e656665c, 0x37aca2658d7c63f3, 0xbffbdb38dbe39c40, 0xb624556bb0c999ef,
+	0x38401d1068e87916, 0x319f934303c27cb9, 0xb9c8ea1e555d830a, 0xb017644d3e7786a5,
+	0x3a51f20d12828c2f, 0x338e7c5e79a88980, 0xbbd905032f377633, 0xb2068b50441d739c,
+	0x34267f5c74954682, 0x3df9f10f1fbf432d, 0xb5ae88524920bc9e, 0xbc710601220ab931,
+	0x363790410effb3bb, 0x3fe81e1265d5b614, 0xb7bf674f334a49a7, 0xbe60e91c58604c08,
+	0x3004a1678041acf1, 0x39db2f34eb6ba95e, 0xb18c5669bdf456ed, 0xb853d83ad6de5342,
+	0x32154e7afa2b59c8, 0x3bcac02991015c67, 0xb39db974c79ea3d4, 0xba423727acb4a67b,
+	0x0000000000000000, 0xc718d73a9ff7ee23, 0x8e31ae753eefdd47, 0x4929794fa1183364,
+	0x1c635ceb7cdebb8f, 0xdb7b8bd1e32955ac, 0x9252f29e423166c8, 0x554a25a4ddc688eb,
+	0xabf0527f125d875d, 0x6ce885458daa697e, 0x25c1fc0a2cb25a1a, 0xe2d92b30b345b439,
+	0xb7930e946e833cd2, 0x708bd9aef174d2f1, 0x39a2a0e1506ce195, 0xfeba77dbcf9b0fb6,
+	0x56e1a5fe24ba0ebb, 0x91f972c4bb4de098, 0xd8d00b8b1a55d3fc, 0x1fc8dcb185a23ddf,
+	0x4a82f9155864b534, 0x8d9a2e2fc7935b17, 0xc4b35760668b6873, 0x03ab805af97c8650,
+	0xfd11f78136e789e6, 0x3a0920bba91067c5, 0x732059f4080854a1, 0xb4388ece97ffba82,
+	0xe172ab6a4a393269, 0x266a7c50d5cedc4a, 0x6f43051f74d6ef2e, 0xa85bd225eb21010d,
+	0x3ff4a154a295ed34, 0xf8ec766e3d620317, 0xb1c50f219c7a3073, 0x76ddd81b038dde50,
+	0x2397fdbfde4b56bb, 0xe48f2a8541bcb898, 0xada653cae0a48bfc, 0x6abe84f07f5365df,
+	0x9404f32bb0c86a69, 0x531c24112f3f844a, 0x1a355d5e8e27b72e, 0xdd2d8a6411d0590d,
+	0x8867afc0cc16d1e6, 0x4f7f78fa53e13fc5, 0x065601b5f2f90ca1, 0xc14ed68f6d0ee282,
+	0x691504aa862fe38f, 0xae0dd39019d80dac, 0xe724aadfb8c03ec8, 0x203c7de52737d0eb,
+	0x75765841faf15800, 0xb26e8f7b6506b623, 0xfb47f634c41e8547, 0x3c5f210e5be96b64,
+	0xc2e556d5947264d2, 0x05fd81ef0b858af1, 0x4cd4f8a0aa9db995, 0x8bcc2f9a356a57b6,
+	0xde860a3ee8acdf5d, 0x199edd04775b317e, 0x50b7a44bd643021a, 0x97af737149b4ec39,
+	0x7ee843a9442bdb69, 0xb9f09493dbdc354a, 0xf0d9eddc7ac4062e, 0x37c13ae6e533e80d,
+	0x628b1f4238f560e6, 0xa593c878a7028ec5, 0xecbab137061abda1, 0x2ba2660d99ed5382,
+	0xd51811d656765c34, 0x1200c6ecc981b217, 0x5b29bfa368998173, 0x9c316899f76e6f50,
+	0xc97b4d3d2aa8e7bb, 0x0e639a07b55f0998, 0x474ae34814473afc, 0x805234728bb0d4df,
+	0x2809e6576091d5d2, 0xef11316dff663bf1, 0xa63848225e7e0895, 0x61209f18c189e6b6,
+	0x346ababc1c4f6e5d, 0xf3726d8683b8807e, 0xba5b14c922a0b31a, 0x7d43c3f3bd575d39,
+	0x83f9b42872cc528f, 0x44e16312ed3bbcac, 0x0dc81a5d4c238fc8, 0xcad0cd67d3d461eb,
+	0x9f9ae8c30e12e900, 0x58823ff991e50723, 0x11ab46b630fd3447, 0xd6b3918caf0ada64,
+	0x411ce2fde6be365d, 0x860435c77949d87e, 0xcf2d4c88d851eb1a, 0x08359bb247a60539,
+	0x5d7fbe169a608dd2, 0x9a67692c059763f1, 0xd34e1063a48f5095, 0x1456c7593b78beb6,
+	0xeaecb082f4e3b100, 0x2df467b86b145f23, 0x64dd1ef7ca0c6c47, 0xa3c5c9cd55fb8264,
+	0xf68fec69883d0a8f, 0x31973b5317cae4ac, 0x78be421cb6d2d7c8, 0xbfa69526292539eb,
+	0x17fd4703c20438e6, 0xd0e590395df3d6c5, 0x99cce976fcebe5a1, 0x5ed43e4c631c0b82,
+	0x0b9e1be8beda8369, 0xcc86ccd2212d6d4a, 0x85afb59d80355e2e, 0x42b762a71fc2b00d,
+	0xbc0d157cd059bfbb, 0x7b15c2464fae5198, 0x323cbb09eeb662fc, 0xf5246c3371418cdf,
+	0xa06e4997ac870434, 0x67769ead3370ea17, 0x2e5fe7e29268d973, 0xe94730d80d9f3750,
+	0xfcd087528956b6d3, 0x3bc8506816a158f0, 0x72e12927b7b96b94, 0xb5f9fe1d284e85b7,
+	0xe0b3dbb9f5880d5c, 0x27ab0c836a7fe37f, 0x6e8275cccb67d01b, 0xa99aa2f654903e38,
+	0x5720d52d9b0b318e, 0x9038021704fcdfad, 0xd9117b58a5e4ecc9, 0x1e09ac623a1302ea,
+	0x4b4389c6e7d58a01, 0x8c5b5efc78226422, 0xc57227b3d93a5746, 0x026af08946cdb965,
+	0xaa3122acadecb868, 0x6d29f596321b564b, 0x24008cd99303652f, 0xe3185be30cf48b0c,
+	0xb6527e47d13203e7, 0x714aa97d4ec5edc4, 0x3863d032efdddea0, 0xff7b0708702a3083,
+	0x01c170d3bfb13f35, 0xc6d9a7e92046d116, 0x8ff0dea6815ee272, 0x48e8099c1ea90c51,
+	0x1da22c38c36f84ba, 0xdabafb025c986a99, 0x9393824dfd8059fd, 0x548b55776277b7de,
+	0xc32426062bc35be7, 0x043cf13cb434b5c4, 0x4d158873152c86a0, 0x8a0d5f498adb6883,
+	0xdf477aed571de068, 0x185fadd7c8ea0e4b, 0x5176d49869f23d2f, 0x966e03a2f605d30c,
+	0x68d47479399edcba, 0xafcca343a6693299, 0xe6e5da0c077101fd, 0x21fd0d369886efde,
+	0x74b7289245406735, 0xb3afffa8dab78916, 0xfa8686e77bafba72, 0x3d9e51dde4585451,
+	0x95c583f80f79555c, 0x52dd54c2908ebb7f, 0x1bf42d8d3196881b, 0xdcecfab7ae616638,
+	0x89a6df1373a7eed3, 0x4ebe0829ec5000f0, 0x079771664d483394, 0xc08fa65cd2bfddb7,
+	0x3e35d1871d24d201, 0xf92d06bd82d33c22, 0xb0047ff223cb0f46, 0x771ca8c8bc3ce165,
+	0x22568d6c61fa698e, 0xe54e5a56fe0d87ad, 0xac6723195f15b4c9, 0x6b7ff423c0e25aea,
+	0x8238c4fbcd7d6dba, 0x452013c1528a8399, 0x0c096a8ef392b0fd, 0xcb11bdb46c655ede,
+	0x9e5b9810b1a3d635, 0x59434f2a2e543816, 0x106a36658f4c0b72, 0xd772e15f10bbe551,
+	0x29c89684df20eae7, 0xeed041be40d704c4, 0xa7f938f1e1cf37a0, 0x60e1efcb7e38d983,
+	0x35abca6fa3fe5168, 0xf2b31d553c09bf4b, 0xbb9a641a9d118c2f, 0x7c82b32002e6620c,
+	0xd4d96105e9c76301, 0x13c1b63f76308d22, 0x5ae8cf70d728be46, 0x9df0184a48df5065,
+	0xc8ba3dee9519d88e, 0x0fa2ead40aee36ad, 0x468b939babf605c9, 0x819344a13401ebea,
+	0x7f29337afb9ae45c, 0xb831e440646d0a7f, 0xf1189d0fc575391b, 0x36004a355a82d738,
+	0x634a6f9187445fd3, 0xa452b8ab18b3b1f0, 0xed7bc1e4b9ab8294, 0x2a6316de265c6cb7,
+	0xbdcc65af6fe8808e, 0x7ad4b295f01f6ead, 0x33fdcbda51075dc9, 0xf4e51ce0cef0b3ea,
+	0xa1af394413363b01, 0x66b7ee7e8cc1d522, 0x2f9e97312dd9e646, 0xe886400bb22e0865,
+	0x163c37d07db507d3, 0xd124e0eae242e9f0, 0x980d99a5435ada94, 0x5f154e9fdcad34b7,
+	0x0a5f6b3b016bbc5c, 0xcd47bc019e9c527f, 0x846ec54e3f84611b, 0x43761274a0738f38,
+	0xeb2dc0514b528e35, 0x2c35176bd4a56016, 0x651c6e2475bd5372, 0xa204b91eea4abd51,
+	0xf74e9cba378c35ba, 0x30564b80a87bdb99, 0x797f32cf0963e8fd, 0xbe67e5f5969406de,
+	0x40dd922e590f0968, 0x87c54514c6f8e74b, 0xceec3c5b67e0d42f, 0x09f4eb61f8173a0c,
+	0x5cbecec525d1b2e7, 0x9ba619ffba265cc4, 0xd28f60b01b3e6fa0, 0x1597b78a84c98183,
+	0x0000000000000000, 0x6b97e50cf94c9ce5, 0x451821b01978c889, 0x2e8fc4bce034546c,
+	0x1906a8c9d8116051, 0x72914dc5215dfcb4, 0x5c1e8979c169a8d8, 0x37896c753825343d,
+	0x320c5093b123c0a2, 0x599bb59f486f5c47, 0x77147123a85b082b, 0x1c83942f511794ce,
+	0x2b0af85a6932a0f3, 0x409d1d56907e3c16, 0x6e12d9ea704a687a, 0x05853ce68906f49f,
+	0xf72e4a8f88a67007, 0x9cb9af8371eaece2, 0xb2366b3f91deb88e, 0xd9a18e336892246b,
+	0xee28e24650b71056, 0x85bf074aa9fb8cb3, 0xab30c3f649cfd8df, 0xc0a726fab083443a,
+	0xc5221a1c3985b0a5, 0xaeb5ff10c0c92c40, 0x803a3bac20fd782c, 0xebaddea0d9b1e4c9,
+	0xdc24b2d5e194d0f4, 0xb7b357d918d84c11, 0x993c9365f8ec187d, 0xf2ab766901a08498,
+	0xee5d941e114de10e, 0x85ca7112e8017deb, 0xab45b5ae08352987, 0xc0d250a2f179b562,
+	0xf75b3cd7c95c815f, 0x9cccd9db30101dba, 0xb2431d67d02449d6, 0xd9d4f86b2968d533,
+	0xdc51c48da06e21ac, 0xb7c621815922bd49, 0x9949e53db916e925, 0xf2de0031405a75c0,
+	0xc5576c44787f41fd, 0xaec089488133dd18, 0x804f4df461078974, 0xebd8a8f8984b1591,
+	0x1973de9199eb9109, 0x72e43b9d60a70dec, 0x5c6bff2180935980, 0x37fc1a2d79dfc565,
+	0x0075765841faf158, 0x6be29354b8b66dbd, 0x456d57e8588239d1, 0x2efab2e4a1cea534,
+	0x2b7f8e0228c851ab, 0x40e86b0ed184cd4e, 0x6e67afb231b09922, 0x05f04abec8fc05c7,
+	0x327926cbf0d931fa, 0x59eec3c70995ad1f, 0x7761077be9a1f973, 0x1cf6e27710ed6596,
+	0xdcbb283d229ac21d, 0xb72ccd31dbd65ef8, 0x99a3098d3be20a94, 0xf234ec81c2ae9671,
+	0xc5bd80f4fa8ba24c, 0xae2a65f803c73ea9, 0x80a5a144e3f36ac5, 0xeb3244481abff620,
+	0xeeb778ae93b902bf, 0x85209da26af59e5a, 0xabaf591e8ac1ca36, 0xc038bc12738d56d3,
+	0xf7b1d0674ba862ee, 0x9c26356bb2e4fe0b, 0xb2a9f1d752d0aa67, 0xd93e14dbab9c3682,
+	0x2b9562b2aa3cb21a, 0x400287be53702eff, 0x6e8d4302b3447a93, 0x051aa60e4a08e676,
+	0x3293ca7b722dd24b, 0x59042f778b614eae, 0x778bebcb6b551ac2, 0x1c1c0ec792198627,
+	0x199932211b1f72b8, 0x720ed72de253ee5d, 0x5c8113910267ba31, 0x3716f69dfb2b26d4,
+	0x009f9ae8c30e12e9, 0x6b087fe43a428e0c, 0x4587bb58da76da60, 0x2e105e54233a4685,
+	0x32e6bc2333d72313, 0x5971592fca9bbff6, 0x77fe9d932aafeb9a, 0x1c69789fd3e3777f,
+	0x2be014eaebc64342, 0x4077f1e6128adfa7, 0x6ef8355af2be8bcb, 0x056fd0560bf2172e,
+	0x00eaecb082f4e3b1, 0x6b7d09bc7bb87f54, 0x45f2cd009b8c2b38, 0x2e65280c62c0b7dd,
+	0x19ec44795ae583e0, 0x727ba175a3a91f05, 0x5cf465c9439d4b69, 0x376380c5bad1d78c,
+	0xc5c8f6acbb715314, 0xae5f13a0423dcff1, 0x80d0d71ca2099b9d, 0xeb4732105b450778,
+	0xdcce5e6563603345, 0xb759bb699a2cafa0, 0x99d67fd57a18fbcc, 0xf2419ad983546729,
+	0xf7c4a63f0a5293b6, 0x9c534333f31e0f53, 0xb2dc878f132a5b3f, 0xd94b6283ea66c7da,
+	0xeec20ef6d243f3e7, 0x8555ebfa2b0f6f02, 0xabda2f46cb3b3b6e, 0xc04dca4a3277a78b,
+	0xb877517a4434853b, 0xd3e0b476bd7819de, 0xfd6f70ca5d4c4db2, 0x96f895c6a400d157,
+	0xa171f9b39c25e56a, 0xcae61cbf6569798f, 0xe469d803855d2de3, 0x8ffe3d0f7c11b106,
+	0x8a7b01e9f5174599, 0xe1ece4e50c5bd97c, 0xcf632059ec6f8d10, 0xa4f4c555152311f5,
+	0x937da9202d0625c8, 0xf8ea4c2cd44ab92d, 0xd6658890347eed41, 0xbdf26d9ccd3271a4,
+	0x4f591bf5cc92f53c, 0x24cefef935de69d9, 0x0a413a45d5ea3db5, 0x61d6df492ca6a150,
+	0x565fb33c1483956d, 0x3dc85630edcf0988, 0x1347928c0dfb5de4, 0x78d07780f4b7c101,
+	0x7d554b667db1359e, 0x16c2ae6a84fda97b, 0x384d6ad664c9fd17, 0x53da8fda9d8561f2,
+	0x6453e3afa5a055cf, 0x0fc406a35cecc92a, 0x214bc21fbcd89d46, 0x4adc2713459401a3,
+	0x562ac56455796435, 0x3dbd2068ac35f8d0, 0x1332e4d44c01acbc, 0x78a501d8b54d3059,
+	0x4f2c6dad8d680464, 0x24bb88a174249881, 0x0a344c1d9410cced, 0x61a3a9116d5c5008,
+	0x642695f7e45aa497, 0x0fb170fb1d163872, 0x213eb447fd226c1e, 0x4aa9514b046ef0fb,
+	0x7d203d3e3c4bc4c6, 0x16b7d832c5075823, 0x38381c8e25330c4f, 0x53aff982dc7f90aa,
+	0xa1048febdddf1432, 0xca936ae7249388d7, 0xe41cae5bc4a7dcbb, 0x8f8b4b573deb405e,
+	0xb802272205ce7463, 0xd395c22efc82e886, 0xfd1a06921cb6bcea, 0x968de39ee5fa200f,
+	0x9308df786cfcd490, 0xf89f3a7495b04875, 0xd610fec875841c19, 0xbd871bc48cc880fc,
+	0x8a0e77b1b4edb4c1, 0xe19992bd4da12824, 0xcf165601ad957c48, 0xa481b30d54d9e0ad,
+	0x64cc794766ae4726, 0x0f5b9c4b9fe2dbc3, 0x21d458f77fd68faf, 0x4a43bdfb869a134a,
+	0x7dcad18ebebf2777, 0x165d348247f3bb92, 0x38d2f03ea7c7effe, 0x534515325e8b731b,
+	0x56c029d4d78d8784, 0x3d57ccd82ec11b61, 0x13d80864cef54f0d, 0x784fed6837b9d3e8,
+	0x4fc6811d0f9ce7d5, 0x24516411f6d07b30, 0x0adea0ad16e42f5c, 0x614945a1efa8b3b9,
+	0x93e233c8ee083721, 0xf875d6c41744abc4, 0xd6fa1278f770ffa8, 0xbd6df7740e3c634d,
+	0x8ae49b0136195770, 0xe1737e0dcf55cb95, 0xcffcbab12f619ff9, 0xa46b5fbdd62d031c,
+	0xa1ee635b5f2bf783, 0xca798657a6676b66, 0xe4f642eb46533f0a, 0x8f61a7e7bf1fa3ef,
+	0xb8e8cb92873a97d2, 0xd37f2e9e7e760b37, 0xfdf0ea229e425f5b, 0x96670f2e670ec3be,
+	0x8a91ed5977e3a628, 0xe10608558eaf3acd, 0xcf89cce96e9b6ea1, 0xa41e29e597d7f244,
+	0x93974590aff2c679, 0xf800a09c56be5a9c, 0xd68f6420b68a0ef0, 0xbd18812c4fc69215,
+	0xb89dbdcac6c0668a, 0xd30a58c63f8cfa6f, 0xfd859c7adfb8ae03, 0x9612797626f432e6,
+	0xa19b15031ed106db, 0xca0cf00fe79d9a3e, 0xe48334b307a9ce52, 0x8f14d1bffee552b7,
+	0x7dbfa7d6ff45d62f, 0x162842da06094aca, 0x38a78666e63d1ea6, 0x5330636a1f718243,
+	0x64b90f1f2754b67e, 0x0f2eea13de182a9b, 0x21a12eaf3e2c7ef7, 0x4a36cba3c760e212,
+	0x4fb3f7454e66168d, 0x24241249b72a8a68, 0x0aabd6f5571ede04, 0x613c33f9ae5242e1,
+	0x56b55f8c967776dc, 0x3d22ba806f3bea39, 0x13ad7e3c8f0fbe55, 0x783a9b30764322b0,
+	0x0000000000000000, 0x70efa2f488680a77, 0xe0de45e911d114ee, 0x9031e71d99b91e99,
+	0x538b617bc843d99e, 0x2364c38f402bd3e9, 0xb3552492d992cd70, 0xc3ba866651fac707,
+	0x3520295f7b66427f, 0x45cf8babf30e4808, 0xd5fe6cb66ab75691, 0xa511ce42e2df5ce6,
+	0x66ab4824b3259be1, 0x1644ead03b4d9196, 0x86750dcda2f48f0f, 0xf69aaf392a9c8578,
+	0x6a4052bef6cc84fe, 0x1aaff04a7ea48e89, 0x8a9e1757e71d9010, 0xfa71b5a36f759a67,
+	0x39cb33c53e8f5d60, 0x49249131b6e75717, 0xd915762c2f5e498e, 0xa9fad4d8a73643f9,
+	0x5f607be18daac681, 0x2f8fd91505c2ccf6, 0xbfbe3e089c7bd26f, 0xcf519cfc1413d818,
+	0x0ceb1a9a45e91f1f, 0x7c04b86ecd811568, 0xec355f7354380bf1, 0x9cdafd87dc500186,
+	0x47b64ed50678f9bf, 0x3759ec218e10f3c8, 0xa7680b3c17a9ed51, 0xd787a9c89fc1e726,
+	0x143d2faece3b2021, 0x64d28d5a46532a56, 0xf4e36a47dfea34cf, 0x840cc8b357823eb8,
+	0x7296678a7d1ebbc0, 0x0279c57ef576b1b7, 0x924822636ccfaf2e, 0xe2a78097e4a7a559,
+	0x211d06f1b55d625e, 0x51f2a4053d356829, 0xc1c34318a48c76b0, 0xb12ce1ec2ce47cc7,
+	0x2df61c6bf0b47d41, 0x5d19be9f78dc7736, 0xcd285982e16569af, 0xbdc7fb76690d63d8,
+	0x7e7d7d1038f7a4df, 0x0e92dfe4b09faea8, 0x9ea338f92926b031, 0xee4c9a0da14eba46,
+	0x18d635348bd23f3e, 0x683997c003ba3549, 0xf80870dd9a032bd0, 0x88e7d229126b21a7,
+	0x4b5d544f4391e6a0, 0x3bb2f6bbcbf9ecd7, 0xab8311a65240f24e, 0xdb6cb352da28f839,
+	0x1d5a7703e611023d, 0x6db5d5f76e79084a, 0xfd8432eaf7c016d3, 0x8d6b901e7fa81ca4,
+	0x4ed116782e52dba3, 0x3e3eb48ca63ad1d4, 0xae0f53913f83cf4d, 0xdee0f165b7ebc53a,
+	0x287a5e5c9d774042, 0x5895fca8151f4a35, 0xc8a41bb58ca654ac, 0xb84bb94104ce5edb,
+	0x7bf13f27553499dc, 0x0b1e9dd3dd5c93ab, 0x9b2f7ace44e58d32, 0xebc0d83acc8d8745,
+	0x771a25bd10dd86c3, 0x07f5874998b58cb4, 0x97c46054010c922d, 0xe72bc2a08964985a,
+	0x249144c6d89e5f5d, 0x547ee63250f6552a, 0xc44f012fc94f4bb3, 0xb4a0a3db412741c4,
+	0x423a0ce26bbbc4bc, 0x32d5ae16e3d3cecb, 0xa2e4490b7a6ad052, 0xd20bebfff202da25,
+	0x11b16d99a3f81d22, 0x615ecf6d2b901755, 0xf16f2870b22909cc, 0x81808a843a4103bb,
+	0x5aec39d6e069fb82, 0x2a039b226801f1f5, 0xba327c3ff1b8ef6c, 0xcadddecb79d0e51b,
+	0x096758ad282a221c, 0x7988fa59a042286b, 0xe9b91d4439fb36f2, 0x9956bfb0b1933c85,
+	0x6fcc10899b0fb9fd, 0x1f23b27d1367b38a, 0x8f1255608adead13, 0xfffdf79402b6a764,
+	0x3c4771f2534c6063, 0x4ca8d306db246a14, 0xdc99341b429d748d, 0xac7696efcaf57efa,
+	0x30ac6b6816a57f7c, 0x4043c99c9ecd750b, 0xd0722e8107746b92, 0xa09d8c758f1c61e5,
+	0x63270a13dee6a6e2, 0x13c8a8e7568eac95, 0x83f94ffacf37b20c, 0xf316ed0e475fb87b,
+	0x058c42376dc33d03, 0x7563e0c3e5ab3774, 0xe55207de7c1229ed, 0x95bda52af47a239a,
+	0x5607234ca580e49d, 0x26e881b82de8eeea, 0xb6d966a5b451f073, 0xc636c4513c39fa04,
+	0x3ab4ee06cc23047a, 0x4a5b4cf2444b0e0d, 0xda6aabefddf21094, 0xaa85091b559a1ae3,
+	0x693f8f7d0460dde4, 0x19d02d898c08d793, 0x89e1ca9415b1c90a, 0xf90e68609dd9c37d,
+	0x0f94c759b7454605, 0x7f7b65ad3f2d4c72, 0xef4a82b0a69452eb, 0x9fa520442efc589c,
+	0x5c1fa6227f069f9b, 0x2cf004d6f76e95ec, 0xbcc1e3cb6ed78b75, 0xcc2e413fe6bf8102,
+	0x50f4bcb83aef8084, 0x201b1e4cb2878af3, 0xb02af9512b3e946a, 0xc0c55ba5a3569e1d,
+	0x037fddc3f2ac591a, 0x73907f377ac4536d, 0xe3a1982ae37d4df4, 0x934e3ade6b154783,
+	0x65d495e74189c2fb, 0x153b3713c9e1c88c, 0x850ad00e5058d615, 0xf5e572fad830dc62,
+	0x365ff49c89ca1b65, 0x46b0566801a21112, 0xd681b175981b0f8b, 0xa66e1381107305fc,
+	0x7d02a0d3ca5bfdc5, 0x0ded02274233f7b2, 0x9ddce53adb8ae92b, 0xed3347ce53e2e35c,
+	0x2e89c1a80218245b, 0x5e66635c8a702e2c, 0xce57844113c930b5, 0xbeb826b59ba13ac2,
+	0x4822898cb13dbfba, 0x38cd2b783955b5cd, 0xa8fccc65a0ecab54, 0xd8136e912884a123,
+	0x1ba9e8f7797e6624, 0x6b464a03f1166c53, 0xfb77ad1e68af72ca, 0x8b980feae0c778bd,
+	0x1742f26d3c97793b, 0x67ad5099b4ff734c, 0xf79cb7842d466dd5, 0x87731570a52e67a2,
+	0x44c99316f4d4a0a5, 0x342631e27cbcaad2, 0xa417d6ffe505b44b, 0xd4f8740b6d6dbe3c,
+	0x2262db3247f13b44, 0x528d79c6cf993133, 0xc2bc9edb56202faa, 0xb2533c2fde4825dd,
+	0x71e9ba498fb2e2da, 0x010618bd07dae8ad, 0x9137ffa09e63f634, 0xe1d85d54160bfc43,
+	0x27ee99052a320647, 0x57013bf1a25a0c30, 0xc730dcec3be312a9, 0xb7df7e18b38b18de,
+	0x7465f87ee271dfd9, 0x048a5a8a6a19d5ae, 0x94bbbd97f3a0cb37, 0xe4541f637bc8c140,
+	0x12ceb05a51544438, 0x622112aed93c4e4f, 0xf210f5b3408550d6, 0x82ff5747c8ed5aa1,
+	0x4145d12199179da6, 0x31aa73d5117f97d1, 0xa19b94c888c68948, 0xd174363c00ae833f,
+	0x4daecbbbdcfe82b9, 0x3d41694f549688ce, 0xad708e52cd2f9657, 0xdd9f2ca645479c20,
+	0x1e25aac014bd5b27, 0x6eca08349cd55150, 0xfefbef29056c4fc9, 0x8e144ddd8d0445be,
+	0x788ee2e4a798c0c6, 0x086140102ff0cab1, 0x9850a70db649d428, 0xe8bf05f93e21de5f,
+	0x2b05839f6fdb1958, 0x5bea216be7b3132f, 0xcbdbc6767e0a0db6, 0xbb346482f66207c1,
+	0x6058d7d02c4afff8, 0x10b77524a422f58f, 0x808692393d9beb16, 0xf06930cdb5f3e161,
+	0x33d3b6abe4092666, 0x433c145f6c612c11, 0xd30df342f5d83288, 0xa3e251b67db038ff,
+	0x5578fe8f572cbd87, 0x25975c7bdf44b7f0, 0xb5a6bb6646fda969, 0xc5491992ce95a31e,
+	0x06f39ff49f6f6419, 0x761c3d0017076e6e, 0xe62dda1d8ebe70f7, 0x96c278e906d67a80,
+	0x0a18856eda867b06, 0x7af7279a52ee7171, 0xeac6c087cb576fe8, 0x9a296273433f659f,
+	0x5993e41512c5a298, 0x297c46e19aada8ef, 0xb94da1fc0314b676, 0xc9a203088b7cbc01,
+	0x3f38ac31a1e03979, 0x4fd70ec52988330e, 0xdfe6e9d8b0312d97, 0xaf094b2c385927e0,
+	0x6cb3cd4a69a3e0e7, 0x1c5c6fbee1cbea90, 0x8c6d88a37872f409, 0xfc822a57f01afe7e,
+	0x0000000000000000, 0x7468dd0d984708f4, 0x7be650b2db6ee0aa, 0x0f8e8dbf4329e85e,
+	0x65fa4bcd5c3c3017, 0x119296c0c47b38e3, 0x1e1c1b7f8752d0bd, 0x6a74c6721f15d849,
+	0xcaf4979ab978602e, 0xbe9c4a97213f68da, 0xb112c72862168084, 0xc57a1a25fa518870,
+	0xaf0edc57e5445039, 0xdb66015a7d0358cd, 0xd4e88ce53e2ab093, 0xa08051e8a66db867,
+	0x94e92f3573f1c05c, 0xe081f238ebb6c8a8, 0xef0f7f87a89f20f6, 0x9b67a28a30d82802,
+	0xf11364f82fcdf04b, 0x857bb9f5b78af8bf, 0x8af5344af4a310e1, 0xfe9de9476ce41815,
+	0x5e1db8afca89a072, 0x2a7565a252cea886, 0x25fbe81d11e740d8, 0x5193351089a0482c,
+	0x3be7f36296b59065, 0x4f8f2e6f0ef29891, 0x4001a3d04ddb70cf, 0x34697eddd59c783b,
+	0x28d35f6ae6e281b9, 0x5cbb82677ea5894d, 0x53350fd83d8c6113, 0x275dd2d5a5cb69e7,
+	0x4d2914a7badeb1ae, 0x3941c9aa2299b95a, 0x36cf441561b05104, 0x42a79918f9f759f0,
+	0xe227c8f05f9ae197, 0x964f15fdc7dde963, 0x99c1984284f4013d, 0xeda9454f1cb309c9,
+	0x87dd833d03a6d180, 0xf3b55e309be1d974, 0xfc3bd38fd8c8312a, 0x88530e82408f39de,
+	0xbc3a705f951341e5, 0xc852ad520d544911, 0xc7dc20ed4e7da14f, 0xb3b4fde0d63aa9bb,
+	0xd9c03b92c92f71f2, 0xada8e69f51687906, 0xa2266b2012419158, 0xd64eb62d8a0699ac,
+	0x76cee7c52c6b21cb, 0x02a63ac8b42c293f, 0x0d28b777f705c161, 0x79406a7a6f42c995,
+	0x1334ac08705711dc, 0x675c7105e8101928, 0x68d2fcbaab39f176, 0x1cba21b7337ef982,
+	0xc390557d2724f331, 0xb7f88870bf63fbc5, 0xb87605cffc4a139b, 0xcc1ed8c2640d1b6f,
+	0xa66a1eb07b18c326, 0xd202c3bde35fcbd2, 0xdd8c4e02a076238c, 0xa9e4930f38312b78,
+	0x0964c2e79e5c931f, 0x7d0c1fea061b9beb, 0x72829255453273b5, 0x06ea4f58dd757b41,
+	0x6c9e892ac260a308, 0x18f654275a27abfc, 0x1778d998190e43a2, 0x6310049581494b56,
+	0x57797a4854d5336d, 0x2311a745cc923b99, 0x2c9f2afa8fbbd3c7, 0x58f7f7f717fcdb33,
+	0x3283318508e9037a, 0x46ebec8890ae0b8e, 0x49656137d387e3d0, 0x3d0dbc3a4bc0eb24,
+	0x9d8dedd2edad5343, 0xe9e530df75ea5bb7, 0xe66bbd6036c3b3e9, 0x9203606dae84bb1d,
+	0xf877a61fb1916354, 0x8c1f7b1229d66ba0, 0x8391f6ad6aff83fe, 0xf7f92ba0f2b88b0a,
+	0xeb430a17c1c67288, 0x9f2bd71a59817a7c, 0x90a55aa51aa89222, 0xe4cd87a882ef9ad6,
+	0x8eb941da9dfa429f, 0xfad19cd705bd4a6b, 0xf55f11684694a235, 0x8137cc65ded3aac1,
+	0x21b79d8d78be12a6, 0x55df4080e0f91a52, 0x5a51cd3fa3d0f20c, 0x2e3910323b97faf8,
+	0x444dd640248222b1, 0x30250b4dbcc52a45, 0x3fab86f2ffecc21b, 0x4bc35bff67abcaef,
+	0x7faa2522b237b2d4, 0x0bc2f82f2a70ba20, 0x044c75906959527e, 0x7024a89df11e5a8a,
+	0x1a506eefee0b82c3, 0x6e38b3e2764c8a37, 0x61b63e5d35656269, 0x15dee350ad226a9d,
+	0xb55eb2b80b4fd2fa, 0xc1366fb59308da0e, 0xceb8e20ad0213250, 0xbad03f0748663aa4,
+	0xd0a4f9755773e2ed, 0xa4cc2478cf34ea19, 0xab42a9c78c1d0247, 0xdf2a74ca145a0ab3,
+	0x8621abfa4e48e663, 0xf24976f7d60fee97, 0xfdc7fb48952606c9, 0x89af26450d610e3d,
+	0xe3dbe0371274d674, 0x97b33d3a8a33de80, 0x983db085c91a36de, 0xec556d88515d3e2a,
+	0x4cd53c60f730864d, 0x38bde16d6f778eb9, 0x37336cd22c5e66e7, 0x435bb1dfb4196e13,
+	0x292f77adab0cb65a, 0x5d47aaa0334bbeae, 0x52c9271f706256f0, 0x26a1fa12e8255e04,
+	0x12c884cf3db9263f, 0x66a059c2a5fe2ecb, 0x692ed47de6d7c695, 0x1d4609707e90ce61,
+	0x7732cf0261851628, 0x035a120ff9c21edc, 0x0cd49fb0baebf682, 0x78bc42bd22acfe76,
+	0xd83c135584c14611, 0xac54ce581c864ee5, 0xa3da43e75fafa6bb, 0xd7b29eeac7e8ae4f,
+	0xbdc65898d8fd7606, 0xc9ae859540ba7ef2, 0xc620082a039396ac, 0xb248d5279bd49e58,
+	0xaef2f490a8aa67da, 0xda9a299d30ed6f2e, 0xd514a42273c48770, 0xa17c792feb838f84,
+	0xcb08bf5df49657cd, 0xbf6062506cd15f39, 0xb0eeefef2ff8b767, 0xc48632e2b7bfbf93,
+	0x6406630a11d207f4, 0x106ebe0789950f00, 0x1fe033b8cabce75e, 0x6b88eeb552fbefaa,
+	0x01fc28c74dee37e3, 0x7594f5cad5a93f17, 0x7a1a78759680d749, 0x0e72a5780ec7dfbd,
+	0x3a1bdba5db5ba786, 0x4e7306a8431caf72, 0x41fd8b170035472c, 0x3595561a98724fd8,
+	0x5fe1906887679791, 0x2b894d651f209f65, 0x2407c0da5c09773b, 0x506f1dd7c44e7fcf,
+	0xf0ef4c3f6223c7a8, 0x84879132fa64cf5c, 0x8b091c8db94d2702, 0xff61c180210a2ff6,
+	0x951507f23e1ff7bf, 0xe17ddaffa658ff4b, 0xeef35740e5711715, 0x9a9b8a4d7d361fe1,
+	0x45b1fe87696c1552, 0x31d9238af12b1da6, 0x3e57ae35b202f5f8, 0x4a3f73382a45fd0c,
+	0x204bb54a35502545, 0x54236847ad172db1, 0x5bade5f8ee3ec5ef, 0x2fc538f57679cd1b,
+	0x8f45691dd014757c, 0xfb2db41048537d88, 0xf4a339af0b7a95d6, 0x80cbe4a2933d9d22,
+	0xeabf22d08c28456b, 0x9ed7ffdd146f4d9f, 0x915972625746a5c1, 0xe531af6fcf01ad35,
+	0xd158d1b21a9dd50e, 0xa5300cbf82daddfa, 0xaabe8100c1f335a4, 0xded65c0d59b43d50,
+	0xb4a29a7f46a1e519, 0xc0ca4772dee6eded, 0xcf44cacd9dcf05b3, 0xbb2c17c005880d47,
+	0x1bac4628a3e5b520, 0x6fc49b253ba2bdd4, 0x604a169a788b558a, 0x1422cb97e0cc5d7e,
+	0x7e560de5ffd98537, 0x0a3ed0e8679e8dc3, 0x05b05d5724b7659d, 0x71d8805abcf06d69,
+	0x6d62a1ed8f8e94eb, 0x190a7ce017c99c1f, 0x1684f15f54e07441, 0x62ec2c52cca77cb5,
+	0x0898ea20d3b2a4fc, 0x7cf0372d4bf5ac08, 0x737eba9208dc4456, 0x0716679f909b4ca2,
+	0xa796367736f6f4c5, 0xd3feeb7aaeb1fc31, 0xdc7066c5ed98146f, 0xa818bbc875df1c9b,
+	0xc26c7dba6acac4d2, 0xb604a0b7f28dcc26, 0xb98a2d08b1a42478, 0xcde2f00529e32c8c,
+	0xf98b8ed8fc7f54b7, 0x8de353d564385c43, 0x826dde6a2711b41d, 0xf6050367bf56bce9,
+	0x9c71c515a04364a0, 0xe819181838046c54, 0xe79795a77b2d840a, 0x93ff48aae36a8cfe,
+	0x337f194245073499, 0x4717c44fdd403c6d, 0x489949f09e69d433, 0x3cf194fd062edcc7,
+	0x5685528f193b048e, 0x22ed8f82817c0c7a, 0x2d63023dc255e424, 0x590bdf305a12ecd0,
+	0x0000000000000000, 0x0c4356f59d90ccc7, 0x8bb04643d0c069cd, 0x87f310b64d50a50a,
+	0x8557672f4b6023d8, 0x891431dad6f0ef1f, 0x0ee7216c9ba04a15, 0x02a47799063086d2,
+	0x999924f77d21b6f2, 0x95da7202e0b17a35, 0x122962b4ade1df3f, 0x1e6a3441307113f8,
+	0x1cce43d83641952a, 0x108d152dabd159ed, 0x977e059be681fce7, 0x9b3d536e7b113020,
+	0xa105a34710a39ca7, 0xad46f5b28d335060, 0x2ab5e504c063f56a, 0x26f6b3f15df339ad,
+	0x2452c4685bc3bf7f, 0x2811929dc65373b8, 0xafe2822b8b03d6b2, 0xa3a1d4de16931a75,
+	0x389c87b06d822a55, 0x34dfd145f012e692, 0xb32cc1f3bd424398, 0xbf6f970620d28f5f,
+	0xbdcbe09f26e2098d, 0xb188b66abb72c54a, 0x367ba6dcf6226040, 0x3a38f0296bb2ac87,
+	0xd13dac26cba7c90d, 0xdd7efad3563705ca, 0x5a8dea651b67a0c0, 0x56cebc9086f76c07,
+	0x546acb0980c7ead5, 0x58299dfc1d572612, 0xdfda8d4a50078318, 0xd399dbbfcd974fdf,
+	0x48a488d1b6867fff, 0x44e7de242b16b338, 0xc314ce9266461632, 0xcf579867fbd6daf5,
+	0xcdf3effefde65c27, 0xc1b0b90b607690e0, 0x4643a9bd2d2635ea, 0x4a00ff48b0b6f92d,
+	0x70380f61db0455aa, 0x7c7b59944694996d, 0xfb8849220bc43c67, 0xf7cb1fd79654f0a0,
+	0xf56f684e90647672, 0xf92c3ebb0df4bab5, 0x7edf2e0d40a41fbf, 0x729c78f8dd34d378,
+	0xe9a12b96a625e358, 0xe5e27d633bb52f9f, 0x62116dd576e58a95, 0x6e523b20eb754652,
+	0x6cf64cb9ed45c080, 0x60b51a4c70d50c47, 0xe7460afa3d85a94d, 0xeb055c0fa015658a,
+	0xa27b584d964f931b, 0xae380eb80bdf5fdc, 0x29cb1e0e468ffad6, 0x258848fbdb1f3611,
+	0x272c3f62dd2fb0c3, 0x2b6f699740bf7c04, 0xac9c79210defd90e, 0xa0df2fd4907f15c9,
+	0x3be27cbaeb6e25e9, 0x37a12a4f76fee92e, 0xb0523af93bae4c24, 0xbc116c0ca63e80e3,
+	0xbeb51b95a00e0631, 0xb2f64d603d9ecaf6, 0x35055dd670ce6ffc, 0x39460b23ed5ea33b,
+	0x037efb0a86ec0fbc, 0x0f3dadff1b7cc37b, 0x88cebd49562c6671, 0x848debbccbbcaab6,
+	0x86299c25cd8c2c64, 0x8a6acad0501ce0a3, 0x0d99da661d4c45a9, 0x01da8c9380dc896e,
+	0x9ae7dffdfbcdb94e, 0x96a48908665d7589, 0x115799be2b0dd083, 0x1d14cf4bb69d1c44,
+	0x1fb0b8d2b0ad9a96, 0x13f3ee272d3d5651, 0x9400fe91606df35b, 0x9843a864fdfd3f9c,
+	0x7346f46b5de85a16, 0x7f05a29ec07896d1, 0xf8f6b2288d2833db, 0xf4b5e4dd10b8ff1c,
+	0xf6119344168879ce, 0xfa52c5b18b18b509, 0x7da1d507c6481003, 0x71e283f25bd8dcc4,
+	0xeadfd09c20c9ece4, 0xe69c8669bd592023, 0x616f96dff0098529, 0x6d2cc02a6d9949ee,
+	0x6f88b7b36ba9cf3c, 0x63cbe146f63903fb, 0xe438f1f0bb69a6f1, 0xe87ba70526f96a36,
+	0xd243572c4d4bc6b1, 0xde0001d9d0db0a76, 0x59f3116f9d8baf7c, 0x55b0479a001b63bb,
+	0x57143003062be569, 0x5b5766f69bbb29ae, 0xdca47640d6eb8ca4, 0xd0e720b54b7b4063,
+	0x4bda73db306a7043, 0x4799252eadfabc84, 0xc06a3598e0aa198e, 0xcc29636d7d3ad549,
+	0xce8d14f47b0a539b, 0xc2ce4201e69a9f5c, 0x453d52b7abca3a56, 0x497e0442365af691,
+	0x44f7b09a2c9f2637, 0x48b4e66fb10feaf0, 0xcf47f6d9fc5f4ffa, 0xc304a02c61cf833d,
+	0xc1a0d7b567ff05ef, 0xcde38140fa6fc928, 0x4a1091f6b73f6c22, 0x4653c7032aafa0e5,
+	0xdd6e946d51be90c5, 0xd12dc298cc2e5c02, 0x56ded22e817ef908, 0x5a9d84db1cee35cf,
+	0x5839f3421adeb31d, 0x547aa5b7874e7fda, 0xd389b501ca1edad0, 0xdfcae3f4578e1617,
+	0xe5f213dd3c3cba90, 0xe9b14528a1ac7657, 0x6e42559eecfcd35d, 0x6201036b716c1f9a,
+	0x60a574f2775c9948, 0x6ce62207eacc558f, 0xeb1532b1a79cf085, 0xe75664443a0c3c42,
+	0x7c6b372a411d0c62, 0x702861dfdc8dc0a5, 0xf7db716991dd65af, 0xfb98279c0c4da968,
+	0xf93c50050a7d2fba, 0xf57f06f097ede37d, 0x728c1646dabd4677, 0x7ecf40b3472d8ab0,
+	0x95ca1cbce738ef3a, 0x99894a497aa823fd, 0x1e7a5aff37f886f7, 0x12390c0aaa684a30,
+	0x109d7b93ac58cce2, 0x1cde2d6631c80025, 0x9b2d3dd07c98a52f, 0x976e6b25e10869e8,
+	0x0c53384b9a1959c8, 0x00106ebe0789950f, 0x87e37e084ad93005, 0x8ba028fdd749fcc2,
+	0x89045f64d1797a10, 0x854709914ce9b6d7, 0x02b4192701b913dd, 0x0ef74fd29c29df1a,
+	0x34cfbffbf79b739d, 0x388ce90e6a0bbf5a, 0xbf7ff9b8275b1a50, 0xb33caf4dbacbd697,
+	0xb198d8d4bcfb5045, 0xbddb8e21216b9c82, 0x3a289e976c3b3988, 0x366bc862f1abf54f,
+	0xad569b0c8abac56f, 0xa115cdf9172a09a8, 0x26e6dd4f5a7aaca2, 0x2aa58bbac7ea6065,
+	0x2801fc23c1dae6b7, 0x2442aad65c4a2a70, 0xa3b1ba60111a8f7a, 0xaff2ec958c8a43bd,
+	0xe68ce8d7bad0b52c, 0xeacfbe22274079eb, 0x6d3cae946a10dce1, 0x617ff861f7801026,
+	0x63db8ff8f1b096f4, 0x6f98d90d6c205a33, 0xe86bc9bb2170ff39, 0xe4289f4ebce033fe,
+	0x7f15cc20c7f103de, 0x73569ad55a61cf19, 0xf4a58a6317316a13, 0xf8e6dc968aa1a6d4,
+	0xfa42ab0f8c912006, 0xf601fdfa1101ecc1, 0x71f2ed4c5c5149cb, 0x7db1bbb9c1c1850c,
+	0x47894b90aa73298b, 0x4bca1d6537e3e54c, 0xcc390dd37ab34046, 0xc07a5b26e7238c81,
+	0xc2de2cbfe1130a53, 0xce9d7a4a7c83c694, 0x496e6afc31d3639e, 0x452d3c09ac43af59,
+	0xde106f67d7529f79, 0xd25339924ac253be, 0x55a029240792f6b4, 0x59e37fd19a023a73,
+	0x5b4708489c32bca1, 0x57045ebd01a27066, 0xd0f74e0b4cf2d56c, 0xdcb418fed16219ab,
+	0x37b144f171777c21, 0x3bf21204ece7b0e6, 0xbc0102b2a1b715ec, 0xb04254473c27d92b,
+	0xb2e623de3a175ff9, 0xbea5752ba787933e, 0x3956659dead73634, 0x351533687747faf3,
+	0xae2860060c56cad3, 0xa26b36f391c60614, 0x25982645dc96a31e, 0x29db70b041066fd9,
+	0x2b7f07294736e90b, 0x273c51dcdaa625cc, 0xa0cf416a97f680c6, 0xac8c179f0a664c01,
+	0x96b4e7b661d4e086, 0x9af7b143fc442c41, 0x1d04a1f5b114894b, 0x1147f7002c84458c,
+	0x13e380992ab4c35e, 0x1fa0d66cb7240f99, 0x9853c6dafa74aa93, 0x9410902f67e46654,
+	0x0f2dc3411cf55674, 0x036e95b481659ab3, 0x849d8502cc353fb9, 0x88ded3f751a5f37e,
+	0x8a7aa46e579575ac, 0x8639f29bca05b96b, 0x01cae22d87551c61, 0x0d89b4d81ac5d0a6,
+	0x0000000000000000, 0x88ee6135593e4d6e, 0x10ddc36ab27c9adc, 0x9833a25feb42d7b2,
+	0xb38c6d7c8f18c4fb, 0x3b620c49d6268995, 0xa351ae163d645e27, 0x2bbfcf23645a1349,
+	0xf52f3151f5d078b5, 0x7dc15064acee35db, 0xe5f2f23b47ace269, 0x6d1c930e1e92af07,
+	0x46a35c2d7ac8bc4e, 0xce4d3d1823f6f120, 0x567e9f47c8b42692, 0xde90fe72918a6bfc,
+	0x7969880b01400128, 0xf187e93e587e4c46, 0x69b44b61b33c9bf4, 0xe15a2a54ea02d69a,
+	0xcae5e5778e58c5d3, 0x420b8442d76688bd, 0xda38261d3c245f0f, 0x52d64728651a1261,
+	0x8c46b95af490799d, 0x04a8d86fadae34f3, 0x9c9b7a3046ece341, 0x14751b051fd2ae2f,
+	0x3fcad4267b88bd66, 0xb724b51322b6f008, 0x2f17174cc9f427ba, 0xa7f9767990ca6ad4,
+	0xf2d2101702800250, 0x7a3c71225bbe4f3e, 0xe20fd37db0fc988c, 0x6ae1b248e9c2d5e2,
+	0x415e7d6b8d98c6ab, 0xc9b01c5ed4a68bc5, 0x5183be013fe45c77, 0xd96ddf3466da1119,
+	0x07fd2146f7507ae5, 0x8f134073ae6e378b, 0x1720e22c452ce039, 0x9fce83191c12ad57,
+	0xb4714c3a7848be1e, 0x3c9f2d0f2176f370, 0xa4ac8f50ca3424c2, 0x2c42ee65930a69ac,
+	0x8bbb981c03c00378, 0x0355f9295afe4e16, 0x9b665b76b1bc99a4, 0x13883a43e882d4ca,
+	0x3837f5608cd8c783, 0xb0d99455d5e68aed, 0x28ea360a3ea45d5f, 0xa004573f679a1031,
+	0x7e94a94df6107bcd, 0xf67ac878af2e36a3, 0x6e496a27446ce111, 0xe6a70b121d52ac7f,
+	0xcd18c4317908bf36, 0x45f6a5042036f258, 0xddc5075bcb7425ea, 0x552b666e924a6884,
+	0xe4a5212e040005a0, 0x6c4b401b5d3e48ce, 0xf478e244b67c9f7c, 0x7c968371ef42d212,
+	0x57294c528b18c15b, 0xdfc72d67d2268c35, 0x47f48f3839645b87, 0xcf1aee0d605a16e9,
+	0x118a107ff1d07d15, 0x9964714aa8ee307b, 0x0157d31543ace7c9, 0x89b9b2201a92aaa7,
+	0xa2067d037ec8b9ee, 0x2ae81c3627f6f480, 0xb2dbbe69ccb42332, 0x3a35df5c958a6e5c,
+	0x9dcca92505400488, 0x1522c8105c7e49e6, 0x8d116a4fb73c9e54, 0x05ff0b7aee02d33a,
+	0x2e40c4598a58c073, 0xa6aea56cd3668d1d, 0x3e9d073338245aaf, 0xb6736606611a17c1,
+	0x68e39874f0907c3d, 0xe00df941a9ae3153, 0x783e5b1e42ece6e1, 0xf0d03a2b1bd2ab8f,
+	0xdb6ff5087f88b8c6, 0x5381943d26b6f5a8, 0xcbb23662cdf4221a, 0x435c575794ca6f74,
+	0x16773139068007f0, 0x9e99500c5fbe4a9e, 0x06aaf253b4fc9d2c, 0x8e449366edc2d042,
+	0xa5fb5c458998c30b, 0x2d153d70d0a68e65, 0xb5269f2f3be459d7, 0x3dc8fe1a62da14b9,
+	0xe3580068f3507f45, 0x6bb6615daa6e322b, 0xf385c302412ce599, 0x7b6ba2371812a8f7,
+	0x50d46d147c48bbbe, 0xd83a0c212576f6d0, 0x4009ae7ece342162, 0xc8e7cf4b970a6c0c,
+	0x6f1eb93207c006d8, 0xe7f0d8075efe4bb6, 0x7fc37a58b5bc9c04, 0xf72d1b6dec82d16a,
+	0xdc92d44e88d8c223, 0x547cb57bd1e68f4d, 0xcc4f17243aa458ff, 0x44a17611639a1591,
+	0x9a318863f2107e6d, 0x12dfe956ab2e3303, 0x8aec4b09406ce4b1, 0x02022a3c1952a9df,
+	0x29bde51f7d08ba96, 0xa153842a2436f7f8, 0x39602675cf74204a, 0xb18e4740964a6d24,
+	0x5b7da9f5e3e1fa02, 0xd393c8c0badfb76c, 0x4ba06a9f519d60de, 0xc34e0baa08a32db0,
+	0xe8f1c4896cf93ef9, 0x601fa5bc35c77397, 0xf82c07e3de85a425, 0x70c266d687bbe94b,
+	0xae5298a4163182b7, 0x26bcf9914f0fcfd9, 0xbe8f5bcea44d186b, 0x36613afbfd735505,
+	0x1ddef5d89929464c, 0x953094edc0170b22, 0x0d0336b22b55dc90, 0x85ed5787726b91fe,
+	0x221421fee2a1fb2a, 0xaafa40cbbb9fb644, 0x32c9e29450dd61f6, 0xba2783a109e32c98,
+	0x91984c826db93fd1, 0x19762db7348772bf, 0x81458fe8dfc5a50d, 0x09abeedd86fbe863,
+	0xd73b10af1771839f, 0x5fd5719a4e4fcef1, 0xc7e6d3c5a50d1943, 0x4f08b2f0fc33542d,
+	0x64b77dd398694764, 0xec591ce6c1570a0a, 0x746abeb92a15ddb8, 0xfc84df8c732b90d6,
+	0xa9afb9e2e161f852, 0x2141d8d7b85fb53c, 0xb9727a88531d628e, 0x319c1bbd0a232fe0,
+	0x1a23d49e6e793ca9, 0x92cdb5ab374771c7, 0x0afe17f4dc05a675, 0x821076c1853beb1b,
+	0x5c8088b314b180e7, 0xd46ee9864d8fcd89, 0x4c5d4bd9a6cd1a3b, 0xc4b32aecfff35755,
+	0xef0ce5cf9ba9441c, 0x67e284fac2970972, 0xffd126a529d5dec0, 0x773f479070eb93ae,
+	0xd0c631e9e021f97a, 0x582850dcb91fb414, 0xc01bf283525d63a6, 0x48f593b60b632ec8,
+	0x634a5c956f393d81, 0xeba43da0360770ef, 0x73979fffdd45a75d, 0xfb79feca847bea33,
+	0x25e900b815f181cf, 0xad07618d4ccfcca1, 0x3534c3d2a78d1b13, 0xbddaa2e7feb3567d,
+	0x96656dc49ae94534, 0x1e8b0cf1c3d7085a, 0x86b8aeae2895dfe8, 0x0e56cf9b71ab9286,
+	0xbfd888dbe7e1ffa2, 0x3736e9eebedfb2cc, 0xaf054bb1559d657e, 0x27eb2a840ca32810,
+	0x0c54e5a768f93b59, 0x84ba849231c77637, 0x1c8926cdda85a185, 0x946747f883bbeceb,
+	0x4af7b98a12318717, 0xc219d8bf4b0fca79, 0x5a2a7ae0a04d1dcb, 0xd2c41bd5f97350a5,
+	0xf97bd4f69d2943ec, 0x7195b5c3c4170e82, 0xe9a6179c2f55d930, 0x614876a9766b945e,
+	0xc6b100d0e6a1fe8a, 0x4e5f61e5bf9fb3e4, 0xd66cc3ba54dd6456, 0x5e82a28f0de32938,
+	0x753d6dac69b93a71, 0xfdd30c993087771f, 0x65e0aec6dbc5a0ad, 0xed0ecff382fbedc3,
+	0x339e31811371863f, 0xbb7050b44a4fcb51, 0x2343f2eba10d1ce3, 0xabad93def833518d,
+	0x80125cfd9c6942c4, 0x08fc3dc8c5570faa, 0x90cf9f972e15d818, 0x1821fea2772b9576,
+	0x4d0a98cce561fdf2, 0xc5e4f9f9bc5fb09c, 0x5dd75ba6571d672e, 0xd5393a930e232a40,
+	0xfe86f5b06a793909, 0x7668948533477467, 0xee5b36dad805a3d5, 0x66b557ef813beebb,
+	0xb825a99d10b18547, 0x30cbc8a8498fc829, 0xa8f86af7a2cd1f9b, 0x20160bc2fbf352f5,
+	0x0ba9c4e19fa941bc, 0x8347a5d4c6970cd2, 0x1b74078b2dd5db60, 0x939a66be74eb960e,
+	0x346310c7e421fcda, 0xbc8d71f2bd1fb1b4, 0x24bed3ad565d6606, 0xac50b2980f632b68,
+	0x87ef7dbb6b393821, 0x0f011c8e3207754f, 0x9732bed1d945a2fd, 0x1fdcdfe4807bef93,
+	0xc14c219611f1846f, 0x49a240a348cfc901, 0xd191e2fca38d1eb3, 0x597f83c9fab353dd,
+	0x72c04cea9ee94094, 0xfa2e2ddfc7d70dfa, 0x621d8f802c95da48, 0xeaf3eeb575ab9726
+};
+
+const uint64_t crc_table_xz[256] CRC_TABLE_ALIGN PROGMEM = {
+	0x0000000000000000, 0xb32e4cbe03a75f6f, 0xf4843657a840a05b, 0x47aa7ae9abe7ff34,
+	0x7bd0c384ff8f5e33, 0xc8fe8f3afc28015c, 0x8f54f5d357cffe68, 0x3c7ab96d5468a107,
+	0xf7a18709ff1ebc66, 0x448fcbb7fcb9e309, 0x0325b15e575e1c3d, 0xb00bfde054f94352,
+	0x8c71448d0091e255, 0x3f5f08330336bd3a, 0x78f572daa8d1420e, 0xcbdb3e64ab761d61,
+	0x7d9ba13851336649, 0xceb5ed8652943926, 0x891f976ff973c612, 0x3a31dbd1fad4997d,
+	0x064b62bcaebc387a, 0xb5652e02ad1b6715, 0xf2cf54eb06fc9821, 0x41e11855055bc74e,
+	0x8a3a2631ae2dda2f, 0x39146a8fad8a8540, 0x7ebe1066066d7a74, 0xcd905cd805ca251b,
+	0xf1eae5b551a2841c, 0x42c4a90b5205db73, 0x056ed3e2f9e22447, 0xb6409f5cfa457b28,
+	0xfb374270a266cc92, 0x48190ecea1c193fd, 0x0fb374270a266cc9, 0xbc9d3899098133a6,
+	0x80e781f45de992a1, 0x33c9cd4a5e4ecdce, 0x7463b7a3f5a932fa, 0xc74dfb1df60e6d95,
+	0x0c96c5795d7870f4, 0xbfb889c75edf2f9b, 0xf812f32ef538d0af, 0x4b3cbf90f69f8fc0,
+	0x774606fda2f72ec7, 0xc4684a43a15071a8, 0x83c230aa0ab78e9c, 0x30ec7c140910d1f3,
+	0x86ace348f355aadb, 0x3582aff6f0f2f5b4, 0x7228d51f5b150a80, 0xc10699a158b255ef,
+	0xfd7c20cc0cdaf4e8, 0x4e526c720f7dab87, 0x09f8169ba49a54b3, 0xbad65a25a73d0bdc,
+	0x710d64410c4b16bd, 0xc22328ff0fec49d2, 0x85895216a40bb6e6, 0x36a71ea8a7ace989,
+	0x0adda7c5f3c4488e, 0xb9f3eb7bf06317e1, 0xfe5991925b84e8d5, 0x4d77dd2c5823b7ba,
+	0x64b62bcaebc387a1, 0xd7986774e864d8ce, 0x90321d9d438327fa, 0x231c512340247895,
+	0x1f66e84e144cd992, 0xac48a4f017eb86fd, 0xebe2de19bc0c79c9, 0x58cc92a7bfab26a6,
+	0x9317acc314dd3bc7, 0x2039e07d177a64a8, 0x67939a94bc9d9b9c, 0xd4bdd62abf3ac4f3,
+	0xe8c76f47eb5265f4, 0x5be923f9e8f53a9b, 0x1c4359104312c5af, 0xaf6d15ae40b59ac0,
+	0x192d8af2baf0e1e8, 0xaa03c64cb957be87, 0xeda9bca512b041b3, 0x5e87f01b11171edc,
+	0x62fd4976457fbfdb, 0xd1d305c846d8e0b4, 0x96797f21ed3f1f80, 0x2557339fee9840ef,
+	0xee8c0dfb45ee5d8e, 0x5da24145464902e1, 0x1a083bacedaefdd5, 0xa9267712ee09a2ba,
+	0x955cce7fba6103bd, 0x267282c1b9c65cd2, 0x61d8f8281221a3e6, 0xd2f6b4961186fc89,
+	0x9f8169ba49a54b33, 0x2caf25044a02145c, 0x6b055fede1e5eb68, 0xd82b1353e242b407,
+	0xe451aa3eb62a1500, 0x577fe680b58d4a6f, 0x10d59c691e6ab55b, 0xa3fbd0d71dcdea34,
+	0x6820eeb3b6bbf755, 0xdb0ea20db51ca83a, 0x9ca4d8e41efb570e, 0x2f8a945a1d5c0861,
+	0x13f02d374934a966, 0xa0de61894a93f609, 0xe7741b60e174093d, 0x545a57dee2d35652,
+	0xe21ac88218962d7a, 0x5134843c1b317215, 0x169efed5b0d68d21, 0xa5b0b26bb371d24e,
+	0x99ca0b06e7197349, 0x2ae447b8e4be2c26, 0x6d4e3d514f59d312, 0xde6071ef4cfe8c7d,
+	0x15bb4f8be788911c, 0xa6950335e42fce73, 0xe13f79dc4fc83147, 0x521135624c6f6e28,
+	0x6e6b8c0f1807cf2f, 0xdd45c0b11ba09040, 0x9aefba58b0476f74, 0x29c1f6e6b3e0301b,
+	0xc96c5795d7870f42, 0x7a421b2bd420502d, 0x3de861c27fc7af19, 0x8ec62d7c7c60f076,
+	0xb2bc941128085171, 0x0192d8af2baf0e1e, 0x4638a2468048f12a, 0xf516eef883efae45,
+	0x3ecdd09c2899b324, 0x8de39c222b3eec4b, 0xca49e6cb80d9137f, 0x7967aa75837e4c10,
+	0x451d1318d716ed17, 0xf6335fa6d4b1b278, 0xb199254f7f564d4c, 0x02b769f17cf11223,
+	0xb4f7f6ad86b4690b, 0x07d9ba1385133664, 0x4073c0fa2ef4c950, 0xf35d8c442d53963f,
+	0xcf273529793b3738, 0x7c0979977a9c6857, 0x3ba3037ed17b9763, 0x888d4fc0d2dcc80c,
+	0x435671a479aad56d, 0xf0783d1a7a0d8a02, 0xb7d247f3d1ea7536, 0x04fc0b4dd24d2a59,
+	0x3886b22086258b5e, 0x8ba8fe9e8582d431, 0xcc0284772e652b05, 0x7f2cc8c92dc2746a,
+	0x325b15e575e1c3d0, 0x8175595b76469cbf, 0xc6df23b2dda1638b, 0x75f16f0cde063ce4,
+	0x498bd6618a6e9de3, 0xfaa59adf89c9c28c, 0xbd0fe036222e3db8, 0x0e21ac88218962d7,
+	0xc5fa92ec8aff7fb6, 0x76d4de52895820d9, 0x317ea4bb22bfdfed, 0x8250e80521188082,
+	0xbe2a516875702185, 0x0d041dd676d77eea, 0x4aae673fdd3081de, 0xf9802b81de97deb1,
+	0x4fc0b4dd24d2a599, 0xfceef8632775faf6, 0xbb44828a8c9205c2, 0x086ace348f355aad,
+	0x34107759db5dfbaa, 0x873e3be7d8faa4c5, 0xc094410e731d5bf1, 0x73ba0db070ba049e,
+	0xb86133d4dbcc19ff, 0x0b4f7f6ad86b4690, 0x4ce50583738cb9a4, 0xffcb493d702be6cb,
+	0xc3b1f050244347cc, 0x709fbcee27e418a3, 0x3735c6078c03e797, 0x841b8ab98fa4b8f8,
+	0xadda7c5f3c4488e3, 0x1ef430e13fe3d78c, 0x595e4a08940428b8, 0xea7006b697a377d7,
+	0xd60abfdbc3cbd6d0, 0x6524f365c06c89bf, 0x228e898c6b8b768b, 0x91a0c532682c29e4,
+	0x5a7bfb56c35a3485, 0xe955b7e8c0fd6bea, 0xaeffcd016b1a94de, 0x1dd181bf68bdcbb1,
+	0x21ab38d23cd56ab6, 0x9285746c3f7235d9, 0xd52f0e859495caed, 0x6601423b97329582,
+	0xd041dd676d77eeaa, 0x636f91d96ed0b1c5, 0x24c5eb30c5374ef1, 0x97eba78ec690119e,
+	0xab911ee392f8b099, 0x18bf525d915feff6, 0x5f1528b43ab810c2, 0xec3b640a391f4fad,
+	0x27e05a6e926952cc, 0x94ce16d091ce0da3, 0xd3646c393a29f297, 0x604a2087398eadf8,
+	0x5c3099ea6de60cff, 0xef1ed5546e415390, 0xa8b4afbdc5a6aca4, 0x1b9ae303c601f3cb,
+	0x56ed3e2f9e224471, 0xe5c372919d851b1e, 0xa26908783662e42a, 0x114744c635c5bb45,
+	0x2d3dfdab61ad1a42, 0x9e13b115620a452d, 0xd9b9cbfcc9edba19, 0x6a978742ca4ae576,
+	0xa14cb926613cf817, 0x1262f598629ba778, 0x55c88f71c97c584c, 0xe6e6c3cfcadb0723,
+	0xda9c7aa29eb3a624, 0x69b2361c9d14f94b, 0x2e184cf536f3067f, 0x9d36004b35545910,
+	0x2b769f17cf112238, 0x9858d3a9ccb67d57, 0xdff2a94067518263, 0x6cdce5fe64f6dd0c,
+	0x50a65c93309e7c0b, 0xe388102d33392364, 0xa4226ac498dedc50, 0x170c267a9b79833f,
+	0xdcd7181e300f9e5e, 0x6ff954a033a8c131, 0x28532e49984f3e05, 0x9b7d62f79be8616a,
+	0xa707db9acf80c06d, 0x14299724cc279f02, 0x5383edcd67c06036, 0xe0ada17364673f59
+};
+
+const uint64_t crc_table_xz_big[2048] CRC_TABLE_ALIGN PROGMEM = {
+	0x0000000000000000, 0xb32e4cbe03a75f6f, 0xf4843657a840a05b, 0x47aa7ae9abe7ff34,
+	0x7bd0c384ff8f5e33, 0xc8fe8f3afc28015c, 0x8f54f5d357cffe68, 0x3c7ab96d5468a107,
+	0xf7a18709ff1ebc66, 0x448fcbb7fcb9e309, 0x0325b15e575e1c3d, 0xb00bfde054f94352,
+	0x8c71448d0091e255, 0x3f5f08330336bd3a, 0x78f572daa8d1420e, 0xcbdb3e64ab761d61,
+	0x7d9ba13851336649, 0xceb5ed8652943926, 0x891f976ff973c612, 0x3a31dbd1fad4997d,
+	0x064b62bcaebc387a, 0xb5652e02ad1b6715, 0xf2cf54eb06fc9821, 0x41e11855055bc74e,
+	0x8a3a2631ae2dda2f, 0x39146a8fad8a8540, 0x7ebe1066066d7a74, 0xcd905cd805ca251b,
+	0xf1eae5b551a2841c, 0x42c4a90b5205db73, 0x056ed3e2f9e22447, 0xb6409f5cfa457b28,
+	0xfb374270a266cc92, 0x48190ecea1c193fd, 0x0fb374270a266cc9, 0xbc9d3899098133a6,
+	0x80e781f45de992a1, 0x33c9cd4a5e4ecdce, 0x7463b7a3f5a932fa, 0xc74dfb1df60e6d95,
+	0x0c96c5795d7870f4, 0xbfb889c75edf2f9b, 0xf812f32ef538d0af, 0x4b3cbf90f69f8fc0,
+	0x774606fda2f72ec7, 0xc4684a43a15071a8, 0x83c230aa0ab78e9c, 0x30ec7c140910d1f3,
+	0x86ace348f355aadb, 0x3582aff6f0f2f5b4, 0x7228d51f5b150a80, 0xc10699a158b255ef,
+	0xfd7c20cc0cdaf4e8, 0x4e526c720f7dab87, 0x09f8169ba49a54b3, 0xbad65a25a73d0bdc,
+	0x710d64410c4b16bd, 0xc22328ff0fec49d2, 0x85895216a40bb6e6, 0x36a71ea8a7ace989,
+	0x0adda7c5f3c4488e, 0xb9f3eb7bf06317e1, 0xfe5991925b84e8d5, 0x4d77dd2c5823b7ba,
+	0x64b62bcaebc387a1, 0xd7986774e864d8ce, 0x90321d9d438327fa, 0x231c512340247895,
+	0x1f66e84e144cd992, 0xac48a4f017eb86fd, 0xebe2de19bc0c79c9, 0x58cc92a7bfab26a6,
+	0x9317acc314dd3bc7, 0x2039e07d177a64a8, 0x67939a94bc9d9b9c, 0xd4bdd62abf3ac4f3,
+	0xe8c76f47eb5265f4, 0x5be923f9e8f53a9b, 0x1c4359104312c5af, 0xaf6d15ae40b59ac0,
+	0x192d8af2baf0e1e8, 0xaa03c64cb957be87, 0xeda9bca512b041b3, 0x5e87f01b11171edc,
+	0x62fd4976457fbfdb, 0xd1d305c846d8e0b4, 0x96797f21ed3f1f80, 0x2557339fee9840ef,
+	0xee8c0dfb45ee5d8e, 0x5da24145464902e1, 0x1a083bacedaefdd5, 0xa9267712ee09a2ba,
+	0x955cce7fba6103bd, 0x267282c1b9c65cd2, 0x61d8f8281221a3e6, 0xd2f6b4961186fc89,
+	0x9f8169ba49a54b33, 0x2caf25044a02145c, 0x6b055fede1e5eb68, 0xd82b1353e242b407,
+	0xe451aa3eb62a1500, 0x577fe680b58d4a6f, 0x10d59c691e6ab55b, 0xa3fbd0d71dcdea34,
+	0x6820eeb3b6bbf755, 0xdb0ea20db51ca83a, 0x9ca4d8e41efb570e, 0x2f8a945a1d5c0861,
+	0x13f02d374934a966, 0xa0de61894a93f609, 0xe7741b60e174093d, 0x545a57dee2d35652,
+	0xe21ac88218962d7a, 0x5134843c1b317215, 0x169efed5b0d68d21, 0xa5b0b26bb371d24e,
+	0x99ca0b06e7197349, 0x2ae447b8e4be2c26, 0x6d4e3d514f59d312, 0xde6071ef4cfe8c7d,
+	0x15bb4f8be788911c, 0xa6950335e42fce73, 0xe13f79dc4fc83147, 0x521135624c6f6e28,
+	0x6e6b8c0f1807cf2f, 0xdd45c0b11ba09040, 0x9aefba58b0476f74, 0x29c1f6e6b3e0301b,
+	0xc96c5795d7870f42, 0x7a421b2bd420502d, 0x3de861c27fc7af19, 0x8ec62d7c7c60f076,
+	0xb2bc941128085171, 0x0192d8af2baf0e1e, 0x4638a2468048f12a, 0xf516eef883efae45,
+	0x3ecdd09c2899b324, 0x8de39c222b3eec4b, 0xca49e6cb80d9137f, 0x7967aa75837e4c10,
+	0x451d1318d716ed17, 0xf6335fa6d4b1b278, 0xb199254f7f564d4c, 0x02b769f17cf11223,
+	0xb4f7f6ad86b4690b, 0x07d9ba1385133664, 0x4073c0fa2ef4c950, 0xf35d8c442d53963f,
+	0xcf273529793b3738, 0x7c0979977a9c6857, 0x3ba3037ed17b9763, 0x888d4fc0d2dcc80c,
+	0x435671a479aad56d, 0xf0783d1a7a0d8a02, 0xb7d247f3d1ea7536, 0x04fc0b4dd24d2a59,
+	0x3886b22086258b5e, 0x8ba8fe9e8582d431, 0xcc0284772e652b05, 0x7f2cc8c92dc2746a,
+	0x325b15e575e1c3d0, 0x8175595b76469cbf, 0xc6df23b2dda1638b, 0x75f16f0cde063ce4,
+	0x498bd6618a6e9de3, 0xfaa59adf89c9c28c, 0xbd0fe036222e3db8, 0x0e21ac88218962d7,
+	0xc5fa92ec8aff7fb6, 0x76d4de52895820d9, 0x317ea4bb22bfdfed, 0x8250e80521188082,
+	0xbe2a516875702185, 0x0d041dd676d77eea, 0x4aae673fdd3081de, 0xf9802b81de97deb1,
+	0x4fc0b4dd24d2a599, 0xfceef8632775faf6, 0xbb44828a8c9205c2, 0x086ace348f355aad,
+	0x34107759db5dfbaa, 0x873e3be7d8faa4c5, 0xc094410e731d5bf1, 0x73ba0db070ba049e,
+	0xb86133d4dbcc19ff, 0x0b4f7f6ad86b4690, 0x4ce50583738cb9a4, 0xffcb493d702be6cb,
+	0xc3b1f050244347cc, 0x709fbcee27e418a3, 0x3735c6078c03e797, 0x841b8ab98fa4b8f8,
+	0xadda7c5f3c4488e3, 0x1ef430e13fe3d78c, 0x595e4a08940428b8, 0xea7006b697a377d7,
+	0xd60abfdbc3cbd6d0, 0x6524f365c06c89bf, 0x228e898c6b8b768b, 0x91a0c532682c29e4,
+	0x5a7bfb56c35a3485, 0xe955b7e8c0fd6bea, 0xaeffcd016b1a94de, 0x1dd181bf68bdcbb1,
+	0x21ab38d23cd56ab6, 0x9285746c3f7235d9, 0xd52f0e859495caed, 0x6601423b97329582,
+	0xd041dd676d77eeaa, 0x636f91d96ed0b1c5, 0x24c5eb30c5374ef1, 0x97eba78ec690119e,
+	0xab911ee392f8b099, 0x18bf525d915feff6, 0x5f1528b43ab810c2, 0xec3b640a391f4fad,
+	0x27e05a6e926952cc, 0x94ce16d091ce0da3, 0xd3646c393a29f297, 0x604a2087398eadf8,
+	0x5c3099ea6de60cff, 0xef1ed5546e415390, 0xa8b4afbdc5a6aca4, 0x1b9ae303c601f3cb,
+	0x56ed3e2f9e224471, 0xe5c372919d851b1e, 0xa26908783662e42a, 0x114744c635c5bb45,
+	0x2d3dfdab61ad1a42, 0x9e13b115620a452d, 0xd9b9cbfcc9edba19, 0x6a978742ca4ae576,
+	0xa14cb926613cf817, 0x1262f598629ba778, 0x55c88f71c97c584c, 0xe6e6c3cfcadb0723,
+	0xda9c7aa29eb3a624, 0x69b2361c9d14f94b, 0x2e184cf536f3067f, 0x9d36004b35545910,
+	0x2b769f17cf112238, 0x9858d3a9ccb67d57, 0xdff2a94067518263, 0x6cdce5fe64f6dd0c,
+	0x50a65c93309e7c0b, 0xe388102d33392364, 0xa4226ac498dedc50, 0x170c267a9b79833f,
+	0xdcd7181e300f9e5e, 0x6ff954a033a8c131, 0x28532e49984f3e05, 0x9b7d62f79be8616a,
+	0xa707db9acf80c06d, 0x14299724cc279f02, 0x5383edcd67c06036, 0xe0ada17364673f59,
+	0x0000000000000000, 0x54e979925cd0f10d, 0xa9d2f324b9a1e21a, 0xfd3b8ab6e5711317,
+	0xc17d4962dc4ddab1, 0x959430f0809d2bbc, 0x68afba4665ec38ab, 0x3c46c3d4393cc9a6,
+	0x10223dee1795abe7, 0x44cb447c4b455aea, 0xb9f0cecaae3449fd, 0xed19b758f2e4b8f0,
+	0xd15f748ccbd87156, 0x85b60d1e9708805b, 0x788d87a87279934c, 0x2c64fe3a2ea96241,
+	0x20447bdc2f2b57ce, 0x74ad024e73fba6c3, 0x899688f8968ab5d4, 0xdd7ff16aca5a44d9,
+	0xe13932bef3668d7f, 0xb5d04b2cafb67c72, 0x48ebc19a4ac76f65, 0x1c02b80816179e68,
+	0x3066463238befc29, 0x648f3fa0646e0d24, 0x99b4b516811f1e33, 0xcd5dcc84ddcfef3e,
+	0xf11b0f50e4f32698, 0xa5f276c2b823d795, 0x58c9fc745d52c482, 0x0c2085e60182358f,
+	0x4088f7b85e56af9c, 0x14618e2a02865e91, 0xe95a049ce7f74d86, 0xbdb37d0ebb27bc8b,
+	0x81f5beda821b752d, 0xd51cc748decb8420, 0x28274dfe3bba9737, 0x7cce346c676a663a,
+	0x50aaca5649c3047b, 0x0443b3c41513f576, 0xf9783972f062e661, 0xad9140e0acb2176c,
+	0x91d78334958edeca, 0xc53efaa6c95e2fc7, 0x380570102c2f3cd0, 0x6cec098270ffcddd,
+	0x60cc8c64717df852, 0x3425f5f62dad095f, 0xc91e7f40c8dc1a48, 0x9df706d2940ceb45,
+	0xa1b1c506ad3022e3, 0xf558bc94f1e0d3ee, 0x086336221491c0f9, 0x5c8a4fb0484131f4,
+	0x70eeb18a66e853b5, 0x2407c8183a38a2b8, 0xd93c42aedf49b1af, 0x8dd53b3c839940a2,
+	0xb193f8e8baa58904, 0xe57a817ae6757809, 0x18410bcc03046b1e, 0x4ca8725e5fd49a13,
+	0x8111ef70bcad5f38, 0xd5f896e2e07dae35, 0x28c31c54050cbd22, 0x7c2a65c659dc4c2f,
+	0x406ca61260e08589, 0x1485df803c307484, 0xe9be5536d9416793, 0xbd572ca48591969e,
+	0x9133d29eab38f4df, 0xc5daab0cf7e805d2, 0x38e121ba129916c5, 0x6c0858284e49e7c8,
+	0x504e9bfc77752e6e, 0x04a7e26e2ba5df63, 0xf99c68d8ced4cc74, 0xad75114a92043d79,
+	0xa15594ac938608f6, 0xf5bced3ecf56f9fb, 0x088767882a27eaec, 0x5c6e1e1a76f71be1,
+	0x6028ddce4fcbd247, 0x34c1a45c131b234a, 0xc9fa2eeaf66a305d, 0x9d135778aabac150,
+	0xb177a9428413a311, 0xe59ed0d0d8c3521c, 0x18a55a663db2410b, 0x4c4c23f46162b006,
+	0x700ae020585e79a0, 0x24e399b2048e88ad, 0xd9d81304e1ff9bba, 0x8d316a96bd2f6ab7,
+	0xc19918c8e2fbf0a4, 0x9570615abe2b01a9, 0x684bebec5b5a12be, 0x3ca2927e078ae3b3,
+	0x00e451aa3eb62a15, 0x540d28386266db18, 0xa936a28e8717c80f, 0xfddfdb1cdbc73902,
+	0xd1bb2526f56e5b43, 0x85525cb4a9beaa4e, 0x7869d6024ccfb959, 0x2c80af90101f4854,
+	0x10c66c44292381f2, 0x442f15d675f370ff, 0xb9149f60908263e8, 0xedfde6f2cc5292e5,
+	0xe1dd6314cdd0a76a, 0xb5341a8691005667, 0x480f903074714570, 0x1ce6e9a228a1b47d,
+	0x20a02a76119d7ddb, 0x744953e44d4d8cd6, 0x8972d952a83c9fc1, 0xdd9ba0c0f4ec6ecc,
+	0xf1ff5efada450c8d, 0xa51627688695fd80, 0x582dadde63e4ee97, 0x0cc4d44c3f341f9a,
+	0x308217980608d63c, 0x646b6e0a5ad82731, 0x9950e4bcbfa93426, 0xcdb99d2ee379c52b,
+	0x90fb71cad654a0f5, 0xc41208588a8451f8, 0x392982ee6ff542ef, 0x6dc0fb7c3325b3e2,
+	0x518638a80a197a44, 0x056f413a56c98b49, 0xf854cb8cb3b8985e, 0xacbdb21eef686953,
+	0x80d94c24c1c10b12, 0xd43035b69d11fa1f, 0x290bbf007860e908, 0x7de2c69224b01805,
+	0x41a405461d8cd1a3, 0x154d7cd4415c20ae, 0xe876f662a42d33b9, 0xbc9f8ff0f8fdc2b4,
+	0xb0bf0a16f97ff73b, 0xe4567384a5af0636, 0x196df93240de1521, 0x4d8480a01c0ee42c,
+	0x71c2437425322d8a, 0x252b3ae679e2dc87, 0xd810b0509c93cf90, 0x8cf9c9c2c0433e9d,
+	0xa09d37f8eeea5cdc, 0xf4744e6ab23aadd1, 0x094fc4dc574bbec6, 0x5da6bd4e0b9b4fcb,
+	0x61e07e9a32a7866d, 0x350907086e777760, 0xc8328dbe8b066477, 0x9cdbf42cd7d6957a,
+	0xd073867288020f69, 0x849affe0d4d2fe64, 0x79a1755631a3ed73, 0x2d480cc46d731c7e,
+	0x110ecf10544fd5d8, 0x45e7b682089f24d5, 0xb8dc3c34edee37c2, 0xec3545a6b13ec6cf,
+	0xc051bb9c9f97a48e, 0x94b8c20ec3475583, 0x698348b826364694, 0x3d6a312a7ae6b799,
+	0x012cf2fe43da7e3f, 0x55c58b6c1f0a8f32, 0xa8fe01dafa7b9c25, 0xfc177848a6ab6d28,
+	0xf037fdaea72958a7, 0xa4de843cfbf9a9aa, 0x59e50e8a1e88babd, 0x0d0c771842584bb0,
+	0x314ab4cc7b648216, 0x65a3cd5e27b4731b, 0x989847e8c2c5600c, 0xcc713e7a9e159101,
+	0xe015c040b0bcf340, 0xb4fcb9d2ec6c024d, 0x49c73364091d115a, 0x1d2e4af655cde057,
+	0x216889226cf129f1, 0x7581f0b03021d8fc, 0x88ba7a06d550cbeb, 0xdc53039489803ae6,
+	0x11ea9eba6af9ffcd, 0x4503e72836290ec0, 0xb8386d9ed3581dd7, 0xecd1140c8f88ecda,
+	0xd097d7d8b6b4257c, 0x847eae4aea64d471, 0x794524fc0f15c766, 0x2dac5d6e53c5366b,
+	0x01c8a3547d6c542a, 0x5521dac621bca527, 0xa81a5070c4cdb630, 0xfcf329e2981d473d,
+	0xc0b5ea36a1218e9b, 0x945c93a4fdf17f96, 0x6967191218806c81, 0x3d8e608044509d8c,
+	0x31aee56645d2a803, 0x65479cf41902590e, 0x987c1642fc734a19, 0xcc956fd0a0a3bb14,
+	0xf0d3ac04999f72b2, 0xa43ad596c54f83bf, 0x59015f20203e90a8, 0x0de826b27cee61a5,
+	0x218cd888524703e4, 0x7565a11a0e97f2e9, 0x885e2bacebe6e1fe, 0xdcb7523eb73610f3,
+	0xe0f191ea8e0ad955, 0xb418e878d2da2858, 0x492362ce37ab3b4f, 0x1dca1b5c6b7bca42,
+	0x5162690234af5051, 0x058b1090687fa15c, 0xf8b09a268d0eb24b, 0xac59e3b4d1de4346,
+	0x901f2060e8e28ae0, 0xc4f659f2b4327bed, 0x39cdd344514368fa, 0x6d24aad60d9399f7,
+	0x414054ec233afbb6, 0x15a92d7e7fea0abb, 0xe892a7c89a9b19ac, 0xbc7bde5ac64be8a1,
+	0x803d1d8eff772107, 0xd4d4641ca3a7d00a, 0x29efeeaa46d6c31d, 0x7d0697381a063210,
+	0x712612de1b84079f, 0x25cf6b4c4754f692, 0xd8f4e1faa225e585, 0x8c1d9868fef51488,
+	0xb05b5bbcc7c9dd2e, 0xe4b2222e9b192c23, 0x1989a8987e683f34, 0x4d60d10a22b8ce39,
+	0x61042f300c11ac78, 0x35ed56a250c15d75, 0xc8d6dc14b5b04e62, 0x9c3fa586e960bf6f,
+	0xa0796652d05c76c9, 0xf4901fc08c8c87c4, 0x09ab957669fd94d3, 0x5d42ece4352d65de,
+	0x0000000000000000, 0x3f0be14a916a6dcb, 0x7e17c29522d4db96, 0x411c23dfb3beb65d,
+	0xfc2f852a45a9b72c, 0xc3246460d4c3dae7, 0x823847bf677d6cba, 0xbd33a6f5f6170171,
+	0x6a87a57f245d70dd, 0x558c4435b5371d16, 0x149067ea0689ab4b, 0x2b9b86a097e3c680,
+	0x96a8205561f4c7f1, 0xa9a3c11ff09eaa3a, 0xe8bfe2c043201c67, 0xd7b4038ad24a71ac,
+	0xd50f4afe48bae1ba, 0xea04abb4d9d08c71, 0xab18886b6a6e3a2c, 0x94136921fb0457e7,
+	0x2920cfd40d135696, 0x162b2e9e9c793b5d, 0x57370d412fc78d00, 0x683cec0bbeade0cb,
+	0xbf88ef816ce79167, 0x80830ecbfd8dfcac, 0xc19f2d144e334af1, 0xfe94cc5edf59273a,
+	0x43a76aab294e264b, 0x7cac8be1b8244b80, 0x3db0a83e0b9afddd, 0x02bb49749af09016,
+	0x38c63ad73e7bddf1, 0x07cddb9daf11b03a, 0x46d1f8421caf0667, 0x79da19088dc56bac,
+	0xc4e9bffd7bd26add, 0xfbe25eb7eab80716, 0xbafe7d685906b14b, 0x85f59c22c86cdc80,
+	0x52419fa81a26ad2c, 0x6d4a7ee28b4cc0e7, 0x2c565d3d38f276ba, 0x135dbc77a9981b71,
+	0xae6e1a825f8f1a00, 0x9165fbc8cee577cb, 0xd079d8177d5bc196, 0xef72395dec31ac5d,
+	0xedc9702976c13c4b, 0xd2c29163e7ab5180, 0x93deb2bc5415e7dd, 0xacd553f6c57f8a16,
+	0x11e6f50333688b67, 0x2eed1449a202e6ac, 0x6ff1379611bc50f1, 0x50fad6dc80d63d3a,
+	0x874ed556529c4c96, 0xb845341cc3f6215d, 0xf95917c370489700, 0xc652f689e122facb,
+	0x7b61507c1735fbba, 0x446ab136865f9671, 0x057692e935e1202c, 0x3a7d73a3a48b4de7,
+	0x718c75ae7cf7bbe2, 0x4e8794e4ed9dd629, 0x0f9bb73b5e236074, 0x30905671cf490dbf,
+	0x8da3f084395e0cce, 0xb2a811cea8346105, 0xf3b432111b8ad758, 0xccbfd35b8ae0ba93,
+	0x1b0bd0d158aacb3f, 0x2400319bc9c0a6f4, 0x651c12447a7e10a9, 0x5a17f30eeb147d62,
+	0xe72455fb1d037c13, 0xd82fb4b18c6911d8, 0x9933976e3fd7a785, 0xa6387624aebdca4e,
+	0xa4833f50344d5a58, 0x9b88de1aa5273793, 0xda94fdc5169981ce, 0xe59f1c8f87f3ec05,
+	0x58acba7a71e4ed74, 0x67a75b30e08e80bf, 0x26bb78ef533036e2, 0x19b099a5c25a5b29,
+	0xce049a2f10102a85, 0xf10f7b65817a474e, 0xb01358ba32c4f113, 0x8f18b9f0a3ae9cd8,
+	0x322b1f0555b99da9, 0x0d20fe4fc4d3f062, 0x4c3cdd90776d463f, 0x73373cdae6072bf4,
+	0x494a4f79428c6613, 0x7641ae33d3e60bd8, 0x375d8dec6058bd85, 0x08566ca6f132d04e,
+	0xb565ca530725d13f, 0x8a6e2b19964fbcf4, 0xcb7208c625f10aa9, 0xf479e98cb49b6762,
+	0x23cdea0666d116ce, 0x1cc60b4cf7bb7b05, 0x5dda28934405cd58, 0x62d1c9d9d56fa093,
+	0xdfe26f2c2378a1e2, 0xe0e98e66b212cc29, 0xa1f5adb901ac7a74, 0x9efe4cf390c617bf,
+	0x9c4505870a3687a9, 0xa34ee4cd9b5cea62, 0xe252c71228e25c3f, 0xdd592658b98831f4,
+	0x606a80ad4f9f3085, 0x5f6161e7def55d4e, 0x1e7d42386d4beb13, 0x2176a372fc2186d8,
+	0xf6c2a0f82e6bf774, 0xc9c941b2bf019abf, 0x88d5626d0cbf2ce2, 0xb7de83279dd54129,
+	0x0aed25d26bc24058, 0x35e6c498faa82d93, 0x74fae74749169bce, 0x4bf1060dd87cf605,
+	0xe318eb5cf9ef77c4, 0xdc130a1668851a0f, 0x9d0f29c9db3bac52, 0xa204c8834a51c199,
+	0x1f376e76bc46c0e8, 0x203c8f3c2d2cad23, 0x6120ace39e921b7e, 0x5e2b4da90ff876b5,
+	0x899f4e23ddb20719, 0xb694af694cd86ad2, 0xf7888cb6ff66dc8f, 0xc8836dfc6e0cb144,
+	0x75b0cb09981bb035, 0x4abb2a430971ddfe, 0x0ba7099cbacf6ba3, 0x34ace8d62ba50668,
+	0x3617a1a2b155967e, 0x091c40e8203ffbb5, 0x4800633793814de8, 0x770b827d02eb2023,
+	0xca382488f4fc2152, 0xf533c5c265964c99, 0xb42fe61dd628fac4, 0x8b2407574742970f,
+	0x5c9004dd9508e6a3, 0x639be59704628b68, 0x2287c648b7dc3d35, 0x1d8c270226b650fe,
+	0xa0bf81f7d0a1518f, 0x9fb460bd41cb3c44, 0xdea84362f2758a19, 0xe1a3a228631fe7d2,
+	0xdbded18bc794aa35, 0xe4d530c156fec7fe, 0xa5c9131ee54071a3, 0x9ac2f254742a1c68,
+	0x27f154a1823d1d19, 0x18fab5eb135770d2, 0x59e69634a0e9c68f, 0x66ed777e3183ab44,
+	0xb15974f4e3c9dae8, 0x8e5295be72a3b723, 0xcf4eb661c11d017e, 0xf045572b50776cb5,
+	0x4d76f1dea6606dc4, 0x727d1094370a000f, 0x3361334b84b4b652, 0x0c6ad20115dedb99,
+	0x0ed19b758f2e4b8f, 0x31da7a3f1e442644, 0x70c659e0adfa9019, 0x4fcdb8aa3c90fdd2,
+	0xf2fe1e5fca87fca3, 0xcdf5ff155bed9168, 0x8ce9dccae8532735, 0xb3e23d8079394afe,
+	0x64563e0aab733b52, 0x5b5ddf403a195699, 0x1a41fc9f89a7e0c4, 0x254a1dd518cd8d0f,
+	0x9879bb20eeda8c7e, 0xa7725a6a7fb0e1b5, 0xe66e79b5cc0e57e8, 0xd96598ff5d643a23,
+	0x92949ef28518cc26, 0xad9f7fb81472a1ed, 0xec835c67a7cc17b0, 0xd388bd2d36a67a7b,
+	0x6ebb1bd8c0b17b0a, 0x51b0fa9251db16c1, 0x10acd94de265a09c, 0x2fa73807730fcd57,
+	0xf8133b8da145bcfb, 0xc718dac7302fd130, 0x8604f9188391676d, 0xb90f185212fb0aa6,
+	0x043cbea7e4ec0bd7, 0x3b375fed7586661c, 0x7a2b7c32c638d041, 0x45209d785752bd8a,
+	0x479bd40ccda22d9c, 0x789035465cc84057, 0x398c1699ef76f60a, 0x0687f7d37e1c9bc1,
+	0xbbb45126880b9ab0, 0x84bfb06c1961f77b, 0xc5a393b3aadf4126, 0xfaa872f93bb52ced,
+	0x2d1c7173e9ff5d41, 0x121790397895308a, 0x530bb3e6cb2b86d7, 0x6c0052ac5a41eb1c,
+	0xd133f459ac56ea6d, 0xee3815133d3c87a6, 0xaf2436cc8e8231fb, 0x902fd7861fe85c30,
+	0xaa52a425bb6311d7, 0x9559456f2a097c1c, 0xd44566b099b7ca41, 0xeb4e87fa08dda78a,
+	0x567d210ffecaa6fb, 0x6976c0456fa0cb30, 0x286ae39adc1e7d6d, 0x176102d04d7410a6,
+	0xc0d5015a9f3e610a, 0xffdee0100e540cc1, 0xbec2c3cfbdeaba9c, 0x81c922852c80d757,
+	0x3cfa8470da97d626, 0x03f1653a4bfdbbed, 0x42ed46e5f8430db0, 0x7de6a7af6929607b,
+	0x7f5deedbf3d9f06d, 0x40560f9162b39da6, 0x014a2c4ed10d2bfb, 0x3e41cd0440674630,
+	0x83726bf1b6704741, 0xbc798abb271a2a8a, 0xfd65a96494a49cd7, 0xc26e482e05cef11c,
+	0x15da4ba4d78480b0, 0x2ad1aaee46eeed7b, 0x6bcd8931f5505b26, 0x54c6687b643a36ed,
+	0xe9f5ce8e922d379c, 0xd6fe2fc403475a57, 0x97e20c1bb0f9ec0a, 0xa8e9ed51219381c1,
+	0x0000000000000000, 0x1dee8a5e222ca1dc, 0x3bdd14bc445943b8, 0x26339ee26675e264,
+	0x77ba297888b28770, 0x6a54a326aa9e26ac, 0x4c673dc4ccebc4c8, 0x5189b79aeec76514,
+	0xef7452f111650ee0, 0xf29ad8af3349af3c, 0xd4a9464d553c4d58, 0xc947cc137710ec84,
+	0x98ce7b8999d78990, 0x8520f1d7bbfb284c, 0xa3136f35dd8eca28, 0xbefde56bffa26bf4,
+	0x4c300ac98dc40345, 0x51de8097afe8a299, 0x77ed1e75c99d40fd, 0x6a03942bebb1e121,
+	0x3b8a23b105768435, 0x2664a9ef275a25e9, 0x0057370d412fc78d, 0x1db9bd5363036651,
+	0xa34458389ca10da5, 0xbeaad266be8dac79, 0x98994c84d8f84e1d, 0x8577c6dafad4efc1,
+	0xd4fe714014138ad5, 0xc910fb1e363f2b09, 0xef2365fc504ac96d, 0xf2cdefa2726668b1,
+	0x986015931b88068a, 0x858e9fcd39a4a756, 0xa3bd012f5fd14532, 0xbe538b717dfde4ee,
+	0xefda3ceb933a81fa, 0xf234b6b5b1162026, 0xd4072857d763c242, 0xc9e9a209f54f639e,
+	0x771447620aed086a, 0x6afacd3c28c1a9b6, 0x4cc953de4eb44bd2, 0x5127d9806c98ea0e,
+	0x00ae6e1a825f8f1a, 0x1d40e444a0732ec6, 0x3b737aa6c606cca2, 0x269df0f8e42a6d7e,
+	0xd4501f5a964c05cf, 0xc9be9504b460a413, 0xef8d0be6d2154677, 0xf26381b8f039e7ab,
+	0xa3ea36221efe82bf, 0xbe04bc7c3cd22363, 0x9837229e5aa7c107, 0x85d9a8c0788b60db,
+	0x3b244dab87290b2f, 0x26cac7f5a505aaf3, 0x00f95917c3704897, 0x1d17d349e15ce94b,
+	0x4c9e64d30f9b8c5f, 0x5170ee8d2db72d83, 0x7743706f4bc2cfe7, 0x6aadfa3169ee6e3b,
+	0xa218840d981e1391, 0xbff60e53ba32b24d, 0x99c590b1dc475029, 0x842b1aeffe6bf1f5,
+	0xd5a2ad7510ac94e1, 0xc84c272b3280353d, 0xee7fb9c954f5d759, 0xf391339776d97685,
+	0x4d6cd6fc897b1d71, 0x50825ca2ab57bcad, 0x76b1c240cd225ec9, 0x6b5f481eef0eff15,
+	0x3ad6ff8401c99a01, 0x273875da23e53bdd, 0x010beb384590d9b9, 0x1ce5616667bc7865,
+	0xee288ec415da10d4, 0xf3c6049a37f6b108, 0xd5f59a785183536c, 0xc81b102673aff2b0,
+	0x9992a7bc9d6897a4, 0x847c2de2bf443678, 0xa24fb300d931d41c, 0xbfa1395efb1d75c0,
+	0x015cdc3504bf1e34, 0x1cb2566b2693bfe8, 0x3a81c88940e65d8c, 0x276f42d762cafc50,
+	0x76e6f54d8c0d9944, 0x6b087f13ae213898, 0x4d3be1f1c854dafc, 0x50d56bafea787b20,
+	0x3a78919e8396151b, 0x27961bc0a1bab4c7, 0x01a58522c7cf56a3, 0x1c4b0f7ce5e3f77f,
+	0x4dc2b8e60b24926b, 0x502c32b8290833b7, 0x761fac5a4f7dd1d3, 0x6bf126046d51700f,
+	0xd50cc36f92f31bfb, 0xc8e24931b0dfba27, 0xeed1d7d3d6aa5843, 0xf33f5d8df486f99f,
+	0xa2b6ea171a419c8b, 0xbf586049386d3d57, 0x996bfeab5e18df33, 0x848574f57c347eef,
+	0x76489b570e52165e, 0x6ba611092c7eb782, 0x4d958feb4a0b55e6, 0x507b05b56827f43a,
+	0x01f2b22f86e0912e, 0x1c1c3871a4cc30f2, 0x3a2fa693c2b9d296, 0x27c12ccde095734a,
+	0x993cc9a61f3718be, 0x84d243f83d1bb962, 0xa2e1dd1a5b6e5b06, 0xbf0f57447942fada,
+	0xee86e0de97859fce, 0xf3686a80b5a93e12, 0xd55bf462d3dcdc76, 0xc8b57e3cf1f07daa,
+	0xd6e9a7309f3239a7, 0xcb072d6ebd1e987b, 0xed34b38cdb6b7a1f, 0xf0da39d2f947dbc3,
+	0xa1538e481780bed7, 0xbcbd041635ac1f0b, 0x9a8e9af453d9fd6f, 0x876010aa71f55cb3,
+	0x399df5c18e573747, 0x24737f9fac7b969b, 0x0240e17dca0e74ff, 0x1fae6b23e822d523,
+	0x4e27dcb906e5b037, 0x53c956e724c911eb, 0x75fac80542bcf38f, 0x6814425b60905253,
+	0x9ad9adf912f63ae2, 0x873727a730da9b3e, 0xa104b94556af795a, 0xbcea331b7483d886,
+	0xed6384819a44bd92, 0xf08d0edfb8681c4e, 0xd6be903dde1dfe2a, 0xcb501a63fc315ff6,
+	0x75adff0803933402, 0x6843755621bf95de, 0x4e70ebb447ca77ba, 0x539e61ea65e6d666,
+	0x0217d6708b21b372, 0x1ff95c2ea90d12ae, 0x39cac2cccf78f0ca, 0x24244892ed545116,
+	0x4e89b2a384ba3f2d, 0x536738fda6969ef1, 0x7554a61fc0e37c95, 0x68ba2c41e2cfdd49,
+	0x39339bdb0c08b85d, 0x24dd11852e241981, 0x02ee8f674851fbe5, 0x1f0005396a7d5a39,
+	0xa1fde05295df31cd, 0xbc136a0cb7f39011, 0x9a20f4eed1867275, 0x87ce7eb0f3aad3a9,
+	0xd647c92a1d6db6bd, 0xcba943743f411761, 0xed9add965934f505, 0xf07457c87b1854d9,
+	0x02b9b86a097e3c68, 0x1f5732342b529db4, 0x3964acd64d277fd0, 0x248a26886f0bde0c,
+	0x7503911281ccbb18, 0x68ed1b4ca3e01ac4, 0x4ede85aec595f8a0, 0x53300ff0e7b9597c,
+	0xedcdea9b181b3288, 0xf02360c53a379354, 0xd610fe275c427130, 0xcbfe74797e6ed0ec,
+	0x9a77c3e390a9b5f8, 0x879949bdb2851424, 0xa1aad75fd4f0f640, 0xbc445d01f6dc579c,
+	0x74f1233d072c2a36, 0x691fa96325008bea, 0x4f2c37814375698e, 0x52c2bddf6159c852,
+	0x034b0a458f9ead46, 0x1ea5801badb20c9a, 0x38961ef9cbc7eefe, 0x257894a7e9eb4f22,
+	0x9b8571cc164924d6, 0x866bfb923465850a, 0xa05865705210676e, 0xbdb6ef2e703cc6b2,
+	0xec3f58b49efba3a6, 0xf1d1d2eabcd7027a, 0xd7e24c08daa2e01e, 0xca0cc656f88e41c2,
+	0x38c129f48ae82973, 0x252fa3aaa8c488af, 0x031c3d48ceb16acb, 0x1ef2b716ec9dcb17,
+	0x4f7b008c025aae03, 0x52958ad220760fdf, 0x74a614304603edbb, 0x69489e6e642f4c67,
+	0xd7b57b059b8d2793, 0xca5bf15bb9a1864f, 0xec686fb9dfd4642b, 0xf186e5e7fdf8c5f7,
+	0xa00f527d133fa0e3, 0xbde1d8233113013f, 0x9bd246c15766e35b, 0x863ccc9f754a4287,
+	0xec9136ae1ca42cbc, 0xf17fbcf03e888d60, 0xd74c221258fd6f04, 0xcaa2a84c7ad1ced8,
+	0x9b2b1fd69416abcc, 0x86c59588b63a0a10, 0xa0f60b6ad04fe874, 0xbd188134f26349a8,
+	0x03e5645f0dc1225c, 0x1e0bee012fed8380, 0x383870e3499861e4, 0x25d6fabd6bb4c038,
+	0x745f4d278573a52c, 0x69b1c779a75f04f0, 0x4f82599bc12ae694, 0x526cd3c5e3064748,
+	0xa0a13c6791602ff9, 0xbd4fb639b34c8e25, 0x9b7c28dbd5396c41, 0x8692a285f715cd9d,
+	0xd71b151f19d2a889, 0xcaf59f413bfe0955, 0xecc601a35d8beb31, 0xf1288bfd7fa74aed,
+	0x4fd56e9680052119, 0x523be4c8a22980c5, 0x74087a2ac45c62a1, 0x69e6f074e670c37d,
+	0x386f47ee08b7a669, 0x2581cdb02a9b07b5, 0x03b253524ceee5d1, 0x1e5cd90c6ec2440d,
+	0x0000000000000000, 0x5c2d776033c4205e, 0xb85aeec0678840bc, 0xe47799a0544c60e2,
+	0xe26d72ab601e9ffd, 0xbe4005cb53dabfa3, 0x5a379c6b0796df41, 0x061aeb0b3452ff1f,
+	0x56024a7d6f33217f, 0x0a2f3d1d5cf70121, 0xee58a4bd08bb61c3, 0xb275d3dd3b7f419d,
+	0xb46f38d60f2dbe82, 0xe8424fb63ce99edc, 0x0c35d61668a5fe3e, 0x5018a1765b61de60,
+	0xac0494fade6642fe, 0xf029e39aeda262a0, 0x145e7a3ab9ee0242, 0x48730d5a8a2a221c,
+	0x4e69e651be78dd03, 0x124491318dbcfd5d, 0xf6330891d9f09dbf, 0xaa1e7ff1ea34bde1,
+	0xfa06de87b1556381, 0xa62ba9e7829143df, 0x425c3047d6dd233d, 0x1e714727e5190363,
+	0x186bac2cd14bfc7c, 0x4446db4ce28fdc22, 0xa03142ecb6c3bcc0, 0xfc1c358c85079c9e,
+	0xcad186de13c29b79, 0x96fcf1be2006bb27, 0x728b681e744adbc5, 0x2ea61f7e478efb9b,
+	0x28bcf47573dc0484, 0x74918315401824da, 0x90e61ab514544438, 0xcccb6dd527906466,
+	0x9cd3cca37cf1ba06, 0xc0febbc34f359a58, 0x248922631b79faba, 0x78a4550328bddae4,
+	0x7ebebe081cef25fb, 0x2293c9682f2b05a5, 0xc6e450c87b676547, 0x9ac927a848a34519,
+	0x66d51224cda4d987, 0x3af86544fe60f9d9, 0xde8ffce4aa2c993b, 0x82a28b8499e8b965,
+	0x84b8608fadba467a, 0xd89517ef9e7e6624, 0x3ce28e4fca3206c6, 0x60cff92ff9f62698,
+	0x30d75859a297f8f8, 0x6cfa2f399153d8a6, 0x888db699c51fb844, 0xd4a0c1f9f6db981a,
+	0xd2ba2af2c2896705, 0x8e975d92f14d475b, 0x6ae0c432a50127b9, 0x36cdb35296c507e7,
+	0x077ba297888b2877, 0x5b56d5f7bb4f0829, 0xbf214c57ef0368cb, 0xe30c3b37dcc74895,
+	0xe516d03ce895b78a, 0xb93ba75cdb5197d4, 0x5d4c3efc8f1df736, 0x0161499cbcd9d768,
+	0x5179e8eae7b80908, 0x0d549f8ad47c2956, 0xe923062a803049b4, 0xb50e714ab3f469ea,
+	0xb3149a4187a696f5, 0xef39ed21b462b6ab, 0x0b4e7481e02ed649, 0x576303e1d3eaf617,
+	0xab7f366d56ed6a89, 0xf752410d65294ad7, 0x1325d8ad31652a35, 0x4f08afcd02a10a6b,
+	0x491244c636f3f574, 0x153f33a60537d52a, 0xf148aa06517bb5c8, 0xad65dd6662bf9596,
+	0xfd7d7c1039de4bf6, 0xa1500b700a1a6ba8, 0x452792d05e560b4a, 0x190ae5b06d922b14,
+	0x1f100ebb59c0d40b, 0x433d79db6a04f455, 0xa74ae07b3e4894b7, 0xfb67971b0d8cb4e9,
+	0xcdaa24499b49b30e, 0x91875329a88d9350, 0x75f0ca89fcc1f3b2, 0x29ddbde9cf05d3ec,
+	0x2fc756e2fb572cf3, 0x73ea2182c8930cad, 0x979db8229cdf6c4f, 0xcbb0cf42af1b4c11,
+	0x9ba86e34f47a9271, 0xc7851954c7beb22f, 0x23f280f493f2d2cd, 0x7fdff794a036f293,
+	0x79c51c9f94640d8c, 0x25e86bffa7a02dd2, 0xc19ff25ff3ec4d30, 0x9db2853fc0286d6e,
+	0x61aeb0b3452ff1f0, 0x3d83c7d376ebd1ae, 0xd9f45e7322a7b14c, 0x85d9291311639112,
+	0x83c3c21825316e0d, 0xdfeeb57816f54e53, 0x3b992cd842b92eb1, 0x67b45bb8717d0eef,
+	0x37acface2a1cd08f, 0x6b818dae19d8f0d1, 0x8ff6140e4d949033, 0xd3db636e7e50b06d,
+	0xd5c188654a024f72, 0x89ecff0579c66f2c, 0x6d9b66a52d8a0fce, 0x31b611c51e4e2f90,
+	0x0ef7452f111650ee, 0x52da324f22d270b0, 0xb6adabef769e1052, 0xea80dc8f455a300c,
+	0xec9a37847108cf13, 0xb0b740e442ccef4d, 0x54c0d94416808faf, 0x08edae242544aff1,
+	0x58f50f527e257191, 0x04d878324de151cf, 0xe0afe19219ad312d, 0xbc8296f22a691173,
+	0xba987df91e3bee6c, 0xe6b50a992dffce32, 0x02c2933979b3aed0, 0x5eefe4594a778e8e,
+	0xa2f3d1d5cf701210, 0xfedea6b5fcb4324e, 0x1aa93f15a8f852ac, 0x468448759b3c72f2,
+	0x409ea37eaf6e8ded, 0x1cb3d41e9caaadb3, 0xf8c44dbec8e6cd51, 0xa4e93adefb22ed0f,
+	0xf4f19ba8a043336f, 0xa8dcecc893871331, 0x4cab7568c7cb73d3, 0x10860208f40f538d,
+	0x169ce903c05dac92, 0x4ab19e63f3998ccc, 0xaec607c3a7d5ec2e, 0xf2eb70a39411cc70,
+	0xc426c3f102d4cb97, 0x980bb4913110ebc9, 0x7c7c2d31655c8b2b, 0x20515a515698ab75,
+	0x264bb15a62ca546a, 0x7a66c63a510e7434, 0x9e115f9a054214d6, 0xc23c28fa36863488,
+	0x9224898c6de7eae8, 0xce09feec5e23cab6, 0x2a7e674c0a6faa54, 0x7653102c39ab8a0a,
+	0x7049fb270df97515, 0x2c648c473e3d554b, 0xc81315e76a7135a9, 0x943e628759b515f7,
+	0x6822570bdcb28969, 0x340f206bef76a937, 0xd078b9cbbb3ac9d5, 0x8c55ceab88fee98b,
+	0x8a4f25a0bcac1694, 0xd66252c08f6836ca, 0x3215cb60db245628, 0x6e38bc00e8e07676,
+	0x3e201d76b381a816, 0x620d6a1680458848, 0x867af3b6d409e8aa, 0xda5784d6e7cdc8f4,
+	0xdc4d6fddd39f37eb, 0x806018bde05b17b5, 0x6417811db4177757, 0x383af67d87d35709,
+	0x098ce7b8999d7899, 0x55a190d8aa5958c7, 0xb1d60978fe153825, 0xedfb7e18cdd1187b,
+	0xebe19513f983e764, 0xb7cce273ca47c73a, 0x53bb7bd39e0ba7d8, 0x0f960cb3adcf8786,
+	0x5f8eadc5f6ae59e6, 0x03a3daa5c56a79b8, 0xe7d443059126195a, 0xbbf93465a2e23904,
+	0xbde3df6e96b0c61b, 0xe1cea80ea574e645, 0x05b931aef13886a7, 0x599446cec2fca6f9,
+	0xa588734247fb3a67, 0xf9a50422743f1a39, 0x1dd29d8220737adb, 0x41ffeae213b75a85,
+	0x47e501e927e5a59a, 0x1bc87689142185c4, 0xffbfef29406de526, 0xa392984973a9c578,
+	0xf38a393f28c81b18, 0xafa74e5f1b0c3b46, 0x4bd0d7ff4f405ba4, 0x17fda09f7c847bfa,
+	0x11e74b9448d684e5, 0x4dca3cf47b12a4bb, 0xa9bda5542f5ec459, 0xf590d2341c9ae407,
+	0xc35d61668a5fe3e0, 0x9f701606b99bc3be, 0x7b078fa6edd7a35c, 0x272af8c6de138302,
+	0x213013cdea417c1d, 0x7d1d64add9855c43, 0x996afd0d8dc93ca1, 0xc5478a6dbe0d1cff,
+	0x955f2b1be56cc29f, 0xc9725c7bd6a8e2c1, 0x2d05c5db82e48223, 0x7128b2bbb120a27d,
+	0x773259b085725d62, 0x2b1f2ed0b6b67d3c, 0xcf68b770e2fa1dde, 0x9345c010d13e3d80,
+	0x6f59f59c5439a11e, 0x337482fc67fd8140, 0xd7031b5c33b1e1a2, 0x8b2e6c3c0075c1fc,
+	0x8d34873734273ee3, 0xd119f05707e31ebd, 0x356e69f753af7e5f, 0x69431e97606b5e01,
+	0x395bbfe13b0a8061, 0x6576c88108cea03f, 0x810151215c82c0dd, 0xdd2c26416f46e083,
+	0xdb36cd4a5b141f9c, 0x871bba2a68d03fc2, 0x636c238a3c9c5f20, 0x3f4154ea0f587f7e,
+	0x0000000000000000, 0x6184d55f721267c6, 0xc309aabee424cf8c, 0xa28d7fe19636a84a,
+	0x14cbfa566747819d, 0x754f2f091555e65b, 0xd7c250e883634e11, 0xb64685b7f17129d7,
+	0x2997f4acce8f033a, 0x481321f3bc9d64fc, 0xea9e5e122aabccb6, 0x8b1a8b4d58b9ab70,
+	0x3d5c0efaa9c882a7, 0x5cd8dba5dbdae561, 0xfe55a4444dec4d2b, 0x9fd1711b3ffe2aed,
+	0x532fe9599d1e0674, 0x32ab3c06ef0c61b2, 0x902643e7793ac9f8, 0xf1a296b80b28ae3e,
+	0x47e4130ffa5987e9, 0x2660c650884be02f, 0x84edb9b11e7d4865, 0xe5696cee6c6f2fa3,
+	0x7ab81df55391054e, 0x1b3cc8aa21836288, 0xb9b1b74bb7b5cac2, 0xd8356214c5a7ad04,
+	0x6e73e7a334d684d3, 0x0ff732fc46c4e315, 0xad7a4d1dd0f24b5f, 0xccfe9842a2e02c99,
+	0xa65fd2b33a3c0ce8, 0xc7db07ec482e6b2e, 0x6556780dde18c364, 0x04d2ad52ac0aa4a2,
+	0xb29428e55d7b8d75, 0xd310fdba2f69eab3, 0x719d825bb95f42f9, 0x10195704cb4d253f,
+	0x8fc8261ff4b30fd2, 0xee4cf34086a16814, 0x4cc18ca11097c05e, 0x2d4559fe6285a798,
+	0x9b03dc4993f48e4f, 0xfa870916e1e6e989, 0x580a76f777d041c3, 0x398ea3a805c22605,
+	0xf5703beaa7220a9c, 0x94f4eeb5d5306d5a, 0x367991544306c510, 0x57fd440b3114a2d6,
+	0xe1bbc1bcc0658b01, 0x803f14e3b277ecc7, 0x22b26b022441448d, 0x4336be5d5653234b,
+	0xdce7cf4669ad09a6, 0xbd631a191bbf6e60, 0x1fee65f88d89c62a, 0x7e6ab0a7ff9ba1ec,
+	0xc82c35100eea883b, 0xa9a8e04f7cf8effd, 0x0b259faeeace47b7, 0x6aa14af198dc2071,
+	0xde670a4ddb760755, 0xbfe3df12a9646093, 0x1d6ea0f33f52c8d9, 0x7cea75ac4d40af1f,
+	0xcaacf01bbc3186c8, 0xab282544ce23e10e, 0x09a55aa558154944, 0x68218ffa2a072e82,
+	0xf7f0fee115f9046f, 0x96742bbe67eb63a9, 0x34f9545ff1ddcbe3, 0x557d810083cfac25,
+	0xe33b04b772be85f2, 0x82bfd1e800ace234, 0x2032ae09969a4a7e, 0x41b67b56e4882db8,
+	0x8d48e31446680121, 0xeccc364b347a66e7, 0x4e4149aaa24ccead, 0x2fc59cf5d05ea96b,
+	0x99831942212f80bc, 0xf807cc1d533de77a, 0x5a8ab3fcc50b4f30, 0x3b0e66a3b71928f6,
+	0xa4df17b888e7021b, 0xc55bc2e7faf565dd, 0x67d6bd066cc3cd97, 0x065268591ed1aa51,
+	0xb014edeeefa08386, 0xd19038b19db2e440, 0x731d47500b844c0a, 0x1299920f79962bcc,
+	0x7838d8fee14a0bbd, 0x19bc0da193586c7b, 0xbb317240056ec431, 0xdab5a71f777ca3f7,
+	0x6cf322a8860d8a20, 0x0d77f7f7f41fede6, 0xaffa8816622945ac, 0xce7e5d49103b226a,
+	0x51af2c522fc50887, 0x302bf90d5dd76f41, 0x92a686eccbe1c70b, 0xf32253b3b9f3a0cd,
+	0x4564d6044882891a, 0x24e0035b3a90eedc, 0x866d7cbaaca64696, 0xe7e9a9e5deb42150,
+	0x2b1731a77c540dc9, 0x4a93e4f80e466a0f, 0xe81e9b199870c245, 0x899a4e46ea62a583,
+	0x3fdccbf11b138c54, 0x5e581eae6901eb92, 0xfcd5614fff3743d8, 0x9d51b4108d25241e,
+	0x0280c50bb2db0ef3, 0x63041054c0c96935, 0xc1896fb556ffc17f, 0xa00dbaea24eda6b9,
+	0x164b3f5dd59c8f6e, 0x77cfea02a78ee8a8, 0xd54295e331b840e2, 0xb4c640bc43aa2724,
+	0x2e16bbb019e2102f, 0x4f926eef6bf077e9, 0xed1f110efdc6dfa3, 0x8c9bc4518fd4b865,
+	0x3add41e67ea591b2, 0x5b5994b90cb7f674, 0xf9d4eb589a815e3e, 0x98503e07e89339f8,
+	0x07814f1cd76d1315, 0x66059a43a57f74d3, 0xc488e5a23349dc99, 0xa50c30fd415bbb5f,
+	0x134ab54ab02a9288, 0x72ce6015c238f54e, 0xd0431ff4540e5d04, 0xb1c7caab261c3ac2,
+	0x7d3952e984fc165b, 0x1cbd87b6f6ee719d, 0xbe30f85760d8d9d7, 0xdfb42d0812cabe11,
+	0x69f2a8bfe3bb97c6, 0x08767de091a9f000, 0xaafb0201079f584a, 0xcb7fd75e758d3f8c,
+	0x54aea6454a731561, 0x352a731a386172a7, 0x97a70cfbae57daed, 0xf623d9a4dc45bd2b,
+	0x40655c132d3494fc, 0x21e1894c5f26f33a, 0x836cf6adc9105b70, 0xe2e823f2bb023cb6,
+	0x8849690323de1cc7, 0xe9cdbc5c51cc7b01, 0x4b40c3bdc7fad34b, 0x2ac416e2b5e8b48d,
+	0x9c82935544999d5a, 0xfd06460a368bfa9c, 0x5f8b39eba0bd52d6, 0x3e0fecb4d2af3510,
+	0xa1de9dafed511ffd, 0xc05a48f09f43783b, 0x62d737110975d071, 0x0353e24e7b67b7b7,
+	0xb51567f98a169e60, 0xd491b2a6f804f9a6, 0x761ccd476e3251ec, 0x179818181c20362a,
+	0xdb66805abec01ab3, 0xbae25505ccd27d75, 0x186f2ae45ae4d53f, 0x79ebffbb28f6b2f9,
+	0xcfad7a0cd9879b2e, 0xae29af53ab95fce8, 0x0ca4d0b23da354a2, 0x6d2005ed4fb13364,
+	0xf2f174f6704f1989, 0x9375a1a9025d7e4f, 0x31f8de48946bd605, 0x507c0b17e679b1c3,
+	0xe63a8ea017089814, 0x87be5bff651affd2, 0x2533241ef32c5798, 0x44b7f141813e305e,
+	0xf071b1fdc294177a, 0x91f564a2b08670bc, 0x33781b4326b0d8f6, 0x52fcce1c54a2bf30,
+	0xe4ba4baba5d396e7, 0x853e9ef4d7c1f121, 0x27b3e11541f7596b, 0x4637344a33e53ead,
+	0xd9e645510c1b1440, 0xb862900e7e097386, 0x1aefefefe83fdbcc, 0x7b6b3ab09a2dbc0a,
+	0xcd2dbf076b5c95dd, 0xaca96a58194ef21b, 0x0e2415b98f785a51, 0x6fa0c0e6fd6a3d97,
+	0xa35e58a45f8a110e, 0xc2da8dfb2d9876c8, 0x6057f21abbaede82, 0x01d32745c9bcb944,
+	0xb795a2f238cd9093, 0xd61177ad4adff755, 0x749c084cdce95f1f, 0x1518dd13aefb38d9,
+	0x8ac9ac0891051234, 0xeb4d7957e31775f2, 0x49c006b67521ddb8, 0x2844d3e90733ba7e,
+	0x9e02565ef64293a9, 0xff8683018450f46f, 0x5d0bfce012665c25, 0x3c8f29bf60743be3,
+	0x562e634ef8a81b92, 0x37aab6118aba7c54, 0x9527c9f01c8cd41e, 0xf4a31caf6e9eb3d8,
+	0x42e599189fef9a0f, 0x23614c47edfdfdc9, 0x81ec33a67bcb5583, 0xe068e6f909d93245,
+	0x7fb997e2362718a8, 0x1e3d42bd44357f6e, 0xbcb03d5cd203d724, 0xdd34e803a011b0e2,
+	0x6b726db451609935, 0x0af6b8eb2372fef3, 0xa87bc70ab54456b9, 0xc9ff1255c756317f,
+	0x05018a1765b61de6, 0x64855f4817a47a20, 0xc60820a98192d26a, 0xa78cf5f6f380b5ac,
+	0x11ca704102f19c7b, 0x704ea51e70e3fbbd, 0xd2c3daffe6d553f7, 0xb3470fa094c73431,
+	0x2c967ebbab391edc, 0x4d12abe4d92b791a, 0xef9fd4054f1dd150, 0x8e1b015a3d0fb696,
+	0x385d84edcc7e9f41, 0x59d951b2be6cf887, 0xfb542e53285a50cd, 0x9ad0fb0c5a48370b,
+	0x0000000000000000, 0x22ef0d5934f964ec, 0x45de1ab269f2c9d8, 0x673117eb5d0bad34,
+	0x8bbc3564d3e593b0, 0xa953383de71cf75c, 0xce622fd6ba175a68, 0xec8d228f8eee3e84,
+	0x85a0c5e208c539e5, 0xa74fc8bb3c3c5d09, 0xc07edf506137f03d, 0xe291d20955ce94d1,
+	0x0e1cf086db20aa55, 0x2cf3fddfefd9ceb9, 0x4bc2ea34b2d2638d, 0x692de76d862b0761,
+	0x999924efbe846d4f, 0xbb7629b68a7d09a3, 0xdc473e5dd776a497, 0xfea83304e38fc07b,
+	0x1225118b6d61feff, 0x30ca1cd259989a13, 0x57fb0b3904933727, 0x75140660306a53cb,
+	0x1c39e10db64154aa, 0x3ed6ec5482b83046, 0x59e7fbbfdfb39d72, 0x7b08f6e6eb4af99e,
+	0x9785d46965a4c71a, 0xb56ad930515da3f6, 0xd25bcedb0c560ec2, 0xf0b4c38238af6a2e,
+	0xa1eae6f4d206c41b, 0x8305ebade6ffa0f7, 0xe434fc46bbf40dc3, 0xc6dbf11f8f0d692f,
+	0x2a56d39001e357ab, 0x08b9dec9351a3347, 0x6f88c92268119e73, 0x4d67c47b5ce8fa9f,
+	0x244a2316dac3fdfe, 0x06a52e4fee3a9912, 0x619439a4b3313426, 0x437b34fd87c850ca,
+	0xaff6167209266e4e, 0x8d191b2b3ddf0aa2, 0xea280cc060d4a796, 0xc8c70199542dc37a,
+	0x3873c21b6c82a954, 0x1a9ccf42587bcdb8, 0x7dadd8a90570608c, 0x5f42d5f031890460,
+	0xb3cff77fbf673ae4, 0x9120fa268b9e5e08, 0xf611edcdd695f33c, 0xd4fee094e26c97d0,
+	0xbdd307f9644790b1, 0x9f3c0aa050bef45d, 0xf80d1d4b0db55969, 0xdae21012394c3d85,
+	0x366f329db7a20301, 0x14803fc4835b67ed, 0x73b1282fde50cad9, 0x515e2576eaa9ae35,
+	0xd10d62c20b0396b3, 0xf3e26f9b3ffaf25f, 0x94d3787062f15f6b, 0xb63c752956083b87,
+	0x5ab157a6d8e60503, 0x785e5affec1f61ef, 0x1f6f4d14b114ccdb, 0x3d80404d85eda837,
+	0x54ada72003c6af56, 0x7642aa79373fcbba, 0x1173bd926a34668e, 0x339cb0cb5ecd0262,
+	0xdf119244d0233ce6, 0xfdfe9f1de4da580a, 0x9acf88f6b9d1f53e, 0xb82085af8d2891d2,
+	0x4894462db587fbfc, 0x6a7b4b74817e9f10, 0x0d4a5c9fdc753224, 0x2fa551c6e88c56c8,
+	0xc32873496662684c, 0xe1c77e10529b0ca0, 0x86f669fb0f90a194, 0xa41964a23b69c578,
+	0xcd3483cfbd42c219, 0xefdb8e9689bba6f5, 0x88ea997dd4b00bc1, 0xaa059424e0496f2d,
+	0x4688b6ab6ea751a9, 0x6467bbf25a5e3545, 0x0356ac1907559871, 0x21b9a14033acfc9d,
+	0x70e78436d90552a8, 0x5208896fedfc3644, 0x35399e84b0f79b70, 0x17d693dd840eff9c,
+	0xfb5bb1520ae0c118, 0xd9b4bc0b3e19a5f4, 0xbe85abe0631208c0, 0x9c6aa6b957eb6c2c,
+	0xf54741d4d1c06b4d, 0xd7a84c8de5390fa1, 0xb0995b66b832a295, 0x9276563f8ccbc679,
+	0x7efb74b00225f8fd, 0x5c1479e936dc9c11, 0x3b256e026bd73125, 0x19ca635b5f2e55c9,
+	0xe97ea0d967813fe7, 0xcb91ad8053785b0b, 0xaca0ba6b0e73f63f, 0x8e4fb7323a8a92d3,
+	0x62c295bdb464ac57, 0x402d98e4809dc8bb, 0x271c8f0fdd96658f, 0x05f38256e96f0163,
+	0x6cde653b6f440602, 0x4e3168625bbd62ee, 0x29007f8906b6cfda, 0x0bef72d0324fab36,
+	0xe762505fbca195b2, 0xc58d5d068858f15e, 0xa2bc4aedd5535c6a, 0x805347b4e1aa3886,
+	0x30c26aafb90933e3, 0x122d67f68df0570f, 0x751c701dd0fbfa3b, 0x57f37d44e4029ed7,
+	0xbb7e5fcb6aeca053, 0x999152925e15c4bf, 0xfea04579031e698b, 0xdc4f482037e70d67,
+	0xb562af4db1cc0a06, 0x978da21485356eea, 0xf0bcb5ffd83ec3de, 0xd253b8a6ecc7a732,
+	0x3ede9a29622999b6, 0x1c31977056d0fd5a, 0x7b00809b0bdb506e, 0x59ef8dc23f223482,
+	0xa95b4e40078d5eac, 0x8bb4431933743a40, 0xec8554f26e7f9774, 0xce6a59ab5a86f398,
+	0x22e77b24d468cd1c, 0x0008767de091a9f0, 0x67396196bd9a04c4, 0x45d66ccf89636028,
+	0x2cfb8ba20f486749, 0x0e1486fb3bb103a5, 0x6925911066baae91, 0x4bca9c495243ca7d,
+	0xa747bec6dcadf4f9, 0x85a8b39fe8549015, 0xe299a474b55f3d21, 0xc076a92d81a659cd,
+	0x91288c5b6b0ff7f8, 0xb3c781025ff69314, 0xd4f696e902fd3e20, 0xf6199bb036045acc,
+	0x1a94b93fb8ea6448, 0x387bb4668c1300a4, 0x5f4aa38dd118ad90, 0x7da5aed4e5e1c97c,
+	0x148849b963cace1d, 0x366744e05733aaf1, 0x5156530b0a3807c5, 0x73b95e523ec16329,
+	0x9f347cddb02f5dad, 0xbddb718484d63941, 0xdaea666fd9dd9475, 0xf8056b36ed24f099,
+	0x08b1a8b4d58b9ab7, 0x2a5ea5ede172fe5b, 0x4d6fb206bc79536f, 0x6f80bf5f88803783,
+	0x830d9dd0066e0907, 0xa1e2908932976deb, 0xc6d387626f9cc0df, 0xe43c8a3b5b65a433,
+	0x8d116d56dd4ea352, 0xaffe600fe9b7c7be, 0xc8cf77e4b4bc6a8a, 0xea207abd80450e66,
+	0x06ad58320eab30e2, 0x2442556b3a52540e, 0x437342806759f93a, 0x619c4fd953a09dd6,
+	0xe1cf086db20aa550, 0xc320053486f3c1bc, 0xa41112dfdbf86c88, 0x86fe1f86ef010864,
+	0x6a733d0961ef36e0, 0x489c30505516520c, 0x2fad27bb081dff38, 0x0d422ae23ce49bd4,
+	0x646fcd8fbacf9cb5, 0x4680c0d68e36f859, 0x21b1d73dd33d556d, 0x035eda64e7c43181,
+	0xefd3f8eb692a0f05, 0xcd3cf5b25dd36be9, 0xaa0de25900d8c6dd, 0x88e2ef003421a231,
+	0x78562c820c8ec81f, 0x5ab921db3877acf3, 0x3d883630657c01c7, 0x1f673b695185652b,
+	0xf3ea19e6df6b5baf, 0xd10514bfeb923f43, 0xb6340354b6999277, 0x94db0e0d8260f69b,
+	0xfdf6e960044bf1fa, 0xdf19e43930b29516, 0xb828f3d26db93822, 0x9ac7fe8b59405cce,
+	0x764adc04d7ae624a, 0x54a5d15de35706a6, 0x3394c6b6be5cab92, 0x117bcbef8aa5cf7e,
+	0x4025ee99600c614b, 0x62cae3c054f505a7, 0x05fbf42b09fea893, 0x2714f9723d07cc7f,
+	0xcb99dbfdb3e9f2fb, 0xe976d6a487109617, 0x8e47c14fda1b3b23, 0xaca8cc16eee25fcf,
+	0xc5852b7b68c958ae, 0xe76a26225c303c42, 0x805b31c9013b9176, 0xa2b43c9035c2f59a,
+	0x4e391e1fbb2ccb1e, 0x6cd613468fd5aff2, 0x0be704add2de02c6, 0x290809f4e627662a,
+	0xd9bcca76de880c04, 0xfb53c72fea7168e8, 0x9c62d0c4b77ac5dc, 0xbe8ddd9d8383a130,
+	0x5200ff120d6d9fb4, 0x70eff24b3994fb58, 0x17dee5a0649f566c, 0x3531e8f950663280,
+	0x5c1c0f94d64d35e1, 0x7ef302cde2b4510d, 0x19c21526bfbffc39, 0x3b2d187f8b4698d5,
+	0xd7a03af005a8a651, 0xf54f37a93151c2bd, 0x927e20426c5a6f89, 0xb0912d1b58a30b65,
+	0x0000000000000000, 0xdabe95afc7875f40, 0x27a584742000a005, 0xfd1b11dbe787ff45,
+	0x4f4b08e84001400a, 0x95f59d4787861f4a, 0x68ee8c9c6001e00f, 0xb2501933a786bf4f,
+	0x9e9611d080028014, 0x4428847f4785df54, 0xb93395a4a0022011, 0x638d000b67857f51,
+	0xd1dd1938c003c01e, 0x0b638c9707849f5e, 0xf6789d4ce003601b, 0x2cc608e327843f5b,
+	0xaff48c8aaf0b1ead, 0x754a1925688c41ed, 0x885108fe8f0bbea8, 0x52ef9d51488ce1e8,
+	0xe0bf8462ef0a5ea7, 0x3a0111cd288d01e7, 0xc71a0016cf0afea2, 0x1da495b9088da1e2,
+	0x31629d5a2f099eb9, 0xebdc08f5e88ec1f9, 0x16c7192e0f093ebc, 0xcc798c81c88e61fc,
+	0x7e2995b26f08deb3, 0xa497001da88f81f3, 0x598c11c64f087eb6, 0x83328469888f21f6,
+	0xcd31b63ef11823df, 0x178f2391369f7c9f, 0xea94324ad11883da, 0x302aa7e5169fdc9a,
+	0x827abed6b11963d5, 0x58c42b79769e3c95, 0xa5df3aa29119c3d0, 0x7f61af0d569e9c90,
+	0x53a7a7ee711aa3cb, 0x89193241b69dfc8b, 0x7402239a511a03ce, 0xaebcb635969d5c8e,
+	0x1cecaf06311be3c1, 0xc6523aa9f69cbc81, 0x3b492b72111b43c4, 0xe1f7beddd69c1c84,
+	0x62c53ab45e133d72, 0xb87baf1b99946232, 0x4560bec07e139d77, 0x9fde2b6fb994c237,
+	0x2d8e325c1e127d78, 0xf730a7f3d9952238, 0x0a2bb6283e12dd7d, 0xd0952387f995823d,
+	0xfc532b64de11bd66, 0x26edbecb1996e226, 0xdbf6af10fe111d63, 0x01483abf39964223,
+	0xb318238c9e10fd6c, 0x69a6b6235997a22c, 0x94bda7f8be105d69, 0x4e03325779970229,
+	0x08bbc3564d3e593b, 0xd20556f98ab9067b, 0x2f1e47226d3ef93e, 0xf5a0d28daab9a67e,
+	0x47f0cbbe0d3f1931, 0x9d4e5e11cab84671, 0x60554fca2d3fb934, 0xbaebda65eab8e674,
+	0x962dd286cd3cd92f, 0x4c9347290abb866f, 0xb18856f2ed3c792a, 0x6b36c35d2abb266a,
+	0xd966da6e8d3d9925, 0x03d84fc14abac665, 0xfec35e1aad3d3920, 0x247dcbb56aba6660,
+	0xa74f4fdce2354796, 0x7df1da7325b218d6, 0x80eacba8c235e793, 0x5a545e0705b2b8d3,
+	0xe8044734a234079c, 0x32bad29b65b358dc, 0xcfa1c3408234a799, 0x151f56ef45b3f8d9,
+	0x39d95e0c6237c782, 0xe367cba3a5b098c2, 0x1e7cda7842376787, 0xc4c24fd785b038c7,
+	0x769256e422368788, 0xac2cc34be5b1d8c8, 0x5137d2900236278d, 0x8b89473fc5b178cd,
+	0xc58a7568bc267ae4, 0x1f34e0c77ba125a4, 0xe22ff11c9c26dae1, 0x389164b35ba185a1,
+	0x8ac17d80fc273aee, 0x507fe82f3ba065ae, 0xad64f9f4dc279aeb, 0x77da6c5b1ba0c5ab,
+	0x5b1c64b83c24faf0, 0x81a2f117fba3a5b0, 0x7cb9e0cc1c245af5, 0xa6077563dba305b5,
+	0x14576c507c25bafa, 0xcee9f9ffbba2e5ba, 0x33f2e8245c251aff, 0xe94c7d8b9ba245bf,
+	0x6a7ef9e2132d6449, 0xb0c06c4dd4aa3b09, 0x4ddb7d96332dc44c, 0x9765e839f4aa9b0c,
+	0x2535f10a532c2443, 0xff8b64a594ab7b03, 0x0290757e732c8446, 0xd82ee0d1b4abdb06,
+	0xf4e8e832932fe45d, 0x2e567d9d54a8bb1d, 0xd34d6c46b32f4458, 0x09f3f9e974a81b18,
+	0xbba3e0dad32ea457, 0x611d757514a9fb17, 0x9c0664aef32e0452, 0x46b8f10134a95b12,
+	0x117786ac9a7cb276, 0xcbc913035dfbed36, 0x36d202d8ba7c1273, 0xec6c97777dfb4d33,
+	0x5e3c8e44da7df27c, 0x84821beb1dfaad3c, 0x79990a30fa7d5279, 0xa3279f9f3dfa0d39,
+	0x8fe1977c1a7e3262, 0x555f02d3ddf96d22, 0xa84413083a7e9267, 0x72fa86a7fdf9cd27,
+	0xc0aa9f945a7f7268, 0x1a140a3b9df82d28, 0xe70f1be07a7fd26d, 0x3db18e4fbdf88d2d,
+	0xbe830a263577acdb, 0x643d9f89f2f0f39b, 0x99268e5215770cde, 0x43981bfdd2f0539e,
+	0xf1c802ce7576ecd1, 0x2b769761b2f1b391, 0xd66d86ba55764cd4, 0x0cd3131592f11394,
+	0x20151bf6b5752ccf, 0xfaab8e5972f2738f, 0x07b09f8295758cca, 0xdd0e0a2d52f2d38a,
+	0x6f5e131ef5746cc5, 0xb5e086b132f33385, 0x48fb976ad574ccc0, 0x924502c512f39380,
+	0xdc4630926b6491a9, 0x06f8a53dace3cee9, 0xfbe3b4e64b6431ac, 0x215d21498ce36eec,
+	0x930d387a2b65d1a3, 0x49b3add5ece28ee3, 0xb4a8bc0e0b6571a6, 0x6e1629a1cce22ee6,
+	0x42d02142eb6611bd, 0x986eb4ed2ce14efd, 0x6575a536cb66b1b8, 0xbfcb30990ce1eef8,
+	0x0d9b29aaab6751b7, 0xd725bc056ce00ef7, 0x2a3eadde8b67f1b2, 0xf08038714ce0aef2,
+	0x73b2bc18c46f8f04, 0xa90c29b703e8d044, 0x5417386ce46f2f01, 0x8ea9adc323e87041,
+	0x3cf9b4f0846ecf0e, 0xe647215f43e9904e, 0x1b5c3084a46e6f0b, 0xc1e2a52b63e9304b,
+	0xed24adc8446d0f10, 0x379a386783ea5050, 0xca8129bc646daf15, 0x103fbc13a3eaf055,
+	0xa26fa520046c4f1a, 0x78d1308fc3eb105a, 0x85ca2154246cef1f, 0x5f74b4fbe3ebb05f,
+	0x19cc45fad742eb4d, 0xc372d05510c5b40d, 0x3e69c18ef7424b48, 0xe4d7542130c51408,
+	0x56874d129743ab47, 0x8c39d8bd50c4f407, 0x7122c966b7430b42, 0xab9c5cc970c45402,
+	0x875a542a57406b59, 0x5de4c18590c73419, 0xa0ffd05e7740cb5c, 0x7a4145f1b0c7941c,
+	0xc8115cc217412b53, 0x12afc96dd0c67413, 0xefb4d8b637418b56, 0x350a4d19f0c6d416,
+	0xb638c9707849f5e0, 0x6c865cdfbfceaaa0, 0x919d4d04584955e5, 0x4b23d8ab9fce0aa5,
+	0xf973c1983848b5ea, 0x23cd5437ffcfeaaa, 0xded645ec184815ef, 0x0468d043dfcf4aaf,
+	0x28aed8a0f84b75f4, 0xf2104d0f3fcc2ab4, 0x0f0b5cd4d84bd5f1, 0xd5b5c97b1fcc8ab1,
+	0x67e5d048b84a35fe, 0xbd5b45e77fcd6abe, 0x4040543c984a95fb, 0x9afec1935fcdcabb,
+	0xd4fdf3c4265ac892, 0x0e43666be1dd97d2, 0xf35877b0065a6897, 0x29e6e21fc1dd37d7,
+	0x9bb6fb2c665b8898, 0x41086e83a1dcd7d8, 0xbc137f58465b289d, 0x66adeaf781dc77dd,
+	0x4a6be214a6584886, 0x90d577bb61df17c6, 0x6dce66608658e883, 0xb770f3cf41dfb7c3,
+	0x0520eafce659088c, 0xdf9e7f5321de57cc, 0x22856e88c659a889, 0xf83bfb2701def7c9,
+	0x7b097f4e8951d63f, 0xa1b7eae14ed6897f, 0x5cacfb3aa951763a, 0x86126e956ed6297a,
+	0x344277a6c9509635, 0xeefce2090ed7c975, 0x13e7f3d2e9503630, 0xc959667d2ed76970,
+	0xe59f6e9e0953562b, 0x3f21fb31ced4096b, 0xc23aeaea2953f62e, 0x18847f45eed4a96e,
+	0xaad4667649521621, 0x706af3d98ed54961, 0x8d71e2026952b624, 0x57cf77adaed5e964
+};
+
+const uint64_t crc_table_goiso[256] CRC_TABLE_ALIGN PROGMEM = {
+	0x0000000000000000, 0x01b0000000000000, 0x0360000000000000, 0x02d0000000000000,
+	0x06c0000000000000, 0x0770000000000000, 0x05a0000000000000, 0x0410000000000000,
+	0x0d80000000000000, 0x0c30000000000000, 0x0ee0000000000000, 0x0f50000000000000,
+	0x0b40000000000000, 0x0af0000000000000, 0x0820000000000000, 0x0990000000000000,
+	0x1b00000000000000, 0x1ab0000000000000, 0x1860000000000000, 0x19d0000000000000,
+	0x1dc0000000000000, 0x1c70000000000000, 0x1ea0000000000000, 0x1f10000000000000,
+	0x1680000000000000, 0x1730000000000000, 0x15e0000000000000, 0x1450000000000000,
+	0x1040000000000000, 0x11f0000000000000, 0x1320000000000000, 0x1290000000000000,
+	0x3600000000000000, 0x37b0000000000000, 0x3560000000000000, 0x34d0000000000000,
+	0x30c0000000000000, 0x3170000000000000, 0x33a0000000000000, 0x3210000000000000,
+	0x3b80000000000000, 0x3a30000000000000, 0x38e0000000000000, 0x3950000000000000,
+	0x3d40000000000000, 0x3cf0000000000000, 0x3e20000000000000, 0x3f90000000000000,
+	0x2d00000000000000, 0x2cb0000000000000, 0x2e60000000000000, 0x2fd0000000000000,
+	0x2bc0000000000000, 0x2a70000000000000, 0x28a0000000000000, 0x2910000000000000,
+	0x2080000000000000, 0x2130000000000000, 0x23e0000000000000, 0x2250000000000000,
+	0x2640000000000000, 0x27f0000000000000, 0x2520000000000000, 0x2490000000000000,
+	0x6c00000000000000, 0x6db0000000000000, 0x6f60000000000000, 0x6ed0000000000000,
+	0x6ac0000000000000, 0x6b70000000000000, 0x69a0000000000000, 0x6810000000000000,
+	0x6180000000000000, 0x6030000000000000, 0x62e0000000000000, 0x6350000000000000,
+	0x6740000000000000, 0x66f0000000000000, 0x6420000000000000, 0x6590000000000000,
+	0x7700000000000000, 0x76b0000000000000, 0x7460000000000000, 0x75d0000000000000,
+	0x71c0000000000000, 0x7070000000000000, 0x72a0000000000000, 0x7310000000000000,
+	0x7a80000000000000, 0x7b30000000000000, 0x79e0000000000000, 0x7850000000000000,
+	0x7c40000000000000, 0x7df0000000000000, 0x7f20000000000000, 0x7e90000000000000,
+	0x5a00000000000000, 0x5bb0000000000000, 0x5960000000000000, 0x58d0000000000000,
+	0x5cc0000000000000, 0x5d70000000000000, 0x5fa0000000000000, 0x5e10000000000000,
+	0x5780000000000000, 0x5630000000000000, 0x54e0000000000000, 0x5550000000000000,
+	0x5140000000000000, 0x50f0000000000000, 0x5220000000000000, 0x5390000000000000,
+	0x4100000000000000, 0x40b0000000000000, 0x4260000000000000, 0x43d0000000000000,
+	0x47c0000000000000, 0x4670000000000000, 0x44a0000000000000, 0x4510000000000000,
+	0x4c80000000000000, 0x4d30000000000000, 0x4fe0000000000000, 0x4e50000000000000,
+	0x4a40000000000000, 0x4bf0000000000000, 0x4920000000000000, 0x4890000000000000,
+	0xd800000000000000, 0xd9b0000000000000, 0xdb60000000000000, 0xdad0000000000000,
+	0xdec0000000000000, 0xdf70000000000000, 0xdda0000000000000, 0xdc10000000000000,
+	0xd580000000000000, 0xd430000000000000, 0xd6e0000000000000, 0xd750000000000000,
+	0xd340000000000000, 0xd2f0000000000000, 0xd020000000000000, 0xd190000000000000,
+	0xc300000000000000, 0xc2b0000000000000, 0xc060000000000000, 0xc1d0000000000000,
+	0xc5c0000000000000, 0xc470000000000000, 0xc6a0000000000000, 0xc710000000000000,
+	0xce80000000000000, 0xcf30000000000000, 0xcde0000000000000, 0xcc50000000000000,
+	0xc840000000000000, 0xc9f0000000000000, 0xcb20000000000000, 0xca90000000000000,
+	0xee00000000000000, 0xefb0000000000000, 0xed60000000000000, 0xecd0000000000000,
+	0xe8c0000000000000, 0xe970000000000000, 0xeba0000000000000, 0xea10000000000000,
+	0xe380000000000000, 0xe230000000000000, 0xe0e0000000000000, 0xe150000000000000,
+	0xe540000000000000, 0xe4f0000000000000, 0xe620000000000000, 0xe790000000000000,
+	0xf500000000000000, 0xf4b0000000000000, 0xf660000000000000, 0xf7d0000000000000,
+	0xf3c0000000000000, 0xf270000000000000, 0xf0a0000000000000, 0xf110000000000000,
+	0xf880000000000000, 0xf930000000000000, 0xfbe0000000000000, 0xfa50000000000000,
+	0xfe40000000000000, 0xfff0000000000000, 0xfd20000000000000, 0xfc90000000000000,
+	0xb400000000000000, 0xb5b0000000000000, 0xb760000000000000, 0xb6d0000000000000,
+	0xb2c0000000000000, 0xb370000000000000, 0xb1a0000000000000, 0xb010000000000000,
+	0xb980000000000000, 0xb830000000000000, 0xbae0000000000000, 0xbb50000000000000,
+	0xbf40000000000000, 0xbef0000000000000, 0xbc20000000000000, 0xbd90000000000000,
+	0xaf00000000000000, 0xaeb0000000000000, 0xac60000000000000, 0xadd0000000000000,
+	0xa9c0000000000000, 0xa870000000000000, 0xaaa0000000000000, 0xab10000000000000,
+	0xa280000000000000, 0xa330000000000000, 0xa1e0000000000000, 0xa050000000000000,
+	0xa440000000000000, 0xa5f0000000000000, 0xa720000000000000, 0xa690000000000000,
+	0x8200000000000000, 0x83b0000000000000, 0x8160000000000000, 0x80d0000000000000,
+	0x84c0000000000000, 0x8570000000000000, 0x87a0000000000000, 0x8610000000000000,
+	0x8f80000000000000, 0x8e30000000000000, 0x8ce0000000000000, 0x8d50000000000000,
+	0x8940000000000000, 0x88f0000000000000, 0x8a20000000000000, 0x8b90000000000000,
+	0x9900000000000000, 0x98b0000000000000, 0x9a60000000000000, 0x9bd0000000000000,
+	0x9fc0000000000000, 0x9e70000000000000, 0x9ca0000000000000, 0x9d10000000000000,
+	0x9480000000000000, 0x9530000000000000, 0x97e0000000000000, 0x9650000000000000,
+	0x9240000000000000, 0x93f0000000000000, 0x9120000000000000, 0x9090000000000000
+};
+
+const uint64_t crc_table_goiso_big[2048] CRC_TABLE_ALIGN PROGMEM = {
+	0x0000000000000000, 0x01b0000000000000, 0x0360000000000000, 0x02d0000000000000,
+	0x06c0000000000000, 0x0770000000000000, 0x05a0000000000000, 0x0410000000000000,
+	0x0d80000000000000, 0x0c30000000000000, 0x0ee0000000000000, 0x0f50000000000000,
+	0x0b40000000000000, 0x0af0000000000000, 0x0820000000000000, 0x0990000000000000,
+	0x1b00000000000000, 0x1ab0000000000000, 0x1860000000000000, 0x19d0000000000000,
+	0x1dc0000000000000, 0x1c70000000000000, 0x1ea0000000000000, 0x1f10000000000000,
+	0x1680000000000000, 0x1730000000000000, 0x15e0000000000000, 0x1450000000000000,
+	0x1040000000000000, 0x11f0000000000000, 0x1320000000000000, 0x1290000000000000,
+	0x3600000000000000, 0x37b0000000000000, 0x3560000000000000, 0x34d0000000000000,
+	0x30c0000000000000, 0x3170000000000000, 0x33a0000000000000, 0x3210000000000000,
+	0x3b80000000000000, 0x3a30000000000000, 0x38e0000000000000, 0x3950000000000000,
+	0x3d40000000000000, 0x3cf0000000000000, 0x3e20000000000000, 0x3f90000000000000,
+	0x2d00000000000000, 0x2cb0000000000000, 0x2e60000000000000, 0x2fd0000000000000,
+	0x2bc0000000000000, 0x2a70000000000000, 0x28a0000000000000, 0x2910000000000000,
+	0x2080000000000000, 0x2130000000000000, 0x23e0000000000000, 0x2250000000000000,
+	0x2640000000000000, 0x27f0000000000000, 0x2520000000000000, 0x2490000000000000,
+	0x6c00000000000000, 0x6db0000000000000, 0x6f60000000000000, 0x6ed0000000000000,
+	0x6ac0000000000000, 0x6b70000000000000, 0x69a0000000000000, 0x6810000000000000,
+	0x6180000000000000, 0x6030000000000000, 0x62e0000000000000, 0x6350000000000000,
+	0x6740000000000000, 0x66f0000000000000, 0x6420000000000000, 0x6590000000000000,
+	0x7700000000000000, 0x76b0000000000000, 0x7460000000000000, 0x75d0000000000000,
+	0x71c0000000000000, 0x7070000000000000, 0x72a0000000000000, 0x7310000000000000,
+	0x7a80000000000000, 0x7b30000000000000, 0x79e0000000000000, 0x7850000000000000,
+	0x7c40000000000000, 0x7df0000000000000, 0x7f20000000000000, 0x7e90000000000000,
+	0x5a00000000000000, 0x5bb0000000000000, 0x5960000000000000, 0x58d0000000000000,
+	0x5cc0000000000000, 0x5d70000000000000, 0x5fa0000000000000, 0x5e10000000000000,
+	0x5780000000000000, 0x5630000000000000, 0x54e0000000000000, 0x5550000000000000,
+	0x5140000000000000, 0x50f0000000000000, 0x5220000000000000, 0x5390000000000000,
+	0x4100000000000000, 0x40b0000000000000, 0x4260000000000000, 0x43d0000000000000,
+	0x47c0000000000000, 0x4670000000000000, 0x44a0000000000000, 0x4510000000000000,
+	0x4c80000000000000, 0x4d30000000000000, 0x4fe0000000000000, 0x4e50000000000000,
+	0x4a40000000000000, 0x4bf0000000000000, 0x4920000000000000, 0x4890000000000000,
+	0xd800000000000000, 0xd9b0000000000000, 0xdb60000000000000, 0xdad0000000000000,
+	0xdec0000000000000, 0xdf70000000000000, 0xdda0000000000000, 0xdc10000000000000,
+	0xd580000000000000, 0xd430000000000000, 0xd6e0000000000000, 0xd750000000000000,
+	0xd340000000000000, 0xd2f0000000000000, 0xd020000000000000, 0xd190000000000000,
+	0xc300000000000000, 0xc2b0000000000000, 0xc060000000000000, 0xc1d0000000000000,
+	0xc5c0000000000000, 0xc470000000000000, 0xc6a0000000000000, 0xc710000000000000,
+	0xce80000000000000, 0xcf30000000000000, 0xcde0000000000000, 0xcc50000000000000,
+	0xc840000000000000, 0xc9f0000000000000, 0xcb20000000000000, 0xca90000000000000,
+	0xee00000000000000, 0xefb0000000000000, 0xed60000000000000, 0xecd0000000000000,
+	0xe8c0000000000000, 0xe970000000000000, 0xeba0000000000000, 0xea10000000000000,
+	0xe380000000000000, 0xe230000000000000, 0xe0e0000000000000, 0xe150000000000000,
+	0xe540000000000000, 0xe4f0000000000000, 0xe620000000000000, 0xe790000000000000,
+	0xf500000000000000, 0xf4b0000000000000, 0xf660000000000000, 0xf7d0000000000000,
+	0xf3c0000000000000, 0xf270000000000000, 0xf0a0000000000000, 0xf110000000000000,
+	0xf880000000000000, 0xf930000000000000, 0xfbe0000000000000, 0xfa50000000000000,
+	0xfe40000000000000, 0xfff0000000000000, 0xfd20000000000000, 0xfc90000000000000,
+	0xb400000000000000, 0xb5b0000000000000, 0xb760000000000000, 0xb6d0000000000000,
+	0xb2c0000000000000, 0xb370000000000000, 0xb1a0000000000000, 0xb010000000000000,
+	0xb980000000000000, 0xb830000000000000, 0xbae0000000000000, 0xbb50000000000000,
+	0xbf40000000000000, 0xbef0000000000000, 0xbc20000000000000, 0xbd90000000000000,
+	0xaf00000000000000, 0xaeb0000000000000, 0xac60000000000000, 0xadd0000000000000,
+	0xa9c0000000000000, 0xa870000000000000, 0xaaa0000000000000, 0xab10000000000000,
+	0xa280000000000000, 0xa330000000000000, 0xa1e0000000000000, 0xa050000000000000,
+	0xa440000000000000, 0xa5f0000000000000, 0xa720000000000000, 0xa690000000000000,
+	0x8200000000000000, 0x83b0000000000000, 0x8160000000000000, 0x80d0000000000000,
+	0x84c0000000000000, 0x8570000000000000, 0x87a0000000000000, 0x8610000000000000,
+	0x8f80000000000000, 0x8e30000000000000, 0x8ce0000000000000, 0x8d50000000000000,
+	0x8940000000000000, 0x88f0000000000000, 0x8a20000000000000, 0x8b90000000000000,
+	0x9900000000000000, 0x98b0000000000000, 0x9a60000000000000, 0x9bd0000000000000,
+	0x9fc0000000000000, 0x9e70000000000000, 0x9ca0000000000000, 0x9d10000000000000,
+	0x9480000000000000, 0x9530000000000000, 0x97e0000000000000, 0x9650000000000000,
+	0x9240000000000000, 0x93f0000000000000, 0x9120000000000000, 0x9090000000000000,
+	0x0000000000000000, 0x0001b00000000000, 0x0003600000000000, 0x0002d00000000000,
+	0x0006c00000000000, 0x0007700000000000, 0x0005a00000000000, 0x0004100000000000,
+	0x000d800000000000, 0x000c300000000000, 0x000ee00000000000, 0x000f500000000000,
+	0x000b400000000000, 0x000af00000000000, 0x0008200000000000, 0x0009900000000000,
+	0x001b000000000000, 0x001ab00000000000, 0x0018600000000000, 0x0019d00000000000,
+	0x001dc00000000000, 0x001c700000000000, 0x001ea00000000000, 0x001f100000000000,
+	0x0016800000000000, 0x0017300000000000, 0x0015e00000000000, 0x0014500000000000,
+	0x0010400000000000, 0x0011f00000000000, 0x0013200000000000, 0x0012900000000000,
+	0x0036000000000000, 0x0037b00000000000, 0x0035600000000000, 0x0034d00000000000,
+	0x0030c00000000000, 0x0031700000000000, 0x0033a00000000000, 0x0032100000000000,
+	0x003b800000000000, 0x003a300000000000, 0x0038e00000000000, 0x0039500000000000,
+	0x003d400000000000, 0x003cf00000000000, 0x003e200000000000, 0x003f900000000000,
+	0x002d000000000000, 0x002cb00000000000, 0x002e600000000000, 0x002fd00000000000,
+	0x002bc00000000000, 0x002a700000000000, 0x0028a00000000000, 0x0029100000000000,
+	0x0020800000000000, 0x0021300000000000, 0x0023e00000000000, 0x0022500000000000,
+	0x0026400000000000, 0x0027f00000000000, 0x0025200000000000, 0x0024900000000000,
+	0x006c000000000000, 0x006db00000000000, 0x006f600000000000, 0x006ed00000000000,
+	0x006ac00000000000, 0x006b700000000000, 0x0069a00000000000, 0x0068100000000000,
+	0x0061800000000000, 0x0060300000000000, 0x0062e00000000000, 0x0063500000000000,
+	0x0067400000000000, 0x0066f00000000000, 0x0064200000000000, 0x0065900000000000,
+	0x0077000000000000, 0x0076b00000000000, 0x0074600000000000, 0x0075d00000000000,
+	0x0071c00000000000, 0x0070700000000000, 0x0072a00000000000, 0x0073100000000000,
+	0x007a800000000000, 0x007b300000000000, 0x0079e00000000000, 0x0078500000000000,
+	0x007c400000000000, 0x007df00000000000, 0x007f200000000000, 0x007e900000000000,
+	0x005a000000000000, 0x005bb00000000000, 0x0059600000000000, 0x0058d00000000000,
+	0x005cc00000000000, 0x005d700000000000, 0x005fa00000000000, 0x005e100000000000,
+	0x0057800000000000, 0x0056300000000000, 0x0054e00000000000, 0x0055500000000000,
+	0x0051400000000000, 0x0050f00000000000, 0x0052200000000000, 0x0053900000000000,
+	0x0041000000000000, 0x0040b00000000000, 0x0042600000000000, 0x0043d00000000000,
+	0x0047c00000000000, 0x0046700000000000, 0x0044a00000000000, 0x0045100000000000,
+	0x004c800000000000, 0x004d300000000000, 0x004fe00000000000, 0x004e500000000000,
+	0x004a400000000000, 0x004bf00000000000, 0x0049200000000000, 0x0048900000000000,
+	0x00d8000000000000, 0x00d9b00000000000, 0x00db600000000000, 0x00dad00000000000,
+	0x00dec00000000000, 0x00df700000000000, 0x00dda00000000000, 0x00dc100000000000,
+	0x00d5800000000000, 0x00d4300000000000, 0x00d6e00000000000, 0x00d7500000000000,
+	0x00d3400000000000, 0x00d2f00000000000, 0x00d0200000000000, 0x00d1900000000000,
+	0x00c3000000000000, 0x00c2b00000000000, 0x00c0600000000000, 0x00c1d00000000000,
+	0x00c5c00000000000, 0x00c4700000000000, 0x00c6a00000000000, 0x00c7100000000000,
+	0x00ce800000000000, 0x00cf300000000000, 0x00cde00000000000, 0x00cc500000000000,
+	0x00c8400000000000, 0x00c9f00000000000, 0x00cb200000000000, 0x00ca900000000000,
+	0x00ee000000000000, 0x00efb00000000000, 0x00ed600000000000, 0x00ecd00000000000,
+	0x00e8c00000000000, 0x00e9700000000000, 0x00eba00000000000, 0x00ea100000000000,
+	0x00e3800000000000, 0x00e2300000000000, 0x00e0e00000000000, 0x00e1500000000000,
+	0x00e5400000000000, 0x00e4f00000000000, 0x00e6200000000000, 0x00e7900000000000,
+	0x00f5000000000000, 0x00f4b00000000000, 0x00f6600000000000, 0x00f7d00000000000,
+	0x00f3c00000000000, 0x00f2700000000000, 0x00f0a00000000000, 0x00f1100000000000,
+	0x00f8800000000000, 0x00f9300000000000, 0x00fbe00000000000, 0x00fa500000000000,
+	0x00fe400000000000, 0x00fff00000000000, 0x00fd200000000000, 0x00fc900000000000,
+	0x00b4000000000000, 0x00b5b00000000000, 0x00b7600000000000, 0x00b6d00000000000,
+	0x00b2c00000000000, 0x00b3700000000000, 0x00b1a00000000000, 0x00b0100000000000,
+	0x00b9800000000000, 0x00b8300000000000, 0x00bae00000000000, 0x00bb500000000000,
+	0x00bf400000000000, 0x00bef00000000000, 0x00bc200000000000, 0x00bd900000000000,
+	0x00af000000000000, 0x00aeb00000000000, 0x00ac600000000000, 0x00add00000000000,
+	0x00a9c00000000000, 0x00a8700000000000, 0x00aaa00000000000, 0x00ab100000000000,
+	0x00a2800000000000, 0x00a3300000000000, 0x00a1e00000000000, 0x00a0500000000000,
+	0x00a4400000000000, 0x00a5f00000000000, 0x00a7200000000000, 0x00a6900000000000,
+	0x0082000000000000, 0x0083b00000000000, 0x0081600000000000, 0x0080d00000000000,
+	0x0084c00000000000, 0x0085700000000000, 0x0087a00000000000, 0x0086100000000000,
+	0x008f800000000000, 0x008e300000000000, 0x008ce00000000000, 0x008d500000000000,
+	0x0089400000000000, 0x0088f00000000000, 0x008a200000000000, 0x008b900000000000,
+	0x0099000000000000, 0x0098b00000000000, 0x009a600000000000, 0x009bd00000000000,
+	0x009fc00000000000, 0x009e700000000000, 0x009ca00000000000, 0x009d100000000000,
+	0x0094800000000000, 0x0095300000000000, 0x0097e00000000000, 0x0096500000000000,
+	0x0092400000000000, 0x0093f00000000000, 0x0091200000000000, 0x0090900000000000,
+	0x0000000000000000, 0x000001b000000000, 0x0000036000000000, 0x000002d000000000,
+	0x000006c000000000, 0x0000077000000000, 0x000005a000000000, 0x0000041000000000,
+	0x00000d8000000000, 0x00000c3000000000, 0x00000ee000000000, 0x00000f5000000000,
+	0x00000b4000000000, 0x00000af000000000, 0x0000082000000000, 0x0000099000000000,
+	0x00001b0000000000, 0x00001ab000000000, 0x0000186000000000, 0x000019d000000000,
+	0x00001dc000000000, 0x00001c7000000000, 0x00001ea000000000, 0x00001f1000000000,
+	0x0000168000000000, 0x0000173000000000, 0x000015e000000000, 0x0000145000000000,
+	0x0000104000000000, 0x000011f000000000, 0x0000132000000000, 0x0000129000000000,
+	0x0000360000000000, 0x000037b000000000, 0x0000356000000000, 0x000034d000000000,
+	0x000030c000000000, 0x0000317000000000, 0x000033a000000000, 0x0000321000000000,
+	0x00003b8000000000, 0x00003a3000000000, 0x000038e000000000, 0x0000395000000000,
+	0x00003d4000000000, 0x00003cf000000000, 0x00003e2000000000, 0x00003f9000000000,
+	0x00002d0000000000, 0x00002cb000000000, 0x00002e6000000000, 0x00002fd000000000,
+	0x00002bc000000000, 0x00002a7000000000, 0x000028a000000000, 0x0000291000000000,
+	0x0000208000000000, 0x0000213000000000, 0x000023e000000000, 0x0000225000000000,
+	0x0000264000000000, 0x000027f000000000, 0x0000252000000000, 0x0000249000000000,
+	0x00006c0000000000, 0x00006db000000000, 0x00006f6000000000, 0x00006ed000000000,
+	0x00006ac000000000, 0x00006b7000000000, 0x000069a000000000, 0x0000681000000000,
+	0x0000618000000000, 0x0000603000000000, 0x000062e000000000, 0x0000635000000000,
+	0x0000674000000000, 0x000066f000000000, 0x0000642000000000, 0x0000659000000000,
+	0x0000770000000000, 0x000076b000000000, 0x0000746000000000, 0x000075d000000000,
+	0x000071c000000000, 0x0000707000000000, 0x000072a000000000, 0x0000731000000000,
+	0x00007a8000000000, 0x00007b3000000000, 0x000079e000000000, 0x0000785000000000,
+	0x00007c4000000000, 0x00007df000000000, 0x00007f2000000000, 0x00007e9000000000,
+	0x00005a0000000000, 0x00005bb000000000, 0x0000596000000000, 0x000058d000000000,
+	0x00005cc000000000, 0x00005d7000000000, 0x00005fa000000000, 0x00005e1000000000,
+	0x0000578000000000, 0x0000563000000000, 0x000054e000000000, 0x0000555000000000,
+	0x0000514000000000, 0x000050f000000000, 0x0000522000000000, 0x0000539000000000,
+	0x0000410000000000, 0x000040b000000000, 0x0000426000000000, 0x000043d000000000,
+	0x000047c000000000, 0x0000467000000000, 0x000044a000000000, 0x0000451000000000,
+	0x00004c8000000000, 0x00004d3000000000, 0x00004fe000000000, 0x00004e5000000000,
+	0x00004a4000000000, 0x00004bf000000000, 0x0000492000000000, 0x0000489000000000,
+	0x0000d80000000000, 0x0000d9b000000000, 0x0000db6000000000, 0x0000dad000000000,
+	0x0000dec000000000, 0x0000df7000000000, 0x0000dda000000000, 0x0000dc1000000000,
+	0x0000d58000000000, 0x0000d43000000000, 0x0000d6e000000000, 0x0000d75000000000,
+	0x0000d34000000000, 0x0000d2f000000000, 0x0000d02000000000, 0x0000d19000000000,
+	0x0000c30000000000, 0x0000c2b000000000, 0x0000c06000000000, 0x0000c1d000000000,
+	0x0000c5c000000000, 0x0000c47000000000, 0x0000c6a000000000, 0x0000c71000000000,
+	0x0000ce8000000000, 0x0000cf3000000000, 0x0000cde000000000, 0x0000cc5000000000,
+	0x0000c84000000000, 0x0000c9f000000000, 0x0000cb2000000000, 0x0000ca9000000000,
+	0x0000ee0000000000, 0x0000efb000000000, 0x0000ed6000000000, 0x0000ecd000000000,
+	0x0000e8c000000000, 0x0000e97000000000, 0x0000eba000000000, 0x0000ea1000000000,
+	0x0000e38000000000, 0x0000e23000000000, 0x0000e0e000000000, 0x0000e15000000000,
+	0x0000e54000000000, 0x0000e4f000000000, 0x0000e62000000000, 0x0000e79000000000,
+	0x0000f50000000000, 0x0000f4b000000000, 0x0000f66000000000, 0x0000f7d000000000,
+	0x0000f3c000000000, 0x0000f27000000000, 0x0000f0a000000000, 0x0000f11000000000,
+	0x0000f88000000000, 0x0000f93000000000, 0x0000fbe000000000, 0x0000fa5000000000,
+	0x0000fe4000000000, 0x0000fff000000000, 0x0000fd2000000000, 0x0000fc9000000000,
+	0x0000b40000000000, 0x0000b5b000000000, 0x0000b76000000000, 0x0000b6d000000000,
+	0x0000b2c000000000, 0x0000b37000000000, 0x0000b1a000000000, 0x0000b01000000000,
+	0x0000b98000000000, 0x0000b83000000000, 0x0000bae000000000, 0x0000bb5000000000,
+	0x0000bf4000000000, 0x0000bef000000000, 0x0000bc2000000000, 0x0000bd9000000000,
+	0x0000af0000000000, 0x0000aeb000000000, 0x0000ac6000000000, 0x0000add000000000,
+	0x0000a9c000000000, 0x0000a87000000000, 0x0000aaa000000000, 0x0000ab1000000000,
+	0x0000a28000000000, 0x0000a33000000000, 0x0000a1e000000000, 0x0000a05000000000,
+	0x0000a44000000000, 0x0000a5f000000000, 0x0000a72000000000, 0x0000a69000000000,
+	0x0000820000000000, 0x000083b000000000, 0x0000816000000000, 0x000080d000000000,
+	0x000084c000000000, 0x0000857000000000, 0x000087a000000000, 0x0000861000000000,
+	0x00008f8000000000, 0x00008e3000000000, 0x00008ce000000000, 0x00008d5000000000,
+	0x0000894000000000, 0x000088f000000000, 0x00008a2000000000, 0x00008b9000000000,
+	0x0000990000000000, 0x000098b000000000, 0x00009a6000000000, 0x00009bd000000000,
+	0x00009fc000000000, 0x00009e7000000000, 0x00009ca000000000, 0x00009d1000000000,
+	0x0000948000000000, 0x0000953000000000, 0x000097e000000000, 0x0000965000000000,
+	0x0000924000000000, 0x000093f000000000, 0x0000912000000000, 0x0000909000000000,
+	0x0000000000000000, 0x00000001b0000000, 0x0000000360000000, 0x00000002d0000000,
+	0x00000006c0000000, 0x0000000770000000, 0x00000005a0000000, 0x0000000410000000,
+	0x0000000d80000000, 0x0000000c30000000, 0x0000000ee0000000, 0x0000000f50000000,
+	0x0000000b40000000, 0x0000000af0000000, 0x0000000820000000, 0x0000000990000000,
+	0x0000001b00000000, 0x0000001ab0000000, 0x0000001860000000, 0x00000019d0000000,
+	0x0000001dc0000000, 0x0000001c70000000, 0x0000001ea0000000, 0x0000001f10000000,
+	0x0000001680000000, 0x0000001730000000, 0x00000015e0000000, 0x0000001450000000,
+	0x0000001040000000, 0x00000011f0000000, 0x0000001320000000, 0x0000001290000000,
+	0x0000003600000000, 0x00000037b0000000, 0x0000003560000000, 0x00000034d0000000,
+	0x00000030c0000000, 0x0000003170000000, 0x00000033a0000000, 0x0000003210000000,
+	0x0000003b80000000, 0x0000003a30000000, 0x00000038e0000000, 0x0000003950000000,
+	0x0000003d40000000, 0x0000003cf0000000, 0x0000003e20000000, 0x0000003f90000000,
+	0x0000002d00000000, 0x0000002cb0000000, 0x0000002e60000000, 0x0000002fd0000000,
+	0x0000002bc0000000, 0x0000002a70000000, 0x00000028a0000000, 0x0000002910000000,
+	0x0000002080000000, 0x0000002130000000, 0x00000023e0000000, 0x0000002250000000,
+	0x0000002640000000, 0x00000027f0000000, 0x0000002520000000, 0x0000002490000000,
+	0x0000006c00000000, 0x0000006db0000000, 0x0000006f60000000, 0x0000006ed0000000,
+	0x0000006ac0000000, 0x0000006b70000000, 0x00000069a0000000, 0x0000006810000000,
+	0x0000006180000000, 0x0000006030000000, 0x00000062e0000000, 0x0000006350000000,
+	0x0000006740000000, 0x00000066f0000000, 0x0000006420000000, 0x0000006590000000,
+	0x0000007700000000, 0x00000076b0000000, 0x0000007460000000, 0x00000075d0000000,
+	0x00000071c0000000, 0x0000007070000000, 0x00000072a0000000, 0x0000007310000000,
+	0x0000007a80000000, 0x0000007b30000000, 0x00000079e0000000, 0x0000007850000000,
+	0x0000007c40000000, 0x0000007df0000000, 0x0000007f20000000, 0x0000007e90000000,
+	0x0000005a00000000, 0x0000005bb0000000, 0x0000005960000000, 0x00000058d0000000,
+	0x0000005cc0000000, 0x0000005d70000000, 0x0000005fa0000000, 0x0000005e10000000,
+	0x0000005780000000, 0x0000005630000000, 0x00000054e0000000, 0x0000005550000000,
+	0x0000005140000000, 0x00000050f0000000, 0x0000005220000000, 0x0000005390000000,
+	0x0000004100000000, 0x00000040b0000000, 0x0000004260000000, 0x00000043d0000000,
+	0x00000047c0000000, 0x0000004670000000, 0x00000044a0000000, 0x0000004510000000,
+	0x0000004c80000000, 0x0000004d30000000, 0x0000004fe0000000, 0x0000004e50000000,
+	0x0000004a40000000, 0x0000004bf0000000, 0x0000004920000000, 0x0000004890000000,
+	0x000000d800000000, 0x000000d9b0000000, 0x000000db60000000, 0x000000dad0000000,
+	0x000000dec0000000, 0x000000df70000000, 0x000000dda0000000, 0x000000dc10000000,
+	0x000000d580000000, 0x000000d430000000, 0x000000d6e0000000, 0x000000d750000000,
+	0x000000d340000000, 0x000000d2f0000000, 0x000000d020000000, 0x000000d190000000,
+	0x000000c300000000, 0x000000c2b0000000, 0x000000c060000000, 0x000000c1d0000000,
+	0x000000c5c0000000, 0x000000c470000000, 0x000000c6a0000000, 0x000000c710000000,
+	0x000000ce80000000, 0x000000cf30000000, 0x000000cde0000000, 0x000000cc50000000,
+	0x000000c840000000, 0x000000c9f0000000, 0x000000cb20000000, 0x000000ca90000000,
+	0x000000ee00000000, 0x000000efb0000000, 0x000000ed60000000, 0x000000ecd0000000,
+	0x000000e8c0000000, 0x000000e970000000, 0x000000eba0000000, 0x000000ea10000000,
+	0x000000e380000000, 0x000000e230000000, 0x000000e0e0000000, 0x000000e150000000,
+	0x000000e540000000, 0x000000e4f0000000, 0x000000e620000000, 0x000000e790000000,
+	0x000000f500000000, 0x000000f4b0000000, 0x000000f660000000, 0x000000f7d0000000,
+	0x000000f3c0000000, 0x000000f270000000, 0x000000f0a0000000, 0x000000f110000000,
+	0x000000f880000000, 0x000000f930000000, 0x000000fbe0000000, 0x000000fa50000000,
+	0x000000fe40000000, 0x000000fff0000000, 0x000000fd20000000, 0x000000fc90000000,
+	0x000000b400000000, 0x000000b5b0000000, 0x000000b760000000, 0x000000b6d0000000,
+	0x000000b2c0000000, 0x000000b370000000, 0x000000b1a0000000, 0x000000b010000000,
+	0x000000b980000000, 0x000000b830000000, 0x000000bae0000000, 0x000000bb50000000,
+	0x000000bf40000000, 0x000000bef0000000, 0x000000bc20000000, 0x000000bd90000000,
+	0x000000af00000000, 0x000000aeb0000000, 0x000000ac60000000, 0x000000add0000000,
+	0x000000a9c0000000, 0x000000a870000000, 0x000000aaa0000000, 0x000000ab10000000,
+	0x000000a280000000, 0x000000a330000000, 0x000000a1e0000000, 0x000000a050000000,
+	0x000000a440000000, 0x000000a5f0000000, 0x000000a720000000, 0x000000a690000000,
+	0x0000008200000000, 0x00000083b0000000, 0x0000008160000000, 0x00000080d0000000,
+	0x00000084c0000000, 0x0000008570000000, 0x00000087a0000000, 0x0000008610000000,
+	0x0000008f80000000, 0x0000008e30000000, 0x0000008ce0000000, 0x0000008d50000000,
+	0x0000008940000000, 0x00000088f0000000, 0x0000008a20000000, 0x0000008b90000000,
+	0x0000009900000000, 0x00000098b0000000, 0x0000009a60000000, 0x0000009bd0000000,
+	0x0000009fc0000000, 0x0000009e70000000, 0x0000009ca0000000, 0x0000009d10000000,
+	0x0000009480000000, 0x0000009530000000, 0x00000097e0000000, 0x0000009650000000,
+	0x0000009240000000, 0x00000093f0000000, 0x0000009120000000, 0x0000009090000000,
+	0x0000000000000000, 0x0000000001b00000, 0x0000000003600000, 0x0000000002d00000,
+	0x0000000006c00000, 0x0000000007700000, 0x0000000005a00000, 0x0000000004100000,
+	0x000000000d800000, 0x000000000c300000, 0x000000000ee00000, 0x000000000f500000,
+	0x000000000b400000, 0x000000000af00000, 0x0000000008200000, 0x0000000009900000,
+	0x000000001b000000, 0x000000001ab00000, 0x0000000018600000, 0x0000000019d00000,
+	0x000000001dc00000, 0x000000001c700000, 0x000000001ea00000, 0x000000001f100000,
+	0x0000000016800000, 0x0000000017300000, 0x0000000015e00000, 0x0000000014500000,
+	0x0000000010400000, 0x0000000011f00000, 0x0000000013200000, 0x0000000012900000,
+	0x0000000036000000, 0x0000000037b00000, 0x0000000035600000, 0x0000000034d00000,
+	0x0000000030c00000, 0x0000000031700000, 0x0000000033a00000, 0x0000000032100000,
+	0x000000003b800000, 0x000000003a300000, 0x0000000038e00000, 0x0000000039500000,
+	0x000000003d400000, 0x000000003cf00000, 0x000000003e200000, 0x000000003f900000,
+	0x000000002d000000, 0x000000002cb00000, 0x000000002e600000, 0x000000002fd00000,
+	0x000000002bc00000, 0x000000002a700000, 0x0000000028a00000, 0x0000000029100000,
+	0x0000000020800000, 0x0000000021300000, 0x0000000023e00000, 0x0000000022500000,
+	0x0000000026400000, 0x0000000027f00000, 0x0000000025200000, 0x0000000024900000,
+	0x000000006c000000, 0x000000006db00000, 0x000000006f600000, 0x000000006ed00000,
+	0x000000006ac00000, 0x000000006b700000, 0x0000000069a00000, 0x0000000068100000,
+	0x0000000061800000, 0x0000000060300000, 0x0000000062e00000, 0x0000000063500000,
+	0x0000000067400000, 0x0000000066f00000, 0x0000000064200000, 0x0000000065900000,
+	0x0000000077000000, 0x0000000076b00000, 0x0000000074600000, 0x0000000075d00000,
+	0x0000000071c00000, 0x0000000070700000, 0x0000000072a00000, 0x0000000073100000,
+	0x000000007a800000, 0x000000007b300000, 0x0000000079e00000, 0x0000000078500000,
+	0x000000007c400000, 0x000000007df00000, 0x000000007f200000, 0x000000007e900000,
+	0x000000005a000000, 0x000000005bb00000, 0x0000000059600000, 0x0000000058d00000,
+	0x000000005cc00000, 0x000000005d700000, 0x000000005fa00000, 0x000000005e100000,
+	0x0000000057800000, 0x0000000056300000, 0x0000000054e00000, 0x0000000055500000,
+	0x0000000051400000, 0x0000000050f00000, 0x0000000052200000, 0x0000000053900000,
+	0x0000000041000000, 0x0000000040b00000, 0x0000000042600000, 0x0000000043d00000,
+	0x0000000047c00000, 0x0000000046700000, 0x0000000044a00000, 0x0000000045100000,
+	0x000000004c800000, 0x000000004d300000, 0x000000004fe00000, 0x000000004e500000,
+	0x000000004a400000, 0x000000004bf00000, 0x0000000049200000, 0x0000000048900000,
+	0x00000000d8000000, 0x00000000d9b00000, 0x00000000db600000, 0x00000000dad00000,
+	0x00000000dec00000, 0x00000000df700000, 0x00000000dda00000, 0x00000000dc100000,
+	0x00000000d5800000, 0x00000000d4300000, 0x00000000d6e00000, 0x00000000d7500000,
+	0x00000000d3400000, 0x00000000d2f00000, 0x00000000d0200000, 0x00000000d1900000,
+	0x00000000c3000000, 0x00000000c2b00000, 0x00000000c0600000, 0x00000000c1d00000,
+	0x00000000c5c00000, 0x00000000c4700000, 0x00000000c6a00000, 0x00000000c7100000,
+	0x00000000ce800000, 0x00000000cf300000, 0x00000000cde00000, 0x00000000cc500000,
+	0x00000000c8400000, 0x00000000c9f00000, 0x00000000cb200000, 0x00000000ca900000,
+	0x00000000ee000000, 0x00000000efb00000, 0x00000000ed600000, 0x00000000ecd00000,
+	0x00000000e8c00000, 0x00000000e9700000, 0x00000000eba00000, 0x00000000ea100000,
+	0x00000000e3800000, 0x00000000e2300000, 0x00000000e0e00000, 0x00000000e1500000,
+	0x00000000e5400000, 0x00000000e4f00000, 0x00000000e6200000, 0x00000000e7900000,
+	0x00000000f5000000, 0x00000000f4b00000, 0x00000000f6600000, 0x00000000f7d00000,
+	0x00000000f3c00000, 0x00000000f2700000, 0x00000000f0a00000, 0x00000000f1100000,
+	0x00000000f8800000, 0x00000000f9300000, 0x00000000fbe00000, 0x00000000fa500000,
+	0x00000000fe400000, 0x00000000fff00000, 0x00000000fd200000, 0x00000000fc900000,
+	0x00000000b4000000, 0x00000000b5b00000, 0x00000000b7600000, 0x00000000b6d00000,
+	0x00000000b2c00000, 0x00000000b3700000, 0x00000000b1a00000, 0x00000000b0100000,
+	0x00000000b9800000, 0x00000000b8300000, 0x00000000bae00000, 0x00000000bb500000,
+	0x00000000bf400000, 0x00000000bef00000, 0x00000000bc200000, 0x00000000bd900000,
+	0x00000000af000000, 0x00000000aeb00000, 0x00000000ac600000, 0x00000000add00000,
+	0x00000000a9c00000, 0x00000000a8700000, 0x00000000aaa00000, 0x00000000ab100000,
+	0x00000000a2800000, 0x00000000a3300000, 0x00000000a1e00000, 0x00000000a0500000,
+	0x00000000a4400000, 0x00000000a5f00000, 0x00000000a7200000, 0x00000000a6900000,
+	0x0000000082000000, 0x0000000083b00000, 0x0000000081600000, 0x0000000080d00000,
+	0x0000000084c00000, 0x0000000085700000, 0x0000000087a00000, 0x0000000086100000,
+	0x000000008f800000, 0x000000008e300000, 0x000000008ce00000, 0x000000008d500000,
+	0x0000000089400000, 0x0000000088f00000, 0x000000008a200000, 0x000000008b900000,
+	0x0000000099000000, 0x0000000098b00000, 0x000000009a600000, 0x000000009bd00000,
+	0x000000009fc00000, 0x000000009e700000, 0x000000009ca00000, 0x000000009d100000,
+	0x0000000094800000, 0x0000000095300000, 0x0000000097e00000, 0x0000000096500000,
+	0x0000000092400000, 0x0000000093f00000, 0x0000000091200000, 0x0000000090900000,
+	0x0000000000000000, 0x000000000001b000, 0x0000000000036000, 0x000000000002d000,
+	0x000000000006c000, 0x0000000000077000, 0x000000000005a000, 0x0000000000041000,
+	0x00000000000d8000, 0x00000000000c3000, 0x00000000000ee000, 0x00000000000f5000,
+	0x00000000000b4000, 0x00000000000af000, 0x0000000000082000, 0x0000000000099000,
+	0x00000000001b0000, 0x00000000001ab000, 0x0000000000186000, 0x000000000019d000,
+	0x00000000001dc000, 0x00000000001c7000, 0x00000000001ea000, 0x00000000001f1000,
+	0x0000000000168000, 0x0000000000173000, 0x000000000015e000, 0x0000000000145000,
+	0x0000000000104000, 0x000000000011f000, 0x0000000000132000, 0x0000000000129000,
+	0x0000000000360000, 0x000000000037b000, 0x0000000000356000, 0x000000000034d000,
+	0x000000000030c000, 0x0000000000317000, 0x000000000033a000, 0x0000000000321000,
+	0x00000000003b8000, 0x00000000003a3000, 0x000000000038e000, 0x0000000000395000,
+	0x00000000003d4000, 0x00000000003cf000, 0x00000000003e2000, 0x00000000003f9000,
+	0x00000000002d0000, 0x00000000002cb000, 0x00000000002e6000, 0x00000000002fd000,
+	0x00000000002bc000, 0x00000000002a7000, 0x000000000028a000, 0x0000000000291000,
+	0x0000000000208000, 0x0000000000213000, 0x000000000023e000, 0x0000000000225000,
+	0x0000000000264000, 0x000000000027f000, 0x0000000000252000, 0x0000000000249000,
+	0x00000000006c0000, 0x00000000006db000, 0x00000000006f6000, 0x00000000006ed000,
+	0x00000000006ac000, 0x00000000006b7000, 0x000000000069a000, 0x0000000000681000,
+	0x0000000000618000, 0x0000000000603000, 0x000000000062e000, 0x0000000000635000,
+	0x0000000000674000, 0x000000000066f000, 0x0000000000642000, 0x0000000000659000,
+	0x0000000000770000, 0x000000000076b000, 0x0000000000746000, 0x000000000075d000,
+	0x000000000071c000, 0x0000000000707000, 0x000000000072a000, 0x0000000000731000,
+	0x00000000007a8000, 0x00000000007b3000, 0x000000000079e000, 0x0000000000785000,
+	0x00000000007c4000, 0x00000000007df000, 0x00000000007f2000, 0x00000000007e9000,
+	0x00000000005a0000, 0x00000000005bb000, 0x0000000000596000, 0x000000000058d000,
+	0x00000000005cc000, 0x00000000005d7000, 0x00000000005fa000, 0x00000000005e1000,
+	0x0000000000578000, 0x0000000000563000, 0x000000000054e000, 0x0000000000555000,
+	0x0000000000514000, 0x000000000050f000, 0x0000000000522000, 0x0000000000539000,
+	0x0000000000410000, 0x000000000040b000, 0x0000000000426000, 0x000000000043d000,
+	0x000000000047c000, 0x0000000000467000, 0x000000000044a000, 0x0000000000451000,
+	0x00000000004c8000, 0x00000000004d3000, 0x00000000004fe000, 0x00000000004e5000,
+	0x00000000004a4000, 0x00000000004bf000, 0x0000000000492000, 0x0000000000489000,
+	0x0000000000d80000, 0x0000000000d9b000, 0x0000000000db6000, 0x0000000000dad000,
+	0x0000000000dec000, 0x0000000000df7000, 0x0000000000dda000, 0x0000000000dc1000,
+	0x0000000000d58000, 0x0000000000d43000, 0x0000000000d6e000, 0x0000000000d75000,
+	0x0000000000d34000, 0x0000000000d2f000, 0x0000000000d02000, 0x0000000000d19000,
+	0x0000000000c30000, 0x0000000000c2b000, 0x0000000000c06000, 0x0000000000c1d000,
+	0x0000000000c5c000, 0x0000000000c47000, 0x0000000000c6a000, 0x0000000000c71000,
+	0x0000000000ce8000, 0x0000000000cf3000, 0x0000000000cde000, 0x0000000000cc5000,
+	0x0000000000c84000, 0x0000000000c9f000, 0x0000000000cb2000, 0x0000000000ca9000,
+	0x0000000000ee0000, 0x0000000000efb000, 0x0000000000ed6000, 0x0000000000ecd000,
+	0x0000000000e8c000, 0x0000000000e97000, 0x0000000000eba000, 0x0000000000ea1000,
+	0x0000000000e38000, 0x0000000000e23000, 0x0000000000e0e000, 0x0000000000e15000,
+	0x0000000000e54000, 0x0000000000e4f000, 0x0000000000e62000, 0x0000000000e79000,
+	0x0000000000f50000, 0x0000000000f4b000, 0x0000000000f66000, 0x0000000000f7d000,
+	0x0000000000f3c000, 0x0000000000f27000, 0x0000000000f0a000, 0x0000000000f11000,
+	0x0000000000f88000, 0x0000000000f93000, 0x0000000000fbe000, 0x0000000000fa5000,
+	0x0000000000fe4000, 0x0000000000fff000, 0x0000000000fd2000, 0x0000000000fc9000,
+	0x0000000000b40000, 0x0000000000b5b000, 0x0000000000b76000, 0x0000000000b6d000,
+	0x0000000000b2c000, 0x0000000000b37000, 0x0000000000b1a000, 0x0000000000b01000,
+	0x0000000000b98000, 0x0000000000b83000, 0x0000000000bae000, 0x0000000000bb5000,
+	0x0000000000bf4000, 0x0000000000bef000, 0x0000000000bc2000, 0x0000000000bd9000,
+	0x0000000000af0000, 0x0000000000aeb000, 0x0000000000ac6000, 0x0000000000add000,
+	0x0000000000a9c000, 0x0000000000a87000, 0x0000000000aaa000, 0x0000000000ab1000,
+	0x0000000000a28000, 0x0000000000a33000, 0x0000000000a1e000, 0x0000000000a05000,
+	0x0000000000a44000, 0x0000000000a5f000, 0x0000000000a72000, 0x0000000000a69000,
+	0x0000000000820000, 0x000000000083b000, 0x0000000000816000, 0x000000000080d000,
+	0x000000000084c000, 0x0000000000857000, 0x000000000087a000, 0x0000000000861000,
+	0x00000000008f8000, 0x00000000008e3000, 0x00000000008ce000, 0x00000000008d5000,
+	0x0000000000894000, 0x000000000088f000, 0x00000000008a2000, 0x00000000008b9000,
+	0x0000000000990000, 0x000000000098b000, 0x00000000009a6000, 0x00000000009bd000,
+	0x00000000009fc000, 0x00000000009e7000, 0x00000000009ca000, 0x00000000009d1000,
+	0x0000000000948000, 0x0000000000953000, 0x000000000097e000, 0x0000000000965000,
+	0x0000000000924000, 0x000000000093f000, 0x0000000000912000, 0x0000000000909000,
+	0x0000000000000000, 0x00000000000001b0, 0x0000000000000360, 0x00000000000002d0,
+	0x00000000000006c0, 0x0000000000000770, 0x00000000000005a0, 0x0000000000000410,
+	0x0000000000000d80, 0x0000000000000c30, 0x0000000000000ee0, 0x0000000000000f50,
+	0x0000000000000b40, 0x0000000000000af0, 0x0000000000000820, 0x0000000000000990,
+	0x0000000000001b00, 0x0000000000001ab0, 0x0000000000001860, 0x00000000000019d0,
+	0x0000000000001dc0, 0x0000000000001c70, 0x0000000000001ea0, 0x0000000000001f10,
+	0x0000000000001680, 0x0000000000001730, 0x00000000000015e0, 0x0000000000001450,
+	0x0000000000001040, 0x00000000000011f0, 0x0000000000001320, 0x0000000000001290,
+	0x0000000000003600, 0x00000000000037b0, 0x0000000000003560, 0x00000000000034d0,
+	0x00000000000030c0, 0x0000000000003170, 0x00000000000033a0, 0x0000000000003210,
+	0x0000000000003b80, 0x0000000000003a30, 0x00000000000038e0, 0x0000000000003950,
+	0x0000000000003d40, 0x0000000000003cf0, 0x0000000000003e20, 0x0000000000003f90,
+	0x0000000000002d00, 0x0000000000002cb0, 0x0000000000002e60, 0x0000000000002fd0,
+	0x0000000000002bc0, 0x0000000000002a70, 0x00000000000028a0, 0x0000000000002910,
+	0x0000000000002080, 0x0000000000002130, 0x00000000000023e0, 0x0000000000002250,
+	0x0000000000002640, 0x00000000000027f0, 0x0000000000002520, 0x0000000000002490,
+	0x0000000000006c00, 0x0000000000006db0, 0x0000000000006f60, 0x0000000000006ed0,
+	0x0000000000006ac0, 0x0000000000006b70, 0x00000000000069a0, 0x0000000000006810,
+	0x0000000000006180, 0x0000000000006030, 0x00000000000062e0, 0x0000000000006350,
+	0x0000000000006740, 0x00000000000066f0, 0x0000000000006420, 0x0000000000006590,
+	0x0000000000007700, 0x00000000000076b0, 0x0000000000007460, 0x00000000000075d0,
+	0x00000000000071c0, 0x0000000000007070, 0x00000000000072a0, 0x0000000000007310,
+	0x0000000000007a80, 0x0000000000007b30, 0x00000000000079e0, 0x0000000000007850,
+	0x0000000000007c40, 0x0000000000007df0, 0x0000000000007f20, 0x0000000000007e90,
+	0x0000000000005a00, 0x0000000000005bb0, 0x0000000000005960, 0x00000000000058d0,
+	0x0000000000005cc0, 0x0000000000005d70, 0x0000000000005fa0, 0x0000000000005e10,
+	0x0000000000005780, 0x0000000000005630, 0x00000000000054e0, 0x0000000000005550,
+	0x0000000000005140, 0x00000000000050f0, 0x0000000000005220, 0x0000000000005390,
+	0x0000000000004100, 0x00000000000040b0, 0x0000000000004260, 0x00000000000043d0,
+	0x00000000000047c0, 0x0000000000004670, 0x00000000000044a0, 0x0000000000004510,
+	0x0000000000004c80, 0x0000000000004d30, 0x0000000000004fe0, 0x0000000000004e50,
+	0x0000000000004a40, 0x0000000000004bf0, 0x0000000000004920, 0x0000000000004890,
+	0x000000000000d800, 0x000000000000d9b0, 0x000000000000db60, 0x000000000000dad0,
+	0x000000000000dec0, 0x000000000000df70, 0x000000000000dda0, 0x000000000000dc10,
+	0x000000000000d580, 0x000000000000d430, 0x000000000000d6e0, 0x000000000000d750,
+	0x000000000000d340, 0x000000000000d2f0, 0x000000000000d020, 0x000000000000d190,
+	0x000000000000c300, 0x000000000000c2b0, 0x000000000000c060, 0x000000000000c1d0,
+	0x000000000000c5c0, 0x000000000000c470, 0x000000000000c6a0, 0x000000000000c710,
+	0x000000000000ce80, 0x000000000000cf30, 0x000000000000cde0, 0x000000000000cc50,
+	0x000000000000c840, 0x000000000000c9f0, 0x000000000000cb20, 0x000000000000ca90,
+	0x000000000000ee00, 0x000000000000efb0, 0x000000000000ed60, 0x000000000000ecd0,
+	0x000000000000e8c0, 0x000000000000e970, 0x000000000000eba0, 0x000000000000ea10,
+	0x000000000000e380, 0x000000000000e230, 0x000000000000e0e0, 0x000000000000e150,
+	0x000000000000e540, 0x000000000000e4f0, 0x000000000000e620, 0x000000000000e790,
+	0x000000000000f500, 0x000000000000f4b0, 0x000000000000f660, 0x000000000000f7d0,
+	0x000000000000f3c0, 0x000000000000f270, 0x000000000000f0a0, 0x000000000000f110,
+	0x000000000000f880, 0x000000000000f930, 0x000000000000fbe0, 0x000000000000fa50,
+	0x000000000000fe40, 0x000000000000fff0, 0x000000000000fd20, 0x000000000000fc90,
+	0x000000000000b400, 0x000000000000b5b0, 0x000000000000b760, 0x000000000000b6d0,
+	0x000000000000b2c0, 0x000000000000b370, 0x000000000000b1a0, 0x000000000000b010,
+	0x000000000000b980, 0x000000000000b830, 0x000000000000bae0, 0x000000000000bb50,
+	0x000000000000bf40, 0x000000000000bef0, 0x000000000000bc20, 0x000000000000bd90,
+	0x000000000000af00, 0x000000000000aeb0, 0x000000000000ac60, 0x000000000000add0,
+	0x000000000000a9c0, 0x000000000000a870, 0x000000000000aaa0, 0x000000000000ab10,
+	0x000000000000a280, 0x000000000000a330, 0x000000000000a1e0, 0x000000000000a050,
+	0x000000000000a440, 0x000000000000a5f0, 0x000000000000a720, 0x000000000000a690,
+	0x0000000000008200, 0x00000000000083b0, 0x0000000000008160, 0x00000000000080d0,
+	0x00000000000084c0, 0x0000000000008570, 0x00000000000087a0, 0x0000000000008610,
+	0x0000000000008f80, 0x0000000000008e30, 0x0000000000008ce0, 0x0000000000008d50,
+	0x0000000000008940, 0x00000000000088f0, 0x0000000000008a20, 0x0000000000008b90,
+	0x0000000000009900, 0x00000000000098b0, 0x0000000000009a60, 0x0000000000009bd0,
+	0x0000000000009fc0, 0x0000000000009e70, 0x0000000000009ca0, 0x0000000000009d10,
+	0x0000000000009480, 0x0000000000009530, 0x00000000000097e0, 0x0000000000009650,
+	0x0000000000009240, 0x00000000000093f0, 0x0000000000009120, 0x0000000000009090,
+	0x0000000000000000, 0xf500000000000001, 0x5a00000000000003, 0xaf00000000000002,
+	0xb400000000000006, 0x4100000000000007, 0xee00000000000005, 0x1b00000000000004,
+	0xd80000000000000d, 0x2d0000000000000c, 0x820000000000000e, 0x770000000000000f,
+	0x6c0000000000000b, 0x990000000000000a, 0x3600000000000008, 0xc300000000000009,
+	0x000000000000001b, 0xf50000000000001a, 0x5a00000000000018, 0xaf00000000000019,
+	0xb40000000000001d, 0x410000000000001c, 0xee0000000000001e, 0x1b0000000000001f,
+	0xd800000000000016, 0x2d00000000000017, 0x8200000000000015, 0x7700000000000014,
+	0x6c00000000000010, 0x9900000000000011, 0x3600000000000013, 0xc300000000000012,
+	0x0000000000000036, 0xf500000000000037, 0x5a00000000000035, 0xaf00000000000034,
+	0xb400000000000030, 0x4100000000000031, 0xee00000000000033, 0x1b00000000000032,
+	0xd80000000000003b, 0x2d0000000000003a, 0x8200000000000038, 0x7700000000000039,
+	0x6c0000000000003d, 0x990000000000003c, 0x360000000000003e, 0xc30000000000003f,
+	0x000000000000002d, 0xf50000000000002c, 0x5a0000000000002e, 0xaf0000000000002f,
+	0xb40000000000002b, 0x410000000000002a, 0xee00000000000028, 0x1b00000000000029,
+	0xd800000000000020, 0x2d00000000000021, 0x8200000000000023, 0x7700000000000022,
+	0x6c00000000000026, 0x9900000000000027, 0x3600000000000025, 0xc300000000000024,
+	0x000000000000006c, 0xf50000000000006d, 0x5a0000000000006f, 0xaf0000000000006e,
+	0xb40000000000006a, 0x410000000000006b, 0xee00000000000069, 0x1b00000000000068,
+	0xd800000000000061, 0x2d00000000000060, 0x8200000000000062, 0x7700000000000063,
+	0x6c00000000000067, 0x9900000000000066, 0x3600000000000064, 0xc300000000000065,
+	0x0000000000000077, 0xf500000000000076, 0x5a00000000000074, 0xaf00000000000075,
+	0xb400000000000071, 0x4100000000000070, 0xee00000000000072, 0x1b00000000000073,
+	0xd80000000000007a, 0x2d0000000000007b, 0x8200000000000079, 0x7700000000000078,
+	0x6c0000000000007c, 0x990000000000007d, 0x360000000000007f, 0xc30000000000007e,
+	0x000000000000005a, 0xf50000000000005b, 0x5a00000000000059, 0xaf00000000000058,
+	0xb40000000000005c, 0x410000000000005d, 0xee0000000000005f, 0x1b0000000000005e,
+	0xd800000000000057, 0x2d00000000000056, 0x8200000000000054, 0x7700000000000055,
+	0x6c00000000000051, 0x9900000000000050, 0x3600000000000052, 0xc300000000000053,
+	0x0000000000000041, 0xf500000000000040, 0x5a00000000000042, 0xaf00000000000043,
+	0xb400000000000047, 0x4100000000000046, 0xee00000000000044, 0x1b00000000000045,
+	0xd80000000000004c, 0x2d0000000000004d, 0x820000000000004f, 0x770000000000004e,
+	0x6c0000000000004a, 0x990000000000004b, 0x3600000000000049, 0xc300000000000048,
+	0x00000000000000d8, 0xf5000000000000d9, 0x5a000000000000db, 0xaf000000000000da,
+	0xb4000000000000de, 0x41000000000000df, 0xee000000000000dd, 0x1b000000000000dc,
+	0xd8000000000000d5, 0x2d000000000000d4, 0x82000000000000d6, 0x77000000000000d7,
+	0x6c000000000000d3, 0x99000000000000d2, 0x36000000000000d0, 0xc3000000000000d1,
+	0x00000000000000c3, 0xf5000000000000c2, 0x5a000000000000c0, 0xaf000000000000c1,
+	0xb4000000000000c5, 0x41000000000000c4, 0xee000000000000c6, 0x1b000000000000c7,
+	0xd8000000000000ce, 0x2d000000000000cf, 0x82000000000000cd, 0x77000000000000cc,
+	0x6c000000000000c8, 0x99000000000000c9, 0x36000000000000cb, 0xc3000000000000ca,
+	0x00000000000000ee, 0xf5000000000000ef, 0x5a000000000000ed, 0xaf000000000000ec,
+	0xb4000000000000e8, 0x41000000000000e9, 0xee000000000000eb, 0x1b000000000000ea,
+	0xd8000000000000e3, 0x2d000000000000e2, 0x82000000000000e0, 0x77000000000000e1,
+	0x6c000000000000e5, 0x99000000000000e4, 0x36000000000000e6, 0xc3000000000000e7,
+	0x00000000000000f5, 0xf5000000000000f4, 0x5a000000000000f6, 0xaf000000000000f7,
+	0xb4000000000000f3, 0x41000000000000f2, 0xee000000000000f0, 0x1b000000000000f1,
+	0xd8000000000000f8, 0x2d000000000000f9, 0x82000000000000fb, 0x77000000000000fa,
+	0x6c000000000000fe, 0x99000000000000ff, 0x36000000000000fd, 0xc3000000000000fc,
+	0x00000000000000b4, 0xf5000000000000b5, 0x5a000000000000b7, 0xaf000000000000b6,
+	0xb4000000000000b2, 0x41000000000000b3, 0xee000000000000b1, 0x1b000000000000b0,
+	0xd8000000000000b9, 0x2d000000000000b8, 0x82000000000000ba, 0x77000000000000bb,
+	0x6c000000000000bf, 0x99000000000000be, 0x36000000000000bc, 0xc3000000000000bd,
+	0x00000000000000af, 0xf5000000000000ae, 0x5a000000000000ac, 0xaf000000000000ad,
+	0xb4000000000000a9, 0x41000000000000a8, 0xee000000000000aa, 0x1b000000000000ab,
+	0xd8000000000000a2, 0x2d000000000000a3, 0x82000000000000a1, 0x77000000000000a0,
+	0x6c000000000000a4, 0x99000000000000a5, 0x36000000000000a7, 0xc3000000000000a6,
+	0x0000000000000082, 0xf500000000000083, 0x5a00000000000081, 0xaf00000000000080,
+	0xb400000000000084, 0x4100000000000085, 0xee00000000000087, 0x1b00000000000086,
+	0xd80000000000008f, 0x2d0000000000008e, 0x820000000000008c, 0x770000000000008d,
+	0x6c00000000000089, 0x9900000000000088, 0x360000000000008a, 0xc30000000000008b,
+	0x0000000000000099, 0xf500000000000098, 0x5a0000000000009a, 0xaf0000000000009b,
+	0xb40000000000009f, 0x410000000000009e, 0xee0000000000009c, 0x1b0000000000009d,
+	0xd800000000000094, 0x2d00000000000095, 0x8200000000000097, 0x7700000000000096,
+	0x6c00000000000092, 0x9900000000000093, 0x3600000000000091, 0xc300000000000090
+};
+
+const uint64_t crc_table_nvme[256] CRC_TABLE_ALIGN PROGMEM = {
+	0x0000000000000000, 0x7f6ef0c830358979, 0xfedde190606b12f2, 0x81b31158505e9b8b,
+	0xc962e5739841b68f, 0xb60c15bba8743ff6, 0x37bf04e3f82aa47d, 0x48d1f42bc81f2d04,
+	0xa61cecb46814fe75, 0xd9721c7c5821770c, 0x58c10d24087fec87, 0x27affdec384a65fe,
+	0x6f7e09c7f05548fa, 0x1010f90fc060c183, 0x91a3e857903e5a08, 0xeecd189fa00bd371,
+	0x78e0ff3b88be6f81, 0x078e0ff3b88be6f8, 0x863d1eabe8d57d73, 0xf953ee63d8e0f40a,
+	0xb1821a4810ffd90e, 0xceecea8020ca5077, 0x4f5ffbd87094cbfc, 0x30310b1040a14285,
+	0xdefc138fe0aa91f4, 0xa192e347d09f188d, 0x2021f21f80c18306, 0x5f4f02d7b0f40a7f,
+	0x179ef6fc78eb277b, 0x68f0063448deae02, 0xe943176c18803589, 0x962de7a428b5bcf0,
+	0xf1c1fe77117cdf02, 0x8eaf0ebf2149567b, 0x0f1c1fe77117cdf0, 0x7072ef2f41224489,
+	0x38a31b04893d698d, 0x47cdebccb908e0f4, 0xc67efa94e9567b7f, 0xb9100a5cd963f206,
+	0x57dd12c379682177, 0x28b3e20b495da80e, 0xa900f35319033385, 0xd66e039b2936bafc,
+	0x9ebff7b0e12997f8, 0xe1d10778d11c1e81, 0x606216208142850a, 0x1f0ce6e8b1770c73,
+	0x8921014c99c2b083, 0xf64ff184a9f739fa, 0x77fce0dcf9a9a271, 0x08921014c99c2b08,
+	0x4043e43f0183060c, 0x3f2d14f731b68f75, 0xbe9e05af61e814fe, 0xc1f0f56751dd9d87,
+	0x2f3dedf8f1d64ef6, 0x50531d30c1e3c78f, 0xd1e00c6891bd5c04, 0xae8efca0a188d57d,
+	0xe65f088b6997f879, 0x9931f84359a27100, 0x1882e91b09fcea8b, 0x67ec19d339c963f2,
+	0xd75adabd7a6e2d6f, 0xa8342a754a5ba416, 0x29873b2d1a053f9d, 0x56e9cbe52a30b6e4,
+	0x1e383fcee22f9be0, 0x6156cf06d21a1299, 0xe0e5de5e82448912, 0x9f8b2e96b271006b,
+	0x71463609127ad31a, 0x0e28c6c1224f5a63, 0x8f9bd7997211c1e8, 0xf0f5275142244891,
+	0xb824d37a8a3b6595, 0xc74a23b2ba0eecec, 0x46f932eaea507767, 0x3997c222da65fe1e,
+	0xafba2586f2d042ee, 0xd0d4d54ec2e5cb97, 0x5167c41692bb501c, 0x2e0934dea28ed965,
+	0x66d8c0f56a91f461, 0x19b6303d5aa47d18, 0x980521650afae693, 0xe76bd1ad3acf6fea,
+	0x09a6c9329ac4bc9b, 0x76c839faaaf135e2, 0xf77b28a2faafae69, 0x8815d86aca9a2710,
+	0xc0c42c4102850a14, 0xbfaadc8932b0836d, 0x3e19cdd162ee18e6, 0x41773d1952db919f,
+	0x269b24ca6b12f26d, 0x59f5d4025b277b14, 0xd846c55a0b79e09f, 0xa72835923b4c69e6,
+	0xeff9c1b9f35344e2, 0x90973171c366cd9b, 0x1124202993385610, 0x6e4ad0e1a30ddf69,
+	0x8087c87e03060c18, 0xffe938b633338561, 0x7e5a29ee636d1eea, 0x0134d92653589793,
+	0x49e52d0d9b47ba97, 0x368bddc5ab7233ee, 0xb738cc9dfb2ca865, 0xc8563c55cb19211c,
+	0x5e7bdbf1e3ac9dec, 0x21152b39d3991495, 0xa0a63a6183c78f1e, 0xdfc8caa9b3f20667,
+	0x97193e827bed2b63, 0xe877ce4a4bd8a21a, 0x69c4df121b863991, 0x16aa2fda2bb3b0e8,
+	0xf86737458bb86399, 0x8709c78dbb8deae0, 0x06bad6d5ebd3716b, 0x79d4261ddbe6f812,
+	0x3105d23613f9d516, 0x4e6b22fe23cc5c6f, 0xcfd833a67392c7e4, 0xb0b6c36e43a74e9d,
+	0x9a6c9329ac4bc9b5, 0xe50263e19c7e40cc, 0x64b172b9cc20db47, 0x1bdf8271fc15523e,
+	0x530e765a340a7f3a, 0x2c608692043ff643, 0xadd397ca54616dc8, 0xd2bd67026454e4b1,
+	0x3c707f9dc45f37c0, 0x431e8f55f46abeb9, 0xc2ad9e0da4342532, 0xbdc36ec59401ac4b,
+	0xf5129aee5c1e814f, 0x8a7c6a266c2b0836, 0x0bcf7b7e3c7593bd, 0x74a18bb60c401ac4,
+	0xe28c6c1224f5a634, 0x9de29cda14c02f4d, 0x1c518d82449eb4c6, 0x633f7d4a74ab3dbf,
+	0x2bee8961bcb410bb, 0x548079a98c8199c2, 0xd53368f1dcdf0249, 0xaa5d9839ecea8b30,
+	0x449080a64ce15841, 0x3bfe706e7cd4d138, 0xba4d61362c8a4ab3, 0xc52391fe1cbfc3ca,
+	0x8df265d5d4a0eece, 0xf29c951de49567b7, 0x732f8445b4cbfc3c, 0x0c41748d84fe7545,
+	0x6bad6d5ebd3716b7, 0x14c39d968d029fce, 0x95708ccedd5c0445, 0xea1e7c06ed698d3c,
+	0xa2cf882d2576a038, 0xdda178e515432941, 0x5c1269bd451db2ca, 0x237c997575283bb3,
+	0xcdb181ead523e8c2, 0xb2df7122e51661bb, 0x336c607ab548fa30, 0x4c0290b2857d7349,
+	0x04d364994d625e4d, 0x7bbd94517d57d734, 0xfa0e85092d094cbf, 0x856075c11d3cc5c6,
+	0x134d926535897936, 0x6c2362ad05bcf04f, 0xed9073f555e26bc4, 0x92fe833d65d7e2bd,
+	0xda2f7716adc8cfb9, 0xa54187de9dfd46c0, 0x24f29686cda3dd4b, 0x5b9c664efd965432,
+	0xb5517ed15d9d8743, 0xca3f8e196da80e3a, 0x4b8c9f413df695b1, 0x34e26f890dc31cc8,
+	0x7c339ba2c5dc31cc, 0x035d6b6af5e9b8b5, 0x82ee7a32a5b7233e, 0xfd808afa9582aa47,
+	0x4d364994d625e4da, 0x3258b95ce6106da3, 0xb3eba804b64ef628, 0xcc8558cc867b7f51,
+	0x8454ace74e645255, 0xfb3a5c2f7e51db2c, 0x7a894d772e0f40a7, 0x05e7bdbf1e3ac9de,
+	0xeb2aa520be311aaf, 0x944455e88e0493d6, 0x15f744b0de5a085d, 0x6a99b478ee6f8124,
+	0x224840532670ac20, 0x5d26b09b16452559, 0xdc95a1c3461bbed2, 0xa3fb510b762e37ab,
+	0x35d6b6af5e9b8b5b, 0x4ab846676eae0222, 0xcb0b573f3ef099a9, 0xb465a7f70ec510d0,
+	0xfcb453dcc6da3dd4, 0x83daa314f6efb4ad, 0x0269b24ca6b12f26, 0x7d0742849684a65f,
+	0x93ca5a1b368f752e, 0xeca4aad306bafc57, 0x6d17bb8b56e467dc, 0x12794b4366d1eea5,
+	0x5aa8bf68aecec3a1, 0x25c64fa09efb4ad8, 0xa4755ef8cea5d153, 0xdb1bae30fe90582a,
+	0xbcf7b7e3c7593bd8, 0xc399472bf76cb2a1, 0x422a5673a732292a, 0x3d44a6bb9707a053,
+	0x759552905f188d57, 0x0afba2586f2d042e, 0x8b48b3003f739fa5, 0xf42643c80f4616dc,
+	0x1aeb5b57af4dc5ad, 0x6585ab9f9f784cd4, 0xe436bac7cf26d75f, 0x9b584a0fff135e26,
+	0xd389be24370c7322, 0xace74eec0739fa5b, 0x2d545fb4576761d0, 0x523aaf7c6752e8a9,
+	0xc41748d84fe75459, 0xbb79b8107fd2dd20, 0x3acaa9482f8c46ab, 0x45a459801fb9cfd2,
+	0x0d75adabd7a6e2d6, 0x721b5d63e7936baf, 0xf3a84c3bb7cdf024, 0x8cc6bcf387f8795d,
+	0x620ba46c27f3aa2c, 0x1d6554a417c62355, 0x9cd645fc4798b8de, 0xe3b8b53477ad31a7,
+	0xab69411fbfb21ca3, 0xd407b1d78f8795da, 0x55b4a08fdfd90e51, 0x2ada5047efec8728
+};
+
+const uint64_t crc_table_nvme_big[2048] CRC_TABLE_ALIGN PROGMEM = {
+	0x0000000000000000, 0x7f6ef0c830358979, 0xfedde190606b12f2, 0x81b31158505e9b8b,
+	0xc962e5739841b68f, 0xb60c15bba8743ff6, 0x37bf04e3f82aa47d, 0x48d1f42bc81f2d04,
+	0xa61cecb46814fe75, 0xd9721c7c5821770c, 0x58c10d24087fec87, 0x27affdec384a65fe,
+	0x6f7e09c7f05548fa, 0x1010f90fc060c183, 0x91a3e857903e5a08, 0xeecd189fa00bd371,
+	0x78e0ff3b88be6f81, 0x078e0ff3b88be6f8, 0x863d1eabe8d57d73, 0xf953ee63d8e0f40a,
+	0xb1821a4810ffd90e, 0xceecea8020ca5077, 0x4f5ffbd87094cbfc, 0x30310b1040a14285,
+	0xdefc138fe0aa91f4, 0xa192e347d09f188d, 0x2021f21f80c18306, 0x5f4f02d7b0f40a7f,
+	0x179ef6fc78eb277b, 0x68f0063448deae02, 0xe943176c18803589, 0x962de7a428b5bcf0,
+	0xf1c1fe77117cdf02, 0x8eaf0ebf2149567b, 0x0f1c1fe77117cdf0, 0x7072ef2f41224489,
+	0x38a31b04893d698d, 0x47cdebccb908e0f4, 0xc67efa94e9567b7f, 0xb9100a5cd963f206,
+	0x57dd12c379682177, 0x28b3e20b495da80e, 0xa900f35319033385, 0xd66e039b2936bafc,
+	0x9ebff7b0e12997f8, 0xe1d10778d11c1e81, 0x606216208142850a, 0x1f0ce6e8b1770c73,
+	0x8921014c99c2b083, 0xf64ff184a9f739fa, 0x77fce0dcf9a9a271, 0x08921014c99c2b08,
+	0x4043e43f0183060c, 0x3f2d14f731b68f75, 0xbe9e05af61e814fe, 0xc1f0f56751dd9d87,
+	0x2f3dedf8f1d64ef6, 0x50531d30c1e3c78f, 0xd1e00c6891bd5c04, 0xae8efca0a188d57d,
+	0xe65f088b6997f879, 0x9931f84359a27100, 0x1882e91b09fcea8b, 0x67ec19d339c963f2,
+	0xd75adabd7a6e2d6f, 0xa8342a754a5ba416, 0x29873b2d1a053f9d, 0x56e9cbe52a30b6e4,
+	0x1e383fcee22f9be0, 0x6156cf06d21a1299, 0xe0e5de5e82448912, 0x9f8b2e96b271006b,
+	0x71463609127ad31a, 0x0e28c6c1224f5a63, 0x8f9bd7997211c1e8, 0xf0f5275142244891,
+	0xb824d37a8a3b6595, 0xc74a23b2ba0eecec, 0x46f932eaea507767, 0x3997c222da65fe1e,
+	0xafba2586f2d042ee, 0xd0d4d54ec2e5cb97, 0x5167c41692bb501c, 0x2e0934dea28ed965,
+	0x66d8c0f56a91f461, 0x19b6303d5aa47d18, 0x980521650afae693, 0xe76bd1ad3acf6fea,
+	0x09a6c9329ac4bc9b, 0x76c839faaaf135e2, 0xf77b28a2faafae69, 0x8815d86aca9a2710,
+	0xc0c42c4102850a14, 0xbfaadc8932b0836d, 0x3e19cdd162ee18e6, 0x41773d1952db919f,
+	0x269b24ca6b12f26d, 0x59f5d4025b277b14, 0xd846c55a0b79e09f, 0xa72835923b4c69e6,
+	0xeff9c1b9f35344e2, 0x90973171c366cd9b, 0x1124202993385610, 0x6e4ad0e1a30ddf69,
+	0x8087c87e03060c18, 0xffe938b633338561, 0x7e5a29ee636d1eea, 0x0134d92653589793,
+	0x49e52d0d9b47ba97, 0x368bddc5ab7233ee, 0xb738cc9dfb2ca865, 0xc8563c55cb19211c,
+	0x5e7bdbf1e3ac9dec, 0x21152b39d3991495, 0xa0a63a6183c78f1e, 0xdfc8caa9b3f20667,
+	0x97193e827bed2b63, 0xe877ce4a4bd8a21a, 0x69c4df121b863991, 0x16aa2fda2bb3b0e8,
+	0xf86737458bb86399, 0x8709c78dbb8deae0, 0x06bad6d5ebd3716b, 0x79d4261ddbe6f812,
+	0x3105d23613f9d516, 0x4e6b22fe23cc5c6f, 0xcfd833a67392c7e4, 0xb0b6c36e43a74e9d,
+	0x9a6c9329ac4bc9b5, 0xe50263e19c7e40cc, 0x64b172b9cc20db47, 0x1bdf8271fc15523e,
+	0x530e765a340a7f3a, 0x2c608692043ff643, 0xadd397ca54616dc8, 0xd2bd67026454e4b1,
+	0x3c707f9dc45f37c0, 0x431e8f55f46abeb9, 0xc2ad9e0da4342532, 0xbdc36ec59401ac4b,
+	0xf5129aee5c1e814f, 0x8a7c6a266c2b0836, 0x0bcf7b7e3c7593bd, 0x74a18bb60c401ac4,
+	0xe28c6c1224f5a634, 0x9de29cda14c02f4d, 0x1c518d82449eb4c6, 0x633f7d4a74ab3dbf,
+	0x2bee8961bcb410bb, 0x548079a98c8199c2, 0xd53368f1dcdf0249, 0xaa5d9839ecea8b30,
+	0x449080a64ce15841, 0x3bfe706e7cd4d138, 0xba4d61362c8a4ab3, 0xc52391fe1cbfc3ca,
+	0x8df265d5d4a0eece, 0xf29c951de49567b7, 0x732f8445b4cbfc3c, 0x0c41748d84fe7545,
+	0x6bad6d5ebd3716b7, 0x14c39d968d029fce, 0x95708ccedd5c0445, 0xea1e7c06ed698d3c,
+	0xa2cf882d2576a038, 0xdda178e515432941, 0x5c1269bd451db2ca, 0x237c997575283bb3,
+	0xcdb181ead523e8c2, 0xb2df7122e51661bb, 0x336c607ab548fa30, 0x4c0290b2857d7349,
+	0x04d364994d625e4d, 0x7bbd94517d57d734, 0xfa0e85092d094cbf, 0x856075c11d3cc5c6,
+	0x134d926535897936, 0x6c2362ad05bcf04f, 0xed9073f555e26bc4, 0x92fe833d65d7e2bd,
+	0xda2f7716adc8cfb9, 0xa54187de9dfd46c0, 0x24f29686cda3dd4b, 0x5b9c664efd965432,
+	0xb5517ed15d9d8743, 0xca3f8e196da80e3a, 0x4b8c9f413df695b1, 0x34e26f890dc31cc8,
+	0x7c339ba2c5dc31cc, 0x035d6b6af5e9b8b5, 0x82ee7a32a5b7233e, 0xfd808afa9582aa47,
+	0x4d364994d625e4da, 0x3258b95ce6106da3, 0xb3eba804b64ef628, 0xcc8558cc867b7f51,
+	0x8454ace74e645255, 0xfb3a5c2f7e51db2c, 0x7a894d772e0f40a7, 0x05e7bdbf1e3ac9de,
+	0xeb2aa520be311aaf, 0x944455e88e0493d6, 0x15f744b0de5a085d, 0x6a99b478ee6f8124,
+	0x224840532670ac20, 0x5d26b09b16452559, 0xdc95a1c3461bbed2, 0xa3fb510b762e37ab,
+	0x35d6b6af5e9b8b5b, 0x4ab846676eae0222, 0xcb0b573f3ef099a9, 0xb465a7f70ec510d0,
+	0xfcb453dcc6da3dd4, 0x83daa314f6efb4ad, 0x0269b24ca6b12f26, 0x7d0742849684a65f,
+	0x93ca5a1b368f752e, 0xeca4aad306bafc57, 0x6d17bb8b56e467dc, 0x12794b4366d1eea5,
+	0x5aa8bf68aecec3a1, 0x25c64fa09efb4ad8, 0xa4755ef8cea5d153, 0xdb1bae30fe90582a,
+	0xbcf7b7e3c7593bd8, 0xc399472bf76cb2a1, 0x422a5673a732292a, 0x3d44a6bb9707a053,
+	0x759552905f188d57, 0x0afba2586f2d042e, 0x8b48b3003f739fa5, 0xf42643c80f4616dc,
+	0x1aeb5b57af4dc5ad, 0x6585ab9f9f784cd4, 0xe436bac7cf26d75f, 0x9b584a0fff135e26,
+	0xd389be24370c7322, 0xace74eec0739fa5b, 0x2d545fb4576761d0, 0x523aaf7c6752e8a9,
+	0xc41748d84fe75459, 0xbb79b8107fd2dd20, 0x3acaa9482f8c46ab, 0x45a459801fb9cfd2,
+	0x0d75adabd7a6e2d6, 0x721b5d63e7936baf, 0xf3a84c3bb7cdf024, 0x8cc6bcf387f8795d,
+	0x620ba46c27f3aa2c, 0x1d6554a417c62355, 0x9cd645fc4798b8de, 0xe3b8b53477ad31a7,
+	0xab69411fbfb21ca3, 0xd407b1d78f8795da, 0x55b4a08fdfd90e51, 0x2ada5047efec8728,
+	0x0000000000000000, 0x8776a97d73bddf69, 0x3a3474a9bfec2db9, 0xbd42ddd4cc51f2d0,
+	0x7468e9537fd85b72, 0xf31e402e0c65841b, 0x4e5c9dfac03476cb, 0xc92a3487b389a9a2,
+	0xe8d1d2a6ffb0b6e4, 0x6fa77bdb8c0d698d, 0xd2e5a60f405c9b5d, 0x55930f7233e14434,
+	0x9cb93bf58068ed96, 0x1bcf9288f3d532ff, 0xa68d4f5c3f84c02f, 0x21fbe6214c391f46,
+	0xe57a831ea7f6fea3, 0x620c2a63d44b21ca, 0xdf4ef7b7181ad31a, 0x58385eca6ba70c73,
+	0x91126a4dd82ea5d1, 0x1664c330ab937ab8, 0xab261ee467c28868, 0x2c50b799147f5701,
+	0x0dab51b858464847, 0x8addf8c52bfb972e, 0x379f2511e7aa65fe, 0xb0e98c6c9417ba97,
+	0x79c3b8eb279e1335, 0xfeb511965423cc5c, 0x43f7cc4298723e8c, 0xc481653febcfe1e5,
+	0xfe2c206e177a6e2d, 0x795a891364c7b144, 0xc41854c7a8964394, 0x436efdbadb2b9cfd,
+	0x8a44c93d68a2355f, 0x0d3260401b1fea36, 0xb070bd94d74e18e6, 0x370614e9a4f3c78f,
+	0x16fdf2c8e8cad8c9, 0x918b5bb59b7707a0, 0x2cc986615726f570, 0xabbf2f1c249b2a19,
+	0x62951b9b971283bb, 0xe5e3b2e6e4af5cd2, 0x58a16f3228feae02, 0xdfd7c64f5b43716b,
+	0x1b56a370b08c908e, 0x9c200a0dc3314fe7, 0x2162d7d90f60bd37, 0xa6147ea47cdd625e,
+	0x6f3e4a23cf54cbfc, 0xe848e35ebce91495, 0x550a3e8a70b8e645, 0xd27c97f70305392c,
+	0xf38771d64f3c266a, 0x74f1d8ab3c81f903, 0xc9b3057ff0d00bd3, 0x4ec5ac02836dd4ba,
+	0x87ef988530e47d18, 0x009931f84359a271, 0xbddbec2c8f0850a1, 0x3aad4551fcb58fc8,
+	0xc881668f76634f31, 0x4ff7cff205de9058, 0xf2b51226c98f6288, 0x75c3bb5bba32bde1,
+	0xbce98fdc09bb1443, 0x3b9f26a17a06cb2a, 0x86ddfb75b65739fa, 0x01ab5208c5eae693,
+	0x2050b42989d3f9d5, 0xa7261d54fa6e26bc, 0x1a64c080363fd46c, 0x9d1269fd45820b05,
+	0x54385d7af60ba2a7, 0xd34ef40785b67dce, 0x6e0c29d349e78f1e, 0xe97a80ae3a5a5077,
+	0x2dfbe591d195b192, 0xaa8d4ceca2286efb, 0x17cf91386e799c2b, 0x90b938451dc44342,
+	0x59930cc2ae4deae0, 0xdee5a5bfddf03589, 0x63a7786b11a1c759, 0xe4d1d116621c1830,
+	0xc52a37372e250776, 0x425c9e4a5d98d81f, 0xff1e439e91c92acf, 0x7868eae3e274f5a6,
+	0xb142de6451fd5c04, 0x363477192240836d, 0x8b76aacdee1171bd, 0x0c0003b09dacaed4,
+	0x36ad46e16119211c, 0xb1dbef9c12a4fe75, 0x0c993248def50ca5, 0x8bef9b35ad48d3cc,
+	0x42c5afb21ec17a6e, 0xc5b306cf6d7ca507, 0x78f1db1ba12d57d7, 0xff877266d29088be,
+	0xde7c94479ea997f8, 0x590a3d3aed144891, 0xe448e0ee2145ba41, 0x633e499352f86528,
+	0xaa147d14e171cc8a, 0x2d62d46992cc13e3, 0x902009bd5e9de133, 0x1756a0c02d203e5a,
+	0xd3d7c5ffc6efdfbf, 0x54a16c82b55200d6, 0xe9e3b1567903f206, 0x6e95182b0abe2d6f,
+	0xa7bf2cacb93784cd, 0x20c985d1ca8a5ba4, 0x9d8b580506dba974, 0x1afdf1787566761d,
+	0x3b061759395f695b, 0xbc70be244ae2b632, 0x013263f086b344e2, 0x8644ca8df50e9b8b,
+	0x4f6efe0a46873229, 0xc8185777353aed40, 0x755a8aa3f96b1f90, 0xf22c23de8ad6c0f9,
+	0xa5dbeb4db4510d09, 0x22ad4230c7ecd260, 0x9fef9fe40bbd20b0, 0x189936997800ffd9,
+	0xd1b3021ecb89567b, 0x56c5ab63b8348912, 0xeb8776b774657bc2, 0x6cf1dfca07d8a4ab,
+	0x4d0a39eb4be1bbed, 0xca7c9096385c6484, 0x773e4d42f40d9654, 0xf048e43f87b0493d,
+	0x3962d0b83439e09f, 0xbe1479c547843ff6, 0x0356a4118bd5cd26, 0x84200d6cf868124f,
+	0x40a1685313a7f3aa, 0xc7d7c12e601a2cc3, 0x7a951cfaac4bde13, 0xfde3b587dff6017a,
+	0x34c981006c7fa8d8, 0xb3bf287d1fc277b1, 0x0efdf5a9d3938561, 0x898b5cd4a02e5a08,
+	0xa870baf5ec17454e, 0x2f0613889faa9a27, 0x9244ce5c53fb68f7, 0x153267212046b79e,
+	0xdc1853a693cf1e3c, 0x5b6efadbe072c155, 0xe62c270f2c233385, 0x615a8e725f9eecec,
+	0x5bf7cb23a32b6324, 0xdc81625ed096bc4d, 0x61c3bf8a1cc74e9d, 0xe6b516f76f7a91f4,
+	0x2f9f2270dcf33856, 0xa8e98b0daf4ee73f, 0x15ab56d9631f15ef, 0x92ddffa410a2ca86,
+	0xb32619855c9bd5c0, 0x3450b0f82f260aa9, 0x89126d2ce377f879, 0x0e64c45190ca2710,
+	0xc74ef0d623438eb2, 0x403859ab50fe51db, 0xfd7a847f9cafa30b, 0x7a0c2d02ef127c62,
+	0xbe8d483d04dd9d87, 0x39fbe140776042ee, 0x84b93c94bb31b03e, 0x03cf95e9c88c6f57,
+	0xcae5a16e7b05c6f5, 0x4d93081308b8199c, 0xf0d1d5c7c4e9eb4c, 0x77a77cbab7543425,
+	0x565c9a9bfb6d2b63, 0xd12a33e688d0f40a, 0x6c68ee32448106da, 0xeb1e474f373cd9b3,
+	0x223473c884b57011, 0xa542dab5f708af78, 0x180007613b595da8, 0x9f76ae1c48e482c1,
+	0x6d5a8dc2c2324238, 0xea2c24bfb18f9d51, 0x576ef96b7dde6f81, 0xd01850160e63b0e8,
+	0x19326491bdea194a, 0x9e44cdecce57c623, 0x23061038020634f3, 0xa470b94571bbeb9a,
+	0x858b5f643d82f4dc, 0x02fdf6194e3f2bb5, 0xbfbf2bcd826ed965, 0x38c982b0f1d3060c,
+	0xf1e3b637425aafae, 0x76951f4a31e770c7, 0xcbd7c29efdb68217, 0x4ca16be38e0b5d7e,
+	0x88200edc65c4bc9b, 0x0f56a7a1167963f2, 0xb2147a75da289122, 0x3562d308a9954e4b,
+	0xfc48e78f1a1ce7e9, 0x7b3e4ef269a13880, 0xc67c9326a5f0ca50, 0x410a3a5bd64d1539,
+	0x60f1dc7a9a740a7f, 0xe7877507e9c9d516, 0x5ac5a8d3259827c6, 0xddb301ae5625f8af,
+	0x14993529e5ac510d, 0x93ef9c5496118e64, 0x2ead41805a407cb4, 0xa9dbe8fd29fda3dd,
+	0x9376adacd5482c15, 0x140004d1a6f5f37c, 0xa942d9056aa401ac, 0x2e3470781919dec5,
+	0xe71e44ffaa907767, 0x6068ed82d92da80e, 0xdd2a3056157c5ade, 0x5a5c992b66c185b7,
+	0x7ba77f0a2af89af1, 0xfcd1d67759454598, 0x41930ba39514b748, 0xc6e5a2dee6a96821,
+	0x0fcf96595520c183, 0x88b93f24269d1eea, 0x35fbe2f0eaccec3a, 0xb28d4b8d99713353,
+	0x760c2eb272bed2b6, 0xf17a87cf01030ddf, 0x4c385a1bcd52ff0f, 0xcb4ef366beef2066,
+	0x0264c7e10d6689c4, 0x85126e9c7edb56ad, 0x3850b348b28aa47d, 0xbf261a35c1377b14,
+	0x9eddfc148d0e6452, 0x19ab5569feb3bb3b, 0xa4e988bd32e249eb, 0x239f21c0415f9682,
+	0xeab51547f2d63f20, 0x6dc3bc3a816be049, 0xd08161ee4d3a1299, 0x57f7c8933e87cdf0,
+	0x0000000000000000, 0xff6e4e1f4e4038be, 0xca05ba6dc417e217, 0x356bf4728a57daa9,
+	0xa0d25288d0b85745, 0x5fbc1c979ef86ffb, 0x6ad7e8e514afb552, 0x95b9a6fa5aef8dec,
+	0x757d8342f9e73de1, 0x8a13cd5db7a7055f, 0xbf78392f3df0dff6, 0x4016773073b0e748,
+	0xd5afd1ca295f6aa4, 0x2ac19fd5671f521a, 0x1faa6ba7ed4888b3, 0xe0c425b8a308b00d,
+	0xeafb0685f3ce7bc2, 0x1595489abd8e437c, 0x20febce837d999d5, 0xdf90f2f77999a16b,
+	0x4a29540d23762c87, 0xb5471a126d361439, 0x802cee60e761ce90, 0x7f42a07fa921f62e,
+	0x9f8685c70a294623, 0x60e8cbd844697e9d, 0x55833faace3ea434, 0xaaed71b5807e9c8a,
+	0x3f54d74fda911166, 0xc03a995094d129d8, 0xf5516d221e86f371, 0x0a3f233d50c6cbcf,
+	0xe12f2b58bf0b64ef, 0x1e416547f14b5c51, 0x2b2a91357b1c86f8, 0xd444df2a355cbe46,
+	0x41fd79d06fb333aa, 0xbe9337cf21f30b14, 0x8bf8c3bdaba4d1bd, 0x74968da2e5e4e903,
+	0x9452a81a46ec590e, 0x6b3ce60508ac61b0, 0x5e57127782fbbb19, 0xa1395c68ccbb83a7,
+	0x3480fa9296540e4b, 0xcbeeb48dd81436f5, 0xfe8540ff5243ec5c, 0x01eb0ee01c03d4e2,
+	0x0bd42ddd4cc51f2d, 0xf4ba63c202852793, 0xc1d197b088d2fd3a, 0x3ebfd9afc692c584,
+	0xab067f559c7d4868, 0x5468314ad23d70d6, 0x6103c538586aaa7f, 0x9e6d8b27162a92c1,
+	0x7ea9ae9fb52222cc, 0x81c7e080fb621a72, 0xb4ac14f27135c0db, 0x4bc25aed3f75f865,
+	0xde7bfc17659a7589, 0x2115b2082bda4d37, 0x147e467aa18d979e, 0xeb100865efcdaf20,
+	0xf68770e226815ab5, 0x09e93efd68c1620b, 0x3c82ca8fe296b8a2, 0xc3ec8490acd6801c,
+	0x5655226af6390df0, 0xa93b6c75b879354e, 0x9c509807322eefe7, 0x633ed6187c6ed759,
+	0x83faf3a0df666754, 0x7c94bdbf91265fea, 0x49ff49cd1b718543, 0xb69107d25531bdfd,
+	0x2328a1280fde3011, 0xdc46ef37419e08af, 0xe92d1b45cbc9d206, 0x1643555a8589eab8,
+	0x1c7c7667d54f2177, 0xe31238789b0f19c9, 0xd679cc0a1158c360, 0x291782155f18fbde,
+	0xbcae24ef05f77632, 0x43c06af04bb74e8c, 0x76ab9e82c1e09425, 0x89c5d09d8fa0ac9b,
+	0x6901f5252ca81c96, 0x966fbb3a62e82428, 0xa3044f48e8bffe81, 0x5c6a0157a6ffc63f,
+	0xc9d3a7adfc104bd3, 0x36bde9b2b250736d, 0x03d61dc03807a9c4, 0xfcb853df7647917a,
+	0x17a85bba998a3e5a, 0xe8c615a5d7ca06e4, 0xddade1d75d9ddc4d, 0x22c3afc813dde4f3,
+	0xb77a09324932691f, 0x4814472d077251a1, 0x7d7fb35f8d258b08, 0x8211fd40c365b3b6,
+	0x62d5d8f8606d03bb, 0x9dbb96e72e2d3b05, 0xa8d06295a47ae1ac, 0x57be2c8aea3ad912,
+	0xc2078a70b0d554fe, 0x3d69c46ffe956c40, 0x0802301d74c2b6e9, 0xf76c7e023a828e57,
+	0xfd535d3f6a444598, 0x023d132024047d26, 0x3756e752ae53a78f, 0xc838a94de0139f31,
+	0x5d810fb7bafc12dd, 0xa2ef41a8f4bc2a63, 0x9784b5da7eebf0ca, 0x68eafbc530abc874,
+	0x882ede7d93a37879, 0x77409062dde340c7, 0x422b641057b49a6e, 0xbd452a0f19f4a2d0,
+	0x28fc8cf5431b2f3c, 0xd792c2ea0d5b1782, 0xe2f93698870ccd2b, 0x1d977887c94cf595,
+	0xd9d7c79715952601, 0x26b989885bd51ebf, 0x13d27dfad182c416, 0xecbc33e59fc2fca8,
+	0x7905951fc52d7144, 0x866bdb008b6d49fa, 0xb3002f72013a9353, 0x4c6e616d4f7aabed,
+	0xacaa44d5ec721be0, 0x53c40acaa232235e, 0x66affeb82865f9f7, 0x99c1b0a76625c149,
+	0x0c78165d3cca4ca5, 0xf3165842728a741b, 0xc67dac30f8ddaeb2, 0x3913e22fb69d960c,
+	0x332cc112e65b5dc3, 0xcc428f0da81b657d, 0xf9297b7f224cbfd4, 0x064735606c0c876a,
+	0x93fe939a36e30a86, 0x6c90dd8578a33238, 0x59fb29f7f2f4e891, 0xa69567e8bcb4d02f,
+	0x465142501fbc6022, 0xb93f0c4f51fc589c, 0x8c54f83ddbab8235, 0x733ab62295ebba8b,
+	0xe68310d8cf043767, 0x19ed5ec781440fd9, 0x2c86aab50b13d570, 0xd3e8e4aa4553edce,
+	0x38f8eccfaa9e42ee, 0xc796a2d0e4de7a50, 0xf2fd56a26e89a0f9, 0x0d9318bd20c99847,
+	0x982abe477a2615ab, 0x6744f05834662d15, 0x522f042abe31f7bc, 0xad414a35f071cf02,
+	0x4d856f8d53797f0f, 0xb2eb21921d3947b1, 0x8780d5e0976e9d18, 0x78ee9bffd92ea5a6,
+	0xed573d0583c1284a, 0x1239731acd8110f4, 0x2752876847d6ca5d, 0xd83cc9770996f2e3,
+	0xd203ea4a5950392c, 0x2d6da45517100192, 0x180650279d47db3b, 0xe7681e38d307e385,
+	0x72d1b8c289e86e69, 0x8dbff6ddc7a856d7, 0xb8d402af4dff8c7e, 0x47ba4cb003bfb4c0,
+	0xa77e6908a0b704cd, 0x58102717eef73c73, 0x6d7bd36564a0e6da, 0x92159d7a2ae0de64,
+	0x07ac3b80700f5388, 0xf8c2759f3e4f6b36, 0xcda981edb418b19f, 0x32c7cff2fa588921,
+	0x2f50b77533147cb4, 0xd03ef96a7d54440a, 0xe5550d18f7039ea3, 0x1a3b4307b943a61d,
+	0x8f82e5fde3ac2bf1, 0x70ecabe2adec134f, 0x45875f9027bbc9e6, 0xbae9118f69fbf158,
+	0x5a2d3437caf34155, 0xa5437a2884b379eb, 0x90288e5a0ee4a342, 0x6f46c04540a49bfc,
+	0xfaff66bf1a4b1610, 0x059128a0540b2eae, 0x30fadcd2de5cf407, 0xcf9492cd901cccb9,
+	0xc5abb1f0c0da0776, 0x3ac5ffef8e9a3fc8, 0x0fae0b9d04cde561, 0xf0c045824a8ddddf,
+	0x6579e37810625033, 0x9a17ad675e22688d, 0xaf7c5915d475b224, 0x5012170a9a358a9a,
+	0xb0d632b2393d3a97, 0x4fb87cad777d0229, 0x7ad388dffd2ad880, 0x85bdc6c0b36ae03e,
+	0x1004603ae9856dd2, 0xef6a2e25a7c5556c, 0xda01da572d928fc5, 0x256f944863d2b77b,
+	0xce7f9c2d8c1f185b, 0x3111d232c25f20e5, 0x047a26404808fa4c, 0xfb14685f0648c2f2,
+	0x6eadcea55ca74f1e, 0x91c380ba12e777a0, 0xa4a874c898b0ad09, 0x5bc63ad7d6f095b7,
+	0xbb021f6f75f825ba, 0x446c51703bb81d04, 0x7107a502b1efc7ad, 0x8e69eb1dffafff13,
+	0x1bd04de7a54072ff, 0xe4be03f8eb004a41, 0xd1d5f78a615790e8, 0x2ebbb9952f17a856,
+	0x24849aa87fd16399, 0xdbead4b731915b27, 0xee8120c5bbc6818e, 0x11ef6edaf586b930,
+	0x8456c820af6934dc, 0x7b38863fe1290c62, 0x4e53724d6b7ed6cb, 0xb13d3c52253eee75,
+	0x51f919ea86365e78, 0xae9757f5c87666c6, 0x9bfca3874221bc6f, 0x6492ed980c6184d1,
+	0xf12b4b62568e093d, 0x0e45057d18ce3183, 0x3b2ef10f9299eb2a, 0xc440bf10dcd9d394,
+	0x0000000000000000, 0x8211147cbaf96306, 0x30fb0eaa2d655567, 0xb2ea1ad6979c3661,
+	0x61f61d545acaaace, 0xe3e70928e033c9c8, 0x510d13fe77afffa9, 0xd31c0782cd569caf,
+	0xc3ec3aa8b595559c, 0x41fd2ed40f6c369a, 0xf317340298f000fb, 0x7106207e220963fd,
+	0xa21a27fcef5fff52, 0x200b338055a69c54, 0x92e12956c23aaa35, 0x10f03d2a78c3c933,
+	0xb301530233bd3853, 0x3110477e89445b55, 0x83fa5da81ed86d34, 0x01eb49d4a4210e32,
+	0xd2f74e566977929d, 0x50e65a2ad38ef19b, 0xe20c40fc4412c7fa, 0x601d5480feeba4fc,
+	0x70ed69aa86286dcf, 0xf2fc7dd63cd10ec9, 0x40166700ab4d38a8, 0xc207737c11b45bae,
+	0x111b74fedce2c701, 0x930a6082661ba407, 0x21e07a54f1879266, 0xa3f16e284b7ef160,
+	0x52db80573fede3cd, 0xd0ca942b851480cb, 0x62208efd1288b6aa, 0xe0319a81a871d5ac,
+	0x332d9d0365274903, 0xb13c897fdfde2a05, 0x03d693a948421c64, 0x81c787d5f2bb7f62,
+	0x9137baff8a78b651, 0x1326ae833081d557, 0xa1ccb455a71de336, 0x23dda0291de48030,
+	0xf0c1a7abd0b21c9f, 0x72d0b3d76a4b7f99, 0xc03aa901fdd749f8, 0x422bbd7d472e2afe,
+	0xe1dad3550c50db9e, 0x63cbc729b6a9b898, 0xd121ddff21358ef9, 0x5330c9839bccedff,
+	0x802cce01569a7150, 0x023dda7dec631256, 0xb0d7c0ab7bff2437, 0x32c6d4d7c1064731,
+	0x2236e9fdb9c58e02, 0xa027fd81033ced04, 0x12cde75794a0db65, 0x90dcf32b2e59b863,
+	0x43c0f4a9e30f24cc, 0xc1d1e0d559f647ca, 0x733bfa03ce6a71ab, 0xf12aee7f749312ad,
+	0xa5b700ae7fdbc79a, 0x27a614d2c522a49c, 0x954c0e0452be92fd, 0x175d1a78e847f1fb,
+	0xc4411dfa25116d54, 0x465009869fe80e52, 0xf4ba135008743833, 0x76ab072cb28d5b35,
+	0x665b3a06ca4e9206, 0xe44a2e7a70b7f100, 0x56a034ace72bc761, 0xd4b120d05dd2a467,
+	0x07ad2752908438c8, 0x85bc332e2a7d5bce, 0x375629f8bde16daf, 0xb5473d8407180ea9,
+	0x16b653ac4c66ffc9, 0x94a747d0f69f9ccf, 0x264d5d066103aaae, 0xa45c497adbfac9a8,
+	0x77404ef816ac5507, 0xf5515a84ac553601, 0x47bb40523bc90060, 0xc5aa542e81306366,
+	0xd55a6904f9f3aa55, 0x574b7d78430ac953, 0xe5a167aed496ff32, 0x67b073d26e6f9c34,
+	0xb4ac7450a339009b, 0x36bd602c19c0639d, 0x84577afa8e5c55fc, 0x06466e8634a536fa,
+	0xf76c80f940362457, 0x757d9485facf4751, 0xc7978e536d537130, 0x45869a2fd7aa1236,
+	0x969a9dad1afc8e99, 0x148b89d1a005ed9f, 0xa66193073799dbfe, 0x2470877b8d60b8f8,
+	0x3480ba51f5a371cb, 0xb691ae2d4f5a12cd, 0x047bb4fbd8c624ac, 0x866aa087623f47aa,
+	0x5576a705af69db05, 0xd767b3791590b803, 0x658da9af820c8e62, 0xe79cbdd338f5ed64,
+	0x446dd3fb738b1c04, 0xc67cc787c9727f02, 0x7496dd515eee4963, 0xf687c92de4172a65,
+	0x259bceaf2941b6ca, 0xa78adad393b8d5cc, 0x1560c0050424e3ad, 0x9771d479bedd80ab,
+	0x8781e953c61e4998, 0x0590fd2f7ce72a9e, 0xb77ae7f9eb7b1cff, 0x356bf38551827ff9,
+	0xe677f4079cd4e356, 0x6466e07b262d8050, 0xd68cfaadb1b1b631, 0x549deed10b48d537,
+	0x7fb7270fa7201c5f, 0xfda633731dd97f59, 0x4f4c29a58a454938, 0xcd5d3dd930bc2a3e,
+	0x1e413a5bfdeab691, 0x9c502e274713d597, 0x2eba34f1d08fe3f6, 0xacab208d6a7680f0,
+	0xbc5b1da712b549c3, 0x3e4a09dba84c2ac5, 0x8ca0130d3fd01ca4, 0x0eb1077185297fa2,
+	0xddad00f3487fe30d, 0x5fbc148ff286800b, 0xed560e59651ab66a, 0x6f471a25dfe3d56c,
+	0xccb6740d949d240c, 0x4ea760712e64470a, 0xfc4d7aa7b9f8716b, 0x7e5c6edb0301126d,
+	0xad406959ce578ec2, 0x2f517d2574aeedc4, 0x9dbb67f3e332dba5, 0x1faa738f59cbb8a3,
+	0x0f5a4ea521087190, 0x8d4b5ad99bf11296, 0x3fa1400f0c6d24f7, 0xbdb05473b69447f1,
+	0x6eac53f17bc2db5e, 0xecbd478dc13bb858, 0x5e575d5b56a78e39, 0xdc464927ec5eed3f,
+	0x2d6ca75898cdff92, 0xaf7db32422349c94, 0x1d97a9f2b5a8aaf5, 0x9f86bd8e0f51c9f3,
+	0x4c9aba0cc207555c, 0xce8bae7078fe365a, 0x7c61b4a6ef62003b, 0xfe70a0da559b633d,
+	0xee809df02d58aa0e, 0x6c91898c97a1c908, 0xde7b935a003dff69, 0x5c6a8726bac49c6f,
+	0x8f7680a4779200c0, 0x0d6794d8cd6b63c6, 0xbf8d8e0e5af755a7, 0x3d9c9a72e00e36a1,
+	0x9e6df45aab70c7c1, 0x1c7ce0261189a4c7, 0xae96faf0861592a6, 0x2c87ee8c3cecf1a0,
+	0xff9be90ef1ba6d0f, 0x7d8afd724b430e09, 0xcf60e7a4dcdf3868, 0x4d71f3d866265b6e,
+	0x5d81cef21ee5925d, 0xdf90da8ea41cf15b, 0x6d7ac0583380c73a, 0xef6bd4248979a43c,
+	0x3c77d3a6442f3893, 0xbe66c7dafed65b95, 0x0c8cdd0c694a6df4, 0x8e9dc970d3b30ef2,
+	0xda0027a1d8fbdbc5, 0x581133dd6202b8c3, 0xeafb290bf59e8ea2, 0x68ea3d774f67eda4,
+	0xbbf63af58231710b, 0x39e72e8938c8120d, 0x8b0d345faf54246c, 0x091c202315ad476a,
+	0x19ec1d096d6e8e59, 0x9bfd0975d797ed5f, 0x291713a3400bdb3e, 0xab0607dffaf2b838,
+	0x781a005d37a42497, 0xfa0b14218d5d4791, 0x48e10ef71ac171f0, 0xcaf01a8ba03812f6,
+	0x690174a3eb46e396, 0xeb1060df51bf8090, 0x59fa7a09c623b6f1, 0xdbeb6e757cdad5f7,
+	0x08f769f7b18c4958, 0x8ae67d8b0b752a5e, 0x380c675d9ce91c3f, 0xba1d732126107f39,
+	0xaaed4e0b5ed3b60a, 0x28fc5a77e42ad50c, 0x9a1640a173b6e36d, 0x180754ddc94f806b,
+	0xcb1b535f04191cc4, 0x490a4723bee07fc2, 0xfbe05df5297c49a3, 0x79f1498993852aa5,
+	0x88dba7f6e7163808, 0x0acab38a5def5b0e, 0xb820a95cca736d6f, 0x3a31bd20708a0e69,
+	0xe92dbaa2bddc92c6, 0x6b3caede0725f1c0, 0xd9d6b40890b9c7a1, 0x5bc7a0742a40a4a7,
+	0x4b379d5e52836d94, 0xc9268922e87a0e92, 0x7bcc93f47fe638f3, 0xf9dd8788c51f5bf5,
+	0x2ac1800a0849c75a, 0xa8d09476b2b0a45c, 0x1a3a8ea0252c923d, 0x982b9adc9fd5f13b,
+	0x3bdaf4f4d4ab005b, 0xb9cbe0886e52635d, 0x0b21fa5ef9ce553c, 0x8930ee224337363a,
+	0x5a2ce9a08e61aa95, 0xd83dfddc3498c993, 0x6ad7e70aa304fff2, 0xe8c6f37619fd9cf4,
+	0xf836ce5c613e55c7, 0x7a27da20dbc736c1, 0xc8cdc0f64c5b00a0, 0x4adcd48af6a263a6,
+	0x99c0d3083bf4ff09, 0x1bd1c774810d9c0f, 0xa93bdda21691aa6e, 0x2b2ac9deac68c968,
+	0x0000000000000000, 0x373d15f784905d1e, 0x6e7a2bef0920ba3c, 0x59473e188db0e722,
+	0xdcf457de12417478, 0xebc9422996d12966, 0xb28e7c311b61ce44, 0x85b369c69ff1935a,
+	0x8d3189ef7c157b9b, 0xba0c9c18f8852685, 0xe34ba2007535c1a7, 0xd476b7f7f1a59cb9,
+	0x51c5de316e540fe3, 0x66f8cbc6eac452fd, 0x3fbff5de6774b5df, 0x0882e029e3e4e8c1,
+	0x2eba358da0bd645d, 0x1987207a242d3943, 0x40c01e62a99dde61, 0x77fd0b952d0d837f,
+	0xf24e6253b2fc1025, 0xc57377a4366c4d3b, 0x9c3449bcbbdcaa19, 0xab095c4b3f4cf707,
+	0xa38bbc62dca81fc6, 0x94b6a995583842d8, 0xcdf1978dd588a5fa, 0xfacc827a5118f8e4,
+	0x7f7febbccee96bbe, 0x4842fe4b4a7936a0, 0x1105c053c7c9d182, 0x2638d5a443598c9c,
+	0x5d746b1b417ac8ba, 0x6a497eecc5ea95a4, 0x330e40f4485a7286, 0x04335503ccca2f98,
+	0x81803cc5533bbcc2, 0xb6bd2932d7abe1dc, 0xeffa172a5a1b06fe, 0xd8c702ddde8b5be0,
+	0xd045e2f43d6fb321, 0xe778f703b9ffee3f, 0xbe3fc91b344f091d, 0x8902dcecb0df5403,
+	0x0cb1b52a2f2ec759, 0x3b8ca0ddabbe9a47, 0x62cb9ec5260e7d65, 0x55f68b32a29e207b,
+	0x73ce5e96e1c7ace7, 0x44f34b616557f1f9, 0x1db47579e8e716db, 0x2a89608e6c774bc5,
+	0xaf3a0948f386d89f, 0x98071cbf77168581, 0xc14022a7faa662a3, 0xf67d37507e363fbd,
+	0xfeffd7799dd2d77c, 0xc9c2c28e19428a62, 0x9085fc9694f26d40, 0xa7b8e9611062305e,
+	0x220b80a78f93a304, 0x153695500b03fe1a, 0x4c71ab4886b31938, 0x7b4cbebf02234426,
+	0xbae8d63682f59174, 0x8dd5c3c10665cc6a, 0xd492fdd98bd52b48, 0xe3afe82e0f457656,
+	0x661c81e890b4e50c, 0x5121941f1424b812, 0x0866aa0799945f30, 0x3f5bbff01d04022e,
+	0x37d95fd9fee0eaef, 0x00e44a2e7a70b7f1, 0x59a37436f7c050d3, 0x6e9e61c173500dcd,
+	0xeb2d0807eca19e97, 0xdc101df06831c389, 0x855723e8e58124ab, 0xb26a361f611179b5,
+	0x9452e3bb2248f529, 0xa36ff64ca6d8a837, 0xfa28c8542b684f15, 0xcd15dda3aff8120b,
+	0x48a6b46530098151, 0x7f9ba192b499dc4f, 0x26dc9f8a39293b6d, 0x11e18a7dbdb96673,
+	0x19636a545e5d8eb2, 0x2e5e7fa3dacdd3ac, 0x771941bb577d348e, 0x4024544cd3ed6990,
+	0xc5973d8a4c1cfaca, 0xf2aa287dc88ca7d4, 0xabed1665453c40f6, 0x9cd00392c1ac1de8,
+	0xe79cbd2dc38f59ce, 0xd0a1a8da471f04d0, 0x89e696c2caafe3f2, 0xbedb83354e3fbeec,
+	0x3b68eaf3d1ce2db6, 0x0c55ff04555e70a8, 0x5512c11cd8ee978a, 0x622fd4eb5c7eca94,
+	0x6aad34c2bf9a2255, 0x5d9021353b0a7f4b, 0x04d71f2db6ba9869, 0x33ea0ada322ac577,
+	0xb659631caddb562d, 0x816476eb294b0b33, 0xd82348f3a4fbec11, 0xef1e5d04206bb10f,
+	0xc92688a063323d93, 0xfe1b9d57e7a2608d, 0xa75ca34f6a1287af, 0x9061b6b8ee82dab1,
+	0x15d2df7e717349eb, 0x22efca89f5e314f5, 0x7ba8f4917853f3d7, 0x4c95e166fcc3aec9,
+	0x4417014f1f274608, 0x732a14b89bb71b16, 0x2a6d2aa01607fc34, 0x1d503f579297a12a,
+	0x98e356910d663270, 0xafde436689f66f6e, 0xf6997d7e0446884c, 0xc1a4688980d6d552,
+	0x41088a3e5d7cb183, 0x76359fc9d9ecec9d, 0x2f72a1d1545c0bbf, 0x184fb426d0cc56a1,
+	0x9dfcdde04f3dc5fb, 0xaac1c817cbad98e5, 0xf386f60f461d7fc7, 0xc4bbe3f8c28d22d9,
+	0xcc3903d12169ca18, 0xfb041626a5f99706, 0xa243283e28497024, 0x957e3dc9acd92d3a,
+	0x10cd540f3328be60, 0x27f041f8b7b8e37e, 0x7eb77fe03a08045c, 0x498a6a17be985942,
+	0x6fb2bfb3fdc1d5de, 0x588faa44795188c0, 0x01c8945cf4e16fe2, 0x36f581ab707132fc,
+	0xb346e86def80a1a6, 0x847bfd9a6b10fcb8, 0xdd3cc382e6a01b9a, 0xea01d67562304684,
+	0xe283365c81d4ae45, 0xd5be23ab0544f35b, 0x8cf91db388f41479, 0xbbc408440c644967,
+	0x3e7761829395da3d, 0x094a747517058723, 0x500d4a6d9ab56001, 0x67305f9a1e253d1f,
+	0x1c7ce1251c067939, 0x2b41f4d298962427, 0x7206caca1526c305, 0x453bdf3d91b69e1b,
+	0xc088b6fb0e470d41, 0xf7b5a30c8ad7505f, 0xaef29d140767b77d, 0x99cf88e383f7ea63,
+	0x914d68ca601302a2, 0xa6707d3de4835fbc, 0xff3743256933b89e, 0xc80a56d2eda3e580,
+	0x4db93f14725276da, 0x7a842ae3f6c22bc4, 0x23c314fb7b72cce6, 0x14fe010cffe291f8,
+	0x32c6d4a8bcbb1d64, 0x05fbc15f382b407a, 0x5cbcff47b59ba758, 0x6b81eab0310bfa46,
+	0xee328376aefa691c, 0xd90f96812a6a3402, 0x8048a899a7dad320, 0xb775bd6e234a8e3e,
+	0xbff75d47c0ae66ff, 0x88ca48b0443e3be1, 0xd18d76a8c98edcc3, 0xe6b0635f4d1e81dd,
+	0x63030a99d2ef1287, 0x543e1f6e567f4f99, 0x0d792176dbcfa8bb, 0x3a4434815f5ff5a5,
+	0xfbe05c08df8920f7, 0xccdd49ff5b197de9, 0x959a77e7d6a99acb, 0xa2a762105239c7d5,
+	0x27140bd6cdc8548f, 0x10291e2149580991, 0x496e2039c4e8eeb3, 0x7e5335ce4078b3ad,
+	0x76d1d5e7a39c5b6c, 0x41ecc010270c0672, 0x18abfe08aabce150, 0x2f96ebff2e2cbc4e,
+	0xaa258239b1dd2f14, 0x9d1897ce354d720a, 0xc45fa9d6b8fd9528, 0xf362bc213c6dc836,
+	0xd55a69857f3444aa, 0xe2677c72fba419b4, 0xbb20426a7614fe96, 0x8c1d579df284a388,
+	0x09ae3e5b6d7530d2, 0x3e932bace9e56dcc, 0x67d415b464558aee, 0x50e90043e0c5d7f0,
+	0x586be06a03213f31, 0x6f56f59d87b1622f, 0x3611cb850a01850d, 0x012cde728e91d813,
+	0x849fb7b411604b49, 0xb3a2a24395f01657, 0xeae59c5b1840f175, 0xddd889ac9cd0ac6b,
+	0xa69437139ef3e84d, 0x91a922e41a63b553, 0xc8ee1cfc97d35271, 0xffd3090b13430f6f,
+	0x7a6060cd8cb29c35, 0x4d5d753a0822c12b, 0x141a4b2285922609, 0x23275ed501027b17,
+	0x2ba5befce2e693d6, 0x1c98ab0b6676cec8, 0x45df9513ebc629ea, 0x72e280e46f5674f4,
+	0xf751e922f0a7e7ae, 0xc06cfcd57437bab0, 0x992bc2cdf9875d92, 0xae16d73a7d17008c,
+	0x882e029e3e4e8c10, 0xbf131769baded10e, 0xe6542971376e362c, 0xd1693c86b3fe6b32,
+	0x54da55402c0ff868, 0x63e740b7a89fa576, 0x3aa07eaf252f4254, 0x0d9d6b58a1bf1f4a,
+	0x051f8b71425bf78b, 0x32229e86c6cbaa95, 0x6b65a09e4b7b4db7, 0x5c58b569cfeb10a9,
+	0xd9ebdcaf501a83f3, 0xeed6c958d48adeed, 0xb791f740593a39cf, 0x80ace2b7ddaa64d1,
+	0x0000000000000000, 0xe9742a79ef04a5d4, 0xe63172a0869ed8c3, 0x0f4558d9699a7d17,
+	0xf8bbc31255aa22ed, 0x11cfe96bbaae8739, 0x1e8ab1b2d334fa2e, 0xf7fe9bcb3c305ffa,
+	0xc5aea077f3c3d6b1, 0x2cda8a0e1cc77365, 0x239fd2d7755d0e72, 0xcaebf8ae9a59aba6,
+	0x3d156365a669f45c, 0xd461491c496d5188, 0xdb2411c520f72c9f, 0x32503bbccff3894b,
+	0xbf8466bcbf103e09, 0x56f04cc550149bdd, 0x59b5141c398ee6ca, 0xb0c13e65d68a431e,
+	0x473fa5aeeaba1ce4, 0xae4b8fd705beb930, 0xa10ed70e6c24c427, 0x487afd77832061f3,
+	0x7a2ac6cb4cd3e8b8, 0x935eecb2a3d74d6c, 0x9c1bb46bca4d307b, 0x756f9e12254995af,
+	0x829105d91979ca55, 0x6be52fa0f67d6f81, 0x64a077799fe71296, 0x8dd45d0070e3b742,
+	0x4bd1eb2a26b7ef79, 0xa2a5c153c9b34aad, 0xade0998aa02937ba, 0x4494b3f34f2d926e,
+	0xb36a2838731dcd94, 0x5a1e02419c196840, 0x555b5a98f5831557, 0xbc2f70e11a87b083,
+	0x8e7f4b5dd57439c8, 0x670b61243a709c1c, 0x684e39fd53eae10b, 0x813a1384bcee44df,
+	0x76c4884f80de1b25, 0x9fb0a2366fdabef1, 0x90f5faef0640c3e6, 0x7981d096e9446632,
+	0xf4558d9699a7d170, 0x1d21a7ef76a374a4, 0x1264ff361f3909b3, 0xfb10d54ff03dac67,
+	0x0cee4e84cc0df39d, 0xe59a64fd23095649, 0xeadf3c244a932b5e, 0x03ab165da5978e8a,
+	0x31fb2de16a6407c1, 0xd88f07988560a215, 0xd7ca5f41ecfadf02, 0x3ebe753803fe7ad6,
+	0xc940eef33fce252c, 0x2034c48ad0ca80f8, 0x2f719c53b950fdef, 0xc605b62a5654583b,
+	0x97a3d6544d6fdef2, 0x7ed7fc2da26b7b26, 0x7192a4f4cbf10631, 0x98e68e8d24f5a3e5,
+	0x6f18154618c5fc1f, 0x866c3f3ff7c159cb, 0x892967e69e5b24dc, 0x605d4d9f715f8108,
+	0x520d7623beac0843, 0xbb795c5a51a8ad97, 0xb43c04833832d080, 0x5d482efad7367554,
+	0xaab6b531eb062aae, 0x43c29f4804028f7a, 0x4c87c7916d98f26d, 0xa5f3ede8829c57b9,
+	0x2827b0e8f27fe0fb, 0xc1539a911d7b452f, 0xce16c24874e13838, 0x2762e8319be59dec,
+	0xd09c73faa7d5c216, 0x39e8598348d167c2, 0x36ad015a214b1ad5, 0xdfd92b23ce4fbf01,
+	0xed89109f01bc364a, 0x04fd3ae6eeb8939e, 0x0bb8623f8722ee89, 0xe2cc484668264b5d,
+	0x1532d38d541614a7, 0xfc46f9f4bb12b173, 0xf303a12dd288cc64, 0x1a778b543d8c69b0,
+	0xdc723d7e6bd8318b, 0x3506170784dc945f, 0x3a434fdeed46e948, 0xd33765a702424c9c,
+	0x24c9fe6c3e721366, 0xcdbdd415d176b6b2, 0xc2f88cccb8eccba5, 0x2b8ca6b557e86e71,
+	0x19dc9d09981be73a, 0xf0a8b770771f42ee, 0xffedefa91e853ff9, 0x1699c5d0f1819a2d,
+	0xe1675e1bcdb1c5d7, 0x0813746222b56003, 0x07562cbb4b2f1d14, 0xee2206c2a42bb8c0,
+	0x63f65bc2d4c80f82, 0x8a8271bb3bccaa56, 0x85c729625256d741, 0x6cb3031bbd527295,
+	0x9b4d98d081622d6f, 0x7239b2a96e6688bb, 0x7d7cea7007fcf5ac, 0x9408c009e8f85078,
+	0xa658fbb5270bd933, 0x4f2cd1ccc80f7ce7, 0x40698915a19501f0, 0xa91da36c4e91a424,
+	0x5ee338a772a1fbde, 0xb79712de9da55e0a, 0xb8d24a07f43f231d, 0x51a6607e1b3b86c9,
+	0x1b9e8afbc2482e8f, 0xf2eaa0822d4c8b5b, 0xfdaff85b44d6f64c, 0x14dbd222abd25398,
+	0xe32549e997e20c62, 0x0a51639078e6a9b6, 0x05143b49117cd4a1, 0xec601130fe787175,
+	0xde302a8c318bf83e, 0x374400f5de8f5dea, 0x3801582cb71520fd, 0xd175725558118529,
+	0x268be99e6421dad3, 0xcfffc3e78b257f07, 0xc0ba9b3ee2bf0210, 0x29ceb1470dbba7c4,
+	0xa41aec477d581086, 0x4d6ec63e925cb552, 0x422b9ee7fbc6c845, 0xab5fb49e14c26d91,
+	0x5ca12f5528f2326b, 0xb5d5052cc7f697bf, 0xba905df5ae6ceaa8, 0x53e4778c41684f7c,
+	0x61b44c308e9bc637, 0x88c06649619f63e3, 0x87853e9008051ef4, 0x6ef114e9e701bb20,
+	0x990f8f22db31e4da, 0x707ba55b3435410e, 0x7f3efd825daf3c19, 0x964ad7fbb2ab99cd,
+	0x504f61d1e4ffc1f6, 0xb93b4ba80bfb6422, 0xb67e137162611935, 0x5f0a39088d65bce1,
+	0xa8f4a2c3b155e31b, 0x418088ba5e5146cf, 0x4ec5d06337cb3bd8, 0xa7b1fa1ad8cf9e0c,
+	0x95e1c1a6173c1747, 0x7c95ebdff838b293, 0x73d0b30691a2cf84, 0x9aa4997f7ea66a50,
+	0x6d5a02b4429635aa, 0x842e28cdad92907e, 0x8b6b7014c408ed69, 0x621f5a6d2b0c48bd,
+	0xefcb076d5befffff, 0x06bf2d14b4eb5a2b, 0x09fa75cddd71273c, 0xe08e5fb4327582e8,
+	0x1770c47f0e45dd12, 0xfe04ee06e14178c6, 0xf141b6df88db05d1, 0x18359ca667dfa005,
+	0x2a65a71aa82c294e, 0xc3118d6347288c9a, 0xcc54d5ba2eb2f18d, 0x2520ffc3c1b65459,
+	0xd2de6408fd860ba3, 0x3baa4e711282ae77, 0x34ef16a87b18d360, 0xdd9b3cd1941c76b4,
+	0x8c3d5caf8f27f07d, 0x654976d6602355a9, 0x6a0c2e0f09b928be, 0x83780476e6bd8d6a,
+	0x74869fbdda8dd290, 0x9df2b5c435897744, 0x92b7ed1d5c130a53, 0x7bc3c764b317af87,
+	0x4993fcd87ce426cc, 0xa0e7d6a193e08318, 0xafa28e78fa7afe0f, 0x46d6a401157e5bdb,
+	0xb1283fca294e0421, 0x585c15b3c64aa1f5, 0x57194d6aafd0dce2, 0xbe6d671340d47936,
+	0x33b93a133037ce74, 0xdacd106adf336ba0, 0xd58848b3b6a916b7, 0x3cfc62ca59adb363,
+	0xcb02f901659dec99, 0x2276d3788a99494d, 0x2d338ba1e303345a, 0xc447a1d80c07918e,
+	0xf6179a64c3f418c5, 0x1f63b01d2cf0bd11, 0x1026e8c4456ac006, 0xf952c2bdaa6e65d2,
+	0x0eac5976965e3a28, 0xe7d8730f795a9ffc, 0xe89d2bd610c0e2eb, 0x01e901afffc4473f,
+	0xc7ecb785a9901f04, 0x2e989dfc4694bad0, 0x21ddc5252f0ec7c7, 0xc8a9ef5cc00a6213,
+	0x3f577497fc3a3de9, 0xd6235eee133e983d, 0xd96606377aa4e52a, 0x30122c4e95a040fe,
+	0x024217f25a53c9b5, 0xeb363d8bb5576c61, 0xe4736552dccd1176, 0x0d074f2b33c9b4a2,
+	0xfaf9d4e00ff9eb58, 0x138dfe99e0fd4e8c, 0x1cc8a6408967339b, 0xf5bc8c396663964f,
+	0x7868d1391680210d, 0x911cfb40f98484d9, 0x9e59a399901ef9ce, 0x772d89e07f1a5c1a,
+	0x80d3122b432a03e0, 0x69a73852ac2ea634, 0x66e2608bc5b4db23, 0x8f964af22ab07ef7,
+	0xbdc6714ee543f7bc, 0x54b25b370a475268, 0x5bf703ee63dd2f7f, 0xb28329978cd98aab,
+	0x457db25cb0e9d551, 0xac0998255fed7085, 0xa34cc0fc36770d92, 0x4a38ea85d973a846,
+	0x0000000000000000, 0xfc5d27f6bf353971, 0xcc6369be26fde189, 0x303e4e4899c8d8f8,
+	0xac1ff52f156c5079, 0x5042d2d9aa596908, 0x607c9c913391b1f0, 0x9c21bb678ca48881,
+	0x6ce6cc0d724f3399, 0x90bbebfbcd7a0ae8, 0xa085a5b354b2d210, 0x5cd88245eb87eb61,
+	0xc0f93922672363e0, 0x3ca41ed4d8165a91, 0x0c9a509c41de8269, 0xf0c7776afeebbb18,
+	0xd9cd981ae49e6732, 0x2590bfec5bab5e43, 0x15aef1a4c26386bb, 0xe9f3d6527d56bfca,
+	0x75d26d35f1f2374b, 0x898f4ac34ec70e3a, 0xb9b1048bd70fd6c2, 0x45ec237d683aefb3,
+	0xb52b541796d154ab, 0x497673e129e46dda, 0x79483da9b02cb522, 0x85151a5f0f198c53,
+	0x1934a13883bd04d2, 0xe56986ce3c883da3, 0xd557c886a540e55b, 0x290aef701a75dc2a,
+	0x8742166691ab5d0f, 0x7b1f31902e9e647e, 0x4b217fd8b756bc86, 0xb77c582e086385f7,
+	0x2b5de34984c70d76, 0xd700c4bf3bf23407, 0xe73e8af7a23aecff, 0x1b63ad011d0fd58e,
+	0xeba4da6be3e46e96, 0x17f9fd9d5cd157e7, 0x27c7b3d5c5198f1f, 0xdb9a94237a2cb66e,
+	0x47bb2f44f6883eef, 0xbbe608b249bd079e, 0x8bd846fad075df66, 0x7785610c6f40e617,
+	0x5e8f8e7c75353a3d, 0xa2d2a98aca00034c, 0x92ece7c253c8dbb4, 0x6eb1c034ecfde2c5,
+	0xf2907b5360596a44, 0x0ecd5ca5df6c5335, 0x3ef312ed46a48bcd, 0xc2ae351bf991b2bc,
+	0x32694271077a09a4, 0xce346587b84f30d5, 0xfe0a2bcf2187e82d, 0x02570c399eb2d15c,
+	0x9e76b75e121659dd, 0x622b90a8ad2360ac, 0x5215dee034ebb854, 0xae48f9168bde8125,
+	0x3a5d0a9e7bc12975, 0xc6002d68c4f41004, 0xf63e63205d3cc8fc, 0x0a6344d6e209f18d,
+	0x9642ffb16ead790c, 0x6a1fd847d198407d, 0x5a21960f48509885, 0xa67cb1f9f765a1f4,
+	0x56bbc693098e1aec, 0xaae6e165b6bb239d, 0x9ad8af2d2f73fb65, 0x668588db9046c214,
+	0xfaa433bc1ce24a95, 0x06f9144aa3d773e4, 0x36c75a023a1fab1c, 0xca9a7df4852a926d,
+	0xe39092849f5f4e47, 0x1fcdb572206a7736, 0x2ff3fb3ab9a2afce, 0xd3aedccc069796bf,
+	0x4f8f67ab8a331e3e, 0xb3d2405d3506274f, 0x83ec0e15acceffb7, 0x7fb129e313fbc6c6,
+	0x8f765e89ed107dde, 0x732b797f522544af, 0x43153737cbed9c57, 0xbf4810c174d8a526,
+	0x2369aba6f87c2da7, 0xdf348c50474914d6, 0xef0ac218de81cc2e, 0x1357e5ee61b4f55f,
+	0xbd1f1cf8ea6a747a, 0x41423b0e555f4d0b, 0x717c7546cc9795f3, 0x8d2152b073a2ac82,
+	0x1100e9d7ff062403, 0xed5dce2140331d72, 0xdd638069d9fbc58a, 0x213ea79f66cefcfb,
+	0xd1f9d0f5982547e3, 0x2da4f70327107e92, 0x1d9ab94bbed8a66a, 0xe1c79ebd01ed9f1b,
+	0x7de625da8d49179a, 0x81bb022c327c2eeb, 0xb1854c64abb4f613, 0x4dd86b921481cf62,
+	0x64d284e20ef41348, 0x988fa314b1c12a39, 0xa8b1ed5c2809f2c1, 0x54eccaaa973ccbb0,
+	0xc8cd71cd1b984331, 0x3490563ba4ad7a40, 0x04ae18733d65a2b8, 0xf8f33f8582509bc9,
+	0x083448ef7cbb20d1, 0xf4696f19c38e19a0, 0xc45721515a46c158, 0x380a06a7e573f829,
+	0xa42bbdc069d770a8, 0x58769a36d6e249d9, 0x6848d47e4f2a9121, 0x9415f388f01fa850,
+	0x74ba153cf78252ea, 0x88e732ca48b76b9b, 0xb8d97c82d17fb363, 0x44845b746e4a8a12,
+	0xd8a5e013e2ee0293, 0x24f8c7e55ddb3be2, 0x14c689adc413e31a, 0xe89bae5b7b26da6b,
+	0x185cd93185cd6173, 0xe401fec73af85802, 0xd43fb08fa33080fa, 0x286297791c05b98b,
+	0xb4432c1e90a1310a, 0x481e0be82f94087b, 0x782045a0b65cd083, 0x847d62560969e9f2,
+	0xad778d26131c35d8, 0x512aaad0ac290ca9, 0x6114e49835e1d451, 0x9d49c36e8ad4ed20,
+	0x01687809067065a1, 0xfd355fffb9455cd0, 0xcd0b11b7208d8428, 0x315636419fb8bd59,
+	0xc191412b61530641, 0x3dcc66ddde663f30, 0x0df2289547aee7c8, 0xf1af0f63f89bdeb9,
+	0x6d8eb404743f5638, 0x91d393f2cb0a6f49, 0xa1edddba52c2b7b1, 0x5db0fa4cedf78ec0,
+	0xf3f8035a66290fe5, 0x0fa524acd91c3694, 0x3f9b6ae440d4ee6c, 0xc3c64d12ffe1d71d,
+	0x5fe7f67573455f9c, 0xa3bad183cc7066ed, 0x93849fcb55b8be15, 0x6fd9b83dea8d8764,
+	0x9f1ecf5714663c7c, 0x6343e8a1ab53050d, 0x537da6e9329bddf5, 0xaf20811f8daee484,
+	0x33013a78010a6c05, 0xcf5c1d8ebe3f5574, 0xff6253c627f78d8c, 0x033f743098c2b4fd,
+	0x2a359b4082b768d7, 0xd668bcb63d8251a6, 0xe656f2fea44a895e, 0x1a0bd5081b7fb02f,
+	0x862a6e6f97db38ae, 0x7a77499928ee01df, 0x4a4907d1b126d927, 0xb61420270e13e056,
+	0x46d3574df0f85b4e, 0xba8e70bb4fcd623f, 0x8ab03ef3d605bac7, 0x76ed1905693083b6,
+	0xeacca262e5940b37, 0x169185945aa13246, 0x26afcbdcc369eabe, 0xdaf2ec2a7c5cd3cf,
+	0x4ee71fa28c437b9f, 0xb2ba3854337642ee, 0x8284761caabe9a16, 0x7ed951ea158ba367,
+	0xe2f8ea8d992f2be6, 0x1ea5cd7b261a1297, 0x2e9b8333bfd2ca6f, 0xd2c6a4c500e7f31e,
+	0x2201d3affe0c4806, 0xde5cf45941397177, 0xee62ba11d8f1a98f, 0x123f9de767c490fe,
+	0x8e1e2680eb60187f, 0x724301765455210e, 0x427d4f3ecd9df9f6, 0xbe2068c872a8c087,
+	0x972a87b868dd1cad, 0x6b77a04ed7e825dc, 0x5b49ee064e20fd24, 0xa714c9f0f115c455,
+	0x3b3572977db14cd4, 0xc7685561c28475a5, 0xf7561b295b4cad5d, 0x0b0b3cdfe479942c,
+	0xfbcc4bb51a922f34, 0x07916c43a5a71645, 0x37af220b3c6fcebd, 0xcbf205fd835af7cc,
+	0x57d3be9a0ffe7f4d, 0xab8e996cb0cb463c, 0x9bb0d72429039ec4, 0x67edf0d29636a7b5,
+	0xc9a509c41de82690, 0x35f82e32a2dd1fe1, 0x05c6607a3b15c719, 0xf99b478c8420fe68,
+	0x65bafceb088476e9, 0x99e7db1db7b14f98, 0xa9d995552e799760, 0x5584b2a3914cae11,
+	0xa543c5c96fa71509, 0x591ee23fd0922c78, 0x6920ac77495af480, 0x957d8b81f66fcdf1,
+	0x095c30e67acb4570, 0xf5011710c5fe7c01, 0xc53f59585c36a4f9, 0x39627eaee3039d88,
+	0x106891def97641a2, 0xec35b628464378d3, 0xdc0bf860df8ba02b, 0x2056df9660be995a,
+	0xbc7764f1ec1a11db, 0x402a4307532f28aa, 0x70140d4fcae7f052, 0x8c492ab975d2c923,
+	0x7c8e5dd38b39723b, 0x80d37a25340c4b4a, 0xb0ed346dadc493b2, 0x4cb0139b12f1aac3,
+	0xd091a8fc9e552242, 0x2ccc8f0a21601b33, 0x1cf2c142b8a8c3cb, 0xe0afe6b4079dfaba,
+	0x0000000000000000, 0x21e9761e252621ac, 0x43d2ec3c4a4c4358, 0x623b9a226f6a62f4,
+	0x87a5d878949886b0, 0xa64cae66b1bea71c, 0xc4773444ded4c5e8, 0xe59e425afbf2e444,
+	0x3b9296a271a69e0b, 0x1a7be0bc5480bfa7, 0x78407a9e3beadd53, 0x59a90c801eccfcff,
+	0xbc374edae53e18bb, 0x9dde38c4c0183917, 0xffe5a2e6af725be3, 0xde0cd4f88a547a4f,
+	0x77252d44e34d3c16, 0x56cc5b5ac66b1dba, 0x34f7c178a9017f4e, 0x151eb7668c275ee2,
+	0xf080f53c77d5baa6, 0xd169832252f39b0a, 0xb35219003d99f9fe, 0x92bb6f1e18bfd852,
+	0x4cb7bbe692eba21d, 0x6d5ecdf8b7cd83b1, 0x0f6557dad8a7e145, 0x2e8c21c4fd81c0e9,
+	0xcb12639e067324ad, 0xeafb158023550501, 0x88c08fa24c3f67f5, 0xa929f9bc69194659,
+	0xee4a5a89c69a782c, 0xcfa32c97e3bc5980, 0xad98b6b58cd63b74, 0x8c71c0aba9f01ad8,
+	0x69ef82f15202fe9c, 0x4806f4ef7724df30, 0x2a3d6ecd184ebdc4, 0x0bd418d33d689c68,
+	0xd5d8cc2bb73ce627, 0xf431ba35921ac78b, 0x960a2017fd70a57f, 0xb7e35609d85684d3,
+	0x527d145323a46097, 0x7394624d0682413b, 0x11aff86f69e823cf, 0x30468e714cce0263,
+	0x996f77cd25d7443a, 0xb88601d300f16596, 0xdabd9bf16f9b0762, 0xfb54edef4abd26ce,
+	0x1ecaafb5b14fc28a, 0x3f23d9ab9469e326, 0x5d184389fb0381d2, 0x7cf13597de25a07e,
+	0xa2fde16f5471da31, 0x831497717157fb9d, 0xe12f0d531e3d9969, 0xc0c67b4d3b1bb8c5,
+	0x25583917c0e95c81, 0x04b14f09e5cf7d2d, 0x668ad52b8aa51fd9, 0x4763a335af833e75,
+	0xe84d9340d5a36333, 0xc9a4e55ef085429f, 0xab9f7f7c9fef206b, 0x8a760962bac901c7,
+	0x6fe84b38413be583, 0x4e013d26641dc42f, 0x2c3aa7040b77a6db, 0x0dd3d11a2e518777,
+	0xd3df05e2a405fd38, 0xf23673fc8123dc94, 0x900de9deee49be60, 0xb1e49fc0cb6f9fcc,
+	0x547add9a309d7b88, 0x7593ab8415bb5a24, 0x17a831a67ad138d0, 0x364147b85ff7197c,
+	0x9f68be0436ee5f25, 0xbe81c81a13c87e89, 0xdcba52387ca21c7d, 0xfd53242659843dd1,
+	0x18cd667ca276d995, 0x392410628750f839, 0x5b1f8a40e83a9acd, 0x7af6fc5ecd1cbb61,
+	0xa4fa28a64748c12e, 0x85135eb8626ee082, 0xe728c49a0d048276, 0xc6c1b2842822a3da,
+	0x235ff0ded3d0479e, 0x02b686c0f6f66632, 0x608d1ce2999c04c6, 0x41646afcbcba256a,
+	0x0607c9c913391b1f, 0x27eebfd7361f3ab3, 0x45d525f559755847, 0x643c53eb7c5379eb,
+	0x81a211b187a19daf, 0xa04b67afa287bc03, 0xc270fd8dcdeddef7, 0xe3998b93e8cbff5b,
+	0x3d955f6b629f8514, 0x1c7c297547b9a4b8, 0x7e47b35728d3c64c, 0x5faec5490df5e7e0,
+	0xba308713f60703a4, 0x9bd9f10dd3212208, 0xf9e26b2fbc4b40fc, 0xd80b1d31996d6150,
+	0x7122e48df0742709, 0x50cb9293d55206a5, 0x32f008b1ba386451, 0x13197eaf9f1e45fd,
+	0xf6873cf564eca1b9, 0xd76e4aeb41ca8015, 0xb555d0c92ea0e2e1, 0x94bca6d70b86c34d,
+	0x4ab0722f81d2b902, 0x6b590431a4f498ae, 0x09629e13cb9efa5a, 0x288be80deeb8dbf6,
+	0xcd15aa57154a3fb2, 0xecfcdc49306c1e1e, 0x8ec7466b5f067cea, 0xaf2e30757a205d46,
+	0xe44200d2f3d1550d, 0xc5ab76ccd6f774a1, 0xa790eceeb99d1655, 0x86799af09cbb37f9,
+	0x63e7d8aa6749d3bd, 0x420eaeb4426ff211, 0x203534962d0590e5, 0x01dc42880823b149,
+	0xdfd096708277cb06, 0xfe39e06ea751eaaa, 0x9c027a4cc83b885e, 0xbdeb0c52ed1da9f2,
+	0x58754e0816ef4db6, 0x799c381633c96c1a, 0x1ba7a2345ca30eee, 0x3a4ed42a79852f42,
+	0x93672d96109c691b, 0xb28e5b8835ba48b7, 0xd0b5c1aa5ad02a43, 0xf15cb7b47ff60bef,
+	0x14c2f5ee8404efab, 0x352b83f0a122ce07, 0x571019d2ce48acf3, 0x76f96fcceb6e8d5f,
+	0xa8f5bb34613af710, 0x891ccd2a441cd6bc, 0xeb2757082b76b448, 0xcace21160e5095e4,
+	0x2f50634cf5a271a0, 0x0eb91552d084500c, 0x6c828f70bfee32f8, 0x4d6bf96e9ac81354,
+	0x0a085a5b354b2d21, 0x2be12c45106d0c8d, 0x49dab6677f076e79, 0x6833c0795a214fd5,
+	0x8dad8223a1d3ab91, 0xac44f43d84f58a3d, 0xce7f6e1feb9fe8c9, 0xef961801ceb9c965,
+	0x319accf944edb32a, 0x1073bae761cb9286, 0x724820c50ea1f072, 0x53a156db2b87d1de,
+	0xb63f1481d075359a, 0x97d6629ff5531436, 0xf5edf8bd9a3976c2, 0xd4048ea3bf1f576e,
+	0x7d2d771fd6061137, 0x5cc40101f320309b, 0x3eff9b239c4a526f, 0x1f16ed3db96c73c3,
+	0xfa88af67429e9787, 0xdb61d97967b8b62b, 0xb95a435b08d2d4df, 0x98b335452df4f573,
+	0x46bfe1bda7a08f3c, 0x675697a38286ae90, 0x056d0d81edeccc64, 0x24847b9fc8caedc8,
+	0xc11a39c53338098c, 0xe0f34fdb161e2820, 0x82c8d5f979744ad4, 0xa321a3e75c526b78,
+	0x0c0f93922672363e, 0x2de6e58c03541792, 0x4fdd7fae6c3e7566, 0x6e3409b0491854ca,
+	0x8baa4beab2eab08e, 0xaa433df497cc9122, 0xc878a7d6f8a6f3d6, 0xe991d1c8dd80d27a,
+	0x379d053057d4a835, 0x1674732e72f28999, 0x744fe90c1d98eb6d, 0x55a69f1238becac1,
+	0xb038dd48c34c2e85, 0x91d1ab56e66a0f29, 0xf3ea317489006ddd, 0xd203476aac264c71,
+	0x7b2abed6c53f0a28, 0x5ac3c8c8e0192b84, 0x38f852ea8f734970, 0x191124f4aa5568dc,
+	0xfc8f66ae51a78c98, 0xdd6610b07481ad34, 0xbf5d8a921bebcfc0, 0x9eb4fc8c3ecdee6c,
+	0x40b82874b4999423, 0x61515e6a91bfb58f, 0x036ac448fed5d77b, 0x2283b256dbf3f6d7,
+	0xc71df00c20011293, 0xe6f486120527333f, 0x84cf1c306a4d51cb, 0xa5266a2e4f6b7067,
+	0xe245c91be0e84e12, 0xc3acbf05c5ce6fbe, 0xa1972527aaa40d4a, 0x807e53398f822ce6,
+	0x65e011637470c8a2, 0x4409677d5156e90e, 0x2632fd5f3e3c8bfa, 0x07db8b411b1aaa56,
+	0xd9d75fb9914ed019, 0xf83e29a7b468f1b5, 0x9a05b385db029341, 0xbbecc59bfe24b2ed,
+	0x5e7287c105d656a9, 0x7f9bf1df20f07705, 0x1da06bfd4f9a15f1, 0x3c491de36abc345d,
+	0x9560e45f03a57204, 0xb4899241268353a8, 0xd6b2086349e9315c, 0xf75b7e7d6ccf10f0,
+	0x12c53c27973df4b4, 0x332c4a39b21bd518, 0x5117d01bdd71b7ec, 0x70fea605f8579640,
+	0xaef272fd7203ec0f, 0x8f1b04e35725cda3, 0xed209ec1384faf57, 0xccc9e8df1d698efb,
+	0x2957aa85e69b6abf, 0x08bedc9bc3bd4b13, 0x6a8546b9acd729e7, 0x4b6c30a789f1084b
+};
+
 #ifdef PROGMEM_MOCK_ACTIVE
 // limit the effect of the progmem mock to this file
 #undef PROGMEM
@@ -0,0 +1,366 @@
+/* FastCRC library code is placed under the MIT license
+ * Copyright (c) 2014 - 2021 Frank Bösing
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+//
+// Autotuner (CRC_TUNE)
+//
+// The kernels of a model are timed on a buffer of the expected message size,
+// the fastest one is bound to the model. While a thread tunes, the timed kernel
+// is forced for this thread only and its calls are not counted (CRC_STATS,
+// CRC_PERF), other threads keep using the kernel bound so far (CRC_KERNEL_AUTO
+// before the first tuning). The results can be kept in a file:
+//   # FastCRC kernels
+//   crc32 clmul 4096
+// (model, kernel, message size it was tuned for).
+//
+
+#if defined(ARDUINO)
+#include <Arduino.h>
+#endif
+
+#include "FastCRC.h"
+#include "FastCRC_tune.h"
+
+#if CRC_TUNE
+
+#include <mutex>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#if !defined(CRC_TUNE_NS)
+#define CRC_TUNE_NS 1000000		// time per kernel and round
+#endif
+#define CRC_TUNE_ROUNDS 3
+#define CRC_TUNE_MAX (16 << 20)	// largest buffer for the timing
+
+uint8_t crc_tune_bound[CRC_MODELS];
+static size_t crc_tune_hint[CRC_MODELS];	// message size of the tuning
+static std::mutex crc_tune_mutex;
+static bool crc_tune_loaded;
+static unsigned crc_tune_generation;		// of the results, counts every tuning
+
+// Results copied under crc_tune_mutex, written to the file without it
+typedef struct {
+	uint8_t kernel[CRC_MODELS];
+	size_t hint[CRC_MODELS];
+	unsigned generation;
+} crc_tune_results_t;
+
+static std::mutex crc_tune_save_mutex;
+static unsigned crc_tune_saved;				// generation in the file
+
+thread_local crc_tune_forced_t crc_tune_forced = {CRC_MODELS, CRC_KERNEL_AUTO};
+
+static const char * const crc_kernel_names[CRC_KERNELS] = {
+	"auto", "table", "clmul", "chorba", "byte", "pshufb"
+};
+
+static uint64_t crc_tune_now(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+static volatile uint64_t crc_tune_sink;
+
+static void crc_tune_call(const unsigned model, const uint8_t *data, const size_t len)
+{
+	FastCRC7 c7;
+	FastCRC8 c8;
+	FastCRC16 c16;
+	FastCRC32 c32;
+	FastCRC64 c64;
+	uint64_t crc = 0;
+
+	switch (model) {
+	case CRC_MODEL_CRC7: crc = c7.crc7(data, len); break;
+	case CRC_MODEL_SMBUS: crc = c8.smbus(data, len); break;
+	case CRC_MODEL_MAXIM: crc = c8.maxim(data, len); break;
+	case CRC_MODEL_CCITT: crc = c16.ccitt(data, len); break;
+	case CRC_MODEL_MCRF4XX: crc = c16.mcrf4xx(data, len); break;
+	case CRC_MODEL_KERMIT: crc = c16.kermit(data, len); break;
+	case CRC_MODEL_MODBUS: crc = c16.modbus(data, len); break;
+	case CRC_MODEL_XMODEM: crc = c16.xmodem(data, len); break;
+	case CRC_MODEL_X25: crc = c16.x25(data, len); break;
+	case CRC_MODEL_CAN15: crc = c16.can15(data, len * 8); break;
+	case CRC_MODEL_CRC32: crc = c32.crc32(data, len); break;
+	case CRC_MODEL_CKSUM: crc = c32.cksum(data, len); break;
+	case CRC_MODEL_MPEG2: crc = c32.mpeg2(data, len); break;
+	case CRC_MODEL_BZIP2: crc = c32.bzip2(data, len); break;
+	case CRC_MODEL_CANFD17: crc = c32.canfd17(data, len * 8); break;
+	case CRC_MODEL_CANFD21: crc = c32.canfd21(data, len * 8); break;
+	case CRC_MODEL_ECMA182: crc = c64.ecma182(data, len); break;
+	case CRC_MODEL_XZ: crc = c64.xz(data, len); break;
+	case CRC_MODEL_GOISO: crc = c64.goiso(data, len); break;
+	case CRC_MODEL_NVME: crc = c64.nvme(data, len); break;
+	}
+	crc_tune_sink = crc;
+}
+
+/** Time one kernel, best of CRC_TUNE_ROUNDS
+ * @return ns per call
+ */
+static double crc_tune_time(const unsigned model, const uint8_t *data, const size_t len)
+{
+	double best = 0;
+
+	crc_tune_call(model, data, len);	// warm up tables and caches
+	for (int r = 0; r < CRC_TUNE_ROUNDS; r++) {
+		uint64_t start = crc_tune_now(), t;
+		size_t calls = 0, batch = 1;
+		do {
+			for (size_t i = 0; i < batch; i++) crc_tune_call(model, data, len);
+			calls += batch;
+			if (batch < 1024) batch *= 2;	// read the clock less often for short messages
+			t = crc_tune_now() - start;
+		} while (t < CRC_TUNE_NS);
+		const double ns = (double)t / calls;
+		if (r == 0 || ns < best) best = ns;
+	}
+	return best;
+}
+
+static size_t crc_tune_default_hint(const unsigned model)
+{
+#if CRC_STATS
+	crc_stats_t stats;
+	if (crc_stats_get(model, &stats) && stats.calls) return stats.bytes / stats.calls;
+#else
+	(void)model;
+#endif
+	return CRC_TUNE_HINT;
+}
+
+// crc_tune_mutex must be held:
+static void crc_tune_run(const unsigned model, size_t hint)
+{
+	uint8_t best = CRC_KERNEL_TABLE, k, n = 0;
+	double best_ns = 0;
+
+	if (!hint) hint = crc_tune_default_hint(model);
+	if (hint > CRC_TUNE_MAX) hint = CRC_TUNE_MAX;
+	if (!hint) hint = 1;
+
+	for (k = CRC_KERNEL_TABLE; k < CRC_KERNELS; k++) n += crc_kernel_available(model, k);
+
+	if (n > 1) {
+		uint8_t *buf = (uint8_t *)malloc(hint);
+		if (buf) {
+			uint32_t x = 0x2545f491;
+			for (size_t i = 0; i < hint; i++) {
+				x ^= x << 13; x ^= x >> 17; x ^= x << 5;
+				buf[i] = x;
+			}
+			crc_tune_forced.model = model;	// other threads keep the bound kernel
+			for (k = CRC_KERNEL_TABLE; k < CRC_KERNELS; k++) {
+				if (!crc_kernel_available(model, k)) continue;
+				crc_tune_forced.kernel = k;
+				const double ns = crc_tune_time(model, buf, hint);
+				if (best_ns == 0 || ns < best_ns * 0.97) {	// a tie keeps the first (simpler) kernel
+					best_ns = ns;
+					best = k;
+				}
+			}
+			crc_tune_forced.model = CRC_MODELS;
+			free(buf);
+		}
+	}
+	crc_tune_hint[model] = hint;
+	crc_tune_generation++;
+	__atomic_store_n(&crc_tune_bound[model], best, __ATOMIC_RELAXED);
+}
+
+// crc_tune_mutex must be held:
+static void crc_tune_copy(crc_tune_results_t *r)
+{
+	for (unsigned m = 0; m < CRC_MODELS; m++) {
+		r->kernel[m] = __atomic_load_n(&crc_tune_bound[m], __ATOMIC_RELAXED);
+		r->hint[m] = crc_tune_hint[m];
+	}
+	r->generation = crc_tune_generation;
+}
+
+static bool crc_tune_write(const char *path, const crc_tune_results_t *r)
+{
+	FILE *f = fopen(path, "w");
+
+	if (!f) return false;
+	fprintf(f, "# FastCRC kernels: model kernel message-size\n");
+	for (unsigned m = 0; m < CRC_MODELS; m++) {
+		if (r->kernel[m] != CRC_KERNEL_AUTO) fprintf(f, "%s %s %lu\n", crc_model_name(m), crc_kernel_names[r->kernel[m]], (unsigned long)r->hint[m]);
+	}
+	return fclose(f) == 0;
+}
+
+// Without crc_tune_mutex, older results than the ones in the file are not written:
+static void crc_tune_autosave(const crc_tune_results_t *r)
+{
+	const char *path = getenv("FASTCRC_TUNE");
+	if (!path || !*path) return;
+
+	std::lock_guard<std::mutex> lock(crc_tune_save_mutex);
+	if ((int)(r->generation - crc_tune_saved) < 0) return;
+	crc_tune_write(path, r);
+	crc_tune_saved = r->generation;
+}
+
+// crc_tune_mutex must be held:
+static bool crc_tune_read(const char *path)
+{
+	char line[128], name[32], kernel[32];
+	unsigned long hint;
+	FILE *f = fopen(path, "r");
+
+	if (!f) return false;
+	while (fgets(line, sizeof(line), f)) {
+		if (line[0] == '#' || sscanf(line, "%31s %31s %lu", name, kernel, &hint) != 3) continue;
+		for (unsigned m = 0; m < CRC_MODELS; m++) {
+			if (strcmp(name, crc_model_name(m))) continue;
+			for (uint8_t k = CRC_KERNEL_TABLE; k < CRC_KERNELS; k++) {
+				if (strcmp(kernel, crc_kernel_names[k]) || !crc_kernel_available(m, k)) continue;
+				crc_tune_hint[m] = hint;
+				__atomic_store_n(&crc_tune_bound[m], k, __ATOMIC_RELAXED);
+			}
+		}
+	}
+	fclose(f);
+	crc_tune_generation++;
+	return true;
+}
+
+/** First call of a model, tunes it (or loads $FASTCRC_TUNE)
+ * @param model CRC_MODEL_xxx
+ * @return Kernel to use
+ */
+uint8_t crc_tune_first(const unsigned model)
+{
+	crc_tune_results_t r;
+	bool tuned = false;
+
+	if (!crc_tune_mutex.try_lock()) return CRC_KERNEL_AUTO;	// another thread tunes
+
+	if (!crc_tune_loaded) {
+		const char *path = getenv("FASTCRC_TUNE");
+		crc_tune_loaded = true;
+		if (path && *path) crc_tune_read(path);
+	}
+	uint8_t k = __atomic_load_n(&crc_tune_bound[model], __ATOMIC_RELAXED);
+	if (k == CRC_KERNEL_AUTO) {
+		crc_tune_run(model, 0);
+		k = crc_tune_bound[model];
+		crc_tune_copy(&r);
+		tuned = true;
+	}
+	crc_tune_mutex.unlock();
+	if (tuned) crc_tune_autosave(&r);
+	return k;
+}
+
+/** Tune all models again
+ * @param hint Expected message size, 0: CRC_TUNE_HINT (with CRC_STATS: the mean size so far)
+ */
+void crc_tune(const size_t hint)
+{
+	crc_tune_results_t r;
+	{
+		std::lock_guard<std::mutex> lock(crc_tune_mutex);
+		for (unsigned m = 0; m < CRC_MODELS; m++) crc_tune_run(m, hint);
+		crc_tune_copy(&r);
+	}
+	crc_tune_autosave(&r);
+}
+
+/** Tune one model again
+ * @param model CRC_MODEL_xxx
+ * @param hint Expected message size, 0: CRC_TUNE_HINT (with CRC_STATS: the mean size so far)
+ * @return false if model is out of range
+ */
+bool crc_tune_model(const unsigned model, const size_t hint)
+{
+	crc_tune_results_t r;
+
+	if (model >= CRC_MODELS) return false;
+	{
+		std::lock_guard<std::mutex> lock(crc_tune_mutex);
+		crc_tune_run(model, hint);
+		crc_tune_copy(&r);
+	}
+	crc_tune_autosave(&r);
+	return true;
+}
+
+/** Kernel of a model, tunes it on the first call
+ * @param model CRC_MODEL_xxx
+ * @return CRC_KERNEL_xxx, CRC_KERNEL_AUTO if out of range or another thread tunes it
+ */
+uint8_t crc_tune_kernel(const unsigned model)
+{
+	if (model >= CRC_MODELS) return CRC_KERNEL_AUTO;
+	return crc_tune_get(model);
+}
+
+/** Bind a kernel to a model, like a result of the tuning (e.g. to benchmark every kernel)
+ * @param model CRC_MODEL_xxx
+ * @param k CRC_KERNEL_xxx, CRC_KERNEL_AUTO: tune again on the next call
+ * @return false if model is out of range or k is not compiled in for it
+ */
+bool crc_tune_bind(const unsigned model, const uint8_t k)
+{
+	if (model >= CRC_MODELS || (k != CRC_KERNEL_AUTO && !crc_kernel_available(model, k))) return false;
+	std::lock_guard<std::mutex> lock(crc_tune_mutex);
+	crc_tune_generation++;
+	__atomic_store_n(&crc_tune_bound[model], k, __ATOMIC_RELAXED);
+	return true;
+}
+
+/** Read tuned kernels, unknown models and kernels not compiled in are skipped
+ * @param path File name
+ * @return false if the file can't be read
+ */
+bool crc_tune_load(const char *path)
+{
+	std::lock_guard<std::mutex> lock(crc_tune_mutex);
+	return crc_tune_read(path);
+}
+
+/** Write the tuned kernels (tuned models only)
+ * @param path File name
+ * @return false if the file can't be written
+ */
+bool crc_tune_save(const char *path)
+{
+	crc_tune_results_t r;
+	{
+		std::lock_guard<std::mutex> lock(crc_tune_mutex);
+		crc_tune_copy(&r);
+	}
+	return crc_tune_write(path, &r);
+}
+
+#endif // #if CRC_TUNE
@@ -0,0 +1,60 @@
+/* FastCRC library code is placed under the MIT license
+ * Copyright (c) 2014 - 2021 Frank Bösing
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+//
+// Kernel of a model for its _upd() method (CRC_TUNE): the tuned kernel,
+// CRC_KERNEL_AUTO while the model is tuned the first time by another thread.
+//
+
+#if !defined(FastCRC_tune)
+#define FastCRC_tune
+
+#if CRC_TUNE
+
+typedef struct {
+	unsigned model;		// CRC_MODELS: the thread does not tune
+	uint8_t kernel;
+} crc_tune_forced_t;
+
+extern uint8_t crc_tune_bound[CRC_MODELS];	// CRC_KERNEL_AUTO: not yet tuned
+extern thread_local crc_tune_forced_t crc_tune_forced;	// kernel timed by the tuner in this thread
+uint8_t crc_tune_first(const unsigned model);
+
+static inline uint8_t crc_tune_get(const unsigned model)
+{
+	if (crc_tune_forced.model == model) return crc_tune_forced.kernel;
+	uint8_t k = __atomic_load_n(&crc_tune_bound[model], __ATOMIC_RELAXED);
+	return k != CRC_KERNEL_AUTO ? k : crc_tune_first(model);
+}
+
+#define CRC_KERNEL(model) crc_tune_get(model)
+#define CRC_TUNE_TIMING() (crc_tune_forced.model != CRC_MODELS)	// the calls of the tuner are not counted (CRC_STATS, CRC_PERF)
+
+#else
+#define CRC_KERNEL(model) CRC_KERNEL_AUTO
+#define CRC_TUNE_TIMING() false
+#endif
+
+#endif
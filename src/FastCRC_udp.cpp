@@ -0,0 +1,192 @@
+/* FastCRC library code is placed under the MIT license
+ * Copyright (c) 2014 - 2021 Frank Bösing
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+//
+// Batched UDP receive (CRC_UDP)
+//
+// One recvmmsg() fills up to batch slots of an arena that is allocated once,
+// the slots start on cache lines. Then all datagrams of the call are verified
+// in one pass of FastCRC32::crc32_verify(): the CRC register over payload and
+// trailer is the residue of CRC32, the trailer is not compared separately.
+// Trailers in network order (CRC_UDP_BE) are reversed in place before.
+// Truncated datagrams (MSG_TRUNC) and datagrams shorter than the CRC are invalid.
+//
+// Pass MSG_WAITFORONE (or MSG_DONTWAIT) to crc_udp_recv() on blocking sockets,
+// without it recvmmsg() waits until the whole batch has arrived.
+//
+
+#include "FastCRC_udp.h"
+
+#if CRC_UDP
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <new>
+
+struct crc_udp {
+	unsigned batch;
+	size_t size;					// of a slot
+	int flags;						// CRC_UDP_xxx
+	uint8_t *arena;					// batch slots of size bytes
+	struct mmsghdr *msgs;
+	struct iovec *iov;
+	struct sockaddr_storage *from;	// CRC_UDP_FROM, else NULL
+	const uint8_t **frames;			// for crc32_verify()
+	size_t *lens;
+	uint8_t *ok;
+	unsigned *index;
+	FastCRC32 crc;
+};
+
+/** Frees a receiver
+ * @param u Receiver, may be NULL
+ */
+void crc_udp_destroy(crc_udp_t *u)
+{
+	if (!u) return;
+	free(u->arena);
+	delete[] u->msgs;
+	delete[] u->iov;
+	delete[] u->from;
+	delete[] u->frames;
+	delete[] u->lens;
+	delete[] u->ok;
+	delete[] u->index;
+	delete u;
+}
+
+/** Creates a receiver with its arena
+ * @param batch Datagrams per call, 0: CRC_UDP_BATCH
+ * @param size Largest datagram including the CRC, 0: CRC_UDP_SIZE
+ * @param flags CRC_UDP_BE, CRC_UDP_FROM or 0
+ * @return Receiver, NULL: out of memory
+ */
+crc_udp_t *crc_udp_create(unsigned batch, size_t size, int flags)
+{
+	if (!batch) batch = CRC_UDP_BATCH;
+	if (!size) size = CRC_UDP_SIZE;
+	size = (size + 63) & ~(size_t)63;
+
+	crc_udp_t *u = new (std::nothrow) crc_udp_t();
+	if (!u) return NULL;
+	u->batch = batch;
+	u->size = size;
+	u->flags = flags;
+	void *arena;
+	if (posix_memalign(&arena, 64, batch * size)) arena = NULL;
+	u->arena = (uint8_t *) arena;
+	u->msgs = new (std::nothrow) struct mmsghdr[batch]();
+	u->iov = new (std::nothrow) struct iovec[batch];
+	u->from = flags & CRC_UDP_FROM ? new (std::nothrow) struct sockaddr_storage[batch] : NULL;
+	u->frames = new (std::nothrow) const uint8_t *[batch];
+	u->lens = new (std::nothrow) size_t[batch];
+	u->ok = new (std::nothrow) uint8_t[batch];
+	u->index = new (std::nothrow) unsigned[batch];
+	if (!u->arena || !u->msgs || !u->iov || (flags & CRC_UDP_FROM && !u->from) || !u->frames || !u->lens || !u->ok || !u->index) {
+		crc_udp_destroy(u);
+		return NULL;
+	}
+
+	for (unsigned i = 0; i < batch; i++) {
+		u->iov[i].iov_base = u->arena + i * size;
+		u->iov[i].iov_len = size;
+		u->msgs[i].msg_hdr.msg_iov = &u->iov[i];
+		u->msgs[i].msg_hdr.msg_iovlen = 1;
+		u->msgs[i].msg_hdr.msg_name = u->from ? &u->from[i] : NULL;
+		u->frames[i] = u->arena + i * size;
+	}
+	return u;
+}
+
+/** Receives up to batch datagrams and verifies their CRCs
+ * @param u Receiver, the datagrams of the previous call are overwritten
+ * @param fd UDP socket
+ * @param flags Flags of recvmmsg(), e.g. MSG_WAITFORONE or MSG_DONTWAIT
+ * @param result Number of datagrams and the indexes of the valid ones
+ * @return 0 or errno of recvmmsg() (EAGAIN: nothing received)
+ */
+int crc_udp_recv(crc_udp_t *u, int fd, int flags, crc_udp_result_t *result)
+{
+	result->received = result->valid = 0;
+	result->index = u->index;
+
+	for (unsigned i = 0; i < u->batch; i++) {
+		u->msgs[i].msg_hdr.msg_namelen = u->from ? sizeof(struct sockaddr_storage) : 0;
+		u->msgs[i].msg_hdr.msg_flags = 0;
+	}
+	int n;
+	do {
+		n = recvmmsg(fd, u->msgs, u->batch, flags, NULL);
+	} while (n < 0 && errno == EINTR);
+	if (n < 0) return errno;
+
+	for (int i = 0; i < n; i++) {
+		size_t len = u->msgs[i].msg_len;
+		if (u->msgs[i].msg_hdr.msg_flags & MSG_TRUNC) len = 0;
+		if (u->flags & CRC_UDP_BE && len >= 4) {
+			uint8_t *t = u->arena + i * u->size + len - 4;
+			uint8_t x = t[0]; t[0] = t[3]; t[3] = x;
+			x = t[1]; t[1] = t[2]; t[2] = x;
+		}
+		u->lens[i] = len;
+	}
+	u->crc.crc32_verify(u->frames, u->lens, n, u->ok);
+
+	size_t valid = 0;
+	for (int i = 0; i < n; i++) {
+		u->index[valid] = i;
+		valid += u->ok[i];
+	}
+	result->received = n;
+	result->valid = valid;
+	return 0;
+}
+
+/** Payload of a datagram of the last crc_udp_recv()
+ * @param u Receiver
+ * @param i Index of the datagram
+ * @param len Length without the CRC
+ * @return Payload, in the arena
+ */
+const uint8_t *crc_udp_data(const crc_udp_t *u, unsigned i, size_t *len)
+{
+	const size_t n = u->msgs[i].msg_len;
+	*len = n >= 4 ? n - 4 : 0;
+	return u->arena + i * u->size;
+}
+
+/** Source address of a datagram of the last crc_udp_recv()
+ * @param u Receiver, created with CRC_UDP_FROM
+ * @param i Index of the datagram
+ * @param len Length of the address
+ * @return Address, NULL: created without CRC_UDP_FROM
+ */
+const struct sockaddr *crc_udp_from(const crc_udp_t *u, unsigned i, socklen_t *len)
+{
+	if (!u->from) return NULL;
+	*len = u->msgs[i].msg_hdr.msg_namelen;
+	return (const struct sockaddr *) &u->from[i];
+}
+
+#endif // CRC_UDP
@@ -0,0 +1,63 @@
+/* FastCRC library code is placed under the MIT license
+ * Copyright (c) 2014 - 2021 Frank Bösing
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining
+ * a copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+// Batched UDP receive with CRC32 trailer verification, see FastCRC_udp.cpp
+
+#if !defined(FastCRC_udp_h)
+#define FastCRC_udp_h
+
+#include "FastCRC.h"
+
+#if CRC_UDP
+
+#include <sys/socket.h>
+
+#if !defined(CRC_UDP_BATCH)
+#define CRC_UDP_BATCH 64		// datagrams per recvmmsg()
+#endif
+#if !defined(CRC_UDP_SIZE)
+#define CRC_UDP_SIZE  2048		// bytes per datagram, longer ones are truncated and invalid
+#endif
+
+// crc_udp_create() flags
+#define CRC_UDP_BE    1			// the CRC is sent high byte first (network order), default: low byte first (Ethernet, gzip)
+#define CRC_UDP_FROM  2			// keep the source addresses, see crc_udp_from()
+
+typedef struct {
+	size_t received;			// datagrams in the arena
+	size_t valid;				// entries in index
+	const unsigned *index;		// the valid datagrams, ascending, until the next crc_udp_recv()
+} crc_udp_result_t;
+
+typedef struct crc_udp crc_udp_t;
+
+crc_udp_t *crc_udp_create(unsigned batch, size_t size, int flags);	// 0: CRC_UDP_BATCH, CRC_UDP_SIZE; NULL: out of memory
+int crc_udp_recv(crc_udp_t *u, int fd, int flags, crc_udp_result_t *result);	// flags of recvmmsg(), 0 or errno (EAGAIN: none)
+const uint8_t *crc_udp_data(const crc_udp_t *u, unsigned i, size_t *len);		// payload of datagram i, without the CRC
+const struct sockaddr *crc_udp_from(const crc_udp_t *u, unsigned i, socklen_t *len);	// NULL: no CRC_UDP_FROM
+void crc_udp_destroy(crc_udp_t *u);
+
+#endif // CRC_UDP
+#endif // FastCRC_udp_h
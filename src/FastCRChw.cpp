@@ -514,6 +514,30 @@ uint32_t FastCRC32::cksum(const uint8_t *data, const size_t datalen)
   return generic(0x04C11DB7L, 0, CRC_FLAG_NOREFLECT | CRC_FLAG_XOR, data, datalen);
 }
 
+/** MPEG2
+ * CRC_32 of MPEG-2 transport stream sections (PSI/SI), DVB
+ * @param data Pointer to Data
+ * @param datalen Length of Data
+ * @return CRC value
+ */
+uint32_t FastCRC32::mpeg2(const uint8_t *data, const size_t datalen)
+{
+  // width=32 poly=0x04c11db7 init=0xffffffff refin=false refout=false xorout=0x00000000 check=0x0376e6e7
+  return generic(0x04C11DB7L, 0XFFFFFFFFL, CRC_FLAG_NOREFLECT, data, datalen);
+}
+
+/** BZIP2
+ * Alias CRC-32/AAL5, CRC-32/DECT-B
+ * @param data Pointer to Data
+ * @param datalen Length of Data
+ * @return CRC value
+ */
+uint32_t FastCRC32::bzip2(const uint8_t *data, const size_t datalen)
+{
+  // width=32 poly=0x04c11db7 init=0xffffffff refin=false refout=false xorout=0xffffffff check=0xfc891918
+  return generic(0x04C11DB7L, 0XFFFFFFFFL, CRC_FLAG_NOREFLECT | CRC_FLAG_XOR, data, datalen);
+}
+
 /** Update
  * Call for subsequent calculations with previous seed
  * @param data Pointer to Data
@@ -564,4 +588,20 @@ uint32_t FastCRC32::generic(const uint32_t polynom, const uint32_t seed, const u
 
 uint32_t FastCRC32::crc32_upd(const uint8_t *data, size_t len){return update(data, len);}
 uint32_t FastCRC32::cksum_upd(const uint8_t *data, size_t len){return update(data, len);}
+uint32_t FastCRC32::mpeg2_upd(const uint8_t *data, size_t len){return update(data, len);}
+uint32_t FastCRC32::bzip2_upd(const uint8_t *data, size_t len){return update(data, len);}
+
+/** POSIX cksum
+ * The cksum utility appends the length of the data to the data: as many
+ * octets as needed, least significant first (none for 0 bytes).
+ * @param length Length of the data passed to cksum() and cksum_upd()
+ * @return CRC value
+ */
+uint32_t FastCRC32::cksum_length(uint64_t length)
+{
+  uint8_t octets[8];
+  size_t n = 0;
+  for (; length; length >>= 8) octets[n++] = (uint8_t) length;
+  return cksum_upd(octets, n);
+}
 #endif // #if defined(KINETISK)
@@ -40,20 +40,150 @@
 #define PROGMEM
 #define pgm_read_byte(addr) (*(const unsigned char *)(addr))
 #define pgm_read_word(addr) ({ \
-	typeof(addr) _addr = (addr); \
+	__typeof__(addr) _addr = (addr); \
 	*(const unsigned short *)(_addr); \
 })
 #define pgm_read_dword(addr) ({ \
-	typeof(addr) _addr = (addr); \
-	*(const unsigned long *)(_addr); \
+	__typeof__(addr) _addr = (addr); \
+	*(const uint32_t *)(_addr); \
 })
 #endif
 
+#if !defined(pgm_read_qword)
+#if defined(__AVR__)
+#define pgm_read_qword(addr) ((uint64_t)pgm_read_dword(addr) | ((uint64_t)pgm_read_dword((const uint8_t *)(addr) + 4) << 32))
+#else
+#define pgm_read_qword(addr) (*(const uint64_t *)(addr))
+#endif
+#endif
+
 
 
+#include <string.h>
+
 #include "FastCRC.h"
+#if !CRC_TABLES_LAZY
 #include "FastCRC_tables.h"
+#endif
+#include "FastCRC_clmul.h"
+#include "FastCRC_pshufb.h"
+#include "FastCRC_perf.h"
+#include "FastCRC_stats.h"
+#include "FastCRC_tune.h"
+#if CRC_NIBBLE
+#include "FastCRC_nibble.h"
+#endif
+
+
+#if CRC_TINY
+// Buffers up to this length use the unrolled kernels (no alignment, no loops):
+#define CRC_TINY_MAX 64
+#endif
+
+// Tables of the models, one table per polynom:
+#if CRC_NIBBLE
+#define CRC_TABLE_CRC7 crc_nibble_crc7
+#define CRC_TABLE_SMBUS crc_nibble_smbus
+#define CRC_TABLE_MAXIM crc_nibble_maxim
+#define CRC_TABLE_CCITT crc_nibble_ccitt
+#define CRC_TABLE_KERMIT crc_nibble_kermit
+#define CRC_TABLE_MODBUS crc_nibble_modbus
+#define CRC_TABLE_CAN15 crc_nibble_can15
+#define CRC_TABLE_CANFD17 crc_nibble_canfd17
+#define CRC_TABLE_CANFD21 crc_nibble_canfd21
+#define CRC_TABLE_CRC32 crc_nibble_crc32
+#define CRC_TABLE_CKSUM crc_nibble_cksum
+#endif
+
+#if !CRC_TABLES_LAZY
+#if !CRC_NIBBLE
+#define CRC_TABLE_CRC7 crc_table_crc7
+#define CRC_TABLE_SMBUS crc_table_smbus
+#define CRC_TABLE_MAXIM crc_table_maxim
+#define CRC_TABLE_CCITT crc_table_ccitt		// ccitt, xmodem
+#define CRC_TABLE_KERMIT crc_table_kermit	// kermit, mcrf4xx, x25
+#define CRC_TABLE_MODBUS crc_table_modbus
+#define CRC_TABLE_CAN15 crc_table_can15
+#define CRC_TABLE_CANFD17 crc_table_canfd17
+#define CRC_TABLE_CANFD21 crc_table_canfd21
+#if CRC_BIGTABLES
+#define CRC_TABLE_CRC32 crc_table_crc32_big
+#define CRC_TABLE_CKSUM crc_table_cksum_big	// cksum, mpeg2, bzip2
+#else
+#define CRC_TABLE_CRC32 crc_table_crc32
+#define CRC_TABLE_CKSUM crc_table_cksum
+#endif
+#endif
+#if CRC_BIGTABLES
+#define CRC_TABLE_ECMA182 crc_table_ecma182_big
+#define CRC_TABLE_XZ crc_table_xz_big
+#define CRC_TABLE_GOISO crc_table_goiso_big
+#define CRC_TABLE_NVME crc_table_nvme_big
+#else
+#define CRC_TABLE_ECMA182 crc_table_ecma182
+#define CRC_TABLE_XZ crc_table_xz
+#define CRC_TABLE_GOISO crc_table_goiso
+#define CRC_TABLE_NVME crc_table_nvme
+#endif
+
+#else
+#if defined(__AVR__)
+#error "CRC_TABLES_LAZY needs the tables in RAM, not available on AVR"
+#endif
+
+#include <stdlib.h>
+
+#define CRC_SLICES32 (CRC_BIGTABLES ? 4 : 1)
+#define CRC_SLICES64 (CRC_BIGTABLES ? 8 : 1)
+#define CRC_LAZY_TABLES 15
+
+static const void *crc_lazy[CRC_LAZY_TABLES];
+
+/** Table of a model, from the registry on the first call
+ * @param i Index in crc_lazy[]
+ * @return Table, exits if out of memory
+ */
+static inline const void *crc_table_lazy(const unsigned i, const uint8_t width, const uint64_t poly, const bool reflect, const uint8_t slices)
+{
+	const void *t = __atomic_load_n(&crc_lazy[i], __ATOMIC_ACQUIRE);
+	if (!t) {
+		t = crc_table(width, poly, reflect, slices);
+		if (!t) abort();	// no way to return an error from the CRC methods
+		__atomic_store_n(&crc_lazy[i], t, __ATOMIC_RELEASE);
+	}
+	return t;
+}
+
+#define CRC_LAZY(i, width, poly, reflect, slices) ((const uint##width##_t *)crc_table_lazy(i, width, poly, reflect, slices))
+
+// Non-reflected polynoms are aligned to the top of the register (crc7: 0x09 << 1):
+#if !CRC_NIBBLE
+#define CRC_TABLE_CRC7 CRC_LAZY(0, 8, 0x12, false, 1)
+#define CRC_TABLE_SMBUS CRC_LAZY(1, 8, 0x07, false, 1)
+#define CRC_TABLE_MAXIM CRC_LAZY(2, 8, 0x31, true, 1)
+#define CRC_TABLE_CCITT CRC_LAZY(3, 16, 0x1021, false, 4)
+#define CRC_TABLE_KERMIT CRC_LAZY(4, 16, 0x1021, true, 4)
+#define CRC_TABLE_MODBUS CRC_LAZY(5, 16, 0x8005, true, 4)
+#define CRC_TABLE_CAN15 CRC_LAZY(6, 16, 0x4599 << 1, false, 1)
+#define CRC_TABLE_CANFD17 CRC_LAZY(7, 32, 0x1685bul << 15, false, 1)
+#define CRC_TABLE_CANFD21 CRC_LAZY(8, 32, 0x102899ul << 11, false, 1)
+#define CRC_TABLE_CRC32 CRC_LAZY(9, 32, 0x04c11db7, true, CRC_SLICES32)
+#define CRC_TABLE_CKSUM CRC_LAZY(10, 32, 0x04c11db7, false, CRC_SLICES32)
+#endif
+#define CRC_TABLE_ECMA182 CRC_LAZY(11, 64, 0x42f0e1eba9ea3693ull, false, CRC_SLICES64)
+#define CRC_TABLE_XZ CRC_LAZY(12, 64, 0x42f0e1eba9ea3693ull, true, CRC_SLICES64)
+#define CRC_TABLE_GOISO CRC_LAZY(13, 64, 0x1bull, true, CRC_SLICES64)
+#define CRC_TABLE_NVME CRC_LAZY(14, 64, 0xad93d23594c93659ull, true, CRC_SLICES64)
+#endif
 
+// Kernel k of an _upd() method may be used for the kernel want:
+static inline bool crc_use(const uint8_t k, const uint8_t want)
+{
+#if CRC_CLMUL
+	if (want == CRC_KERNEL_CLMUL && !crc_clmul_cpu()) return false;
+#endif
+	return k == CRC_KERNEL_AUTO || k == want;
+}
 
 static inline
 uint32_t REV16( uint32_t value)
@@ -68,7 +198,397 @@ uint32_t REV32( uint32_t value)
 	return ((value >> 8) & 0xff00ff) | ((value & 0xff00ff) << 8);
 }
 
+static inline
+uint64_t REV64( uint64_t value)
+{
+	return ((uint64_t)REV32(value) << 32) | REV32(value >> 32);
+}
+
+// Unaligned little-endian loads:
+static inline uint32_t crc_load32(const uint8_t *data)
+{
+	uint32_t v;
+	memcpy(&v, data, 4);
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+	v = __builtin_bswap32(v);
+#endif
+	return v;
+}
+
+static inline uint64_t crc_load64(const uint8_t *data)
+{
+	uint64_t v;
+	memcpy(&v, data, 8);
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+	v = __builtin_bswap64(v);
+#endif
+	return v;
+}
+
+/** Remaining bits of a non byte-aligned message, MSB-first
+ * @param crc CRC register (not byteswapped)
+ * @param data Byte with the remaining bits, starting at bit 7
+ * @param nbits Number of bits (0..7)
+ * @param poly Polynom
+ * @param width Width of the CRC register (8, 16 or 32)
+ * @return CRC register
+ */
+static uint32_t crc_bits_msb(uint32_t crc, uint8_t data, unsigned nbits, const uint32_t poly, const unsigned width)
+{
+	const uint32_t top = (uint32_t)1 << (width - 1);
+	while (nbits--) {
+		crc ^= (uint32_t)(data & 0x80) << (width - 8);
+		data <<= 1;
+		crc = (crc & top) ? (crc << 1) ^ poly : crc << 1;
+	}
+	return crc & ((top << 1) - 1);
+}
+
+/** Remaining bits of a non byte-aligned message, LSB-first (reflected)
+ * @param crc CRC register
+ * @param data Byte with the remaining bits, starting at bit 0
+ * @param nbits Number of bits (0..7)
+ * @param poly Reflected polynom
+ * @return CRC register
+ */
+static uint32_t crc_bits_lsb(uint32_t crc, uint8_t data, unsigned nbits, const uint32_t poly)
+{
+	while (nbits--) {
+		crc ^= data & 1;
+		data >>= 1;
+		crc = (crc & 1) ? (crc >> 1) ^ poly : crc >> 1;
+	}
+	return crc;
+}
+
+
+
+/** Table driven 8-bit CRC (also used for the 7-bit CRC)
+ * @param crc CRC register
+ * @param data Pointer to Data
+ * @param len Length of Data
+ * @param table Table of the model (nibble tables with CRC_NIBBLE)
+ * @return CRC register
+ */
+#if CRC_NIBBLE
+static uint8_t crc8_update(uint8_t crc, const uint8_t *data, size_t len, const uint8_t *table)
+{
+	while (len--) {
+		const uint8_t x = crc ^ *data++;
+		crc = pgm_read_byte(&table[x & 0x0f]) ^ pgm_read_byte(&table[16 + (x >> 4)]);
+	}
+	return crc;
+}
+#else
+static uint8_t crc8_update(uint8_t crc, const uint8_t *data, size_t len, const uint8_t *table)
+{
+	if (len) do {
+		crc = pgm_read_byte(&table[crc ^ *data]);
+		data++;
+	} while (--len);
+	return crc;
+}
+#endif
+
+#if CRC_PSHUFB
+static uint8_t crc8_pshufb(uint8_t crc, const uint8_t **data, size_t *len, const crc_pshufb_t *k, const uint8_t *table)
+{
+	uint8_t res[16];
+	size_t n = crc_pshufb(crc, *data, *len, k, res);
+	*data += n;
+	*len -= n;
+	return crc8_update(0, res, 16, table);
+}
+#elif CRC_CLMUL
+static uint8_t crc8_clmul(uint8_t crc, const uint8_t **data, size_t *len, const crc_clmul_t *k, const uint8_t *table)
+{
+	uint8_t res[16];
+	size_t n = crc_clmul(crc, *data, *len, k, res);
+	*data += n;
+	*len -= n;
+	return crc8_update(0, res, 16, table);
+}
+#endif
+
+// ================= MODELS ===================
+
+static const char * const crc_model_names[CRC_MODELS] = {
+	"crc7", "smbus", "maxim",
+	"ccitt", "mcrf4xx", "kermit", "modbus", "xmodem", "x25", "can15",
+	"crc32", "cksum", "mpeg2", "bzip2", "canfd17", "canfd21",
+	"ecma182", "xz", "goiso", "nvme"
+};
+
+/** Name of a model
+ * @param model CRC_MODEL_xxx
+ * @return Name, NULL if out of range
+ */
+const char *crc_model_name(const unsigned model)
+{
+	return model < CRC_MODELS ? crc_model_names[model] : NULL;
+}
+
+// Parameters of every model, for crc_combine()
+static const struct {
+	uint8_t width;
+	bool reflect;
+	uint64_t poly, init, xorout;
+} crc_model_params[CRC_MODELS] = {
+	{ 7, false, 0x09, 0, 0 },
+	{ 8, false, 0x07, 0, 0 },
+	{ 8, true, 0x31, 0, 0 },
+	{ 16, false, 0x1021, 0xffff, 0 },
+	{ 16, true, 0x1021, 0xffff, 0 },
+	{ 16, true, 0x1021, 0, 0 },
+	{ 16, true, 0x8005, 0xffff, 0 },
+	{ 16, false, 0x1021, 0, 0 },
+	{ 16, true, 0x1021, 0xffff, 0xffff },
+	{ 15, false, 0x4599, 0, 0 },
+	{ 32, true, 0x04c11db7, 0xffffffff, 0xffffffff },
+	{ 32, false, 0x04c11db7, 0, 0xffffffff },
+	{ 32, false, 0x04c11db7, 0xffffffff, 0 },
+	{ 32, false, 0x04c11db7, 0xffffffff, 0xffffffff },
+	{ 17, false, 0x1685b, 0, 0 },
+	{ 21, false, 0x102899, 0, 0 },
+	{ 64, false, 0x42f0e1eba9ea3693ull, 0, 0 },
+	{ 64, true, 0x42f0e1eba9ea3693ull, ~0ull, ~0ull },
+	{ 64, true, 0x1bull, ~0ull, ~0ull },
+	{ 64, true, 0xad93d23594c93659ull, ~0ull, ~0ull }
+};
+
+// Lowest width bits of x in reverse order (crc_combine(), crc_table_generate())
+static uint64_t crc_reflect(uint64_t x, const unsigned width)
+{
+	uint64_t r = 0;
+	for (unsigned i = 0; i < width; i++, x >>= 1) r = (r << 1) | (x & 1);
+	return r;
+}
+
+// a * b mod poly, not reflected
+static uint64_t crc_mulmodp(const uint64_t a, const uint64_t b, const uint64_t poly, const unsigned width)
+{
+	const uint64_t top = 1ull << (width - 1);
+	const uint64_t mask = top | (top - 1);
+	uint64_t p = 0;
+	for (uint64_t m = top; m; m >>= 1) {
+		p = p & top ? ((p << 1) ^ poly) & mask : p << 1;
+		if (a & m) p ^= b;
+	}
+	return p;
+}
+
+/** CRC combine, all models
+ * CRC of the concatenation A + B from the CRCs of both parts. With the
+ * register r = crc ^ xorout (reflected back for reflected models):
+ * r(A + B) = (r(A) ^ init) * x^len2 ^ r(B), mod P. O(width * log(len2)).
+ * FastCRC32::crc32_combine() is faster for CRC32.
+ * @param model CRC_MODEL_xxx
+ * @param crc1 CRC of A
+ * @param crc2 CRC of B
+ * @param len2 Length of B, in bytes (in bits for the CAN models)
+ * @return CRC of A + B, 0 if the model is out of range
+ */
+uint64_t crc_combine(const unsigned model, const uint64_t crc1, const uint64_t crc2, uint64_t len2)
+{
+	if (model >= CRC_MODELS) return 0;
+	const bool bits = model == CRC_MODEL_CAN15 || model == CRC_MODEL_CANFD17 || model == CRC_MODEL_CANFD21;
+	const unsigned w = crc_model_params[model].width;
+	const uint64_t poly = crc_model_params[model].poly;
+	const bool reflect = crc_model_params[model].reflect;
+
+	// x^len2 (x^(8 * len2)) by squaring, all widths are 7 or more
+	uint64_t x = 1;
+	uint64_t sq = bits ? 2 : crc_mulmodp(0x10, 0x10, poly, w);
+	for (; len2; len2 >>= 1) {
+		if (len2 & 1) x = crc_mulmodp(x, sq, poly, w);
+		sq = crc_mulmodp(sq, sq, poly, w);
+	}
+
+	uint64_t r = crc1 ^ crc_model_params[model].xorout;
+	if (reflect) r = crc_reflect(r, w);
+	r = crc_mulmodp(r ^ crc_model_params[model].init, x, poly, w);
+	if (reflect) r = crc_reflect(r, w);
+	return r ^ crc2;
+}
+
+/** CRC of any model
+ * @param model CRC_MODEL_xxx
+ * @param data Pointer to Data
+ * @param len Length of Data, in bits for the CAN models
+ * @return CRC value, 0 if the model is out of range
+ */
+uint64_t crc_calc(const unsigned model, const uint8_t *data, const size_t len)
+{
+	switch (model) {
+		case CRC_MODEL_CRC7:	{ FastCRC7 c; return c.crc7(data, len); }
+		case CRC_MODEL_SMBUS:	{ FastCRC8 c; return c.smbus(data, len); }
+		case CRC_MODEL_MAXIM:	{ FastCRC8 c; return c.maxim(data, len); }
+		case CRC_MODEL_CCITT:	{ FastCRC16 c; return c.ccitt(data, len); }
+		case CRC_MODEL_MCRF4XX:	{ FastCRC16 c; return c.mcrf4xx(data, len); }
+		case CRC_MODEL_KERMIT:	{ FastCRC16 c; return c.kermit(data, len); }
+		case CRC_MODEL_MODBUS:	{ FastCRC16 c; return c.modbus(data, len); }
+		case CRC_MODEL_XMODEM:	{ FastCRC16 c; return c.xmodem(data, len); }
+		case CRC_MODEL_X25:		{ FastCRC16 c; return c.x25(data, len); }
+		case CRC_MODEL_CAN15:	{ FastCRC16 c; return c.can15(data, len); }
+		case CRC_MODEL_CRC32:	{ FastCRC32 c; return c.crc32(data, len); }
+		case CRC_MODEL_CKSUM:	{ FastCRC32 c; return c.cksum(data, len); }
+		case CRC_MODEL_MPEG2:	{ FastCRC32 c; return c.mpeg2(data, len); }
+		case CRC_MODEL_BZIP2:	{ FastCRC32 c; return c.bzip2(data, len); }
+		case CRC_MODEL_CANFD17:	{ FastCRC32 c; return c.canfd17(data, len); }
+		case CRC_MODEL_CANFD21:	{ FastCRC32 c; return c.canfd21(data, len); }
+		case CRC_MODEL_ECMA182:	{ FastCRC64 c; return c.ecma182(data, len); }
+		case CRC_MODEL_XZ:		{ FastCRC64 c; return c.xz(data, len); }
+		case CRC_MODEL_GOISO:	{ FastCRC64 c; return c.goiso(data, len); }
+		case CRC_MODEL_NVME:	{ FastCRC64 c; return c.nvme(data, len); }
+	}
+	return 0;
+}
+
+/** Memory of the table used by a model (shared tables are counted for every model)
+ * @param model CRC_MODEL_xxx
+ * @return Bytes, 0 if out of range
+ */
+size_t crc_table_bytes(const unsigned model)
+{
+	const bool big = CRC_BIGTABLES;
+
+	if (model >= CRC_MODELS) return 0;
+	if (model <= CRC_MODEL_MAXIM) return CRC_NIBBLE ? 32 : 256;
+	if (model <= CRC_MODEL_CAN15) return CRC_NIBBLE ? 64 : model == CRC_MODEL_CAN15 ? 512 : 2048;
+	if (model <= CRC_MODEL_CANFD21) return CRC_NIBBLE ? 128 : (big && model <= CRC_MODEL_BZIP2) ? 4096 : 1024;
+	return big ? 16384 : 2048;
+}
+
+/** Kernel compiled in for a model (CRC_CLMUL 2: and supported by the CPU)
+ * @param model CRC_MODEL_xxx
+ * @param k CRC_KERNEL_xxx
+ * @return true if the _upd() method of the model can use k
+ */
+bool crc_kernel_available(const unsigned model, const uint8_t k)
+{
+	const bool bits = model == CRC_MODEL_CAN15 || model == CRC_MODEL_CANFD17 || model == CRC_MODEL_CANFD21;
+	const bool crc8 = model <= CRC_MODEL_MAXIM;
+
+	if (model >= CRC_MODELS) return false;
+	switch (k) {
+	case CRC_KERNEL_AUTO:
+	case CRC_KERNEL_TABLE: return true;
+#if CRC_CLMUL
+	case CRC_KERNEL_CLMUL: return crc_clmul_cpu() && !bits && !(crc8 && CRC_PSHUFB);
+#endif
+	case CRC_KERNEL_CHORBA: return CRC_CHORBA && model == CRC_MODEL_CRC32;
+	case CRC_KERNEL_BYTE: return !bits && !crc8 && (model >= CRC_MODEL_ECMA182 || (!CRC_NIBBLE && (CRC_BIGTABLES || model < CRC_MODEL_CAN15)));
+	case CRC_KERNEL_PSHUFB: return CRC_PSHUFB && crc8;
+	default: return false;
+	}
+}
+
+// ================= TABLE REGISTRY ===================
+#if CRC_TABLES_LAZY
+// Tables generated on first use, one per (width, poly, reflect), 64-byte aligned.
+// A table with more slices serves the requests for fewer slices.
+
+#define CRC_REGISTRY_SLOTS 32
+
+typedef struct {
+	uint8_t width;
+	bool reflect;
+	uint8_t slices;
+	uint64_t poly;
+	void *table;
+} crc_registry_t;
+
+static crc_registry_t crc_registry[CRC_REGISTRY_SLOTS];
+static unsigned crc_registry_used;
+static bool crc_registry_lock;
+
+static uint64_t crc_table_entry(const void *table, const uint8_t width, const size_t i)
+{
+	switch (width) {
+	case 8: return ((const uint8_t *)table)[i];
+	case 16: return ((const uint16_t *)table)[i];
+	case 32: return ((const uint32_t *)table)[i];
+	default: return ((const uint64_t *)table)[i];
+	}
+}
+
+static void crc_table_store(void *table, const uint8_t width, const size_t i, const uint64_t v)
+{
+	switch (width) {
+	case 8: ((uint8_t *)table)[i] = v; break;
+	case 16: ((uint16_t *)table)[i] = v; break;
+	case 32: ((uint32_t *)table)[i] = v; break;
+	default: ((uint64_t *)table)[i] = v; break;
+	}
+}
+
+/** Fill a table like the ones in FastCRC_tables.h
+ * Reflected: LSB-first. Not reflected: MSB-first, entries byteswapped.
+ * Slice n is slice n - 1 advanced by one zero byte.
+ */
+static void crc_table_generate(void *table, const uint8_t width, const uint64_t poly, const bool reflect, const uint8_t slices)
+{
+	const uint64_t mask = width == 64 ? ~(uint64_t)0 : ((uint64_t)1 << width) - 1;
+	const uint64_t rpoly = crc_reflect(poly, width);
+
+	for (unsigned i = 0; i < 256; i++) {
+		uint64_t c;
+		if (reflect) {
+			c = i;
+			for (int b = 0; b < 8; b++) c = (c & 1) ? (c >> 1) ^ rpoly : c >> 1;
+		} else {
+			c = (uint64_t)i << (width - 8);
+			for (int b = 0; b < 8; b++) c = ((c >> (width - 1)) & 1) ? ((c << 1) ^ poly) & mask : (c << 1) & mask;
+			c = width == 8 ? c : width == 16 ? REV16(c) : width == 32 ? REV32(c) : REV64(c);
+		}
+		crc_table_store(table, width, i, c);
+	}
+	for (unsigned i = 256; i < slices * 256u; i++) {
+		const uint64_t p = crc_table_entry(table, width, i - 256);
+		crc_table_store(table, width, i, (p >> 8) ^ crc_table_entry(table, width, p & 0xff));
+	}
+}
 
+/** Table of a CRC, generated on the first call
+ * @param width 8, 16, 32 or 64, smaller CRCs are aligned to the top of the register
+ * @param poly Polynom (normal, not reflected form)
+ * @param reflect LSB-first table, else MSB-first with byteswapped entries
+ * @param slices Number of 256 entry tables for slice-by-n, 1..8
+ * @return 64-byte aligned table, NULL if the parameters are invalid or out of memory
+ */
+const void *crc_table(const uint8_t width, const uint64_t poly, const bool reflect, const uint8_t slices)
+{
+	const void *table = NULL;
+	unsigned i;
+
+	if ((width != 8 && width != 16 && width != 32 && width != 64) || slices < 1 || slices > 8) return NULL;
+
+	while (__atomic_test_and_set(&crc_registry_lock, __ATOMIC_ACQUIRE)) ;
+	for (i = 0; i < crc_registry_used; i++) {
+		const crc_registry_t *r = &crc_registry[i];
+		if (r->width == width && r->poly == poly && r->reflect == reflect && r->slices >= slices) {
+			table = r->table;
+			break;
+		}
+	}
+	if (!table && crc_registry_used < CRC_REGISTRY_SLOTS) {
+		const size_t size = (size_t)slices * 256 * (width / 8);
+		uint8_t *mem = (uint8_t *)malloc(size + 63);	// never freed
+		if (mem) {
+			crc_registry_t *r = &crc_registry[crc_registry_used++];
+			r->width = width;
+			r->poly = poly;
+			r->reflect = reflect;
+			r->slices = slices;
+			r->table = mem + (-(uintptr_t)mem & 63);
+			crc_table_generate(r->table, width, poly, reflect, slices);
+			table = r->table;
+		}
+	}
+	__atomic_clear(&crc_registry_lock, __ATOMIC_RELEASE);
+	return table;
+}
+#endif
 
 // ================= 7-BIT CRC ===================
 
@@ -84,11 +604,15 @@ FastCRC7::FastCRC7(){}
  */
 uint8_t FastCRC7::crc7_upd(const uint8_t *data, size_t datalen)
 {
+	CRC_PERF_SCOPE(CRC_MODEL_CRC7, datalen);
+	CRC_STATS_ADD(CRC_MODEL_CRC7, datalen);
 	uint8_t crc = seed;
-	if (datalen) do {
-		crc = pgm_read_byte(&crc_table_crc7[crc ^ *data]);
-		data++;
-	} while (--datalen);
+#if CRC_PSHUFB
+	if (datalen >= CRC_PSHUFB_MIN && crc_use(CRC_KERNEL(CRC_MODEL_CRC7), CRC_KERNEL_PSHUFB)) crc = crc8_pshufb(crc, &data, &datalen, &crc_pshufb_crc7, CRC_TABLE_CRC7);
+#elif CRC_CLMUL
+	if (datalen >= CRC_CLMUL_MIN && crc_use(CRC_KERNEL(CRC_MODEL_CRC7), CRC_KERNEL_CLMUL)) crc = crc8_clmul(crc, &data, &datalen, &crc_clmul_crc7, CRC_TABLE_CRC7);
+#endif
+	crc = crc8_update(crc, data, datalen, CRC_TABLE_CRC7);
 	seed = crc;
 	return crc >> 1;
 }
@@ -114,11 +638,15 @@ FastCRC8::FastCRC8(){}
  */
 uint8_t FastCRC8::smbus_upd(const uint8_t *data, size_t datalen)
 {
+	CRC_PERF_SCOPE(CRC_MODEL_SMBUS, datalen);
+	CRC_STATS_ADD(CRC_MODEL_SMBUS, datalen);
 	uint8_t crc = seed;
-	if (datalen) do {
-		crc = pgm_read_byte(&crc_table_smbus[crc ^ *data]);
-		data++;
-	} while (--datalen);
+#if CRC_PSHUFB
+	if (datalen >= CRC_PSHUFB_MIN && crc_use(CRC_KERNEL(CRC_MODEL_SMBUS), CRC_KERNEL_PSHUFB)) crc = crc8_pshufb(crc, &data, &datalen, &crc_pshufb_smbus, CRC_TABLE_SMBUS);
+#elif CRC_CLMUL
+	if (datalen >= CRC_CLMUL_MIN && crc_use(CRC_KERNEL(CRC_MODEL_SMBUS), CRC_KERNEL_CLMUL)) crc = crc8_clmul(crc, &data, &datalen, &crc_clmul_smbus, CRC_TABLE_SMBUS);
+#endif
+	crc = crc8_update(crc, data, datalen, CRC_TABLE_SMBUS);
 	seed = crc;
 	return crc;
 }
@@ -138,11 +666,15 @@ uint8_t FastCRC8::smbus(const uint8_t *data, const size_t datalen)
  */
 uint8_t FastCRC8::maxim_upd(const uint8_t *data, size_t datalen)
 {
+	CRC_PERF_SCOPE(CRC_MODEL_MAXIM, datalen);
+	CRC_STATS_ADD(CRC_MODEL_MAXIM, datalen);
 	uint8_t crc = seed;
-	if (datalen) do {
-		crc = pgm_read_byte(&crc_table_maxim[crc ^ *data]);
-		data++;
-	} while (--datalen);
+#if CRC_PSHUFB
+	if (datalen >= CRC_PSHUFB_MIN && crc_use(CRC_KERNEL(CRC_MODEL_MAXIM), CRC_KERNEL_PSHUFB)) crc = crc8_pshufb(crc, &data, &datalen, &crc_pshufb_maxim, CRC_TABLE_MAXIM);
+#elif CRC_CLMUL
+	if (datalen >= CRC_CLMUL_MIN && crc_use(CRC_KERNEL(CRC_MODEL_MAXIM), CRC_KERNEL_CLMUL)) crc = crc8_clmul(crc, &data, &datalen, &crc_clmul_maxim, CRC_TABLE_MAXIM);
+#endif
+	crc = crc8_update(crc, data, datalen, CRC_TABLE_MAXIM);
 	seed = crc;
 	return crc;
 }
@@ -153,6 +685,30 @@ uint8_t FastCRC8::maxim(const uint8_t *data, const size_t datalen)
   return maxim_upd(data, datalen);
 }
 
+/** SMBUS CRC over a bit-granular message
+ * @param data Pointer to Data, bits MSB-first
+ * @param nbits Length of Data in bits
+ * @return CRC value
+ */
+uint8_t FastCRC8::smbus_bits(const uint8_t *data, const size_t nbits)
+{
+	smbus(data, nbits >> 3);
+	if (nbits & 7) seed = crc_bits_msb(seed, data[nbits >> 3], nbits & 7, 0x07, 8);
+	return seed;
+}
+
+/** MAXIM CRC over a bit-granular message
+ * @param data Pointer to Data, bits LSB-first
+ * @param nbits Length of Data in bits
+ * @return CRC value
+ */
+uint8_t FastCRC8::maxim_bits(const uint8_t *data, const size_t nbits)
+{
+	maxim(data, nbits >> 3);
+	if (nbits & 7) seed = crc_bits_lsb(seed, data[nbits >> 3], nbits & 7, 0x8c);
+	return seed;
+}
+
 // ================= 16-BIT CRC ===================
 /** Constructor
  */
@@ -164,33 +720,151 @@ FastCRC16::FastCRC16(){}
 	pgm_read_word(&table[((data >> 16) & 0xff) + 0x100]) ^	\
 	pgm_read_word(&table[data >> 24]);
 
-/** CCITT
- * Alias "false CCITT"
+#if CRC_NIBBLE
+/** Nibble-table kernel for all 16-Bit CRCs (CRC_NIBBLE), two 16-entry tables
+ * @param crc CRC register
  * @param data Pointer to Data
- * @param datalen Length of Data
- * @return CRC value
+ * @param len Length of Data
+ * @param table Nibble tables of the model
+ * @return CRC register
  */
-uint16_t FastCRC16::ccitt_upd(const uint8_t *data, size_t len)
+static uint16_t crc16_update(uint16_t crc, const uint8_t *data, size_t len, const uint16_t *table)
 {
+	while (len--) {
+		const uint8_t x = (crc & 0xff) ^ *data++;
+		crc = (crc >> 8) ^ pgm_read_word(&table[x & 0x0f]) ^ pgm_read_word(&table[16 + (x >> 4)]);
+	}
+	return crc;
+}
+
+// Bytewise kernel (CRC_KERNEL_BYTE): the nibble kernel
+static inline uint16_t crc16_bytes(uint16_t crc, const uint8_t *data, size_t len, const uint16_t *table)
+{
+	return crc16_update(crc, data, len, table);
+}
+#else
+#if CRC_TINY
+/** Unrolled slice-by-4 for short buffers (up to CRC_TINY_MAX bytes)
+ * Unaligned loads, one jump into the unrolled words and one into the remaining bytes.
+ * @param crc CRC register
+ * @param data Pointer to Data
+ * @param len Length of Data, up to CRC_TINY_MAX
+ * @param table Table of the model
+ * @return CRC register
+ */
+static inline uint16_t crc16_tiny(uint16_t crc, const uint8_t *data, size_t len, const uint16_t *table)
+{
+	const uint8_t *p = data + (len & ~(size_t)3);
+	uint32_t d;
+
+	switch (len >> 2) {
+	case 16: d = crc_load32(p - 64); crc_n4(crc, d, table); // fall through
+	case 15: d = crc_load32(p - 60); crc_n4(crc, d, table); // fall through
+	case 14: d = crc_load32(p - 56); crc_n4(crc, d, table); // fall through
+	case 13: d = crc_load32(p - 52); crc_n4(crc, d, table); // fall through
+	case 12: d = crc_load32(p - 48); crc_n4(crc, d, table); // fall through
+	case 11: d = crc_load32(p - 44); crc_n4(crc, d, table); // fall through
+	case 10: d = crc_load32(p - 40); crc_n4(crc, d, table); // fall through
+	case 9: d = crc_load32(p - 36); crc_n4(crc, d, table); // fall through
+	case 8: d = crc_load32(p - 32); crc_n4(crc, d, table); // fall through
+	case 7: d = crc_load32(p - 28); crc_n4(crc, d, table); // fall through
+	case 6: d = crc_load32(p - 24); crc_n4(crc, d, table); // fall through
+	case 5: d = crc_load32(p - 20); crc_n4(crc, d, table); // fall through
+	case 4: d = crc_load32(p - 16); crc_n4(crc, d, table); // fall through
+	case 3: d = crc_load32(p - 12); crc_n4(crc, d, table); // fall through
+	case 2: d = crc_load32(p - 8); crc_n4(crc, d, table); // fall through
+	case 1: d = crc_load32(p - 4); crc_n4(crc, d, table); // fall through
+	default: break;
+	}
+
+	p = data + len;
+	switch (len & 3) {
+	case 3: crc = (crc >> 8) ^ pgm_read_word(&table[(crc & 0xff) ^ p[-3]]); // fall through
+	case 2: crc = (crc >> 8) ^ pgm_read_word(&table[(crc & 0xff) ^ p[-2]]); // fall through
+	case 1: crc = (crc >> 8) ^ pgm_read_word(&table[(crc & 0xff) ^ p[-1]]); // fall through
+	default: break;
+	}
+	return crc;
+}
+#endif
+
+/** Table driven 16-bit CRC, slice-by-4
+ * @param crc CRC register
+ * @param data Pointer to Data
+ * @param len Length of Data
+ * @param table Table of the model
+ * @return CRC register
+ */
+static uint16_t crc16_update(uint16_t crc, const uint8_t *data, size_t len, const uint16_t *table)
+{
+#if CRC_TINY
+	if (len <= CRC_TINY_MAX) return crc16_tiny(crc, data, len, table);
+#endif
 
-	uint16_t crc = seed;
 	while (((uintptr_t)data & 3) && len) {
-		crc = (crc >> 8) ^ pgm_read_word(&crc_table_ccitt[(crc & 0xff) ^ *data++]);
+		crc = (crc >> 8) ^ pgm_read_word(&table[(crc & 0xff) ^ *data++]);
 		len--;
 	}
 
 	while (len >= 16) {
 		len -= 16;
-		crc_n4(crc, ((uint32_t *)data)[0], crc_table_ccitt);
-		crc_n4(crc, ((uint32_t *)data)[1], crc_table_ccitt);
-		crc_n4(crc, ((uint32_t *)data)[2], crc_table_ccitt);
-		crc_n4(crc, ((uint32_t *)data)[3], crc_table_ccitt);
+		crc_n4(crc, ((uint32_t *)data)[0], table);
+		crc_n4(crc, ((uint32_t *)data)[1], table);
+		crc_n4(crc, ((uint32_t *)data)[2], table);
+		crc_n4(crc, ((uint32_t *)data)[3], table);
 		data += 16;
 	}
 
 	while (len--) {
-		crc = (crc >> 8) ^ pgm_read_word(&crc_table_ccitt[(crc & 0xff) ^ *data++]);
+		crc = (crc >> 8) ^ pgm_read_word(&table[(crc & 0xff) ^ *data++]);
+	}
+	return crc;
+}
+
+/** Bytewise kernel (CRC_KERNEL_BYTE), first 256 entries of the table only
+ * @param crc CRC register
+ * @param data Pointer to Data
+ * @param len Length of Data
+ * @param table Table of the model
+ * @return CRC register
+ */
+static uint16_t crc16_bytes(uint16_t crc, const uint8_t *data, size_t len, const uint16_t *table)
+{
+	while (len--) {
+		crc = (crc >> 8) ^ pgm_read_word(&table[(crc & 0xff) ^ *data++]);
 	}
+	return crc;
+}
+#endif
+
+#if CRC_CLMUL
+static uint16_t crc16_clmul(uint16_t crc, const uint8_t **data, size_t *len, const crc_clmul_t *k, const uint16_t *table)
+{
+	uint8_t res[16];
+	size_t n = crc_clmul(crc, *data, *len, k, res);
+	*data += n;
+	*len -= n;
+	return crc16_update(0, res, 16, table);
+}
+#endif
+
+/** CCITT
+ * Alias "false CCITT"
+ * @param data Pointer to Data
+ * @param datalen Length of Data
+ * @return CRC value
+ */
+uint16_t FastCRC16::ccitt_upd(const uint8_t *data, size_t len)
+{
+	CRC_PERF_SCOPE(CRC_MODEL_CCITT, len);
+	CRC_STATS_ADD(CRC_MODEL_CCITT, len);
+	const uint8_t k = CRC_KERNEL(CRC_MODEL_CCITT);
+
+	uint16_t crc = seed;
+#if CRC_CLMUL
+	if (len >= CRC_CLMUL_MIN && crc_use(k, CRC_KERNEL_CLMUL)) crc = crc16_clmul(crc, &data, &len, &crc_clmul_ccitt, CRC_TABLE_CCITT);
+#endif
+	crc = k == CRC_KERNEL_BYTE ? crc16_bytes(crc, data, len, CRC_TABLE_CCITT) : crc16_update(crc, data, len, CRC_TABLE_CCITT);
 
 	seed = crc;
 	crc = REV16(crc);
@@ -213,26 +887,15 @@ uint16_t FastCRC16::ccitt(const uint8_t *data,const size_t datalen)
 
 uint16_t FastCRC16::mcrf4xx_upd(const uint8_t *data, size_t len)
 {
+	CRC_PERF_SCOPE(CRC_MODEL_MCRF4XX, len);
+	CRC_STATS_ADD(CRC_MODEL_MCRF4XX, len);
+	const uint8_t k = CRC_KERNEL(CRC_MODEL_MCRF4XX);
 
 	uint16_t crc = seed;
-
-	while (((uintptr_t)data & 3) && len) {
-		crc = (crc >> 8) ^ pgm_read_word(&crc_table_mcrf4xx[(crc & 0xff) ^ *data++]);
-		len--;
-	}
-
-	while (len >= 16) {
-		len -= 16;
-		crc_n4(crc, ((uint32_t *)data)[0], crc_table_mcrf4xx);
-		crc_n4(crc, ((uint32_t *)data)[1], crc_table_mcrf4xx);
-		crc_n4(crc, ((uint32_t *)data)[2], crc_table_mcrf4xx);
-		crc_n4(crc, ((uint32_t *)data)[3], crc_table_mcrf4xx);
-		data += 16;
-	}
-
-	while (len--) {
-		crc = (crc >> 8) ^ pgm_read_word(&crc_table_mcrf4xx[(crc & 0xff) ^ *data++]);
-	}
+#if CRC_CLMUL
+	if (len >= CRC_CLMUL_MIN && crc_use(k, CRC_KERNEL_CLMUL)) crc = crc16_clmul(crc, &data, &len, &crc_clmul_kermit, CRC_TABLE_KERMIT);
+#endif
+	crc = k == CRC_KERNEL_BYTE ? crc16_bytes(crc, data, len, CRC_TABLE_KERMIT) : crc16_update(crc, data, len, CRC_TABLE_KERMIT);
 
 	seed = crc;
 	return crc;
@@ -253,26 +916,15 @@ uint16_t FastCRC16::mcrf4xx(const uint8_t *data,const size_t datalen)
  */
 uint16_t FastCRC16::modbus_upd(const uint8_t *data, size_t len)
 {
+	CRC_PERF_SCOPE(CRC_MODEL_MODBUS, len);
+	CRC_STATS_ADD(CRC_MODEL_MODBUS, len);
+	const uint8_t k = CRC_KERNEL(CRC_MODEL_MODBUS);
 
 	uint16_t crc = seed;
-
-	while (((uintptr_t)data & 3) && len) {
-		crc = (crc >> 8) ^ pgm_read_word(&crc_table_modbus[(crc & 0xff) ^ *data++]);
-		len--;
-	}
-
-	while (len >= 16) {
-		len -= 16;
-		crc_n4(crc, ((uint32_t *)data)[0], crc_table_modbus);
-		crc_n4(crc, ((uint32_t *)data)[1], crc_table_modbus);
-		crc_n4(crc, ((uint32_t *)data)[2], crc_table_modbus);
-		crc_n4(crc, ((uint32_t *)data)[3], crc_table_modbus);
-		data += 16;
-	}
-
-	while (len--) {
-		crc = (crc >> 8) ^ pgm_read_word(&crc_table_modbus[(crc & 0xff) ^ *data++]);
-	}
+#if CRC_CLMUL
+	if (len >= CRC_CLMUL_MIN && crc_use(k, CRC_KERNEL_CLMUL)) crc = crc16_clmul(crc, &data, &len, &crc_clmul_modbus, CRC_TABLE_MODBUS);
+#endif
+	crc = k == CRC_KERNEL_BYTE ? crc16_bytes(crc, data, len, CRC_TABLE_MODBUS) : crc16_update(crc, data, len, CRC_TABLE_MODBUS);
 
 	seed = crc;
 	return crc;
@@ -293,26 +945,15 @@ uint16_t FastCRC16::modbus(const uint8_t *data, const size_t datalen)
  */
 uint16_t FastCRC16::kermit_upd(const uint8_t *data, size_t len)
 {
+	CRC_PERF_SCOPE(CRC_MODEL_KERMIT, len);
+	CRC_STATS_ADD(CRC_MODEL_KERMIT, len);
+	const uint8_t k = CRC_KERNEL(CRC_MODEL_KERMIT);
 
 	uint16_t crc = seed;
-
-	while (((uintptr_t)data & 3) && len) {
-		crc = (crc >> 8) ^ pgm_read_word(&crc_table_kermit[(crc & 0xff) ^ *data++]);
-		len--;
-	}
-
-	while (len >= 16) {
-		len -= 16;
-		crc_n4(crc, ((uint32_t *)data)[0], crc_table_kermit);
-		crc_n4(crc, ((uint32_t *)data)[1], crc_table_kermit);
-		crc_n4(crc, ((uint32_t *)data)[2], crc_table_kermit);
-		crc_n4(crc, ((uint32_t *)data)[3], crc_table_kermit);
-		data += 16;
-	}
-
-	while (len--) {
-		crc = (crc >> 8) ^ pgm_read_word(&crc_table_kermit[(crc & 0xff) ^ *data++]);
-	}
+#if CRC_CLMUL
+	if (len >= CRC_CLMUL_MIN && crc_use(k, CRC_KERNEL_CLMUL)) crc = crc16_clmul(crc, &data, &len, &crc_clmul_kermit, CRC_TABLE_KERMIT);
+#endif
+	crc = k == CRC_KERNEL_BYTE ? crc16_bytes(crc, data, len, CRC_TABLE_KERMIT) : crc16_update(crc, data, len, CRC_TABLE_KERMIT);
 
 	seed = crc;
 	return crc;
@@ -334,26 +975,15 @@ uint16_t FastCRC16::kermit(const uint8_t *data, const size_t datalen)
  */
 uint16_t FastCRC16::xmodem_upd(const uint8_t *data, size_t len)
 {
+	CRC_PERF_SCOPE(CRC_MODEL_XMODEM, len);
+	CRC_STATS_ADD(CRC_MODEL_XMODEM, len);
+	const uint8_t k = CRC_KERNEL(CRC_MODEL_XMODEM);
 
 	uint16_t crc = seed;
-
-	while (((uintptr_t)data & 3) && len) {
-		crc = (crc >> 8) ^ pgm_read_word(&crc_table_xmodem[(crc & 0xff) ^ *data++]);
-		len--;
-	}
-
-	while (len >= 16) {
-		len -= 16;
-		crc_n4(crc, ((uint32_t *)data)[0], crc_table_xmodem);
-		crc_n4(crc, ((uint32_t *)data)[1], crc_table_xmodem);
-		crc_n4(crc, ((uint32_t *)data)[2], crc_table_xmodem);
-		crc_n4(crc, ((uint32_t *)data)[3], crc_table_xmodem);
-		data += 16;
-	}
-
-	while (len--) {
-		crc = (crc >> 8) ^ pgm_read_word(&crc_table_xmodem[(crc & 0xff) ^ *data++]);
-	}
+#if CRC_CLMUL
+	if (len >= CRC_CLMUL_MIN && crc_use(k, CRC_KERNEL_CLMUL)) crc = crc16_clmul(crc, &data, &len, &crc_clmul_ccitt, CRC_TABLE_CCITT);
+#endif
+	crc = k == CRC_KERNEL_BYTE ? crc16_bytes(crc, data, len, CRC_TABLE_CCITT) : crc16_update(crc, data, len, CRC_TABLE_CCITT);
 
 	seed = crc;
 	crc = REV16(crc);
@@ -375,26 +1005,15 @@ uint16_t FastCRC16::xmodem(const uint8_t *data, const size_t datalen)
  */
 uint16_t FastCRC16::x25_upd(const uint8_t *data, size_t len)
 {
+	CRC_PERF_SCOPE(CRC_MODEL_X25, len);
+	CRC_STATS_ADD(CRC_MODEL_X25, len);
+	const uint8_t k = CRC_KERNEL(CRC_MODEL_X25);
 
 	uint16_t crc = seed;
-
-	while (((uintptr_t)data & 3) && len) {
-		crc = (crc >> 8) ^ pgm_read_word(&crc_table_x25[(crc & 0xff) ^ *data++]);
-		len--;
-	}
-
-	while (len >= 16) {
-		len -= 16;
-		crc_n4(crc, ((uint32_t *)data)[0], crc_table_x25);
-		crc_n4(crc, ((uint32_t *)data)[1], crc_table_x25);
-		crc_n4(crc, ((uint32_t *)data)[2], crc_table_x25);
-		crc_n4(crc, ((uint32_t *)data)[3], crc_table_x25);
-		data += 16;
-	}
-
-	while (len--) {
-		crc = (crc >> 8) ^ pgm_read_word(&crc_table_x25[(crc & 0xff) ^ *data++]);
-	}
+#if CRC_CLMUL
+	if (len >= CRC_CLMUL_MIN && crc_use(k, CRC_KERNEL_CLMUL)) crc = crc16_clmul(crc, &data, &len, &crc_clmul_kermit, CRC_TABLE_KERMIT);
+#endif
+	crc = k == CRC_KERNEL_BYTE ? crc16_bytes(crc, data, len, CRC_TABLE_KERMIT) : crc16_update(crc, data, len, CRC_TABLE_KERMIT);
 
 	seed = crc;
 	crc = ~crc;
@@ -413,10 +1032,227 @@ uint16_t FastCRC16::x25(const uint8_t *data, const size_t datalen)
 
 
 
+/** CRC over a bit-granular message
+ * Whole bytes use the table, only the remaining bits are calculated bitwise.
+ * The reflected models take the bits LSB-first, the others MSB-first.
+ * @param data Pointer to Data
+ * @param nbits Length of Data in bits
+ * @return CRC value
+ */
+uint16_t FastCRC16::ccitt_bits(const uint8_t *data, const size_t nbits)
+{
+	ccitt(data, nbits >> 3);
+	if (nbits & 7) seed = REV16(crc_bits_msb(REV16(seed), data[nbits >> 3], nbits & 7, 0x1021, 16));
+	return REV16(seed);
+}
+
+uint16_t FastCRC16::mcrf4xx_bits(const uint8_t *data, const size_t nbits)
+{
+	mcrf4xx(data, nbits >> 3);
+	if (nbits & 7) seed = crc_bits_lsb(seed, data[nbits >> 3], nbits & 7, 0x8408);
+	return seed;
+}
+
+uint16_t FastCRC16::kermit_bits(const uint8_t *data, const size_t nbits)
+{
+	kermit(data, nbits >> 3);
+	if (nbits & 7) seed = crc_bits_lsb(seed, data[nbits >> 3], nbits & 7, 0x8408);
+	return seed;
+}
+
+uint16_t FastCRC16::modbus_bits(const uint8_t *data, const size_t nbits)
+{
+	modbus(data, nbits >> 3);
+	if (nbits & 7) seed = crc_bits_lsb(seed, data[nbits >> 3], nbits & 7, 0xa001);
+	return seed;
+}
+
+uint16_t FastCRC16::xmodem_bits(const uint8_t *data, const size_t nbits)
+{
+	xmodem(data, nbits >> 3);
+	if (nbits & 7) seed = REV16(crc_bits_msb(REV16(seed), data[nbits >> 3], nbits & 7, 0x1021, 16));
+	return REV16(seed);
+}
+
+uint16_t FastCRC16::x25_bits(const uint8_t *data, const size_t nbits)
+{
+	x25(data, nbits >> 3);
+	if (nbits & 7) seed = crc_bits_lsb(seed, data[nbits >> 3], nbits & 7, 0x8408);
+	return ~seed;
+}
+
+/** CAN
+ * CRC-15 of CAN 2.0 frames, over an arbitrary number of bits (MSB-first)
+ * Only the last call of can15_upd() may end within a byte.
+ * @param data Pointer to Data
+ * @param nbits Length of Data in bits
+ * @return CRC value
+ */
+uint16_t FastCRC16::can15_upd(const uint8_t *data, size_t nbits)
+{
+	CRC_PERF_SCOPE(CRC_MODEL_CAN15, (nbits + 7) >> 3);
+	CRC_STATS_ADD(CRC_MODEL_CAN15, (nbits + 7) >> 3);
+	uint16_t crc = crc16_bytes(seed, data, nbits >> 3, CRC_TABLE_CAN15);
+
+	data += nbits >> 3;
+	if (nbits & 7) crc = REV16(crc_bits_msb(REV16(crc), *data, nbits & 7, 0x4599 << 1, 16));
+
+	seed = crc;
+	return REV16(crc) >> 1;
+}
+
+uint16_t FastCRC16::can15(const uint8_t *data, const size_t nbits)
+{
+  // width=15 poly=0x4599 init=0x0000 refin=false refout=false xorout=0x0000 check=0x059e
+  seed = 0x0000;
+  return can15_upd(data, nbits);
+}
+
+/** SD/MMC wide bus
+ * CRC-16/XMODEM of each DAT line, calculated from the interleaved data.
+ * Interleaving the lanes turns their polynom P(x) into P(x^4) (or P(x^8)),
+ * x^64 + x^48 + x^20 + 1 for 4 lines, one CRC of the whole block. Its
+ * sparse polynom reduces with shifts, no table needed. Lane n ends up in
+ * the bits n, n + 4, n + 8, ... of the register.
+ * 4-bit bus: DAT3..DAT0 carry bit 7..4, then bit 3..0 of each byte
+ * 8-bit bus: DAT7..DAT0 carry bit 7..0 of each byte
+ * @param data Pointer to Data (usually 512 bytes block)
+ * @param datalen Length of Data
+ * @param crc CRC values for DAT0..DAT3 (DAT0..DAT7)
+ */
+void FastCRC16::sd4bit(const uint8_t *data, const size_t datalen, uint16_t *crc)
+{
+	uint64_t r = 0;
+	uint64_t t;
+	size_t len = datalen;
+
+	while (len >= 4) {
+		len -= 4;
+		t = (r >> 32) ^ (((uint32_t)data[0] << 24) | ((uint32_t)data[1] << 16) | ((uint32_t)data[2] << 8) | data[3]);
+		r = (r << 32) ^ (t << 48) ^ (t << 20) ^ t;
+		t >>= 16; // t * x^48 above x^63
+		r ^= (t << 48) ^ (t << 20) ^ t;
+		data += 4;
+	}
+
+	while (len--) {
+		t = (r >> 56) ^ *data++;
+		r = (r << 8) ^ (t << 48) ^ (t << 20) ^ t;
+	}
+
+	for (unsigned lane = 0; lane < 4; lane++) {
+		uint16_t c = 0;
+		for (unsigned i = 0; i < 16; i++)
+			c |= ((r >> (4 * i + lane)) & 1) << i;
+		crc[lane] = c;
+	}
+}
+
+void FastCRC16::sd8bit(const uint8_t *data, const size_t datalen, uint16_t *crc)
+{
+	// P(x^8) = x^128 + x^96 + x^40 + 1
+	uint64_t hi = 0, lo = 0;
+	uint64_t t;
+	size_t len = datalen;
+
+	while (len >= 4) {
+		len -= 4;
+		t = (hi >> 32) ^ (((uint32_t)data[0] << 24) | ((uint32_t)data[1] << 16) | ((uint32_t)data[2] << 8) | data[3]);
+		hi = (hi << 32) ^ (lo >> 32) ^ (t << 32) ^ (t >> 24);
+		lo = (lo << 32) ^ (t << 40) ^ t;
+		data += 4;
+	}
+
+	while (len--) {
+		t = (hi >> 56) ^ *data++;
+		hi = (hi << 8) ^ (lo >> 56) ^ (t << 32);
+		lo = (lo << 8) ^ (t << 40) ^ t;
+	}
+
+	for (unsigned lane = 0; lane < 8; lane++) {
+		uint16_t c = 0;
+		for (unsigned i = 0; i < 8; i++) {
+			c |= ((lo >> (8 * i + lane)) & 1) << i;
+			c |= ((hi >> (8 * i + lane)) & 1) << (i + 8);
+		}
+		crc[lane] = c;
+	}
+}
+
+/** Verifies frames with the CRC appended LSB first (Modbus RTU, HDLC)
+ * The CRC register over a valid frame including its CRC is the residue of the model,
+ * no separate compare with the trailer. The kernel is chosen once for all frames; the
+ * frames do not depend on each other, so the CPU overlaps their table lookups.
+ * @param frames Pointers to the frames
+ * @param lens Lengths of the frames, including the CRC
+ * @param n Number of frames
+ * @param ok ok[i] is set to 1 if frame i is valid, else to 0
+ * @param table Table of the model
+ * @param residue CRC register after a valid frame
+ * @param clmul Constants of the model (crc_clmul_t), NULL: no carry-less multiply
+ * @return Number of valid frames
+ */
+static size_t crc16_verify(const uint8_t *const *frames, const size_t *lens, const size_t n, uint8_t *ok, const uint16_t *table,
+	const uint16_t residue, const void *clmul)
+{
+	size_t valid = 0;
+
+	for (size_t i = 0; i < n; i++) {
+		const uint8_t *data = frames[i];
+		size_t len = lens[i];
+		uint16_t crc = 0xffff;
+#if CRC_CLMUL
+		if (clmul && len >= CRC_CLMUL_MIN) crc = crc16_clmul(crc, &data, &len, (const crc_clmul_t *)clmul, table);
+#endif
+		crc = crc16_update(crc, data, len, table);
+		ok[i] = lens[i] >= 2 && crc == residue;
+		valid += ok[i];
+	}
+	(void)clmul;
+	return valid;
+}
+
+/** MODBUS frames (RTU), batched
+ * @param frames Pointers to the frames, each ends with its CRC (low byte first)
+ * @param lens Lengths of the frames, including the CRC
+ * @param n Number of frames
+ * @param ok ok[i]: 1 if frame i is valid, else 0
+ * @return Number of valid frames
+ */
+size_t FastCRC16::modbus_verify(const uint8_t *const *frames, const size_t *lens, const size_t n, uint8_t *ok)
+{
+#if CRC_CLMUL
+	const void *clmul = crc_use(CRC_KERNEL(CRC_MODEL_MODBUS), CRC_KERNEL_CLMUL) ? &crc_clmul_modbus : NULL;
+#else
+	const void *clmul = NULL;
+#endif
+	return crc16_verify(frames, lens, n, ok, CRC_TABLE_MODBUS, 0x0000, clmul);
+}
+
+/** X25 frames (HDLC FCS), batched
+ * @param frames Pointers to the frames, each ends with its FCS (low byte first)
+ * @param lens Lengths of the frames, including the FCS
+ * @param n Number of frames
+ * @param ok ok[i]: 1 if frame i is valid, else 0
+ * @return Number of valid frames
+ */
+size_t FastCRC16::x25_verify(const uint8_t *const *frames, const size_t *lens, const size_t n, uint8_t *ok)
+{
+#if CRC_CLMUL
+	const void *clmul = crc_use(CRC_KERNEL(CRC_MODEL_X25), CRC_KERNEL_CLMUL) ? &crc_clmul_kermit : NULL;
+#else
+	const void *clmul = NULL;
+#endif
+	return crc16_verify(frames, lens, n, ok, CRC_TABLE_KERMIT, 0xf0b8, clmul);
+}
+
 // ================= 32-BIT CRC ===================
 /** Constructor
  */
-FastCRC32::FastCRC32(){}
+FastCRC32::FastCRC32()
+{
+	crc32_kernel = CRC_KERNEL_AUTO;
+}
 
 #define crc_n4d(crc, data, table) crc ^= data; \
 	crc = pgm_read_dword(&table[(crc & 0xff) + 0x300]) ^	\
@@ -430,54 +1266,257 @@ FastCRC32::FastCRC32(){}
 	crc = (crc >> 8) ^ pgm_read_dword(&table[crc & 0xff]); \
 	crc = (crc >> 8) ^ pgm_read_dword(&table[crc & 0xff]);
 
-/** CRC32
- * Alias CRC-32/ADCCP, PKZIP, Ethernet, 802.3
+#if CRC_NIBBLE
+/** Nibble-table kernel for all 32-Bit CRCs (CRC_NIBBLE), two 16-entry tables
+ * @param crc CRC register
  * @param data Pointer to Data
- * @param datalen Length of Data
- * @return CRC value
+ * @param len Length of Data
+ * @param table Nibble tables of the model
+ * @return CRC register
  */
-#if CRC_BIGTABLES
-#define CRC_TABLE_CRC32 crc_table_crc32_big
+static uint32_t crc32_update(uint32_t crc, const uint8_t *data, size_t len, const uint32_t *table)
+{
+	while (len--) {
+		const uint8_t x = (crc & 0xff) ^ *data++;
+		crc = (crc >> 8) ^ pgm_read_dword(&table[x & 0x0f]) ^ pgm_read_dword(&table[16 + (x >> 4)]);
+	}
+	return crc;
+}
+
+// Bytewise kernel (CRC_KERNEL_BYTE): the nibble kernel
+static inline uint32_t crc32_bytes(uint32_t crc, const uint8_t *data, size_t len, const uint32_t *table)
+{
+	return crc32_update(crc, data, len, table);
+}
 #else
-#define CRC_TABLE_CRC32 crc_table_crc32
+#if CRC_TINY && CRC_BIGTABLES
+/** Unrolled slice-by-4 for short buffers (up to CRC_TINY_MAX bytes)
+ * @param crc CRC register
+ * @param data Pointer to Data
+ * @param len Length of Data, up to CRC_TINY_MAX
+ * @param table Big table of the model
+ * @return CRC register
+ */
+static inline uint32_t crc32_tiny(uint32_t crc, const uint8_t *data, size_t len, const uint32_t *table)
+{
+	const uint8_t *p = data + (len & ~(size_t)3);
+
+	switch (len >> 2) {
+	case 16: crc_n4d(crc, crc_load32(p - 64), table); // fall through
+	case 15: crc_n4d(crc, crc_load32(p - 60), table); // fall through
+	case 14: crc_n4d(crc, crc_load32(p - 56), table); // fall through
+	case 13: crc_n4d(crc, crc_load32(p - 52), table); // fall through
+	case 12: crc_n4d(crc, crc_load32(p - 48), table); // fall through
+	case 11: crc_n4d(crc, crc_load32(p - 44), table); // fall through
+	case 10: crc_n4d(crc, crc_load32(p - 40), table); // fall through
+	case 9: crc_n4d(crc, crc_load32(p - 36), table); // fall through
+	case 8: crc_n4d(crc, crc_load32(p - 32), table); // fall through
+	case 7: crc_n4d(crc, crc_load32(p - 28), table); // fall through
+	case 6: crc_n4d(crc, crc_load32(p - 24), table); // fall through
+	case 5: crc_n4d(crc, crc_load32(p - 20), table); // fall through
+	case 4: crc_n4d(crc, crc_load32(p - 16), table); // fall through
+	case 3: crc_n4d(crc, crc_load32(p - 12), table); // fall through
+	case 2: crc_n4d(crc, crc_load32(p - 8), table); // fall through
+	case 1: crc_n4d(crc, crc_load32(p - 4), table); // fall through
+	default: break;
+	}
+
+	p = data + len;
+	switch (len & 3) {
+	case 3: crc = (crc >> 8) ^ pgm_read_dword(&table[(crc & 0xff) ^ p[-3]]); // fall through
+	case 2: crc = (crc >> 8) ^ pgm_read_dword(&table[(crc & 0xff) ^ p[-2]]); // fall through
+	case 1: crc = (crc >> 8) ^ pgm_read_dword(&table[(crc & 0xff) ^ p[-1]]); // fall through
+	default: break;
+	}
+	return crc;
+}
 #endif
 
-uint32_t FastCRC32::crc32_upd(const uint8_t *data, size_t len)
+/** Slicing-by-4 (or bytewise with small tables) kernel for all 32-Bit CRCs
+ * The non-reflected models (cksum, mpeg2, bzip2) use a byteswapped table,
+ * so they are processed MSB-first without reflecting the data.
+ * @param crc CRC register
+ * @param data Pointer to Data
+ * @param len Length of Data
+ * @param table Reflected or byteswapped table
+ * @return CRC register
+ */
+static uint32_t crc32_update(uint32_t crc, const uint8_t *data, size_t len, const uint32_t *table)
 {
-
-	uint32_t crc = seed;
+#if CRC_TINY && CRC_BIGTABLES
+	if (len <= CRC_TINY_MAX) return crc32_tiny(crc, data, len, table);
+#endif
 
 	while (((uintptr_t)data & 3) && len) {
-		crc = (crc >> 8) ^ pgm_read_dword(&CRC_TABLE_CRC32[(crc & 0xff) ^ *data++]);
+		crc = (crc >> 8) ^ pgm_read_dword(&table[(crc & 0xff) ^ *data++]);
 		len--;
 	}
 
 	while (len >= 16) {
 		len -= 16;
 		#if CRC_BIGTABLES
-		crc_n4d(crc, ((uint32_t *)data)[0], CRC_TABLE_CRC32);
-		crc_n4d(crc, ((uint32_t *)data)[1], CRC_TABLE_CRC32);
-		crc_n4d(crc, ((uint32_t *)data)[2], CRC_TABLE_CRC32);
-		crc_n4d(crc, ((uint32_t *)data)[3], CRC_TABLE_CRC32);
+		crc_n4d(crc, ((uint32_t *)data)[0], table);
+		crc_n4d(crc, ((uint32_t *)data)[1], table);
+		crc_n4d(crc, ((uint32_t *)data)[2], table);
+		crc_n4d(crc, ((uint32_t *)data)[3], table);
 		#else
-		crcsm_n4d(crc, ((uint32_t *)data)[0], CRC_TABLE_CRC32);
-		crcsm_n4d(crc, ((uint32_t *)data)[1], CRC_TABLE_CRC32);
-		crcsm_n4d(crc, ((uint32_t *)data)[2], CRC_TABLE_CRC32);
-		crcsm_n4d(crc, ((uint32_t *)data)[3], CRC_TABLE_CRC32);
+		crcsm_n4d(crc, ((uint32_t *)data)[0], table);
+		crcsm_n4d(crc, ((uint32_t *)data)[1], table);
+		crcsm_n4d(crc, ((uint32_t *)data)[2], table);
+		crcsm_n4d(crc, ((uint32_t *)data)[3], table);
 		#endif
 		data += 16;
 	}
 
 	while (len--) {
-		crc = (crc >> 8) ^ pgm_read_dword(&CRC_TABLE_CRC32[(crc & 0xff) ^ *data++]);
+		crc = (crc >> 8) ^ pgm_read_dword(&table[(crc & 0xff) ^ *data++]);
+	}
+
+	return crc;
+}
+
+/** Bytewise kernel (CRC_KERNEL_BYTE), first 256 entries of the table only
+ * @param crc CRC register
+ * @param data Pointer to Data
+ * @param len Length of Data
+ * @param table Table of the model
+ * @return CRC register
+ */
+static uint32_t crc32_bytes(uint32_t crc, const uint8_t *data, size_t len, const uint32_t *table)
+{
+	while (len--) {
+		crc = (crc >> 8) ^ pgm_read_dword(&table[(crc & 0xff) ^ *data++]);
+	}
+	return crc;
+}
+#endif
+
+#if CRC_CLMUL
+/** CLMUL folding for all 32-Bit CRCs, advances data and len
+ * @param crc CRC register
+ * @param data Pointer to pointer to Data
+ * @param len Pointer to Length of Data, at least CRC_CLMUL_MIN
+ * @param k Fold constants
+ * @param table Table for the residue
+ * @return CRC register
+ */
+static uint32_t crc32_clmul(uint32_t crc, const uint8_t **data, size_t *len, const crc_clmul_t *k, const uint32_t *table)
+{
+	uint8_t res[16];
+	size_t n = crc_clmul(crc, *data, *len, k, res);
+	*data += n;
+	*len -= n;
+	return crc32_update(0, res, 16, table);
+}
+#endif
+
+#if CRC_CHORBA
+//
+// Chorba: CRC32 with shifts and xors only.
+//
+// x^4018 + x^2091 + x^1837 + 1 is a multiple of the CRC32 polynom, so a bit
+// of the message can be cancelled by xoring it into the message 1927, 2181
+// and 4018 bits later. The message is cancelled 64 bit at a time until the
+// last ~4 kBit, whose CRC is the CRC of the whole message. Every word gets the
+// (already corrected) words 30, 34 and 62 words before it xored in, so only
+// the last 64 words are kept.
+//
+
+#if !defined(CRC_CHORBA_MIN)
+#define CRC_CHORBA_MIN 2048
+#endif
+#if CRC_CHORBA_MIN < 1024
+#error "CRC_CHORBA_MIN must be at least 1024"
+#endif
+
+#define CRC_CHORBA_BITS 4018
+
+// Word w shifted by s bits, taken from the ring buffer r:
+#define crc_chorba_tap(r, w, s) \
+	((r[((w) - ((s) >> 6)) & 63] << ((s) & 63)) | (r[((w) - ((s) >> 6) - 1) & 63] >> (64 - ((s) & 63))))
+
+#define crc_chorba_word(r, w) \
+	(crc_chorba_tap(r, w, 1927) ^ crc_chorba_tap(r, w, 2181) ^ crc_chorba_tap(r, w, 4018))
+
+/** Chorba kernel for CRC32
+ * @param crc CRC register
+ * @param data Pointer to Data, advanced to the end
+ * @param len Length of Data, at least CRC_CHORBA_MIN, set to 0
+ * @param table Table for the remaining bits
+ * @return CRC register
+ */
+static uint32_t crc32_chorba(uint32_t crc, const uint8_t **data, size_t *len, const uint32_t *table)
+{
+	uint64_t r[64];
+	uint8_t tail[8 * 66];
+	const uint8_t *p = *data;
+	const size_t n = (*len * 8 - CRC_CHORBA_BITS) / 64; // cancelled words
+	const size_t end = *len / 8;
+	size_t w, t;
+
+	memset(r, 0, sizeof(r));
+	r[0] = crc_load64(p) ^ crc;
+	for (w = 1; w < n; w++) {
+		r[w & 63] = crc_load64(p + w * 8) ^ crc_chorba_word(r, w);
+	}
+
+	// Corrected remaining words, cancelled words only:
+	for (t = 0; w < end; w++, t += 8) {
+		uint64_t v = crc_load64(p + w * 8) ^ crc_chorba_word(r, w);
+		r[w & 63] = 0;
+		for (int i = 0; i < 8; i++) tail[t + i] = v >> (i * 8);
+	}
+	if (*len & 7) {
+		uint64_t v = crc_chorba_word(r, w);
+		for (size_t i = 0; i < (*len & 7); i++) tail[t++] = p[w * 8 + i] ^ (uint8_t)(v >> (i * 8));
 	}
 
+	*data += *len;
+	*len = 0;
+	return crc32_update(0, tail, t, table);
+}
+#endif
+
+/** CRC32
+ * Alias CRC-32/ADCCP, PKZIP, Ethernet, 802.3
+ * @param data Pointer to Data
+ * @param datalen Length of Data
+ * @return CRC value
+ */
+uint32_t FastCRC32::crc32_upd(const uint8_t *data, size_t len)
+{
+	CRC_PERF_SCOPE(CRC_MODEL_CRC32, len);
+	CRC_STATS_ADD(CRC_MODEL_CRC32, len);
+	const uint8_t k = crc32_kernel != CRC_KERNEL_AUTO ? crc32_kernel : CRC_KERNEL(CRC_MODEL_CRC32);
+	uint32_t crc = seed;
+#if CRC_CLMUL
+	if (len >= CRC_CLMUL_MIN && crc_use(k, CRC_KERNEL_CLMUL))
+		crc = crc32_clmul(crc, &data, &len, &crc_clmul_crc32, CRC_TABLE_CRC32);
+#endif
+#if CRC_CHORBA
+	if (len >= CRC_CHORBA_MIN && crc_use(k, CRC_KERNEL_CHORBA))
+		crc = crc32_chorba(crc, &data, &len, CRC_TABLE_CRC32);
+#endif
+	crc = k == CRC_KERNEL_BYTE ? crc32_bytes(crc, data, len, CRC_TABLE_CRC32) : crc32_update(crc, data, len, CRC_TABLE_CRC32);
 	seed = crc;
 	crc = ~crc;
 
 	return crc;
 }
 
+/** Select the kernel of crc32_upd()
+ * CRC_KERNEL_AUTO uses CLMUL if compiled in, else CHORBA if compiled in, else the tables
+ * (with CRC_TUNE: the tuned kernel). Short buffers and the tail of the buffer always use the tables.
+ * @param k CRC_KERNEL_AUTO, _TABLE, _CLMUL, _CHORBA or _BYTE
+ * @return false if the kernel is not compiled in
+ */
+bool FastCRC32::kernel(const uint8_t k)
+{
+	if (!crc_kernel_available(CRC_MODEL_CRC32, k)) return false;
+	crc32_kernel = k;
+	return true;
+}
+
 uint32_t FastCRC32::crc32(const uint8_t *data, const size_t datalen)
 {
   // poly=0x04c11db7 init=0xffffffff refin=true refout=true xorout=0xffffffff check=0xcbf43926
@@ -485,57 +1524,672 @@ uint32_t FastCRC32::crc32(const uint8_t *data, const size_t datalen)
   return crc32_upd(data, datalen);
 }
 
+/** CRC32 continued from a value of crc32() or crc32_from(), like zlib's crc32(crc, data, len)
+ * @param crc CRC value of the data before, 0 for none
+ * @param data Pointer to Data
+ * @param datalen Length of Data
+ * @return CRC value
+ */
+uint32_t FastCRC32::crc32_from(const uint32_t crc, const uint8_t *data, const size_t datalen)
+{
+  seed = ~crc;
+  return crc32_upd(data, datalen);
+}
+
+/** CRC32 frames (Ethernet FCS, gzip trailer), batched
+ * The CRC register over a valid frame including its CRC (low byte first) is the residue 0xdebb20e3.
+ * The kernel is chosen once for all frames, the same as in crc32_upd().
+ * @param frames Pointers to the frames
+ * @param lens Lengths of the frames, including the CRC
+ * @param n Number of frames
+ * @param ok ok[i] is set to 1 if frame i is valid, else to 0
+ * @return Number of valid frames
+ */
+size_t FastCRC32::crc32_verify(const uint8_t *const *frames, const size_t *lens, const size_t n, uint8_t *ok)
+{
+	const uint8_t k = crc32_kernel != CRC_KERNEL_AUTO ? crc32_kernel : CRC_KERNEL(CRC_MODEL_CRC32);
+	const uint32_t *table = CRC_TABLE_CRC32;
+	size_t valid = 0;
+
+	for (size_t i = 0; i < n; i++) {
+		const uint8_t *data = frames[i];
+		size_t len = lens[i];
+		uint32_t crc = 0xffffffff;
+#if CRC_CLMUL
+		if (len >= CRC_CLMUL_MIN && crc_use(k, CRC_KERNEL_CLMUL)) crc = crc32_clmul(crc, &data, &len, &crc_clmul_crc32, table);
+#endif
+#if CRC_CHORBA
+		if (len >= CRC_CHORBA_MIN && crc_use(k, CRC_KERNEL_CHORBA)) crc = crc32_chorba(crc, &data, &len, table);
+#endif
+		crc = k == CRC_KERNEL_BYTE ? crc32_bytes(crc, data, len, table) : crc32_update(crc, data, len, table);
+		ok[i] = lens[i] >= 4 && crc == 0xdebb20e3;
+		valid += ok[i];
+	}
+	return valid;
+}
+
+// x^(2^n) mod P, reflected, for crc32_combine()
+static const uint32_t crc32_x2n[32] = {
+	0x40000000, 0x20000000, 0x08000000, 0x00800000, 0x00008000, 0xedb88320, 0xb1e6b092, 0xa06a2517,
+	0xed627dae, 0x88d14467, 0xd7bbfe6a, 0xec447f11, 0x8e7ea170, 0x6427800e, 0x4d47bae0, 0x09fe548f,
+	0x83852d0f, 0x30362f1a, 0x7b5a9cc3, 0x31fec169, 0x9fec022a, 0x6c8dedc4, 0x15d6874d, 0x5fde7a4e,
+	0xbad90e37, 0x2e4e5eef, 0x4eaba214, 0xa8a472c0, 0x429a969e, 0x148d302a, 0xc40ba6d0, 0xc4e22c3c
+};
+
+// a * b mod P, reflected (bit 31 is x^0)
+static uint32_t crc32_multmodp(uint32_t a, uint32_t b)
+{
+	uint32_t p = 0;
+	for (uint32_t m = 1u << 31; m; m >>= 1) {
+		if (a & m) {
+			p ^= b;
+			if (!(a & (m - 1))) break;
+		}
+		b = b & 1 ? (b >> 1) ^ 0xedb88320 : b >> 1;
+	}
+	return p;
+}
+
+/** CRC32 combine
+ * CRC32 of the concatenation A + B from the CRC32s of both parts: crc1 is
+ * multiplied by x^(8 * len2) mod P, with init and xorout of CRC32 nothing
+ * else is needed. O(log(len2)), no data access.
+ * @param crc1 crc32() of A
+ * @param crc2 crc32() of B
+ * @param len2 Length of B in bytes
+ * @return crc32() of A + B
+ */
+uint32_t FastCRC32::crc32_combine(const uint32_t crc1, const uint32_t crc2, uint64_t len2)
+{
+	uint32_t x = 1u << 31;	// x^0
+	for (unsigned k = 3; len2; len2 >>= 1, k++)
+		if (len2 & 1) x = crc32_multmodp(crc32_x2n[k & 31], x);
+	return crc32_multmodp(x, crc1) ^ crc2;
+}
+
 /** CKSUM
  * Alias CRC-32/POSIX
  * @param data Pointer to Data
  * @param datalen Length of Data
  * @return CRC value
  */
- #if CRC_BIGTABLES
-#define CRC_TABLE_CKSUM crc_table_cksum_big
-#else
-#define CRC_TABLE_CKSUM crc_table_cksum
-#endif
 uint32_t FastCRC32::cksum_upd(const uint8_t *data, size_t len)
 {
+	CRC_PERF_SCOPE(CRC_MODEL_CKSUM, len);
+	CRC_STATS_ADD(CRC_MODEL_CKSUM, len);
+	const uint8_t k = CRC_KERNEL(CRC_MODEL_CKSUM);
+	uint32_t crc = seed;
+#if CRC_CLMUL
+	if (len >= CRC_CLMUL_MIN && crc_use(k, CRC_KERNEL_CLMUL)) crc = crc32_clmul(crc, &data, &len, &crc_clmul_cksum, CRC_TABLE_CKSUM);
+#endif
+	crc = k == CRC_KERNEL_BYTE ? crc32_bytes(crc, data, len, CRC_TABLE_CKSUM) : crc32_update(crc, data, len, CRC_TABLE_CKSUM);
+	seed = crc;
+	crc = ~REV32(crc);
+	return crc;
+}
+
+uint32_t FastCRC32::cksum(const uint8_t *data, const size_t datalen)
+{
+  // width=32 poly=0x04c11db7 init=0x00000000 refin=false refout=false xorout=0xffffffff check=0x765e7680
+  seed = 0x00;
+  return cksum_upd(data, datalen);
+}
 
+/** POSIX cksum
+ * The cksum utility appends the length of the data to the data: as many
+ * octets as needed, least significant first (none for 0 bytes).
+ * @param length Length of the data passed to cksum() and cksum_upd()
+ * @return CRC value
+ */
+uint32_t FastCRC32::cksum_length(uint64_t length)
+{
+	uint8_t octets[8];
+	size_t n = 0;
+	for (; length; length >>= 8) octets[n++] = (uint8_t) length;
+	return cksum_upd(octets, n);
+}
+
+/** MPEG2
+ * CRC_32 of MPEG-2 transport stream sections (PSI/SI), DVB
+ * @param data Pointer to Data
+ * @param datalen Length of Data
+ * @return CRC value
+ */
+uint32_t FastCRC32::mpeg2_upd(const uint8_t *data, size_t len)
+{
+	CRC_PERF_SCOPE(CRC_MODEL_MPEG2, len);
+	CRC_STATS_ADD(CRC_MODEL_MPEG2, len);
+	const uint8_t k = CRC_KERNEL(CRC_MODEL_MPEG2);
 	uint32_t crc = seed;
+#if CRC_CLMUL
+	if (len >= CRC_CLMUL_MIN && crc_use(k, CRC_KERNEL_CLMUL)) crc = crc32_clmul(crc, &data, &len, &crc_clmul_cksum, CRC_TABLE_CKSUM);
+#endif
+	crc = k == CRC_KERNEL_BYTE ? crc32_bytes(crc, data, len, CRC_TABLE_CKSUM) : crc32_update(crc, data, len, CRC_TABLE_CKSUM);
+	seed = crc;
+	crc = REV32(crc);
+	return crc;
+}
 
-	while (((uintptr_t)data & 3) && len) {
-		crc = (crc >> 8) ^ pgm_read_dword(&CRC_TABLE_CKSUM[(crc & 0xff) ^ *data++]);
+uint32_t FastCRC32::mpeg2(const uint8_t *data, const size_t datalen)
+{
+  // width=32 poly=0x04c11db7 init=0xffffffff refin=false refout=false xorout=0x00000000 check=0x0376e6e7
+  seed = 0xffffffff;
+  return mpeg2_upd(data, datalen);
+}
+
+/** BZIP2
+ * Alias CRC-32/AAL5, CRC-32/DECT-B
+ * @param data Pointer to Data
+ * @param datalen Length of Data
+ * @return CRC value
+ */
+uint32_t FastCRC32::bzip2_upd(const uint8_t *data, size_t len)
+{
+	CRC_PERF_SCOPE(CRC_MODEL_BZIP2, len);
+	CRC_STATS_ADD(CRC_MODEL_BZIP2, len);
+	const uint8_t k = CRC_KERNEL(CRC_MODEL_BZIP2);
+	uint32_t crc = seed;
+#if CRC_CLMUL
+	if (len >= CRC_CLMUL_MIN && crc_use(k, CRC_KERNEL_CLMUL)) crc = crc32_clmul(crc, &data, &len, &crc_clmul_cksum, CRC_TABLE_CKSUM);
+#endif
+	crc = k == CRC_KERNEL_BYTE ? crc32_bytes(crc, data, len, CRC_TABLE_CKSUM) : crc32_update(crc, data, len, CRC_TABLE_CKSUM);
+	seed = crc;
+	crc = ~REV32(crc);
+	return crc;
+}
+
+uint32_t FastCRC32::bzip2(const uint8_t *data, const size_t datalen)
+{
+  // width=32 poly=0x04c11db7 init=0xffffffff refin=false refout=false xorout=0xffffffff check=0xfc891918
+  seed = 0xffffffff;
+  return bzip2_upd(data, datalen);
+}
+
+/** CRC over a bit-granular message
+ * Whole bytes use the table, only the remaining bits are calculated bitwise.
+ * The reflected models take the bits LSB-first, the others MSB-first.
+ * @param data Pointer to Data
+ * @param nbits Length of Data in bits
+ * @return CRC value
+ */
+uint32_t FastCRC32::crc32_bits(const uint8_t *data, const size_t nbits)
+{
+	crc32(data, nbits >> 3);
+	if (nbits & 7) seed = crc_bits_lsb(seed, data[nbits >> 3], nbits & 7, 0xedb88320);
+	return ~seed;
+}
+
+uint32_t FastCRC32::cksum_bits(const uint8_t *data, const size_t nbits)
+{
+	cksum(data, nbits >> 3);
+	if (nbits & 7) seed = REV32(crc_bits_msb(REV32(seed), data[nbits >> 3], nbits & 7, 0x04c11db7, 32));
+	return ~REV32(seed);
+}
+
+uint32_t FastCRC32::mpeg2_bits(const uint8_t *data, const size_t nbits)
+{
+	mpeg2(data, nbits >> 3);
+	if (nbits & 7) seed = REV32(crc_bits_msb(REV32(seed), data[nbits >> 3], nbits & 7, 0x04c11db7, 32));
+	return REV32(seed);
+}
+
+uint32_t FastCRC32::bzip2_bits(const uint8_t *data, const size_t nbits)
+{
+	bzip2(data, nbits >> 3);
+	if (nbits & 7) seed = REV32(crc_bits_msb(REV32(seed), data[nbits >> 3], nbits & 7, 0x04c11db7, 32));
+	return ~REV32(seed);
+}
+
+/** Bytewise table and remaining bits for the narrow non-reflected CRCs
+ * The CRC is left aligned in the register, the table is byteswapped.
+ * @param crc CRC register
+ * @param data Pointer to Data
+ * @param nbits Length of Data in bits
+ * @param table Byteswapped table
+ * @param poly Polynom, left aligned
+ * @return CRC register
+ */
+static uint32_t crc32_update_bits(uint32_t crc, const uint8_t *data, size_t nbits, const uint32_t *table, const uint32_t poly)
+{
+	crc = crc32_bytes(crc, data, nbits >> 3, table);
+	data += nbits >> 3;
+	if (nbits & 7) crc = REV32(crc_bits_msb(REV32(crc), *data, nbits & 7, poly, 32));
+
+	return crc;
+}
+
+/** CAN FD, 17 Bit
+ * CRC-17 of CAN FD frames up to 16 data bytes, over an arbitrary number of bits (MSB-first)
+ * Only the last call of canfd17_upd() may end within a byte.
+ * @param data Pointer to Data
+ * @param nbits Length of Data in bits
+ * @return CRC value
+ */
+uint32_t FastCRC32::canfd17_upd(const uint8_t *data, size_t nbits)
+{
+	CRC_PERF_SCOPE(CRC_MODEL_CANFD17, (nbits + 7) >> 3);
+	CRC_STATS_ADD(CRC_MODEL_CANFD17, (nbits + 7) >> 3);
+	seed = crc32_update_bits(seed, data, nbits, CRC_TABLE_CANFD17, 0x1685bUL << 15);
+	return REV32(seed) >> 15;
+}
+
+uint32_t FastCRC32::canfd17(const uint8_t *data, const size_t nbits)
+{
+  // width=17 poly=0x1685b init=0x00000 refin=false refout=false xorout=0x00000 check=0x04f03
+  seed = 0x00;
+  return canfd17_upd(data, nbits);
+}
+
+/** CAN FD, 21 Bit
+ * CRC-21 of CAN FD frames with more than 16 data bytes, over an arbitrary number of bits (MSB-first)
+ * Only the last call of canfd21_upd() may end within a byte.
+ * @param data Pointer to Data
+ * @param nbits Length of Data in bits
+ * @return CRC value
+ */
+uint32_t FastCRC32::canfd21_upd(const uint8_t *data, size_t nbits)
+{
+	CRC_PERF_SCOPE(CRC_MODEL_CANFD21, (nbits + 7) >> 3);
+	CRC_STATS_ADD(CRC_MODEL_CANFD21, (nbits + 7) >> 3);
+	seed = crc32_update_bits(seed, data, nbits, CRC_TABLE_CANFD21, 0x102899UL << 11);
+	return REV32(seed) >> 11;
+}
+
+uint32_t FastCRC32::canfd21(const uint8_t *data, const size_t nbits)
+{
+  // width=21 poly=0x102899 init=0x000000 refin=false refout=false xorout=0x000000 check=0x0ed841
+  seed = 0x00;
+  return canfd21_upd(data, nbits);
+}
+
+// MPEG-2 transport stream
+#define TS_PACKET_SIZE 188
+#define TS_SYNC_BYTE 0x47
+#define TS_PID_NULL 0x1fff
+#define TS_PSI_SLOTS 16 // PIDs with a section in progress
+
+typedef struct {
+	uint16_t pid;
+	uint16_t remaining;	// Bytes left of the section
+	uint8_t hdr[3];		// table_id, section_syntax_indicator, section_length
+	uint8_t hdrlen;
+	uint8_t cc;			// continuity_counter
+	uint8_t used;		// slot belongs to pid
+	uint8_t active;		// section in progress
+	uint32_t crc;
+} ts_psi_slot_t;
+
+/** Feed section bytes of one PID
+ * @param slot Section in progress
+ * @param data Pointer to Data
+ * @param len Length of Data
+ * @param sections Counter for checked sections
+ * @param bad Counter for sections with wrong CRC
+ * @return Number of bytes used, the rest belongs to the next section
+ */
+static size_t ts_psi_feed(ts_psi_slot_t *slot, const uint8_t *data, size_t len, size_t *sections, size_t *bad)
+{
+	size_t n = 0;
+
+	while (slot->hdrlen < 3 && n < len) {
+		slot->hdr[slot->hdrlen++] = data[n++];
+		if (slot->hdr[0] == 0xff) {	// stuffing, no more sections in this packet
+			slot->active = 0;
+			return len;
+		}
+	}
+	slot->crc = crc32_update(slot->crc, data, n, CRC_TABLE_CKSUM);
+	if (slot->hdrlen < 3) return n;
+	if (n) slot->remaining = ((slot->hdr[1] & 0x0f) << 8) | slot->hdr[2];
+
+	size_t m = len - n;
+	if (m > slot->remaining) m = slot->remaining;
+	slot->crc = crc32_update(slot->crc, data + n, m, CRC_TABLE_CKSUM);
+	slot->remaining -= m;
+	n += m;
+
+	if (!slot->remaining) {
+		// Only sections with section_syntax_indicator carry a CRC_32,
+		// the CRC over the whole section including CRC_32 is zero.
+		if (slot->hdr[1] & 0x80) {
+			(*sections)++;
+			if (slot->crc) (*bad)++;
+		}
+		slot->active = 0;
+	}
+	return n;
+}
+
+/** Validate the CRC_32 of all PSI/SI sections in a MPEG-2 transport stream
+ * Sections may span several packets, up to TS_PSI_SLOTS PIDs at the same time.
+ * PES packets, scrambled packets and incomplete sections are skipped.
+ * @param data Pointer to transport stream (188 byte packets)
+ * @param datalen Length of Data
+ * @param sections Optional, number of sections checked
+ * @return Number of sections with wrong CRC
+ */
+size_t FastCRC32::mpeg2_ts(const uint8_t *data, const size_t datalen, size_t *sections)
+{
+	ts_psi_slot_t slots[TS_PSI_SLOTS];
+	unsigned next = 0;
+	size_t checked = 0, bad = 0;
+	const uint8_t *end = data + datalen;
+
+	memset(slots, 0, sizeof(slots));
+
+	while (end - data >= TS_PACKET_SIZE) {
+		if (data[0] != TS_SYNC_BYTE) {	// lost sync
+			data++;
+			continue;
+		}
+		const uint8_t *pkt = data;
+		data += TS_PACKET_SIZE;
+
+		uint16_t pid = ((pkt[1] & 0x1f) << 8) | pkt[2];
+		uint8_t pusi = pkt[1] & 0x40;
+		uint8_t cc = pkt[3] & 0x0f;
+		if ((pkt[1] & 0x80) || (pkt[3] & 0xc0) || !(pkt[3] & 0x10) || pid == TS_PID_NULL) continue;
+
+		const uint8_t *p = pkt + 4;
+		if (pkt[3] & 0x20) p += 1 + p[0];	// adaptation field
+		if (p >= data) continue;
+
+		ts_psi_slot_t *slot = NULL;
+		for (unsigned i = 0; i < TS_PSI_SLOTS && !slot; i++)
+			if (slots[i].used && slots[i].pid == pid) slot = &slots[i];
+
+		if (slot) {
+			if (cc == slot->cc) continue;					// duplicate packet
+			if (cc != ((slot->cc + 1) & 0x0f)) slot->active = 0;	// discontinuity
+			slot->cc = cc;
+		}
+
+		if (!pusi) {
+			if (slot && slot->active) ts_psi_feed(slot, p, data - p, &checked, &bad);
+			continue;
+		}
+
+		if (data - p >= 3 && p[0] == 0x00 && p[1] == 0x00 && p[2] == 0x01) continue; // PES
+
+		const uint8_t *sec = p + 1 + p[0];	// pointer_field
+		if (sec >= data) continue;
+
+		if (!slot) {
+			for (unsigned i = 0; i < TS_PSI_SLOTS && !slot; i++)
+				if (!slots[i].used) slot = &slots[i];
+			if (!slot) {
+				slot = &slots[next];
+				next = (next + 1) % TS_PSI_SLOTS;
+			}
+			slot->pid = pid;
+			slot->cc = cc;
+			slot->used = 1;
+			slot->active = 0;
+		}
+
+		if (slot->active) {
+			ts_psi_feed(slot, p + 1, sec - (p + 1), &checked, &bad);
+			slot->active = 0;	// drop it, if it did not end before the new one
+		}
+
+		while (sec < data) {
+			slot->active = 1;
+			slot->hdrlen = 0;
+			slot->crc = 0xffffffff;
+			sec += ts_psi_feed(slot, sec, data - sec, &checked, &bad);
+			if (slot->active) break;	// continues in the next packet
+		}
+	}
+
+	if (sections) *sections = checked;
+	return bad;
+}
+
+// ================= 64-BIT CRC ===================
+/** Constructor
+ */
+FastCRC64::FastCRC64(){}
+
+#define crc_n8q(crc, data, table) crc ^= data; \
+	crc = pgm_read_qword(&table[(crc & 0xff) + 0x700]) ^	\
+	pgm_read_qword(&table[((crc >> 8) & 0xff) + 0x600]) ^	\
+	pgm_read_qword(&table[((crc >> 16) & 0xff) + 0x500]) ^	\
+	pgm_read_qword(&table[((crc >> 24) & 0xff) + 0x400]) ^	\
+	pgm_read_qword(&table[((crc >> 32) & 0xff) + 0x300]) ^	\
+	pgm_read_qword(&table[((crc >> 40) & 0xff) + 0x200]) ^	\
+	pgm_read_qword(&table[((crc >> 48) & 0xff) + 0x100]) ^	\
+	pgm_read_qword(&table[(crc >> 56) & 0xff]);
+
+#define crcsm_n8q(crc, data, table) crc ^= data; \
+	crc = (crc >> 8) ^ pgm_read_qword(&table[crc & 0xff]); \
+	crc = (crc >> 8) ^ pgm_read_qword(&table[crc & 0xff]); \
+	crc = (crc >> 8) ^ pgm_read_qword(&table[crc & 0xff]); \
+	crc = (crc >> 8) ^ pgm_read_qword(&table[crc & 0xff]); \
+	crc = (crc >> 8) ^ pgm_read_qword(&table[crc & 0xff]); \
+	crc = (crc >> 8) ^ pgm_read_qword(&table[crc & 0xff]); \
+	crc = (crc >> 8) ^ pgm_read_qword(&table[crc & 0xff]); \
+	crc = (crc >> 8) ^ pgm_read_qword(&table[crc & 0xff]);
+
+#if CRC_TINY && CRC_BIGTABLES
+/** Unrolled slice-by-8 for short buffers (up to CRC_TINY_MAX bytes)
+ * @param crc CRC register
+ * @param data Pointer to Data
+ * @param len Length of Data, up to CRC_TINY_MAX
+ * @param table Big table of the model
+ * @return CRC register
+ */
+static inline uint64_t crc64_tiny(uint64_t crc, const uint8_t *data, size_t len, const uint64_t *table)
+{
+	const uint8_t *p = data + (len & ~(size_t)7);
+
+	switch (len >> 3) {
+	case 8: crc_n8q(crc, crc_load64(p - 64), table); // fall through
+	case 7: crc_n8q(crc, crc_load64(p - 56), table); // fall through
+	case 6: crc_n8q(crc, crc_load64(p - 48), table); // fall through
+	case 5: crc_n8q(crc, crc_load64(p - 40), table); // fall through
+	case 4: crc_n8q(crc, crc_load64(p - 32), table); // fall through
+	case 3: crc_n8q(crc, crc_load64(p - 24), table); // fall through
+	case 2: crc_n8q(crc, crc_load64(p - 16), table); // fall through
+	case 1: crc_n8q(crc, crc_load64(p - 8), table); // fall through
+	default: break;
+	}
+
+	p = data + len;
+	switch (len & 7) {
+	case 7: crc = (crc >> 8) ^ pgm_read_qword(&table[(crc & 0xff) ^ p[-7]]); // fall through
+	case 6: crc = (crc >> 8) ^ pgm_read_qword(&table[(crc & 0xff) ^ p[-6]]); // fall through
+	case 5: crc = (crc >> 8) ^ pgm_read_qword(&table[(crc & 0xff) ^ p[-5]]); // fall through
+	case 4: crc = (crc >> 8) ^ pgm_read_qword(&table[(crc & 0xff) ^ p[-4]]); // fall through
+	case 3: crc = (crc >> 8) ^ pgm_read_qword(&table[(crc & 0xff) ^ p[-3]]); // fall through
+	case 2: crc = (crc >> 8) ^ pgm_read_qword(&table[(crc & 0xff) ^ p[-2]]); // fall through
+	case 1: crc = (crc >> 8) ^ pgm_read_qword(&table[(crc & 0xff) ^ p[-1]]); // fall through
+	default: break;
+	}
+	return crc;
+}
+#endif
+
+/** Slicing-by-8 (or bytewise with small tables) kernel for all 64-Bit CRCs
+ * @param crc CRC register
+ * @param data Pointer to Data
+ * @param len Length of Data
+ * @param table Reflected or byteswapped table
+ * @return CRC register
+ */
+static uint64_t crc64_update(uint64_t crc, const uint8_t *data, size_t len, const uint64_t *table)
+{
+#if CRC_TINY && CRC_BIGTABLES
+	if (len <= CRC_TINY_MAX) return crc64_tiny(crc, data, len, table);
+#endif
+
+	while (((uintptr_t)data & 7) && len) {
+		crc = (crc >> 8) ^ pgm_read_qword(&table[(crc & 0xff) ^ *data++]);
 		len--;
 	}
 
-	while (len >= 16) {
-		len -= 16;
+	while (len >= 32) {
+		len -= 32;
 		#if CRC_BIGTABLES
-		crc_n4d(crc, ((uint32_t *)data)[0], CRC_TABLE_CKSUM);
-		crc_n4d(crc, ((uint32_t *)data)[1], CRC_TABLE_CKSUM);
-		crc_n4d(crc, ((uint32_t *)data)[2], CRC_TABLE_CKSUM);
-		crc_n4d(crc, ((uint32_t *)data)[3], CRC_TABLE_CKSUM);
+		crc_n8q(crc, ((uint64_t *)data)[0], table);
+		crc_n8q(crc, ((uint64_t *)data)[1], table);
+		crc_n8q(crc, ((uint64_t *)data)[2], table);
+		crc_n8q(crc, ((uint64_t *)data)[3], table);
 		#else
-		crcsm_n4d(crc, ((uint32_t *)data)[0], CRC_TABLE_CKSUM);
-		crcsm_n4d(crc, ((uint32_t *)data)[1], CRC_TABLE_CKSUM);
-		crcsm_n4d(crc, ((uint32_t *)data)[2], CRC_TABLE_CKSUM);
-		crcsm_n4d(crc, ((uint32_t *)data)[3], CRC_TABLE_CKSUM);
+		crcsm_n8q(crc, ((uint64_t *)data)[0], table);
+		crcsm_n8q(crc, ((uint64_t *)data)[1], table);
+		crcsm_n8q(crc, ((uint64_t *)data)[2], table);
+		crcsm_n8q(crc, ((uint64_t *)data)[3], table);
 		#endif
-		data += 16;
+		data += 32;
 	}
 
 	while (len--) {
-		crc = (crc >> 8) ^ pgm_read_dword(&CRC_TABLE_CKSUM[(crc & 0xff) ^ *data++]);
+		crc = (crc >> 8) ^ pgm_read_qword(&table[(crc & 0xff) ^ *data++]);
 	}
 
-	seed = crc;
-	crc = ~REV32(crc);
 	return crc;
 }
 
-uint32_t FastCRC32::cksum(const uint8_t *data, const size_t datalen)
+/** Bytewise kernel (CRC_KERNEL_BYTE), first 256 entries of the table only
+ * @param crc CRC register
+ * @param data Pointer to Data
+ * @param len Length of Data
+ * @param table Table of the model
+ * @return CRC register
+ */
+static uint64_t crc64_bytes(uint64_t crc, const uint8_t *data, size_t len, const uint64_t *table)
 {
-  // width=32 poly=0x04c11db7 init=0x00000000 refin=false refout=false xorout=0xffffffff check=0x765e7680
+	while (len--) {
+		crc = (crc >> 8) ^ pgm_read_qword(&table[(crc & 0xff) ^ *data++]);
+	}
+	return crc;
+}
+
+#if CRC_CLMUL
+/** CLMUL folding for all 64-Bit CRCs, advances data and len
+ * @param crc CRC register
+ * @param data Pointer to pointer to Data
+ * @param len Pointer to Length of Data, at least CRC_CLMUL_MIN
+ * @param k Fold constants
+ * @param table Table for the residue
+ * @return CRC register
+ */
+static uint64_t crc64_clmul(uint64_t crc, const uint8_t **data, size_t *len, const crc_clmul_t *k, const uint64_t *table)
+{
+	uint8_t res[16];
+	size_t n = crc_clmul(crc, *data, *len, k, res);
+	*data += n;
+	*len -= n;
+	return crc64_update(0, res, 16, table);
+}
+#endif
+
+/** ECMA-182
+ * Alias CRC-64
+ * @param data Pointer to Data
+ * @param datalen Length of Data
+ * @return CRC value
+ */
+uint64_t FastCRC64::ecma182_upd(const uint8_t *data, size_t len)
+{
+	CRC_PERF_SCOPE(CRC_MODEL_ECMA182, len);
+	CRC_STATS_ADD(CRC_MODEL_ECMA182, len);
+	const uint8_t k = CRC_KERNEL(CRC_MODEL_ECMA182);
+	uint64_t crc = seed;
+#if CRC_CLMUL
+	if (len >= CRC_CLMUL_MIN && crc_use(k, CRC_KERNEL_CLMUL)) crc = crc64_clmul(crc, &data, &len, &crc_clmul_ecma182, CRC_TABLE_ECMA182);
+#endif
+	crc = k == CRC_KERNEL_BYTE ? crc64_bytes(crc, data, len, CRC_TABLE_ECMA182) : crc64_update(crc, data, len, CRC_TABLE_ECMA182);
+	seed = crc;
+	return REV64(crc);
+}
+
+uint64_t FastCRC64::ecma182(const uint8_t *data, const size_t datalen)
+{
+  // width=64 poly=0x42f0e1eba9ea3693 init=0x0000000000000000 refin=false refout=false xorout=0x0000000000000000 check=0x6c40df5f0b497347
   seed = 0x00;
-  return cksum_upd(data, datalen);
+  return ecma182_upd(data, datalen);
+}
+
+/** XZ
+ * Alias CRC-64/GO-ECMA
+ * @param data Pointer to Data
+ * @param datalen Length of Data
+ * @return CRC value
+ */
+uint64_t FastCRC64::xz_upd(const uint8_t *data, size_t len)
+{
+	CRC_PERF_SCOPE(CRC_MODEL_XZ, len);
+	CRC_STATS_ADD(CRC_MODEL_XZ, len);
+	const uint8_t k = CRC_KERNEL(CRC_MODEL_XZ);
+	uint64_t crc = seed;
+#if CRC_CLMUL
+	if (len >= CRC_CLMUL_MIN && crc_use(k, CRC_KERNEL_CLMUL)) crc = crc64_clmul(crc, &data, &len, &crc_clmul_xz, CRC_TABLE_XZ);
+#endif
+	crc = k == CRC_KERNEL_BYTE ? crc64_bytes(crc, data, len, CRC_TABLE_XZ) : crc64_update(crc, data, len, CRC_TABLE_XZ);
+	seed = crc;
+	return ~crc;
+}
+
+uint64_t FastCRC64::xz(const uint8_t *data, const size_t datalen)
+{
+  // width=64 poly=0x42f0e1eba9ea3693 init=0xffffffffffffffff refin=true refout=true xorout=0xffffffffffffffff check=0x995dc9bbdf1939fa
+  seed = 0xffffffffffffffff;
+  return xz_upd(data, datalen);
+}
+
+/** GO-ISO
+ * hash/crc64 ISO table of golang
+ * @param data Pointer to Data
+ * @param datalen Length of Data
+ * @return CRC value
+ */
+uint64_t FastCRC64::goiso_upd(const uint8_t *data, size_t len)
+{
+	CRC_PERF_SCOPE(CRC_MODEL_GOISO, len);
+	CRC_STATS_ADD(CRC_MODEL_GOISO, len);
+	const uint8_t k = CRC_KERNEL(CRC_MODEL_GOISO);
+	uint64_t crc = seed;
+#if CRC_CLMUL
+	if (len >= CRC_CLMUL_MIN && crc_use(k, CRC_KERNEL_CLMUL)) crc = crc64_clmul(crc, &data, &len, &crc_clmul_goiso, CRC_TABLE_GOISO);
+#endif
+	crc = k == CRC_KERNEL_BYTE ? crc64_bytes(crc, data, len, CRC_TABLE_GOISO) : crc64_update(crc, data, len, CRC_TABLE_GOISO);
+	seed = crc;
+	return ~crc;
+}
+
+uint64_t FastCRC64::goiso(const uint8_t *data, const size_t datalen)
+{
+  // width=64 poly=0x000000000000001b init=0xffffffffffffffff refin=true refout=true xorout=0xffffffffffffffff check=0xb90956c775a41001
+  seed = 0xffffffffffffffff;
+  return goiso_upd(data, datalen);
+}
+
+/** NVME
+ * NVM Express end-to-end data protection
+ * @param data Pointer to Data
+ * @param datalen Length of Data
+ * @return CRC value
+ */
+uint64_t FastCRC64::nvme_upd(const uint8_t *data, size_t len)
+{
+	CRC_PERF_SCOPE(CRC_MODEL_NVME, len);
+	CRC_STATS_ADD(CRC_MODEL_NVME, len);
+	const uint8_t k = CRC_KERNEL(CRC_MODEL_NVME);
+	uint64_t crc = seed;
+#if CRC_CLMUL
+	if (len >= CRC_CLMUL_MIN && crc_use(k, CRC_KERNEL_CLMUL)) crc = crc64_clmul(crc, &data, &len, &crc_clmul_nvme, CRC_TABLE_NVME);
+#endif
+	crc = k == CRC_KERNEL_BYTE ? crc64_bytes(crc, data, len, CRC_TABLE_NVME) : crc64_update(crc, data, len, CRC_TABLE_NVME);
+	seed = crc;
+	return ~crc;
+}
+
+uint64_t FastCRC64::nvme(const uint8_t *data, const size_t datalen)
+{
+  // width=64 poly=0xad93d23594c93659 init=0xffffffffffffffff refin=true refout=true xorout=0xffffffffffffffff check=0xae8b14860a799888
+  seed = 0xffffffffffffffff;
+  return nvme_upd(data, datalen);
 }
 
 #endif // #if !defined(KINETISK)
@@ -0,0 +1,130 @@
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "FastCRC.h"
+
+// POSIX cksum: same output as the cksum utility, files are checksummed in parallel
+// g++ -std=gnu++11 -O2 -DCRC_CLMUL=2 -pthread -I../src cksum.cpp ../src/FastCRCsw.cpp ../src/FastCRC_file.cpp -ofastcrc-cksum
+//
+// fastcrc-cksum [-j threads] [file...]
+// No file or "-": standard input. The lines are printed in the order of the
+// arguments, as soon as all files before are done. Files are mapped (large)
+// or read (small, pipes), see crc_file_read(); with CRC_CLMUL 2 (the CMake
+// default) the CLMUL kernel is used if the CPU has it, see FastCRC.h.
+
+typedef struct {
+  const char *name;
+  uint32_t crc;
+  uint64_t size;
+  int err;
+  bool done;
+} job_t;
+
+typedef struct {
+  FastCRC32 crc;
+  uint64_t size;
+} sum_t;
+
+static std::vector<job_t> jobs;
+static std::atomic<size_t> next_job(0);
+static std::mutex done_mutex;
+static std::condition_variable done_cond;
+
+static void chunk(void *ctx, const uint8_t *data, size_t len)
+{
+  sum_t *s = (sum_t *) ctx;
+  s->crc.cksum_upd(data, len);
+  s->size += len;
+}
+
+static void cksum(job_t *job)
+{
+  int fd = 0;
+  if (strcmp(job->name, "-")) {
+    do fd = open(job->name, O_RDONLY); while (fd < 0 && errno == EINTR);
+    if (fd < 0) {
+      job->err = errno;
+      return;
+    }
+  }
+
+  sum_t s;
+  s.crc.cksum(NULL, 0);
+  s.size = 0;
+  job->err = crc_file_read(fd, chunk, &s);
+  job->crc = s.crc.cksum_length(s.size);
+  job->size = s.size;
+  if (fd) close(fd);
+}
+
+static void worker()
+{
+  for (size_t i; (i = next_job++) < jobs.size(); ) {
+    cksum(&jobs[i]);
+    {
+      std::lock_guard<std::mutex> lock(done_mutex);
+      jobs[i].done = true;
+    }
+    done_cond.notify_one();
+  }
+}
+
+int main(int argc, char **argv)
+{
+  const char *prog = strrchr(argv[0], '/') ? strrchr(argv[0], '/') + 1 : argv[0];
+  unsigned threads = std::thread::hardware_concurrency();
+  int i = 1;
+
+  for (; i < argc && argv[i][0] == '-' && argv[i][1]; i++) {
+    if (!strcmp(argv[i], "--")) {
+      i++;
+      break;
+    }
+    if (!strncmp(argv[i], "-j", 2)) {
+      const char *n = argv[i][2] ? argv[i] + 2 : i + 1 < argc ? argv[++i] : "";
+      threads = atoi(n);
+      if (threads) continue;
+    }
+    fprintf(stderr, "usage: %s [-j threads] [file...]\n", prog);
+    return 2;
+  }
+
+  bool stdin_only = i == argc;
+  for (; i < argc; i++) jobs.push_back({argv[i], 0, 0, 0, false});
+  if (stdin_only) jobs.push_back({"-", 0, 0, 0, false});
+
+  if (threads < 1) threads = 1;
+  if (threads > jobs.size()) threads = jobs.size();
+
+  std::vector<std::thread> pool;
+  for (unsigned t = 0; t < threads; t++) pool.emplace_back(worker);
+
+  int status = 0;
+  for (size_t j = 0; j < jobs.size(); j++) {
+    {
+      std::unique_lock<std::mutex> lock(done_mutex);
+      done_cond.wait(lock, [&] { return jobs[j].done; });
+    }
+    if (jobs[j].err) {
+      fprintf(stderr, "%s: %s: %s\n", prog, jobs[j].name, strerror(jobs[j].err));
+      status = 1;
+    }
+    else if (stdin_only) printf("%u %llu\n", (unsigned) jobs[j].crc, (unsigned long long) jobs[j].size);
+    else printf("%u %llu %s\n", (unsigned) jobs[j].crc, (unsigned long long) jobs[j].size, jobs[j].name);
+  }
+
+  for (auto &t : pool) t.join();
+  if (fflush(stdout) == EOF) {
+    fprintf(stderr, "%s: write error: %s\n", prog, strerror(errno));
+    status = 1;
+  }
+  return status;
+}
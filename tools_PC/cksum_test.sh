@@ -0,0 +1,56 @@
+#!/bin/sh
+# fastcrc-cksum against the cksum utility: files, standard input and a missing file
+# cksum_test.sh ./fastcrc-cksum [cksum]
+#
+# exit: 0 same output, 1 some differ
+
+tool=${1:-./fastcrc-cksum}
+case $tool in /*) ;; *) tool=$PWD/$tool ;; esac
+ref=${2:-cksum}
+dir=$(mktemp -d) || exit 1
+trap 'rm -rf "$dir"' EXIT
+failed=0
+
+check() {	# what, expected file, output file
+  if cmp -s "$2" "$3"; then
+    echo "$1 is OK"
+  else
+    echo "$1 is NOT OK"
+    diff "$2" "$3"
+    failed=1
+  fi
+}
+
+# 0, 1, 255, 256 bytes (length octets 0, 1, 1, 2) and more than 64 KB (crc_file_read() in several chunks)
+for n in 0 1 255 256 100000; do
+  head -c $n /dev/urandom > "$dir/f$n"
+done
+cd "$dir" || exit 1
+
+for n in 0 1 255 256 100000; do
+  "$ref" f$n > ref.out
+  "$tool" f$n > tool.out
+  check "file $n" ref.out tool.out
+  "$ref" < f$n > ref.out
+  "$tool" < f$n > tool.out
+  check "stdin $n" ref.out tool.out
+done
+
+"$ref" f0 f1 f255 f256 f100000 > ref.out
+"$tool" -j 3 f0 f1 f255 f256 f100000 > tool.out
+check "files" ref.out tool.out
+
+# both fail with a message and print the other files
+"$ref" f1 missing f255 > ref.out 2> ref.err
+r=$?
+"$tool" f1 missing f255 > tool.out 2> tool.err
+t=$?
+check "missing file" ref.out tool.out
+if [ $r -ne 0 ] && [ $t -ne 0 ] && grep -q missing tool.err; then
+  echo "missing file status is OK"
+else
+  echo "missing file status is NOT OK: cksum $r, fastcrc-cksum $t"
+  failed=1
+fi
+
+exit $failed
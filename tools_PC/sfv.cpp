@@ -0,0 +1,100 @@
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <string>
+#include "FastCRC_sfv.h"
+
+// SFV manifests of directory trees, see FastCRC_sfv.cpp
+// g++ -std=gnu++11 -O2 -march=native -pthread -I../src sfv.cpp ../src/FastCRCsw.cpp ../src/FastCRC_file.cpp ../src/FastCRC_sfv.cpp -ofastcrc-sfv
+//
+// fastcrc-sfv -c manifest.sfv [dir]   create (dir: the directory of the manifest or below, default: that directory)
+// fastcrc-sfv -v manifest.sfv         verify, prints the files that are bad, missing or cannot be read
+// options: -j threads, -s part size in MB (large files), -p progress on stderr, -r report.json
+// exit: 0 all files OK, 1 some files not OK, 2 usage or manifest error
+
+// at most 10 times per second
+static void progress(void *ctx, const crc_sfv_progress_t *p)
+{
+  static double last;
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  const double now = ts.tv_sec + ts.tv_nsec * 1e-9;
+  const bool done = p->files_done == p->files;
+
+  (void) ctx;
+  if (now - last < 0.1 && !done) return;
+  last = now;
+  fprintf(stderr, "\r%zu/%zu files, %llu/%llu MB", p->files_done, p->files,
+    (unsigned long long) (p->bytes_done >> 20), (unsigned long long) (p->bytes >> 20));
+  if (done) fprintf(stderr, "\n");
+}
+
+static int usage(const char *prog)
+{
+  fprintf(stderr, "usage: %s [-j threads] [-s MB] [-p] [-r report.json] -c manifest.sfv [dir]\n"
+                  "       %s [-j threads] [-s MB] [-p] [-r report.json] -v manifest.sfv\n", prog, prog);
+  return 2;
+}
+
+int main(int argc, char **argv)
+{
+  const char *prog = strrchr(argv[0], '/') ? strrchr(argv[0], '/') + 1 : argv[0];
+  const char *json = NULL;
+  char mode = 0;
+  crc_sfv_options_t opt;
+  memset(&opt, 0, sizeof(opt));
+
+  int c;
+  while ((c = getopt(argc, argv, "cvj:s:pr:")) != -1) {
+    switch (c) {
+      case 'c':
+      case 'v': mode = c; break;
+      case 'j': opt.threads = atoi(optarg); break;
+      case 's': opt.split = strtoull(optarg, NULL, 10) << 20; break;
+      case 'p': opt.progress = progress; break;
+      case 'r': json = optarg; break;
+      default: return usage(prog);
+    }
+  }
+  if (!mode || optind >= argc || argc - optind > (mode == 'c' ? 2 : 1)) return usage(prog);
+
+  const char *manifest = argv[optind];
+  crc_sfv_report_t report;
+  int err;
+  if (mode == 'c') {
+    const char *dir = optind + 1 < argc ? argv[optind + 1] : NULL;
+    std::string def = strrchr(manifest, '/') ? std::string(manifest, strrchr(manifest, '/') - manifest + 1) : ".";
+    err = crc_sfv_create(manifest, dir ? dir : def.c_str(), &opt, &report);
+  }
+  else err = crc_sfv_verify(manifest, &opt, &report);
+  if (err) {
+    fprintf(stderr, "%s: %s: %s\n", prog, manifest, err == EXDEV ? "the directory is not below the manifest" : strerror(err));
+    crc_sfv_free(&report);
+    return 2;
+  }
+
+  for (size_t i = 0; i < report.count; i++) {
+    const crc_sfv_file_t *f = &report.files[i];
+    if (f->status == CRC_SFV_BAD) printf("%s BAD %08X, expected %08X\n", f->path, (unsigned) f->crc, (unsigned) f->expected);
+    else if (f->status == CRC_SFV_MISSING) printf("%s MISSING\n", f->path);
+    else if (f->status == CRC_SFV_ERROR) printf("%s ERROR %s\n", f->path, strerror(f->err));
+  }
+  printf("%zu files, %zu OK, %zu bad, %zu missing, %zu errors, %.1f MB in %.2f s (%.0f MB/s)\n",
+    report.count, report.ok, report.bad, report.missing, report.errors, report.bytes / 1e6, report.seconds,
+    report.seconds > 0 ? report.bytes / report.seconds / 1e6 : 0.0);
+
+  if (json) {
+    int fd = strcmp(json, "-") ? open(json, O_WRONLY | O_CREAT | O_TRUNC, 0644) : 1;
+    err = fd < 0 ? errno : crc_sfv_json(&report, fd);
+    if (err) fprintf(stderr, "%s: %s: %s\n", prog, json, strerror(err));
+    if (fd > 1) close(fd);
+  }
+
+  const int status = report.ok == report.count ? 0 : 1;
+  crc_sfv_free(&report);
+  return status;
+}
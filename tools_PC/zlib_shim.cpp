@@ -0,0 +1,50 @@
+#include <stddef.h>
+#include <sys/types.h>
+#include "FastCRC.h"
+
+// zlib's crc32(), crc32_z() and crc32_combine() on the kernels of FastCRC, to be preloaded or linked in front of -lz
+// g++ -std=gnu++11 -O2 -mpclmul -mssse3 -fPIC -shared -fvisibility=hidden -I../src zlib_shim.cpp ../src/FastCRCsw.cpp -olibfastcrc_z.so
+//
+// LD_PRELOAD=./libfastcrc_z.so gzip -t file.gz      (or: g++ ... -L. -lfastcrc_z -lz)
+//
+// The prototypes are the ones of zlib.h (not included, so the exports keep their names with Z_PREFIX builds too):
+// uLong is unsigned long, uInt unsigned int, z_size_t size_t, z_off_t long and z_off64_t off64_t (crc32_combine64(),
+// called instead of crc32_combine() by programs built with _FILE_OFFSET_BITS=64). All other functions stay with zlib.
+// Build with -DCRC_CLMUL=2 instead of -mpclmul -mssse3 for any x86 CPU (CLMUL if the CPU has it), with -march=native
+// for the machine it runs on only.
+
+#define ZSHIM_EXPORT extern "C" __attribute__((visibility("default")))
+
+static unsigned long zshim_crc32(unsigned long crc, const unsigned char *buf, size_t len)
+{
+  if (!buf) return 0;	// zlib: the initial value
+  FastCRC32 c;
+  return c.crc32_from((uint32_t) crc, buf, len);
+}
+
+static unsigned long zshim_combine(unsigned long crc1, unsigned long crc2, int64_t len2)
+{
+  if (len2 < 0) return crc1;	// zlib up to 1.2.11
+  FastCRC32 c;
+  return c.crc32_combine((uint32_t) crc1, (uint32_t) crc2, (uint64_t) len2);
+}
+
+ZSHIM_EXPORT unsigned long crc32(unsigned long crc, const unsigned char *buf, unsigned int len)
+{
+  return zshim_crc32(crc, buf, len);
+}
+
+ZSHIM_EXPORT unsigned long crc32_z(unsigned long crc, const unsigned char *buf, size_t len)
+{
+  return zshim_crc32(crc, buf, len);
+}
+
+ZSHIM_EXPORT unsigned long crc32_combine(unsigned long crc1, unsigned long crc2, long len2)
+{
+  return zshim_combine(crc1, crc2, len2);
+}
+
+ZSHIM_EXPORT unsigned long crc32_combine64(unsigned long crc1, unsigned long crc2, off64_t len2)
+{
+  return zshim_combine(crc1, crc2, len2);
+}
@@ -0,0 +1,110 @@
+#include <dlfcn.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <zlib.h>
+
+// Conformance of libfastcrc_z.so (zlib_shim.cpp) with zlib, and the speed of both
+// g++ -std=gnu++11 -O2 zlib_test.cpp -ozlib_test -lz -ldl
+// zlib_test [./libfastcrc_z.so]
+//
+// zlib is called directly, the shim through dlopen(): do not run this under LD_PRELOAD of the shim.
+// exit: 0 all results equal, 1 some differ or the shim is slower than zlib on 1 MB calls,
+//       2 the shim cannot be loaded
+
+typedef uLong (*crc32_fn)(uLong, const Bytef *, uInt);
+typedef uLong (*crc32_z_fn)(uLong, const Bytef *, z_size_t);
+typedef uLong (*combine_fn)(uLong, uLong, z_off_t);
+
+static double now()
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+int main(int argc, char **argv)
+{
+  const char *path = argc > 1 ? argv[1] : "./libfastcrc_z.so";
+  void *shim = dlopen(path, RTLD_NOW | RTLD_LOCAL);
+  crc32_fn s_crc32 = shim ? (crc32_fn) dlsym(shim, "crc32") : NULL;
+  crc32_z_fn s_crc32_z = shim ? (crc32_z_fn) dlsym(shim, "crc32_z") : NULL;
+  combine_fn s_combine = shim ? (combine_fn) dlsym(shim, "crc32_combine") : NULL;
+  combine_fn s_combine64 = shim ? (combine_fn) dlsym(shim, "crc32_combine64") : NULL;
+  if (!s_crc32 || !s_crc32_z || !s_combine || !s_combine64) {
+    fprintf(stderr, "%s: %s\n", path, dlerror());
+    return 2;
+  }
+
+  const size_t size = 1 << 20;
+  unsigned char *buf = (unsigned char *) malloc(size + 64);
+  srand(1);
+  for (size_t i = 0; i < size + 64; i++) buf[i] = rand();
+  unsigned long tests = 0, failed = 0;
+
+#define CHECK(what, a, b) do { \
+    tests++; \
+    if ((a) != (b)) { \
+      if (failed++ < 10) printf("%s: zlib %08lx, shim %08lx\n", what, (unsigned long) (a), (unsigned long) (b)); \
+    } \
+  } while (0)
+
+  // every length up to 1 KB at every alignment, then random lengths, with random start values
+  for (size_t len = 0; len <= 1024; len++) {
+    for (size_t off = 0; off < 16; off++) {
+      const uLong start = len & 1 ? (uLong) rand() : 0;
+      CHECK("crc32", crc32(start, buf + off, len), s_crc32(start, buf + off, len));
+    }
+  }
+  for (unsigned i = 0; i < 2000; i++) {
+    const size_t len = rand() % size, off = rand() % 64;
+    const uLong start = ((uLong) rand() << 16) ^ rand();
+    CHECK("crc32_z", crc32_z(start, buf + off, len), s_crc32_z(start, buf + off, len));
+  }
+  CHECK("crc32 NULL", crc32(0x12345678, Z_NULL, 10), s_crc32(0x12345678, Z_NULL, 10));
+  CHECK("crc32 upper bits", crc32(~0ul, buf, 100), s_crc32(~0ul, buf, 100));
+
+  // combine: zero, short, long and very long second parts
+  static const z_off_t lens[] = {0, 1, 2, 3, 7, 8, 100, 4096, 65535, 1 << 20, 0x7fffffffL,
+    (z_off_t) (sizeof(z_off_t) > 4 ? 0x123456789aLL : 0x12345678L)};
+  for (unsigned i = 0; i < sizeof(lens) / sizeof(lens[0]); i++) {
+    for (unsigned r = 0; r < 50; r++) {
+      const uLong c1 = ((uLong) rand() << 16) ^ rand(), c2 = ((uLong) rand() << 16) ^ rand();
+      CHECK("crc32_combine", crc32_combine(c1, c2, lens[i]), s_combine(c1, c2, lens[i]));
+      CHECK("crc32_combine64", crc32_combine64(c1, c2, lens[i]), s_combine64(c1, c2, lens[i]));
+    }
+  }
+  // and the CRC of split buffers
+  for (unsigned i = 0; i < 500; i++) {
+    const size_t len = rand() % size, cut = len ? rand() % len : 0;
+    const uLong whole = crc32(0, buf, len);
+    CHECK("split", whole, s_combine(s_crc32_z(0, buf, cut), s_crc32_z(0, buf + cut, len - cut), len - cut));
+  }
+
+  printf("%lu tests, %lu failed\n", tests, failed);
+
+  // speed, 1 MB and 64 byte calls
+  static const size_t chunks[] = {size, 64};
+  bool slow = false;
+  for (unsigned c = 0; c < 2; c++) {
+    const size_t n = chunks[c], loops = (256u << 20) / n;
+    uLong a = 0, b = 0;
+    double t = now();
+    for (size_t i = 0; i < loops; i++) a = crc32_z(a, buf, n);
+    const double tz = now() - t;
+    t = now();
+    for (size_t i = 0; i < loops; i++) b = s_crc32_z(b, buf, n);
+    const double ts = now() - t;
+    CHECK("speed", a, b);
+    printf("%7zu byte calls: zlib %6.0f MB/s, shim %6.0f MB/s\n", n, loops * n / tz / 1e6, loops * n / ts / 1e6);
+    if (n == size && ts > tz) {
+      printf("the shim is slower than zlib on %zu byte calls\n", n);
+      slow = true;
+    }
+  }
+
+  dlclose(shim);
+  free(buf);
+  return failed || slow ? 1 : 0;
+}